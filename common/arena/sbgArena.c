@@ -0,0 +1,176 @@
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+// Local headers
+#include "sbgArena.h"
+
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Returns the usable memory of a block.
+ *
+ * \param[in]	pBlock						Block.
+ * \return									Pointer on the first usable byte.
+ */
+static uint8_t *sbgArenaBlockGetData(SbgArenaBlock *pBlock)
+{
+	assert(pBlock);
+
+	return (uint8_t*)pBlock + sizeof(*pBlock);
+}
+
+/*!
+ * Try to allocate memory from a block.
+ *
+ * \param[in]	pBlock						Block.
+ * \param[in]	size						Size in bytes.
+ * \param[in]	alignment					Alignment in bytes, must be a power of two.
+ * \return									Allocated memory, NULL if the block is full.
+ */
+static void *sbgArenaBlockAlloc(SbgArenaBlock *pBlock, size_t size, size_t alignment)
+{
+	uintptr_t	 address;
+	uintptr_t	 alignedAddress;
+	size_t		 padding;
+	void		*pMemory = NULL;
+
+	assert(pBlock);
+
+	address			= (uintptr_t)(sbgArenaBlockGetData(pBlock) + pBlock->used);
+	alignedAddress	= (address + (alignment - 1)) & ~((uintptr_t)alignment - 1);
+	padding			= (size_t)(alignedAddress - address);
+
+	if ((pBlock->size - pBlock->used) >= (padding + size))
+	{
+		pBlock->used	+= padding + size;
+		pMemory			 = (void*)alignedAddress;
+	}
+
+	return pMemory;
+}
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+SBG_COMMON_LIB_API void sbgArenaConstruct(SbgArena *pArena, size_t blockSize)
+{
+	assert(pArena);
+
+	if (blockSize == 0)
+	{
+		blockSize = SBG_ARENA_DEFAULT_BLOCK_SIZE;
+	}
+
+	pArena->pFirstBlock		= NULL;
+	pArena->pCurrentBlock	= NULL;
+	pArena->blockSize		= blockSize;
+	pArena->allocatedSize	= 0;
+}
+
+SBG_COMMON_LIB_API void sbgArenaDestroy(SbgArena *pArena)
+{
+	SbgArenaBlock	*pBlock;
+
+	assert(pArena);
+
+	pBlock = pArena->pFirstBlock;
+
+	while (pBlock)
+	{
+		SbgArenaBlock	*pNextBlock;
+
+		pNextBlock = pBlock->pNext;
+		free(pBlock);
+		pBlock = pNextBlock;
+	}
+
+	pArena->pFirstBlock		= NULL;
+	pArena->pCurrentBlock	= NULL;
+	pArena->allocatedSize	= 0;
+}
+
+SBG_COMMON_LIB_API void sbgArenaReset(SbgArena *pArena)
+{
+	SbgArenaBlock	*pBlock;
+
+	assert(pArena);
+
+	for (pBlock = pArena->pFirstBlock; pBlock; pBlock = pBlock->pNext)
+	{
+		pBlock->used = 0;
+	}
+
+	pArena->pCurrentBlock = pArena->pFirstBlock;
+}
+
+SBG_COMMON_LIB_API void *sbgArenaAlloc(SbgArena *pArena, size_t size, size_t alignment)
+{
+	void			*pMemory = NULL;
+
+	assert(pArena);
+	assert((alignment != 0) && ((alignment & (alignment - 1)) == 0));
+
+	//
+	// Try the current block and then the next ones that may have been kept by a reset
+	//
+	while (pArena->pCurrentBlock)
+	{
+		pMemory = sbgArenaBlockAlloc(pArena->pCurrentBlock, size, alignment);
+
+		if (pMemory || !pArena->pCurrentBlock->pNext)
+		{
+			break;
+		}
+
+		pArena->pCurrentBlock = pArena->pCurrentBlock->pNext;
+	}
+
+	if (!pMemory)
+	{
+		SbgArenaBlock	*pBlock;
+		size_t			 blockSize;
+
+		//
+		// Allocate a new block large enough for oversized requests
+		//
+		blockSize	= sbgMax(pArena->blockSize, size + alignment);
+		pBlock		= malloc(sizeof(*pBlock) + blockSize);
+
+		if (pBlock)
+		{
+			pBlock->pNext	= NULL;
+			pBlock->size	= blockSize;
+			pBlock->used	= 0;
+
+			if (pArena->pCurrentBlock)
+			{
+				pArena->pCurrentBlock->pNext = pBlock;
+			}
+			else
+			{
+				pArena->pFirstBlock = pBlock;
+			}
+
+			pArena->pCurrentBlock	 = pBlock;
+			pArena->allocatedSize	+= sizeof(*pBlock) + blockSize;
+
+			pMemory = sbgArenaBlockAlloc(pBlock, size, alignment);
+		}
+		else
+		{
+			SBG_LOG_ERROR(SBG_MALLOC_FAILED, "unable to allocate arena block of %zu bytes", blockSize);
+		}
+	}
+
+	return pMemory;
+}
+
+SBG_COMMON_LIB_API size_t sbgArenaGetAllocatedSize(const SbgArena *pArena)
+{
+	assert(pArena);
+
+	return pArena->allocatedSize;
+}
@@ -0,0 +1,138 @@
+/*!
+ *      \file           sbgArena.h
+ *      \author         SBG Systems
+ *      \date           19 October 2026
+ *
+ *      \brief          Simple arena allocator made of large blocks released all at once.
+ *
+ *      \section CodeCopyright Copyright Notice
+ *      The MIT license
+ *
+ *      Copyright (C) 2007-2022, SBG Systems SAS. All rights reserved.
+ *
+ *      Permission is hereby granted, free of charge, to any person obtaining a copy
+ *      of this software and associated documentation files (the "Software"), to deal
+ *      in the Software without restriction, including without limitation the rights
+ *      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *      copies of the Software, and to permit persons to whom the Software is
+ *      furnished to do so, subject to the following conditions:
+ *
+ *      The above copyright notice and this permission notice shall be included in all
+ *      copies or substantial portions of the Software.
+ *
+ *      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *      SOFTWARE.
+ */
+
+#ifndef SBG_ARENA_H
+#define SBG_ARENA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Default arena block size in bytes.
+ */
+#define SBG_ARENA_DEFAULT_BLOCK_SIZE				(1024 * 1024)
+
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Arena memory block.
+ *
+ * Blocks are allocated with malloc() and chained together, the usable memory follows the block header.
+ */
+typedef struct _SbgArenaBlock
+{
+	struct _SbgArenaBlock	*pNext;						/*!< Next block or NULL if this is the last one. */
+	size_t					 size;						/*!< Usable block size in bytes. */
+	size_t					 used;						/*!< Number of bytes allocated from this block. */
+} SbgArenaBlock;
+
+/*!
+ * Arena allocator.
+ *
+ * Memory is carved out of large blocks so many small allocations only cost a pointer bump.
+ * Allocations can't be released individually, the whole arena is reset or destroyed at once.
+ */
+typedef struct _SbgArena
+{
+	SbgArenaBlock			*pFirstBlock;				/*!< First allocated block. */
+	SbgArenaBlock			*pCurrentBlock;				/*!< Block allocations are currently carved from. */
+	size_t					 blockSize;					/*!< Minimum usable size of new blocks, in bytes. */
+	size_t					 allocatedSize;				/*!< Total memory allocated by the arena, in bytes. */
+} SbgArena;
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Arena constructor.
+ *
+ * No memory is allocated until the first allocation.
+ *
+ * \param[in]	pArena						Arena.
+ * \param[in]	blockSize					Minimum block size in bytes, 0 to use SBG_ARENA_DEFAULT_BLOCK_SIZE.
+ */
+SBG_COMMON_LIB_API void sbgArenaConstruct(SbgArena *pArena, size_t blockSize);
+
+/*!
+ * Arena destructor.
+ *
+ * All memory allocated from the arena is released.
+ *
+ * \param[in]	pArena						Arena.
+ */
+SBG_COMMON_LIB_API void sbgArenaDestroy(SbgArena *pArena);
+
+/*!
+ * Reset an arena.
+ *
+ * All allocations are discarded but blocks are kept to be reused by next allocations.
+ *
+ * \param[in]	pArena						Arena.
+ */
+SBG_COMMON_LIB_API void sbgArenaReset(SbgArena *pArena);
+
+/*!
+ * Allocate memory from an arena.
+ *
+ * \param[in]	pArena						Arena.
+ * \param[in]	size						Size in bytes.
+ * \param[in]	alignment					Alignment in bytes, must be a power of two.
+ * \return									Allocated memory, NULL if a new block can't be allocated.
+ */
+SBG_COMMON_LIB_API void *sbgArenaAlloc(SbgArena *pArena, size_t size, size_t alignment);
+
+/*!
+ * Returns the total memory allocated by an arena.
+ *
+ * \param[in]	pArena						Arena.
+ * \return									Allocated memory including block overhead, in bytes.
+ */
+SBG_COMMON_LIB_API size_t sbgArenaGetAllocatedSize(const SbgArena *pArena);
+
+//----------------------------------------------------------------------//
+//- Footer (close extern C block)                                      -//
+//----------------------------------------------------------------------//
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_ARENA_H
@@ -0,0 +1,332 @@
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+// Local headers
+#include "sbgFileMap.h"
+
+//----------------------------------------------------------------------//
+//- Include specific header for WIN32 and UNIX platforms               -//
+//----------------------------------------------------------------------//
+#ifdef WIN32
+	#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+	#define SBG_FILE_MAP_USE_MMAP
+#endif
+
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Load a whole file in an allocated buffer.
+ *
+ * Used on platforms without memory mapping support or if the mapping has failed.
+ *
+ * \param[out]	pFileMap					File map.
+ * \param[in]	pPath						File path.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgFileMapLoad(SbgFileMap *pFileMap, const char *pPath)
+{
+	SbgErrorCode	 errorCode = SBG_NO_ERROR;
+	FILE			*pFile;
+	long			 fileSize;
+	uint8_t			*pBuffer;
+
+	assert(pFileMap);
+	assert(pPath);
+
+	pFile = fopen(pPath, "rb");
+
+	if (pFile)
+	{
+		fseek(pFile, 0, SEEK_END);
+		fileSize = ftell(pFile);
+		fseek(pFile, 0, SEEK_SET);
+
+		if (fileSize > 0)
+		{
+			pBuffer = malloc((size_t)fileSize);
+
+			if (pBuffer)
+			{
+				if (fread(pBuffer, 1, (size_t)fileSize, pFile) == (size_t)fileSize)
+				{
+					pFileMap->pBuffer	= pBuffer;
+					pFileMap->size		= (size_t)fileSize;
+				}
+				else
+				{
+					errorCode = SBG_READ_ERROR;
+					SBG_LOG_ERROR(errorCode, "unable to read file %s", pPath);
+					free(pBuffer);
+				}
+			}
+			else
+			{
+				errorCode = SBG_MALLOC_FAILED;
+				SBG_LOG_ERROR(errorCode, "unable to allocate %ld bytes", fileSize);
+			}
+		}
+		else if (fileSize < 0)
+		{
+			errorCode = SBG_READ_ERROR;
+			SBG_LOG_ERROR(errorCode, "unable to get the size of file %s", pPath);
+		}
+
+		fclose(pFile);
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+		SBG_LOG_ERROR(errorCode, "unable to open file %s", pPath);
+	}
+
+	return errorCode;
+}
+
+#ifdef SBG_FILE_MAP_USE_MMAP
+/*!
+ * Map a whole file using mmap.
+ *
+ * \param[out]	pFileMap					File map.
+ * \param[in]	pPath						File path.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgFileMapMap(SbgFileMap *pFileMap, const char *pPath)
+{
+	SbgErrorCode	 errorCode = SBG_NO_ERROR;
+	int				 fd;
+	struct stat		 fileStat;
+	void			*pBuffer;
+
+	assert(pFileMap);
+	assert(pPath);
+
+	fd = open(pPath, O_RDONLY);
+
+	if (fd >= 0)
+	{
+		if (fstat(fd, &fileStat) == 0)
+		{
+			if (fileStat.st_size > 0)
+			{
+				pBuffer = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+
+				if (pBuffer != MAP_FAILED)
+				{
+					pFileMap->pBuffer	= pBuffer;
+					pFileMap->size		= (size_t)fileStat.st_size;
+					pFileMap->mapped	= true;
+				}
+				else
+				{
+					errorCode = SBG_ERROR;
+				}
+			}
+		}
+		else
+		{
+			errorCode = SBG_READ_ERROR;
+		}
+
+		//
+		// The mapping remains valid once the file descriptor is closed
+		//
+		close(fd);
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+	}
+
+	return errorCode;
+}
+#elif defined(WIN32)
+/*!
+ * Map a whole file using a Windows file mapping.
+ *
+ * \param[out]	pFileMap					File map.
+ * \param[in]	pPath						File path.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgFileMapMap(SbgFileMap *pFileMap, const char *pPath)
+{
+	SbgErrorCode	 errorCode = SBG_NO_ERROR;
+	HANDLE			 hFile;
+	HANDLE			 hMapping;
+	LARGE_INTEGER	 fileSize;
+	void			*pBuffer;
+
+	assert(pFileMap);
+	assert(pPath);
+
+	hFile = CreateFileA(pPath, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+	if (hFile != INVALID_HANDLE_VALUE)
+	{
+		if (GetFileSizeEx(hFile, &fileSize) && ((uint64_t)fileSize.QuadPart <= SIZE_MAX))
+		{
+			if (fileSize.QuadPart > 0)
+			{
+				hMapping = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+
+				if (hMapping)
+				{
+					pBuffer = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+
+					if (pBuffer)
+					{
+						pFileMap->pBuffer			= pBuffer;
+						pFileMap->size				= (size_t)fileSize.QuadPart;
+						pFileMap->mapped			= true;
+						pFileMap->pFileHandle		= hFile;
+						pFileMap->pMappingHandle	= hMapping;
+					}
+					else
+					{
+						errorCode = SBG_ERROR;
+						CloseHandle(hMapping);
+					}
+				}
+				else
+				{
+					errorCode = SBG_ERROR;
+				}
+			}
+		}
+		else
+		{
+			errorCode = SBG_READ_ERROR;
+		}
+
+		if (!pFileMap->mapped)
+		{
+			CloseHandle(hFile);
+		}
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+	}
+
+	return errorCode;
+}
+#endif
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+SBG_COMMON_LIB_API SbgErrorCode sbgFileMapOpen(SbgFileMap *pFileMap, const char *pPath)
+{
+	SbgErrorCode	errorCode;
+
+	assert(pFileMap);
+	assert(pPath);
+
+	memset(pFileMap, 0, sizeof(*pFileMap));
+
+#if defined(SBG_FILE_MAP_USE_MMAP) || defined(WIN32)
+	errorCode = sbgFileMapMap(pFileMap, pPath);
+
+	if (errorCode == SBG_ERROR)
+	{
+		//
+		// The file exists but can't be mapped, load it instead
+		//
+		SBG_LOG_WARNING(errorCode, "unable to map file %s, loading it in memory", pPath);
+		errorCode = sbgFileMapLoad(pFileMap, pPath);
+	}
+	else if (errorCode != SBG_NO_ERROR)
+	{
+		SBG_LOG_ERROR(errorCode, "unable to open file %s", pPath);
+	}
+#else
+	errorCode = sbgFileMapLoad(pFileMap, pPath);
+#endif
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API void sbgFileMapClose(SbgFileMap *pFileMap)
+{
+	assert(pFileMap);
+
+	if (pFileMap->mapped)
+	{
+#ifdef SBG_FILE_MAP_USE_MMAP
+		munmap((void*)pFileMap->pBuffer, pFileMap->size);
+#elif defined(WIN32)
+		UnmapViewOfFile(pFileMap->pBuffer);
+		CloseHandle(pFileMap->pMappingHandle);
+		CloseHandle(pFileMap->pFileHandle);
+#endif
+	}
+	else
+	{
+		free((void*)pFileMap->pBuffer);
+	}
+
+	memset(pFileMap, 0, sizeof(*pFileMap));
+}
+
+SBG_COMMON_LIB_API void sbgFileMapSetAccess(const SbgFileMap *pFileMap, SbgFileMapAccess access)
+{
+	assert(pFileMap);
+
+#ifdef SBG_FILE_MAP_USE_MMAP
+	if (pFileMap->mapped)
+	{
+		int		advice;
+
+		switch (access)
+		{
+		case SBG_FILE_MAP_ACCESS_SEQUENTIAL:
+			advice = MADV_SEQUENTIAL;
+			break;
+		case SBG_FILE_MAP_ACCESS_RANDOM:
+			advice = MADV_RANDOM;
+			break;
+		default:
+			advice = MADV_NORMAL;
+		}
+
+		if (madvise((void*)pFileMap->pBuffer, pFileMap->size, advice) != 0)
+		{
+			SBG_LOG_WARNING(SBG_ERROR, "unable to set file map access pattern");
+		}
+	}
+#else
+	SBG_UNUSED_PARAMETER(access);
+#endif
+}
+
+SBG_COMMON_LIB_API void sbgFileMapPrefetch(const SbgFileMap *pFileMap, size_t offset, size_t size)
+{
+	assert(pFileMap);
+
+#ifdef SBG_FILE_MAP_USE_MMAP
+	if (pFileMap->mapped && (offset < pFileMap->size))
+	{
+		size_t		pageSize;
+		size_t		alignedOffset;
+
+		//
+		// The range start must be aligned on a page, the mapping itself always is
+		//
+		pageSize		= (size_t)sysconf(_SC_PAGESIZE);
+		alignedOffset	= offset - (offset % pageSize);
+		size			= sbgMin(size, pFileMap->size - offset) + (offset - alignedOffset);
+
+		madvise((void*)&pFileMap->pBuffer[alignedOffset], size, MADV_WILLNEED);
+	}
+#else
+	SBG_UNUSED_PARAMETER(offset);
+	SBG_UNUSED_PARAMETER(size);
+#endif
+}
@@ -0,0 +1,144 @@
+/*!
+ *      \file           sbgFileMap.h
+ *      \author         SBG Systems
+ *      \date           19 October 2026
+ *
+ *      \brief          Read only access to a whole file, memory mapped when the platform supports it.
+ *
+ *      \section CodeCopyright Copyright Notice
+ *      The MIT license
+ *
+ *      Copyright (C) 2007-2022, SBG Systems SAS. All rights reserved.
+ *
+ *      Permission is hereby granted, free of charge, to any person obtaining a copy
+ *      of this software and associated documentation files (the "Software"), to deal
+ *      in the Software without restriction, including without limitation the rights
+ *      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *      copies of the Software, and to permit persons to whom the Software is
+ *      furnished to do so, subject to the following conditions:
+ *
+ *      The above copyright notice and this permission notice shall be included in all
+ *      copies or substantial portions of the Software.
+ *
+ *      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *      SOFTWARE.
+ */
+
+#ifndef SBG_FILE_MAP_H
+#define SBG_FILE_MAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Expected access pattern of a file map, used to tune the operating system read ahead.
+ */
+typedef enum _SbgFileMapAccess
+{
+	SBG_FILE_MAP_ACCESS_NORMAL,								/*!< No specific access pattern. */
+	SBG_FILE_MAP_ACCESS_SEQUENTIAL,							/*!< The file is read sequentially, aggressive read ahead. */
+	SBG_FILE_MAP_ACCESS_RANDOM								/*!< The file is read at random offsets, no read ahead. */
+} SbgFileMapAccess;
+
+/*!
+ * Read only file mapping.
+ *
+ * The file is memory mapped on POSIX and Windows platforms. On other platforms,
+ * or if the mapping fails, the file is loaded in an allocated buffer instead.
+ */
+typedef struct _SbgFileMap
+{
+	const uint8_t			*pBuffer;					/*!< File content, NULL if the file is empty. */
+	size_t					 size;						/*!< File size in bytes. */
+	bool					 mapped;					/*!< True if the buffer is memory mapped, false if it has been allocated. */
+	void					*pFileHandle;				/*!< Platform specific file handle. */
+	void					*pMappingHandle;			/*!< Platform specific mapping handle. */
+} SbgFileMap;
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Map a whole file for read only access.
+ *
+ * \param[out]	pFileMap					File map.
+ * \param[in]	pPath						File path.
+ * \return									SBG_NO_ERROR if successful.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgFileMapOpen(SbgFileMap *pFileMap, const char *pPath);
+
+/*!
+ * Unmap a file.
+ *
+ * \param[in]	pFileMap					File map.
+ */
+SBG_COMMON_LIB_API void sbgFileMapClose(SbgFileMap *pFileMap);
+
+/*!
+ * Set the expected access pattern of a file map.
+ *
+ * This is only a hint, it has no effect if the file isn't memory mapped or if the platform
+ * doesn't support it.
+ *
+ * \param[in]	pFileMap					File map.
+ * \param[in]	access						Expected access pattern.
+ */
+SBG_COMMON_LIB_API void sbgFileMapSetAccess(const SbgFileMap *pFileMap, SbgFileMapAccess access);
+
+/*!
+ * Ask the operating system to load a range of a file map ahead of its use.
+ *
+ * This is only a hint, it returns immediately and has no effect if the file isn't memory
+ * mapped or if the platform doesn't support it.
+ *
+ * \param[in]	pFileMap					File map.
+ * \param[in]	offset						Range offset in bytes.
+ * \param[in]	size						Range size in bytes, clamped to the end of the file.
+ */
+SBG_COMMON_LIB_API void sbgFileMapPrefetch(const SbgFileMap *pFileMap, size_t offset, size_t size);
+
+/*!
+ * Returns the file content.
+ *
+ * \param[in]	pFileMap					File map.
+ * \return									File content, NULL if the file is empty.
+ */
+SBG_INLINE const uint8_t *sbgFileMapGetBuffer(const SbgFileMap *pFileMap)
+{
+	assert(pFileMap);
+
+	return pFileMap->pBuffer;
+}
+
+/*!
+ * Returns the file size.
+ *
+ * \param[in]	pFileMap					File map.
+ * \return									File size in bytes.
+ */
+SBG_INLINE size_t sbgFileMapGetSize(const SbgFileMap *pFileMap)
+{
+	assert(pFileMap);
+
+	return pFileMap->size;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_FILE_MAP_H
@@ -14,7 +14,10 @@ static const char *gInterfaceType[] =
 	[SBG_IF_TYPE_SERIAL]		= "serial",
 	[SBG_IF_TYPE_ETH_UDP]		= "eth UDP",
 	[SBG_IF_TYPE_ETH_TCP_IP]	= "eth TCP",
-	[SBG_IF_TYPE_FILE]			= "file"
+	[SBG_IF_TYPE_FILE]			= "file",
+	[SBG_IF_TYPE_PIPE]			= "pipe",
+	[SBG_IF_TYPE_TEE]			= "tee",
+	[SBG_IF_TYPE_URING]			= "io_uring"
 };
 
 //----------------------------------------------------------------------//
@@ -58,6 +58,9 @@ extern "C" {
 #define SBG_IF_TYPE_ETH_UDP			(2)				/*!< The interface is an UDP one. */
 #define SBG_IF_TYPE_ETH_TCP_IP		(3)				/*!< The interface is an TCP/IP one. */
 #define SBG_IF_TYPE_FILE			(4)				/*!< The interface is a file. */
+#define SBG_IF_TYPE_PIPE			(5)				/*!< The interface is an in memory pipe. */
+#define SBG_IF_TYPE_TEE				(6)				/*!< The interface mirrors the data read from another interface. */
+#define SBG_IF_TYPE_URING			(7)				/*!< The interface receives data through io_uring. */
 #define SBG_IF_TYPE_LAST_RESERVED	(999)			/*!< Last reserved value for standard types. */
 
 //
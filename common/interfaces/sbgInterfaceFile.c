@@ -1,14 +1,73 @@
 // sbgCommnonLib headers
 #include <sbgCommon.h>
+#include <fileMap/sbgFileMap.h>
 
 // Local headers
 #include "sbgInterface.h"
 #include "sbgInterfaceFile.h"
 
+// Standard headers
+#if defined(__unix__) || defined(__APPLE__)
+#include <errno.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#define SBG_INTERFACE_FILE_USE_POSIX
+#endif
+
+//----------------------------------------------------------------------//
+//- Private definitions                                                -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Size of the mapped file range prefetched ahead of the read cursor.
+ */
+#define SBG_INTERFACE_FILE_PREFETCH_SIZE		(4u * 1024u * 1024u)
+
+/*!
+ * File access modes.
+ */
+typedef enum _SbgInterfaceFileMode
+{
+	SBG_INTERFACE_FILE_MODE_STDIO,					/*!< Each read goes through fread. */
+	SBG_INTERFACE_FILE_MODE_MAP,					/*!< The file is memory mapped. */
+	SBG_INTERFACE_FILE_MODE_BUFFERED				/*!< The file is read in large blocks in a read ahead buffer. */
+} SbgInterfaceFileMode;
+
+/*!
+ * Structure that stores all internal data used by the file interface.
+ */
+typedef struct _SbgInterfaceFile
+{
+	SbgInterfaceFileMode	 mode;					/*!< Access mode. */
+	FILE					*pFile;					/*!< File, NULL in map mode. */
+	SbgFileMap				 fileMap;				/*!< File map, only used in map mode. */
+	size_t					 cursor;				/*!< Number of bytes read, only used in map and buffered modes. */
+	size_t					 prefetchOffset;		/*!< End of the range prefetched so far, only used in map mode. */
+	uint8_t					*pBuffer;				/*!< Read ahead buffer, only used in buffered mode. */
+	size_t					 bufferSize;			/*!< Read ahead buffer size in bytes. */
+	size_t					 bufferOffset;			/*!< Offset of the next byte to read in the read ahead buffer. */
+	size_t					 bufferLength;			/*!< Number of valid bytes in the read ahead buffer. */
+} SbgInterfaceFile;
+
 //----------------------------------------------------------------------//
 //- Private methods                                                    -//
 //----------------------------------------------------------------------//
 
+/*!
+ * Returns the file interface instance.
+ * 
+ * \param[in]	pInterface								Interface instance.
+ * \return												The file interface instance.
+ */
+static SbgInterfaceFile *sbgInterfaceFileGet(const SbgInterface *pInterface)
+{
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_FILE);
+	assert(pInterface->handle);
+
+	return (SbgInterfaceFile*)pInterface->handle;
+}
+
 /*!
  * Returns the interface FILE descriptor.
  * 
@@ -17,11 +76,53 @@
  */
 static FILE *sbgInterfaceFileGetDesc(SbgInterface *pInterface)
 {
+	SbgInterfaceFile	*pFileHandle;
+
+	pFileHandle = sbgInterfaceFileGet(pInterface);
+
+	assert(pFileHandle->pFile);
+
+	return pFileHandle->pFile;
+}
+
+/*!
+ * Allocate a file interface instance and attach it to an interface.
+ *
+ * \param[in]	pInterface								Interface instance.
+ * \param[in]	mode									Access mode.
+ * \param[in]	filePath								File path used as the interface name.
+ * \return												The file interface instance, NULL if it can't be allocated.
+ */
+static SbgInterfaceFile *sbgInterfaceFileCreate(SbgInterface *pInterface, SbgInterfaceFileMode mode, const char *filePath)
+{
+	SbgInterfaceFile	*pFileHandle;
+
 	assert(pInterface);
-	assert(pInterface->type == SBG_IF_TYPE_FILE);
-	assert(pInterface->handle);
+	assert(filePath);
+
+	pFileHandle = calloc(1, sizeof(*pFileHandle));
+
+	if (pFileHandle)
+	{
+		pFileHandle->mode = mode;
+
+		//
+		// Define base interface members
+		//
+		pInterface->handle		= pFileHandle;
+		pInterface->type		= SBG_IF_TYPE_FILE;
+
+		//
+		// Define the interface name
+		//
+		sbgInterfaceNameSet(pInterface, filePath);
+	}
+	else
+	{
+		SBG_LOG_ERROR(SBG_MALLOC_FAILED, "unable to allocate handle");
+	}
 
-	return (FILE*)pInterface->handle;
+	return pFileHandle;
 }
 
 /*!
@@ -32,14 +133,25 @@ static FILE *sbgInterfaceFileGetDesc(SbgInterface *pInterface)
  */
 static SbgErrorCode sbgInterfaceFileDestroy(SbgInterface *pInterface)
 {
-	FILE	*pInputFile;
+	SbgInterfaceFile	*pFileHandle;
 
 	assert(pInterface);
 	assert(pInterface->type == SBG_IF_TYPE_FILE);
 
-	pInputFile = sbgInterfaceFileGetDesc(pInterface);
+	pFileHandle = sbgInterfaceFileGet(pInterface);
+
+	if (pFileHandle->mode == SBG_INTERFACE_FILE_MODE_MAP)
+	{
+		sbgFileMapClose(&pFileHandle->fileMap);
+	}
+	else
+	{
+		fclose(pFileHandle->pFile);
+	}
+
+	free(pFileHandle->pBuffer);
+	free(pFileHandle);
 
-	fclose(pInputFile);
 	sbgInterfaceZeroInit(pInterface);	
 
 	return SBG_NO_ERROR;
@@ -120,6 +232,154 @@ static SbgErrorCode sbgInterfaceFileRead(SbgInterface *pInterface, void *pBuffer
 	return errorCode;
 }
 
+/*!
+ * Read some data from a memory mapped file.
+ *
+ * The range following the read data is prefetched so the pages are loaded before they are accessed.
+ *
+ * \param[in]	pInterface								Valid handle on an initialized interface.
+ * \param[in]	pBuffer									Pointer on an allocated buffer that can hold at least bytesToRead bytes of data.
+ * \param[out]	pReadBytes								Pointer on an uint32_t used to return the number of read bytes.
+ * \param[in]	bytesToRead								Number of bytes we would like to read.
+ * \return												SBG_NO_ERROR.
+ */
+static SbgErrorCode sbgInterfaceFileMapRead(SbgInterface *pInterface, void *pBuffer, size_t *pReadBytes, size_t bytesToRead)
+{
+	SbgInterfaceFile	*pFileHandle;
+	size_t				 fileSize;
+
+	assert(pBuffer);
+	assert(pReadBytes);
+
+	pFileHandle	= sbgInterfaceFileGet(pInterface);
+	fileSize	= sbgFileMapGetSize(&pFileHandle->fileMap);
+
+	*pReadBytes = sbgMin(bytesToRead, fileSize - pFileHandle->cursor);
+
+	if (*pReadBytes != 0)
+	{
+		memcpy(pBuffer, &sbgFileMapGetBuffer(&pFileHandle->fileMap)[pFileHandle->cursor], *pReadBytes);
+		pFileHandle->cursor += *pReadBytes;
+	}
+
+	//
+	// Keep at least half a prefetch window loaded ahead of the cursor
+	//
+	if (((pFileHandle->cursor + (SBG_INTERFACE_FILE_PREFETCH_SIZE / 2)) >= pFileHandle->prefetchOffset) && (pFileHandle->prefetchOffset < fileSize))
+	{
+		sbgFileMapPrefetch(&pFileHandle->fileMap, pFileHandle->prefetchOffset, SBG_INTERFACE_FILE_PREFETCH_SIZE);
+		pFileHandle->prefetchOffset += SBG_INTERFACE_FILE_PREFETCH_SIZE;
+	}
+
+	return SBG_NO_ERROR;
+}
+
+/*!
+ * Fill the read ahead buffer of a buffered file.
+ *
+ * On POSIX platforms, the buffer is filled with the data available at once so a pipe
+ * fed in real time doesn't block until the whole buffer is filled.
+ *
+ * \param[in]	pFileHandle								File interface instance.
+ * \return												SBG_NO_ERROR if no error occurs, the buffer is left empty at the end of the file.
+ */
+static SbgErrorCode sbgInterfaceFileFillBuffer(SbgInterfaceFile *pFileHandle)
+{
+	SbgErrorCode	 errorCode = SBG_NO_ERROR;
+
+	assert(pFileHandle);
+	assert(pFileHandle->bufferOffset == pFileHandle->bufferLength);
+
+	pFileHandle->bufferOffset = 0;
+
+#ifdef SBG_INTERFACE_FILE_USE_POSIX
+	{
+		ssize_t		 result;
+
+		do
+		{
+			result = read(fileno(pFileHandle->pFile), pFileHandle->pBuffer, pFileHandle->bufferSize);
+		} while ((result < 0) && (errno == EINTR));
+
+		if (result >= 0)
+		{
+			pFileHandle->bufferLength = (size_t)result;
+		}
+		else
+		{
+			pFileHandle->bufferLength = 0;
+
+			errorCode = SBG_READ_ERROR;
+			SBG_LOG_ERROR(errorCode, "File read error %d", errno);
+		}
+	}
+#else
+	pFileHandle->bufferLength = fread(pFileHandle->pBuffer, sizeof(uint8_t), pFileHandle->bufferSize, pFileHandle->pFile);
+
+	if ((pFileHandle->bufferLength < pFileHandle->bufferSize) && (ferror(pFileHandle->pFile) != 0))
+	{
+		errorCode = SBG_READ_ERROR;
+		SBG_LOG_ERROR(errorCode, "File read error %u", ferror(pFileHandle->pFile));
+	}
+#endif
+
+	return errorCode;
+}
+
+/*!
+ * Read some data from a buffered file.
+ *
+ * \param[in]	pInterface								Valid handle on an initialized interface.
+ * \param[in]	pBuffer									Pointer on an allocated buffer that can hold at least bytesToRead bytes of data.
+ * \param[out]	pReadBytes								Pointer on an uint32_t used to return the number of read bytes.
+ * \param[in]	bytesToRead								Number of bytes we would like to read.
+ * \return												SBG_NO_ERROR if no error occurs, please check the number of received bytes.
+ */
+static SbgErrorCode sbgInterfaceFileBufferedRead(SbgInterface *pInterface, void *pBuffer, size_t *pReadBytes, size_t bytesToRead)
+{
+	SbgErrorCode		 errorCode = SBG_NO_ERROR;
+	SbgInterfaceFile	*pFileHandle;
+	size_t				 size;
+
+	assert(pBuffer);
+	assert(pReadBytes);
+
+	pFileHandle = sbgInterfaceFileGet(pInterface);
+
+	*pReadBytes = 0;
+
+	while ((errorCode == SBG_NO_ERROR) && (*pReadBytes < bytesToRead))
+	{
+		if (pFileHandle->bufferOffset == pFileHandle->bufferLength)
+		{
+			//
+			// Only refill the buffer once per read so a pipe doesn't block once some data has been read
+			//
+			if (*pReadBytes != 0)
+			{
+				break;
+			}
+
+			errorCode = sbgInterfaceFileFillBuffer(pFileHandle);
+
+			if (pFileHandle->bufferLength == 0)
+			{
+				break;
+			}
+		}
+
+		size = sbgMin(bytesToRead - *pReadBytes, pFileHandle->bufferLength - pFileHandle->bufferOffset);
+
+		memcpy(&((uint8_t*)pBuffer)[*pReadBytes], &pFileHandle->pBuffer[pFileHandle->bufferOffset], size);
+
+		pFileHandle->bufferOffset	+= size;
+		pFileHandle->cursor			+= size;
+		*pReadBytes					+= size;
+	}
+
+	return errorCode;
+}
+
 /*!
  * Make an interface flush all pending input or output data.
  *
@@ -132,20 +392,24 @@ static SbgErrorCode sbgInterfaceFileRead(SbgInterface *pInterface, void *pBuffer
  */
 static SbgErrorCode sbgInterfaceFileFlush(SbgInterface *pInterface, uint32_t flags)
 {
-	SbgErrorCode	 errorCode;
-	FILE			*pInputFile;
+	SbgErrorCode		 errorCode;
+	SbgInterfaceFile	*pFileHandle;
 
 	assert(pInterface);
 	assert(pInterface->type == SBG_IF_TYPE_FILE);
 
-	pInputFile = sbgInterfaceFileGetDesc(pInterface);
+	pFileHandle = sbgInterfaceFileGet(pInterface);
 
-	if ((pInterface->pReadFunc	&& (flags & SBG_IF_FLUSH_INPUT)) ||
-		(pInterface->pWriteFunc	&& (flags & SBG_IF_FLUSH_OUTPUT)))
+	//
+	// Memory mapped and buffered files are read only and don't go through stdio buffers
+	//
+	if ((pFileHandle->mode == SBG_INTERFACE_FILE_MODE_STDIO) &&
+		((pInterface->pReadFunc		&& (flags & SBG_IF_FLUSH_INPUT)) ||
+		 (pInterface->pWriteFunc	&& (flags & SBG_IF_FLUSH_OUTPUT))))
 	{
 		int			 ret;
 
-		ret = fflush(pInputFile);
+		ret = fflush(pFileHandle->pFile);
 
 		if (ret == 0)
 		{
@@ -170,8 +434,9 @@ static SbgErrorCode sbgInterfaceFileFlush(SbgInterface *pInterface, uint32_t fla
 
 SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFileOpen(SbgInterface *pInterface, const char *filePath)
 {
-	SbgErrorCode	 errorCode = SBG_NO_ERROR;
-	FILE			*pInputFile;
+	SbgErrorCode		 errorCode = SBG_NO_ERROR;
+	SbgInterfaceFile	*pFileHandle;
+	FILE				*pInputFile;
 	
 	assert(pInterface);
 	assert(filePath);
@@ -191,24 +456,151 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFileOpen(SbgInterface *pInterface, c
 	//
 	if (pInputFile)
 	{
-		//
-		// Define base interface members
-		//
-		pInterface->handle		= pInputFile;
-		pInterface->type		= SBG_IF_TYPE_FILE;
+		pFileHandle = sbgInterfaceFileCreate(pInterface, SBG_INTERFACE_FILE_MODE_STDIO, filePath);
 
+		if (pFileHandle)
+		{
+			pFileHandle->pFile = pInputFile;
+
+			//
+			// Define all specialized members
+			//
+			pInterface->pDestroyFunc	= sbgInterfaceFileDestroy;
+			pInterface->pReadFunc		= sbgInterfaceFileRead;
+			pInterface->pWriteFunc		= NULL;
+			pInterface->pFlushFunc		= sbgInterfaceFileFlush;
+		}
+		else
+		{
+			errorCode = SBG_MALLOC_FAILED;
+			fclose(pInputFile);
+		}
+	}
+	else
+	{
 		//
-		// Define the interface name
+		// Unable to open the input file
 		//
-		sbgInterfaceNameSet(pInterface, filePath);
-				
+		errorCode = SBG_INVALID_PARAMETER;
+	}
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFileMapOpen(SbgInterface *pInterface, const char *filePath)
+{
+	SbgErrorCode		 errorCode;
+	SbgInterfaceFile	*pFileHandle;
+	SbgFileMap			 fileMap;
+
+	assert(pInterface);
+	assert(filePath);
+
+	//
+	// Always call the underlying zero init method to make sure we can correctly handle SbgInterface evolutions
+	//
+	sbgInterfaceZeroInit(pInterface);
+
+	errorCode = sbgFileMapOpen(&fileMap, filePath);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		pFileHandle = sbgInterfaceFileCreate(pInterface, SBG_INTERFACE_FILE_MODE_MAP, filePath);
+
+		if (pFileHandle)
+		{
+			pFileHandle->fileMap = fileMap;
+
+			//
+			// The file is parsed from start to end, let the kernel read ahead aggressively
+			//
+			sbgFileMapSetAccess(&pFileHandle->fileMap, SBG_FILE_MAP_ACCESS_SEQUENTIAL);
+			sbgFileMapPrefetch(&pFileHandle->fileMap, 0, SBG_INTERFACE_FILE_PREFETCH_SIZE);
+			pFileHandle->prefetchOffset = SBG_INTERFACE_FILE_PREFETCH_SIZE;
+
+			//
+			// Define all specialized members
+			//
+			pInterface->pDestroyFunc	= sbgInterfaceFileDestroy;
+			pInterface->pReadFunc		= sbgInterfaceFileMapRead;
+			pInterface->pWriteFunc		= NULL;
+			pInterface->pFlushFunc		= sbgInterfaceFileFlush;
+		}
+		else
+		{
+			errorCode = SBG_MALLOC_FAILED;
+			sbgFileMapClose(&fileMap);
+		}
+	}
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFileBufferedOpen(SbgInterface *pInterface, const char *filePath, size_t bufferSize)
+{
+	SbgErrorCode		 errorCode = SBG_NO_ERROR;
+	SbgInterfaceFile	*pFileHandle;
+	FILE				*pInputFile;
+	uint8_t				*pBuffer;
+
+	assert(pInterface);
+	assert(filePath);
+
+	//
+	// Always call the underlying zero init method to make sure we can correctly handle SbgInterface evolutions
+	//
+	sbgInterfaceZeroInit(pInterface);
+
+	if (bufferSize == 0)
+	{
+		bufferSize = SBG_IF_FILE_DEFAULT_BUFFER_SIZE;
+	}
+
+	pInputFile = fopen(filePath, "rb");
+
+	if (pInputFile)
+	{
 		//
-		// Define all specialized members
+		// Data is already buffered by the interface, the stdio buffer would only add a copy
 		//
-		pInterface->pDestroyFunc	= sbgInterfaceFileDestroy;
-		pInterface->pReadFunc		= sbgInterfaceFileRead;
-		pInterface->pWriteFunc		= NULL;
-		pInterface->pFlushFunc		= sbgInterfaceFileFlush;
+		setvbuf(pInputFile, NULL, _IONBF, 0);
+
+		pBuffer = malloc(bufferSize);
+
+		if (pBuffer)
+		{
+			pFileHandle = sbgInterfaceFileCreate(pInterface, SBG_INTERFACE_FILE_MODE_BUFFERED, filePath);
+
+			if (pFileHandle)
+			{
+				pFileHandle->pFile		= pInputFile;
+				pFileHandle->pBuffer	= pBuffer;
+				pFileHandle->bufferSize	= bufferSize;
+
+				//
+				// Define all specialized members
+				//
+				pInterface->pDestroyFunc	= sbgInterfaceFileDestroy;
+				pInterface->pReadFunc		= sbgInterfaceFileBufferedRead;
+				pInterface->pWriteFunc		= NULL;
+				pInterface->pFlushFunc		= sbgInterfaceFileFlush;
+			}
+			else
+			{
+				errorCode = SBG_MALLOC_FAILED;
+				free(pBuffer);
+			}
+		}
+		else
+		{
+			errorCode = SBG_MALLOC_FAILED;
+			SBG_LOG_ERROR(errorCode, "unable to allocate %zu bytes read ahead buffer", bufferSize);
+		}
+
+		if (errorCode != SBG_NO_ERROR)
+		{
+			fclose(pInputFile);
+		}
 	}
 	else
 	{
@@ -223,8 +615,9 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFileOpen(SbgInterface *pInterface, c
 
 SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFileWriteOpen(SbgInterface *pInterface, const char *filePath)
 {
-	SbgErrorCode	 errorCode = SBG_NO_ERROR;
-	FILE			*pInputFile;
+	SbgErrorCode		 errorCode = SBG_NO_ERROR;
+	SbgInterfaceFile	*pFileHandle;
+	FILE				*pInputFile;
 
 	assert(pInterface);
 	assert(filePath);
@@ -239,24 +632,25 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFileWriteOpen(SbgInterface *pInterfa
 	//
 	if (pInputFile)
 	{
-		//
-		// Define base interface members
-		//
-		pInterface->handle = pInputFile;
-		pInterface->type = SBG_IF_TYPE_FILE;
-
-		//
-		// Define the interface name
-		//
-		sbgInterfaceNameSet(pInterface, filePath);
+		pFileHandle = sbgInterfaceFileCreate(pInterface, SBG_INTERFACE_FILE_MODE_STDIO, filePath);
 
-		//
-		// Define all specialized members
-		//
-		pInterface->pDestroyFunc	= sbgInterfaceFileDestroy;
-		pInterface->pReadFunc		= NULL;
-		pInterface->pWriteFunc		= sbgInterfaceFileWrite;
-		pInterface->pFlushFunc		= sbgInterfaceFileFlush;
+		if (pFileHandle)
+		{
+			pFileHandle->pFile = pInputFile;
+
+			//
+			// Define all specialized members
+			//
+			pInterface->pDestroyFunc	= sbgInterfaceFileDestroy;
+			pInterface->pReadFunc		= NULL;
+			pInterface->pWriteFunc		= sbgInterfaceFileWrite;
+			pInterface->pFlushFunc		= sbgInterfaceFileFlush;
+		}
+		else
+		{
+			errorCode = SBG_MALLOC_FAILED;
+			fclose(pInputFile);
+		}
 	}
 	else
 	{
@@ -271,34 +665,126 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFileWriteOpen(SbgInterface *pInterfa
 
 SBG_COMMON_LIB_API size_t sbgInterfaceFileGetSize(SbgInterface *pInterface)
 {
-	FILE	*pInputFile;
-	long	 cursorPos;
-	long	 fileSize;
+	SbgInterfaceFile	*pFileHandle;
+	size_t				 fileSize;
 
 	assert(pInterface);
 	assert(pInterface->type == SBG_IF_TYPE_FILE);
 
-	pInputFile = sbgInterfaceFileGetDesc(pInterface);
+	pFileHandle = sbgInterfaceFileGet(pInterface);
 
-	//
-	// Compute the file size
-	//
-	cursorPos = ftell(pInputFile);
-	fseek(pInputFile, 0, SEEK_END);
-	fileSize = ftell(pInputFile);
-	fseek(pInputFile, cursorPos, SEEK_SET);
-	
-	return (size_t)fileSize;
+	if (pFileHandle->mode == SBG_INTERFACE_FILE_MODE_MAP)
+	{
+		fileSize = sbgFileMapGetSize(&pFileHandle->fileMap);
+	}
+	else
+	{
+#ifdef SBG_INTERFACE_FILE_USE_POSIX
+		struct stat		 fileStat;
+
+		//
+		// Query the file size without moving the cursor, pipes report a zero size
+		//
+		if (fstat(fileno(pFileHandle->pFile), &fileStat) == 0)
+		{
+			fileSize = (size_t)fileStat.st_size;
+		}
+		else
+		{
+			fileSize = 0;
+		}
+#else
+		long			 cursorPos;
+
+		//
+		// Compute the file size
+		//
+		cursorPos = ftell(pFileHandle->pFile);
+		fseek(pFileHandle->pFile, 0, SEEK_END);
+		fileSize = (size_t)ftell(pFileHandle->pFile);
+		fseek(pFileHandle->pFile, cursorPos, SEEK_SET);
+#endif
+	}
+
+	return fileSize;
 }
 
 SBG_COMMON_LIB_API size_t sbgInterfaceFileGetCursor(const SbgInterface *pInterface)
 {
-	FILE	*pInputFile;
+	SbgInterfaceFile	*pFileHandle;
+	size_t				 cursor;
 
 	assert(pInterface);
 	assert(pInterface->type == SBG_IF_TYPE_FILE);
 
-	pInputFile = sbgInterfaceFileGetDesc((SbgInterface*)pInterface);
+	pFileHandle = sbgInterfaceFileGet(pInterface);
+
+	if (pFileHandle->mode == SBG_INTERFACE_FILE_MODE_STDIO)
+	{
+		cursor = (size_t)ftell(pFileHandle->pFile);
+	}
+	else
+	{
+		cursor = pFileHandle->cursor;
+	}
+
+	return cursor;
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFilePeek(SbgInterface *pInterface, const void **ppBuffer, size_t *pSize)
+{
+	SbgErrorCode		 errorCode = SBG_NO_ERROR;
+	SbgInterfaceFile	*pFileHandle;
+
+	assert(ppBuffer);
+	assert(pSize);
+
+	pFileHandle = sbgInterfaceFileGet(pInterface);
+
+	if (pFileHandle->mode == SBG_INTERFACE_FILE_MODE_MAP)
+	{
+		*ppBuffer	= &sbgFileMapGetBuffer(&pFileHandle->fileMap)[pFileHandle->cursor];
+		*pSize		= sbgFileMapGetSize(&pFileHandle->fileMap) - pFileHandle->cursor;
+	}
+	else if (pFileHandle->mode == SBG_INTERFACE_FILE_MODE_BUFFERED)
+	{
+		if (pFileHandle->bufferOffset == pFileHandle->bufferLength)
+		{
+			errorCode = sbgInterfaceFileFillBuffer(pFileHandle);
+		}
+
+		*ppBuffer	= &pFileHandle->pBuffer[pFileHandle->bufferOffset];
+		*pSize		= pFileHandle->bufferLength - pFileHandle->bufferOffset;
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+		SBG_LOG_ERROR(errorCode, "peek isn't supported by stdio file interfaces");
+
+		*ppBuffer	= NULL;
+		*pSize		= 0;
+	}
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API void sbgInterfaceFileConsume(SbgInterface *pInterface, size_t size)
+{
+	SbgInterfaceFile	*pFileHandle;
+
+	pFileHandle = sbgInterfaceFileGet(pInterface);
+
+	if (pFileHandle->mode == SBG_INTERFACE_FILE_MODE_MAP)
+	{
+		assert(size <= (sbgFileMapGetSize(&pFileHandle->fileMap) - pFileHandle->cursor));
+	}
+	else
+	{
+		assert(pFileHandle->mode == SBG_INTERFACE_FILE_MODE_BUFFERED);
+		assert(size <= (pFileHandle->bufferLength - pFileHandle->bufferOffset));
+
+		pFileHandle->bufferOffset += size;
+	}
 
-	return (size_t)ftell(pInputFile);
+	pFileHandle->cursor += size;
 }
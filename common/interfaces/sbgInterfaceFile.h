@@ -44,6 +44,12 @@ extern "C" {
 // Local headers
 #include "sbgInterface.h"
 
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+#define SBG_IF_FILE_DEFAULT_BUFFER_SIZE			(1024u * 1024u)			/*!< Default read ahead buffer size in bytes for buffered file interfaces. */
+
 //----------------------------------------------------------------------//
 //- Public methods                                                     -//
 //----------------------------------------------------------------------//
@@ -57,6 +63,32 @@ extern "C" {
  */
 SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFileOpen(SbgInterface *pHandle, const char *filePath);
 
+/*!
+ *	Open a memory mapped file as an interface for read only operations.
+ *
+ *	The whole file is mapped and read sequentially, the kernel is asked to read ahead
+ *	and the range following the cursor is prefetched. Only regular files can be mapped,
+ *	use sbgInterfaceFileBufferedOpen for pipes and character devices.
+ *
+ *	\param[in]	pHandle							Pointer on an allocated interface instance to initialize.
+ *	\param[in]	filePath						File path to open.
+ *	eturn										SBG_NO_ERROR if the interface has been created.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFileMapOpen(SbgInterface *pHandle, const char *filePath);
+
+/*!
+ *	Open a file as an interface for read only operations using a large read ahead buffer.
+ *
+ *	The file is read in blocks of up to bufferSize bytes instead of one read per protocol
+ *	request. This works with any input, including pipes.
+ *
+ *	\param[in]	pHandle							Pointer on an allocated interface instance to initialize.
+ *	\param[in]	filePath						File path to open.
+ *	\param[in]	bufferSize						Read ahead buffer size in bytes, 0 to use SBG_IF_FILE_DEFAULT_BUFFER_SIZE.
+ *	eturn										SBG_NO_ERROR if the interface has been created.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFileBufferedOpen(SbgInterface *pHandle, const char *filePath, size_t bufferSize);
+
 /*!
  *	Open a file as an interface for write only operations.
  *
@@ -82,6 +114,29 @@ SBG_COMMON_LIB_API size_t sbgInterfaceFileGetSize(SbgInterface *pHandle);
  */
 SBG_COMMON_LIB_API size_t sbgInterfaceFileGetCursor(const SbgInterface *pHandle);
 
+/*!
+ *	Returns the data available at the cursor without copying it.
+ *
+ *	For memory mapped files, all the remaining file data is returned. For buffered files,
+ *	the read ahead buffer content is returned and the buffer is refilled if it's empty.
+ *	The cursor isn't moved, call sbgInterfaceFileConsume once the data has been used.
+ *	Only supported by memory mapped and buffered file interfaces.
+ *
+ *	\param[in]	pHandle							Valid handle on an initialized interface.
+ *	\param[out]	ppBuffer						Pointer on the available data, valid until the next read or consume.
+ *	\param[out]	pSize							Available data size in bytes, 0 at the end of the file.
+ *	eturn										SBG_NO_ERROR if no error occurs.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceFilePeek(SbgInterface *pHandle, const void **ppBuffer, size_t *pSize);
+
+/*!
+ *	Move the cursor after data returned by sbgInterfaceFilePeek.
+ *
+ *	\param[in]	pHandle							Valid handle on an initialized interface.
+ *	\param[in]	size							Number of bytes to consume, at most the size returned by sbgInterfaceFilePeek.
+ */
+SBG_COMMON_LIB_API void sbgInterfaceFileConsume(SbgInterface *pHandle, size_t size);
+
 //----------------------------------------------------------------------//
 //- Footer (close extern C block)                                      -//
 //----------------------------------------------------------------------//
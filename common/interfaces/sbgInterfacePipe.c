@@ -0,0 +1,728 @@
+// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <interfaces/sbgInterfacePipe.h>
+
+// Standard headers
+#if defined(__unix__) || defined(__APPLE__)
+	#include <pthread.h>
+	#include <sys/time.h>
+	#define SBG_INTERFACE_PIPE_USE_THREADS
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+	#define SBG_INTERFACE_PIPE_LOAD(pValue)						__atomic_load_n(pValue, __ATOMIC_ACQUIRE)
+	#define SBG_INTERFACE_PIPE_STORE(pValue, value)				__atomic_store_n(pValue, value, __ATOMIC_RELEASE)
+	#define SBG_INTERFACE_PIPE_FENCE()							__atomic_thread_fence(__ATOMIC_SEQ_CST)
+	#define SBG_INTERFACE_PIPE_DECREMENT(pValue)				__atomic_sub_fetch(pValue, 1, __ATOMIC_ACQ_REL)
+#elif defined(_MSC_VER)
+	#include <intrin.h>
+
+	//
+	// Volatile accesses have acquire and release semantics on x86 and x64 targets
+	//
+	#define SBG_INTERFACE_PIPE_LOAD(pValue)						(*(volatile size_t *)(pValue))
+	#define SBG_INTERFACE_PIPE_STORE(pValue, value)				(*(volatile size_t *)(pValue) = (value))
+	#define SBG_INTERFACE_PIPE_FENCE()							_ReadWriteBarrier()
+	#define SBG_INTERFACE_PIPE_DECREMENT(pValue)				((uint32_t)_InterlockedDecrement((volatile long *)(pValue)))
+#else
+	#error "atomic operations are not supported by this compiler"
+#endif
+
+//----------------------------------------------------------------------//
+//- Private definitions                                                -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Cache line size, producer and consumer members are kept on separate cache lines.
+ */
+#define SBG_INTERFACE_PIPE_CACHE_LINE_SIZE				(64)
+
+/*!
+ * Single producer single consumer byte ring.
+ *
+ * Indexes increase monotonically and are masked to access the buffer.
+ */
+typedef struct _SbgInterfacePipeRing
+{
+	uint8_t				*pBuffer;																	/*!< Ring buffer. */
+	size_t				 capacity;																	/*!< Buffer size in bytes, a power of two. */
+	uint8_t				 padding0[SBG_INTERFACE_PIPE_CACHE_LINE_SIZE];
+
+	size_t				 head;																		/*!< Write index, only modified by the producer. */
+	size_t				 cachedTail;																/*!< Last read index seen by the producer. */
+	size_t				 writerWaiting;																/*!< Non zero while the producer waits for free space. */
+	uint8_t				 padding1[SBG_INTERFACE_PIPE_CACHE_LINE_SIZE];
+
+	size_t				 tail;																		/*!< Read index, only modified by the consumer. */
+	size_t				 cachedHead;																/*!< Last write index seen by the consumer. */
+	size_t				 readerWaiting;																/*!< Non zero while the consumer waits for data. */
+	uint8_t				 padding2[SBG_INTERFACE_PIPE_CACHE_LINE_SIZE];
+
+#ifdef SBG_INTERFACE_PIPE_USE_THREADS
+	pthread_mutex_t		 mutex;																		/*!< Mutex protecting the waits. */
+	pthread_cond_t		 cond;																		/*!< Condition signaled when a waiting side can proceed. */
+#endif // SBG_INTERFACE_PIPE_USE_THREADS
+} SbgInterfacePipeRing;
+
+/*!
+ * Rings shared by the interfaces of a pipe.
+ */
+typedef struct _SbgInterfacePipeShared
+{
+	SbgInterfacePipeRing	 rings[2];					/*!< Rings, one per direction. */
+	size_t					 nrRings;					/*!< Number of rings, 1 for a loopback pipe. */
+	uint32_t				 refCount;					/*!< Number of interfaces using the rings. */
+} SbgInterfacePipeShared;
+
+/*!
+ * Structure that stores all internal data used by the pipe interface.
+ */
+typedef struct _SbgInterfacePipe
+{
+	SbgInterfacePipeShared	*pShared;					/*!< Shared rings. */
+	SbgInterfacePipeRing	*pRxRing;					/*!< Ring read by this interface. */
+	SbgInterfacePipeRing	*pTxRing;					/*!< Ring written by this interface. */
+	bool					 blocking;					/*!< True to wait for data on read and for free space on write. */
+	uint32_t				 readTimeOut;				/*!< Maximum time in ms to wait for data. */
+	uint32_t				 writeTimeOut;				/*!< Maximum time in ms to wait for free space. */
+} SbgInterfacePipe;
+
+//----------------------------------------------------------------------//
+//- Private functions                                                  -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Returns the pipe interface instance.
+ *
+ * \param[in]	pInterface								Interface instance.
+ * \return												The pipe interface instance.
+ */
+static SbgInterfacePipe *sbgInterfacePipeGet(SbgInterface *pInterface)
+{
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_PIPE);
+	assert(pInterface->handle);
+
+	return (SbgInterfacePipe*)pInterface->handle;
+}
+
+/*!
+ * Initialize a ring.
+ *
+ * \param[out]	pRing									Ring.
+ * \param[in]	capacity								Ring capacity in bytes, a power of two.
+ * \return												SBG_NO_ERROR if the ring has been initialized.
+ */
+static SbgErrorCode sbgInterfacePipeRingConstruct(SbgInterfacePipeRing *pRing, size_t capacity)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+
+	assert(pRing);
+	assert((capacity != 0) && ((capacity & (capacity - 1)) == 0));
+
+	memset(pRing, 0, sizeof(*pRing));
+
+	pRing->pBuffer	= malloc(capacity);
+	pRing->capacity	= capacity;
+
+	if (pRing->pBuffer)
+	{
+#ifdef SBG_INTERFACE_PIPE_USE_THREADS
+		pthread_mutex_init(&pRing->mutex, NULL);
+		pthread_cond_init(&pRing->cond, NULL);
+#endif // SBG_INTERFACE_PIPE_USE_THREADS
+	}
+	else
+	{
+		errorCode = SBG_MALLOC_FAILED;
+		SBG_LOG_ERROR(errorCode, "unable to allocate ring buffer");
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Release a ring.
+ *
+ * \param[in]	pRing									Ring.
+ */
+static void sbgInterfacePipeRingDestroy(SbgInterfacePipeRing *pRing)
+{
+	assert(pRing);
+
+#ifdef SBG_INTERFACE_PIPE_USE_THREADS
+	pthread_cond_destroy(&pRing->cond);
+	pthread_mutex_destroy(&pRing->mutex);
+#endif // SBG_INTERFACE_PIPE_USE_THREADS
+
+	SBG_FREE(pRing->pBuffer);
+}
+
+/*!
+ * Returns the number of bytes that can be written to a ring, producer side.
+ *
+ * The read index is only reloaded if the cached one doesn't leave enough free space.
+ *
+ * \param[in]	pRing									Ring.
+ * \param[in]	size									Number of bytes the producer would like to write.
+ * \return												Number of free bytes.
+ */
+static size_t sbgInterfacePipeRingGetFree(SbgInterfacePipeRing *pRing, size_t size)
+{
+	size_t					 freeSize;
+
+	assert(pRing);
+
+	freeSize = pRing->capacity - (pRing->head - pRing->cachedTail);
+
+	if (freeSize < size)
+	{
+		pRing->cachedTail	= SBG_INTERFACE_PIPE_LOAD(&pRing->tail);
+		freeSize			= pRing->capacity - (pRing->head - pRing->cachedTail);
+	}
+
+	return freeSize;
+}
+
+/*!
+ * Returns the number of bytes that can be read from a ring, consumer side.
+ *
+ * \param[in]	pRing									Ring.
+ * \param[in]	size									Number of bytes the consumer would like to read.
+ * \return												Number of available bytes.
+ */
+static size_t sbgInterfacePipeRingGetUsed(SbgInterfacePipeRing *pRing, size_t size)
+{
+	size_t					 usedSize;
+
+	assert(pRing);
+
+	usedSize = pRing->cachedHead - pRing->tail;
+
+	if (usedSize < size)
+	{
+		pRing->cachedHead	= SBG_INTERFACE_PIPE_LOAD(&pRing->head);
+		usedSize			= pRing->cachedHead - pRing->tail;
+	}
+
+	return usedSize;
+}
+
+/*!
+ * Wake up the other side of a ring if it is waiting.
+ *
+ * \param[in]	pRing									Ring.
+ * \param[in]	pWaiting								Waiting flag of the other side.
+ */
+static void sbgInterfacePipeRingWakeUp(SbgInterfacePipeRing *pRing, size_t *pWaiting)
+{
+	assert(pRing);
+	assert(pWaiting);
+
+#ifdef SBG_INTERFACE_PIPE_USE_THREADS
+	//
+	// Pairs with the fence of sbgInterfacePipeRingWait: either the waiting flag is seen
+	// here or the waiting side sees the updated index before sleeping
+	//
+	SBG_INTERFACE_PIPE_FENCE();
+
+	if (SBG_INTERFACE_PIPE_LOAD(pWaiting))
+	{
+		pthread_mutex_lock(&pRing->mutex);
+		pthread_cond_broadcast(&pRing->cond);
+		pthread_mutex_unlock(&pRing->mutex);
+	}
+#else
+	SBG_UNUSED_PARAMETER(pRing);
+	SBG_UNUSED_PARAMETER(pWaiting);
+#endif // SBG_INTERFACE_PIPE_USE_THREADS
+}
+
+/*!
+ * Wait until data can be read from a ring, or written to it.
+ *
+ * \param[in]	pRing									Ring.
+ * \param[in]	reader									True to wait for data, false to wait for free space.
+ * \param[in]	timeOut									Maximum time to wait in ms.
+ * \return												true if the ring is ready, false if the time out has elapsed.
+ */
+static bool sbgInterfacePipeRingWait(SbgInterfacePipeRing *pRing, bool reader, uint32_t timeOut)
+{
+	uint32_t				 startTime;
+	bool					 ready;
+
+	assert(pRing);
+
+	startTime = sbgGetTime();
+
+#ifdef SBG_INTERFACE_PIPE_USE_THREADS
+	pthread_mutex_lock(&pRing->mutex);
+
+	SBG_INTERFACE_PIPE_STORE(reader ? &pRing->readerWaiting : &pRing->writerWaiting, 1);
+	SBG_INTERFACE_PIPE_FENCE();
+#endif // SBG_INTERFACE_PIPE_USE_THREADS
+
+	for (;;)
+	{
+		uint32_t			 elapsedTime;
+
+		ready = reader ? (sbgInterfacePipeRingGetUsed(pRing, 1) != 0) : (sbgInterfacePipeRingGetFree(pRing, 1) != 0);
+
+		elapsedTime = sbgGetTime() - startTime;
+
+		if (ready || (elapsedTime >= timeOut))
+		{
+			break;
+		}
+
+#ifdef SBG_INTERFACE_PIPE_USE_THREADS
+		{
+			struct timeval		 now;
+			struct timespec		 deadline;
+			uint64_t			 deadlineNs;
+
+			gettimeofday(&now, NULL);
+
+			deadlineNs			= ((uint64_t)now.tv_usec * 1000ull) + ((uint64_t)(timeOut - elapsedTime) * 1000000ull);
+			deadline.tv_sec		= now.tv_sec + (time_t)(deadlineNs / 1000000000ull);
+			deadline.tv_nsec	= (long)(deadlineNs % 1000000000ull);
+
+			pthread_cond_timedwait(&pRing->cond, &pRing->mutex, &deadline);
+		}
+#else
+		sbgSleep(1);
+#endif // SBG_INTERFACE_PIPE_USE_THREADS
+	}
+
+#ifdef SBG_INTERFACE_PIPE_USE_THREADS
+	SBG_INTERFACE_PIPE_STORE(reader ? &pRing->readerWaiting : &pRing->writerWaiting, 0);
+
+	pthread_mutex_unlock(&pRing->mutex);
+#endif // SBG_INTERFACE_PIPE_USE_THREADS
+
+	return ready;
+}
+
+/*!
+ * Write bytes to a ring, producer side.
+ *
+ * \param[in]	pRing									Ring.
+ * \param[in]	pBuffer									Data to write.
+ * \param[in]	size									Number of bytes to write, must fit in the free space.
+ */
+static void sbgInterfacePipeRingWrite(SbgInterfacePipeRing *pRing, const uint8_t *pBuffer, size_t size)
+{
+	size_t					 offset;
+	size_t					 firstSize;
+
+	assert(pRing);
+	assert(pBuffer || (size == 0));
+	assert(size <= pRing->capacity - (pRing->head - pRing->cachedTail));
+
+	offset		= pRing->head & (pRing->capacity - 1);
+	firstSize	= sbgMin(size, pRing->capacity - offset);
+
+	memcpy(&pRing->pBuffer[offset], pBuffer, firstSize);
+	memcpy(pRing->pBuffer, &pBuffer[firstSize], size - firstSize);
+
+	SBG_INTERFACE_PIPE_STORE(&pRing->head, pRing->head + size);
+
+	sbgInterfacePipeRingWakeUp(pRing, &pRing->readerWaiting);
+}
+
+/*!
+ * Read bytes from a ring, consumer side.
+ *
+ * \param[in]	pRing									Ring.
+ * \param[out]	pBuffer									Buffer receiving the data.
+ * \param[in]	size									Number of bytes to read, must be available.
+ */
+static void sbgInterfacePipeRingRead(SbgInterfacePipeRing *pRing, uint8_t *pBuffer, size_t size)
+{
+	size_t					 offset;
+	size_t					 firstSize;
+
+	assert(pRing);
+	assert(pBuffer || (size == 0));
+	assert(size <= pRing->cachedHead - pRing->tail);
+
+	offset		= pRing->tail & (pRing->capacity - 1);
+	firstSize	= sbgMin(size, pRing->capacity - offset);
+
+	memcpy(pBuffer, &pRing->pBuffer[offset], firstSize);
+	memcpy(&pBuffer[firstSize], pRing->pBuffer, size - firstSize);
+
+	SBG_INTERFACE_PIPE_STORE(&pRing->tail, pRing->tail + size);
+
+	sbgInterfacePipeRingWakeUp(pRing, &pRing->writerWaiting);
+}
+
+/*!
+ * Destroy an interface initialized using sbgInterfacePipeCreate or sbgInterfacePipeCreatePair.
+ *
+ * The rings are released with the last interface using them.
+ *
+ * \param[in]	pInterface						Pointer on a valid pipe interface.
+ * \return										SBG_NO_ERROR if the interface has been closed and released.
+ */
+static SbgErrorCode sbgInterfacePipeDestroy(SbgInterface *pInterface)
+{
+	SbgInterfacePipe		*pPipeHandle;
+	SbgInterfacePipeShared	*pShared;
+
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_PIPE);
+
+	pPipeHandle	= sbgInterfacePipeGet(pInterface);
+	pShared		= pPipeHandle->pShared;
+
+	if (SBG_INTERFACE_PIPE_DECREMENT(&pShared->refCount) == 0)
+	{
+		for (size_t i = 0; i < pShared->nrRings; i++)
+		{
+			sbgInterfacePipeRingDestroy(&pShared->rings[i]);
+		}
+
+		free(pShared);
+	}
+
+	free(pPipeHandle);
+
+	sbgInterfaceZeroInit(pInterface);
+
+	return SBG_NO_ERROR;
+}
+
+/*!
+ * Try to write some data to an interface.
+ *
+ * \param[in]	pHandle									Valid handle on an initialized interface.
+ * \param[in]	pBuffer									Pointer on an allocated buffer that contains the data to write
+ * \param[in]	bytesToWrite							Number of bytes we would like to write.
+ * \return												SBG_NO_ERROR if all bytes have been written successfully.
+ */
+static SbgErrorCode sbgInterfacePipeWrite(SbgInterface *pInterface, const void *pBuffer, size_t bytesToWrite)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+	SbgInterfacePipe		*pPipeHandle;
+	SbgInterfacePipeRing	*pRing;
+
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_PIPE);
+	assert(pBuffer);
+
+	pPipeHandle	= sbgInterfacePipeGet(pInterface);
+	pRing		= pPipeHandle->pTxRing;
+
+	if (pPipeHandle->blocking)
+	{
+		while (bytesToWrite != 0)
+		{
+			size_t				 size;
+
+			size = sbgMin(sbgInterfacePipeRingGetFree(pRing, bytesToWrite), bytesToWrite);
+
+			if (size != 0)
+			{
+				sbgInterfacePipeRingWrite(pRing, pBuffer, size);
+
+				bytesToWrite	-= size;
+				pBuffer			= (const uint8_t *)pBuffer + size;
+			}
+			else if (!sbgInterfacePipeRingWait(pRing, false, pPipeHandle->writeTimeOut))
+			{
+				errorCode = SBG_TIME_OUT;
+				SBG_LOG_ERROR(errorCode, "pipe full");
+				break;
+			}
+		}
+	}
+	else if (sbgInterfacePipeRingGetFree(pRing, bytesToWrite) >= bytesToWrite)
+	{
+		sbgInterfacePipeRingWrite(pRing, pBuffer, bytesToWrite);
+	}
+	else
+	{
+		errorCode = SBG_BUFFER_OVERFLOW;
+		SBG_LOG_ERROR(errorCode, "pipe full");
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Try to read some data from an interface.
+ *
+ * \param[in]	pHandle									Valid handle on an initialized interface.
+ * \param[in]	pBuffer									Pointer on an allocated buffer that can hold at least bytesToRead bytes of data.
+ * \param[out]	pReadBytes								Pointer on an uint32_t used to return the number of read bytes.
+ * \param[in]	bytesToRead								Number of bytes we would like to read.
+ * \return												SBG_NO_ERROR if no error occurs, please check the number of received bytes.
+ */
+static SbgErrorCode sbgInterfacePipeRead(SbgInterface *pInterface, void *pBuffer, size_t *pReadBytes, size_t bytesToRead)
+{
+	SbgInterfacePipe		*pPipeHandle;
+	SbgInterfacePipeRing	*pRing;
+	size_t					 size;
+
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_PIPE);
+	assert(pBuffer);
+	assert(pReadBytes);
+
+	pPipeHandle	= sbgInterfacePipeGet(pInterface);
+	pRing		= pPipeHandle->pRxRing;
+
+	size = sbgInterfacePipeRingGetUsed(pRing, bytesToRead);
+
+	if ((size == 0) && (bytesToRead != 0) && pPipeHandle->blocking)
+	{
+		sbgInterfacePipeRingWait(pRing, true, pPipeHandle->readTimeOut);
+
+		size = sbgInterfacePipeRingGetUsed(pRing, bytesToRead);
+	}
+
+	size = sbgMin(size, bytesToRead);
+
+	sbgInterfacePipeRingRead(pRing, pBuffer, size);
+
+	*pReadBytes = size;
+
+	return SBG_NO_ERROR;
+}
+
+/*!
+ * Initialize a pipe interface.
+ *
+ * \param[in]	pInterface						Pointer on an allocated interface instance to initialize.
+ * \param[in]	pShared							Shared rings, referenced by the interface.
+ * \param[in]	pRxRing							Ring read by the interface.
+ * \param[in]	pTxRing							Ring written by the interface.
+ * \param[in]	pOptions						Pipe options.
+ * \param[in]	pName							Interface name.
+ * \return										SBG_NO_ERROR if the interface has been created.
+ */
+static SbgErrorCode sbgInterfacePipeConstruct(SbgInterface *pInterface, SbgInterfacePipeShared *pShared, SbgInterfacePipeRing *pRxRing, SbgInterfacePipeRing *pTxRing, const SbgInterfacePipeOptions *pOptions, const char *pName)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+	SbgInterfacePipe		*pNewPipeHandle;
+
+	assert(pInterface);
+	assert(pShared);
+	assert(pRxRing);
+	assert(pTxRing);
+	assert(pOptions);
+	assert(pName);
+
+	pNewPipeHandle = malloc(sizeof(*pNewPipeHandle));
+
+	if (pNewPipeHandle)
+	{
+		pNewPipeHandle->pShared			= pShared;
+		pNewPipeHandle->pRxRing			= pRxRing;
+		pNewPipeHandle->pTxRing			= pTxRing;
+		pNewPipeHandle->blocking		= pOptions->blocking;
+		pNewPipeHandle->readTimeOut		= pOptions->readTimeOut;
+		pNewPipeHandle->writeTimeOut	= pOptions->writeTimeOut;
+
+		pShared->refCount++;
+
+		pInterface->handle			= pNewPipeHandle;
+		pInterface->type			= SBG_IF_TYPE_PIPE;
+
+		sbgInterfaceNameSet(pInterface, pName);
+
+		//
+		// Define all overloaded members
+		//
+		pInterface->pDestroyFunc	= sbgInterfacePipeDestroy;
+		pInterface->pReadFunc		= sbgInterfacePipeRead;
+		pInterface->pWriteFunc		= sbgInterfacePipeWrite;
+	}
+	else
+	{
+		errorCode = SBG_MALLOC_FAILED;
+		SBG_LOG_ERROR(errorCode, "unable to allocate handle");
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Allocate the rings of a pipe.
+ *
+ * \param[out]	ppShared						Allocated shared rings, without reference.
+ * \param[in]	nrRings							Number of rings to allocate.
+ * \param[in]	pOptions						Pipe options.
+ * \return										SBG_NO_ERROR if the rings have been allocated.
+ */
+static SbgErrorCode sbgInterfacePipeSharedCreate(SbgInterfacePipeShared **ppShared, size_t nrRings, const SbgInterfacePipeOptions *pOptions)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+	SbgInterfacePipeShared	*pShared;
+	size_t					 capacity;
+
+	assert(ppShared);
+	assert(nrRings <= SBG_ARRAY_SIZE(pShared->rings));
+	assert(pOptions);
+
+	if ((pOptions->capacity != 0) && (pOptions->capacity <= (SIZE_MAX / 2)))
+	{
+		capacity = 1;
+
+		while (capacity < pOptions->capacity)
+		{
+			capacity <<= 1;
+		}
+
+		pShared = malloc(sizeof(*pShared));
+
+		if (pShared)
+		{
+			pShared->nrRings	= 0;
+			pShared->refCount	= 0;
+
+			while ((errorCode == SBG_NO_ERROR) && (pShared->nrRings < nrRings))
+			{
+				errorCode = sbgInterfacePipeRingConstruct(&pShared->rings[pShared->nrRings], capacity);
+
+				if (errorCode == SBG_NO_ERROR)
+				{
+					pShared->nrRings++;
+				}
+			}
+
+			if (errorCode == SBG_NO_ERROR)
+			{
+				*ppShared = pShared;
+			}
+			else
+			{
+				for (size_t i = 0; i < pShared->nrRings; i++)
+				{
+					sbgInterfacePipeRingDestroy(&pShared->rings[i]);
+				}
+
+				free(pShared);
+			}
+		}
+		else
+		{
+			errorCode = SBG_MALLOC_FAILED;
+			SBG_LOG_ERROR(errorCode, "unable to allocate pipe");
+		}
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+		SBG_LOG_ERROR(errorCode, "invalid pipe capacity: %zu", pOptions->capacity);
+	}
+
+	return errorCode;
+}
+
+//----------------------------------------------------------------------//
+//- Public functions                                                   -//
+//----------------------------------------------------------------------//
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfacePipeCreate(SbgInterface *pInterface, const SbgInterfacePipeOptions *pOptions)
+{
+	SbgErrorCode			 errorCode;
+	SbgInterfacePipeOptions	 defaultOptions;
+	SbgInterfacePipeShared	*pShared;
+
+	assert(pInterface);
+
+	//
+	// Always call the underlying zero init method to make sure we can correctly handle SbgInterface evolutions
+	//
+	sbgInterfaceZeroInit(pInterface);
+
+	if (!pOptions)
+	{
+		sbgInterfacePipeOptionsInit(&defaultOptions);
+		pOptions = &defaultOptions;
+	}
+
+	errorCode = sbgInterfacePipeSharedCreate(&pShared, 1, pOptions);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		errorCode = sbgInterfacePipeConstruct(pInterface, pShared, &pShared->rings[0], &pShared->rings[0], pOptions, "pipe: loopback");
+
+		if (errorCode != SBG_NO_ERROR)
+		{
+			sbgInterfacePipeRingDestroy(&pShared->rings[0]);
+			free(pShared);
+		}
+	}
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfacePipeCreatePair(SbgInterface *pFirst, SbgInterface *pSecond, const SbgInterfacePipeOptions *pOptions)
+{
+	SbgErrorCode			 errorCode;
+	SbgInterfacePipeOptions	 defaultOptions;
+	SbgInterfacePipeShared	*pShared;
+
+	assert(pFirst);
+	assert(pSecond);
+	assert(pFirst != pSecond);
+
+	sbgInterfaceZeroInit(pFirst);
+	sbgInterfaceZeroInit(pSecond);
+
+	if (!pOptions)
+	{
+		sbgInterfacePipeOptionsInit(&defaultOptions);
+		pOptions = &defaultOptions;
+	}
+
+	errorCode = sbgInterfacePipeSharedCreate(&pShared, 2, pOptions);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		errorCode = sbgInterfacePipeConstruct(pFirst, pShared, &pShared->rings[0], &pShared->rings[1], pOptions, "pipe: first");
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			errorCode = sbgInterfacePipeConstruct(pSecond, pShared, &pShared->rings[1], &pShared->rings[0], pOptions, "pipe: second");
+
+			if (errorCode != SBG_NO_ERROR)
+			{
+				sbgInterfaceDestroy(pFirst);
+			}
+		}
+		else
+		{
+			sbgInterfacePipeRingDestroy(&pShared->rings[0]);
+			sbgInterfacePipeRingDestroy(&pShared->rings[1]);
+			free(pShared);
+		}
+	}
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API size_t sbgInterfacePipeGetReadAvailable(SbgInterface *pInterface)
+{
+	SbgInterfacePipeRing	*pRing;
+
+	assert(pInterface);
+
+	pRing = sbgInterfacePipeGet(pInterface)->pRxRing;
+
+	return SBG_INTERFACE_PIPE_LOAD(&pRing->head) - pRing->tail;
+}
+
+SBG_COMMON_LIB_API size_t sbgInterfacePipeGetWriteAvailable(SbgInterface *pInterface)
+{
+	SbgInterfacePipeRing	*pRing;
+
+	assert(pInterface);
+
+	pRing = sbgInterfacePipeGet(pInterface)->pTxRing;
+
+	return pRing->capacity - (pRing->head - SBG_INTERFACE_PIPE_LOAD(&pRing->tail));
+}
@@ -0,0 +1,140 @@
+/*!
+ *      \file           sbgInterfacePipe.h
+ *      \author         SBG Systems
+ *      \date           19 October 2026
+ *
+ *      \brief          In memory pipe interface.
+ *
+ *                      Bounded lock free byte rings connecting two interfaces of the same process,
+ *                      used to simulate a device or benchmark the protocol without system calls.
+ *
+ *      \section CodeCopyright Copyright Notice
+ *      The MIT license
+ *
+ *      Copyright (C) 2007-2022, SBG Systems SAS. All rights reserved.
+ *
+ *      Permission is hereby granted, free of charge, to any person obtaining a copy
+ *      of this software and associated documentation files (the "Software"), to deal
+ *      in the Software without restriction, including without limitation the rights
+ *      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *      copies of the Software, and to permit persons to whom the Software is
+ *      furnished to do so, subject to the following conditions:
+ *
+ *      The above copyright notice and this permission notice shall be included in all
+ *      copies or substantial portions of the Software.
+ *
+ *      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *      SOFTWARE.
+ */
+
+#ifndef SBG_INTERFACE_PIPE_H
+#define SBG_INTERFACE_PIPE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <interfaces/sbgInterface.h>
+
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Default ring capacity in bytes.
+ */
+#define SBG_INTERFACE_PIPE_DEFAULT_CAPACITY			(64u * 1024u)
+
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Pipe interface options.
+ *
+ * Each ring has a single producer and a single consumer: an interface must only be
+ * written by one thread and read by one thread at a time.
+ */
+typedef struct _SbgInterfacePipeOptions
+{
+	size_t			capacity;							/*!< Ring capacity in bytes, rounded up to a power of two. */
+	bool			blocking;							/*!< True to wait for data on read and for free space on write. */
+	uint32_t		readTimeOut;						/*!< Maximum time in ms to wait for data when blocking. */
+	uint32_t		writeTimeOut;						/*!< Maximum time in ms to wait for free space when blocking. */
+} SbgInterfacePipeOptions;
+
+//----------------------------------------------------------------------//
+//- Public functions                                                   -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Initialize pipe interface options with default values.
+ *
+ * Pipes are non blocking by default so single threaded simulations are deterministic.
+ *
+ * \param[out]	pOptions						Pipe interface options.
+ */
+SBG_INLINE void sbgInterfacePipeOptionsInit(SbgInterfacePipeOptions *pOptions)
+{
+	assert(pOptions);
+
+	pOptions->capacity		= SBG_INTERFACE_PIPE_DEFAULT_CAPACITY;
+	pOptions->blocking		= false;
+	pOptions->readTimeOut	= 0;
+	pOptions->writeTimeOut	= 0;
+}
+
+/*!
+ * Initialize a loopback pipe interface, data written to it is read back from it.
+ *
+ * \param[in]	pInterface						Pointer on an allocated interface instance to initialize.
+ * \param[in]	pOptions						Pipe options, NULL to use the default ones.
+ * \return										SBG_NO_ERROR if the interface has been created.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfacePipeCreate(SbgInterface *pInterface, const SbgInterfacePipeOptions *pOptions);
+
+/*!
+ * Initialize a pair of connected pipe interfaces.
+ *
+ * Data written to one interface is read from the other one, for example to connect a simulated
+ * device to an sbgECom handle. Both interfaces can be destroyed in any order.
+ *
+ * Without blocking, a write either fits in the ring or fails with SBG_BUFFER_OVERFLOW and writes nothing,
+ * so frames are never split. With blocking, a write waits for free space and fails with SBG_TIME_OUT,
+ * after writing part of the data, if the reader doesn't consume it in time.
+ *
+ * \param[in]	pFirst							Pointer on an allocated interface instance to initialize.
+ * \param[in]	pSecond							Pointer on an allocated interface instance to initialize.
+ * \param[in]	pOptions						Pipe options of both interfaces, NULL to use the default ones.
+ * \return										SBG_NO_ERROR if the interfaces have been created.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfacePipeCreatePair(SbgInterface *pFirst, SbgInterface *pSecond, const SbgInterfacePipeOptions *pOptions);
+
+/*!
+ * Returns the number of bytes that can be read from a pipe interface.
+ *
+ * \param[in]	pInterface						Pointer on a valid pipe interface.
+ * \return										Number of bytes available.
+ */
+SBG_COMMON_LIB_API size_t sbgInterfacePipeGetReadAvailable(SbgInterface *pInterface);
+
+/*!
+ * Returns the number of bytes that can be written to a pipe interface without waiting.
+ *
+ * \param[in]	pInterface						Pointer on a valid pipe interface.
+ * \return										Number of free bytes.
+ */
+SBG_COMMON_LIB_API size_t sbgInterfacePipeGetWriteAvailable(SbgInterface *pInterface);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_INTERFACE_PIPE_H
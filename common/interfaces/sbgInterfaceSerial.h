@@ -43,10 +43,48 @@ extern "C" {
 #include <sbgCommon.h>
 #include <interfaces/sbgInterface.h>
 
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Serial interface options.
+ *
+ * On Linux, baud rates without a standard Bxxx constant, such as 3 Mbps on some adapters,
+ * are configured using termios2 and BOTHER. Options other than the baud rate are ignored on Windows.
+ */
+typedef struct _SbgInterfaceSerialOptions
+{
+	uint32_t	baudRate;									/*!< Baud rate in bps. */
+	bool		lowLatency;									/*!< True to request low latency from the driver (ASYNC_LOW_LATENCY), Linux only. */
+	bool		blockingRead;								/*!< True if reads wait according to vMin and vTime, false if reads return immediately. */
+	uint8_t		vMin;										/*!< Minimum number of bytes returned by a blocking read. */
+	uint8_t		vTime;										/*!< Blocking read timeout in tenths of a second. */
+} SbgInterfaceSerialOptions;
+
 //----------------------------------------------------------------------//
 //- Public methods                                                     -//
 //----------------------------------------------------------------------//
 
+/*!
+ * Initialize serial interface options with default values.
+ *
+ * Reads return immediately and low latency is disabled.
+ *
+ * \param[out]	pOptions						Serial interface options.
+ * \param[in]	baudRate						Serial interface baud rate in bps.
+ */
+SBG_INLINE void sbgInterfaceSerialOptionsInit(SbgInterfaceSerialOptions *pOptions, uint32_t baudRate)
+{
+	assert(pOptions);
+
+	pOptions->baudRate		= baudRate;
+	pOptions->lowLatency	= false;
+	pOptions->blockingRead	= false;
+	pOptions->vMin			= 0;
+	pOptions->vTime			= 1;
+}
+
 /*!
  *	Initialize a serial interface for read and write operations.
  *
@@ -57,6 +95,26 @@ extern "C" {
  */
 SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceSerialCreate(SbgInterface *pInterface, const char *deviceName, uint32_t baudRate);
 
+/*!
+ *	Initialize a serial interface for read and write operations with custom options.
+ *
+ *	\param[in]	pInterface						Pointer on an allocated interface instance to initialize.
+ *	\param[in]	deviceName						Serial interface location (COM21 , /dev/ttys0, depending on platform).
+ *	\param[in]	pOptions						Serial interface options.
+ *	\return										SBG_NO_ERROR if the interface has been created.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceSerialCreateEx(SbgInterface *pInterface, const char *deviceName, const SbgInterfaceSerialOptions *pOptions);
+
+/*!
+ *	Returns the descriptor of a serial interface.
+ *
+ *	The descriptor can be used to wait for data in an event loop, it must not be closed.
+ *
+ *	\param[in]	pInterface						Pointer on a valid serial interface.
+ *	\return										File descriptor on POSIX systems, HANDLE on Windows.
+ */
+SBG_COMMON_LIB_API intptr_t sbgInterfaceSerialGetDesc(SbgInterface *pInterface);
+
 //----------------------------------------------------------------------//
 //- Footer (close extern C block)                                      -//
 //----------------------------------------------------------------------//
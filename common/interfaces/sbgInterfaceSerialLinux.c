@@ -0,0 +1,85 @@
+#ifdef __linux__
+
+// Standard headers
+#include <string.h>
+#include <errno.h>
+#include <sys/ioctl.h>
+#include <asm/termbits.h>
+#include <linux/serial.h>
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <interfaces/sbgInterfaceSerialLinux.h>
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+SbgErrorCode sbgInterfaceSerialLinuxSetBaudRate(int fd, uint32_t baudRate, bool drain)
+{
+	SbgErrorCode		errorCode = SBG_NO_ERROR;
+	struct termios2		options;
+
+	if (ioctl(fd, TCGETS2, &options) != -1)
+	{
+		//
+		// Set both input and output baud rates
+		//
+		options.c_cflag &= ~(CBAUD | (CBAUD << IBSHIFT));
+		options.c_cflag |= BOTHER | (BOTHER << IBSHIFT);
+		options.c_ispeed = baudRate;
+		options.c_ospeed = baudRate;
+
+		if (ioctl(fd, drain ? TCSETSW2 : TCSETS2, &options) != -1)
+		{
+			//
+			// Drivers round the baud rate to the closest one they support
+			//
+			if ((ioctl(fd, TCGETS2, &options) != -1) && (options.c_ospeed != baudRate))
+			{
+				SBG_LOG_WARNING(SBG_INVALID_PARAMETER, "baud rate set to %u bps instead of %" PRIu32 " bps", options.c_ospeed, baudRate);
+			}
+		}
+		else
+		{
+			errorCode = SBG_INVALID_PARAMETER;
+			SBG_LOG_ERROR(errorCode, "unable to set baud rate %" PRIu32 ", error:%s", baudRate, strerror(errno));
+		}
+	}
+	else
+	{
+		errorCode = SBG_ERROR;
+		SBG_LOG_ERROR(errorCode, "unable to get serial port options, error:%s", strerror(errno));
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgInterfaceSerialLinuxSetLowLatency(int fd)
+{
+	SbgErrorCode			errorCode = SBG_NO_ERROR;
+	struct serial_struct	serial;
+
+	if (ioctl(fd, TIOCGSERIAL, &serial) != -1)
+	{
+		serial.flags |= ASYNC_LOW_LATENCY;
+
+		if (ioctl(fd, TIOCSSERIAL, &serial) == -1)
+		{
+			errorCode = SBG_ERROR;
+		}
+	}
+	else
+	{
+		errorCode = SBG_ERROR;
+	}
+
+	if (errorCode != SBG_NO_ERROR)
+	{
+		SBG_LOG_WARNING(errorCode, "low latency not supported by the driver, error:%s", strerror(errno));
+	}
+
+	return errorCode;
+}
+
+#endif // __linux__
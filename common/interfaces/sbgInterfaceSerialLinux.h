@@ -0,0 +1,81 @@
+/*!
+ *      \file           sbgInterfaceSerialLinux.h
+ *      \author         SBG Systems
+ *      \date           19 October 2026
+ *
+ *      \brief          Linux specific serial port settings.
+ *
+ *                      termios2 and the kernel serial structures can't be used in the same
+ *                      translation unit as the C library termios definitions, these settings
+ *                      are thus implemented separately.
+ *
+ *      \section CodeCopyright Copyright Notice
+ *      The MIT license
+ *
+ *      Copyright (C) 2007-2022, SBG Systems SAS. All rights reserved.
+ *
+ *      Permission is hereby granted, free of charge, to any person obtaining a copy
+ *      of this software and associated documentation files (the "Software"), to deal
+ *      in the Software without restriction, including without limitation the rights
+ *      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *      copies of the Software, and to permit persons to whom the Software is
+ *      furnished to do so, subject to the following conditions:
+ *
+ *      The above copyright notice and this permission notice shall be included in all
+ *      copies or substantial portions of the Software.
+ *
+ *      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *      SOFTWARE.
+ */
+
+#ifndef SBG_INTERFACE_SERIAL_LINUX_H
+#define SBG_INTERFACE_SERIAL_LINUX_H
+
+//----------------------------------------------------------------------//
+//- Header (open extern C block)                                       -//
+//----------------------------------------------------------------------//
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+/*!
+ *	Set any baud rate using termios2 and BOTHER.
+ *
+ *	\param[in]	fd								Serial port file descriptor.
+ *	\param[in]	baudRate						Baud rate in bps.
+ *	\param[in]	drain							True to wait until all output data has been written before changing the baud rate.
+ *	\return										SBG_NO_ERROR if the baud rate has been set.
+ */
+SbgErrorCode sbgInterfaceSerialLinuxSetBaudRate(int fd, uint32_t baudRate, bool drain);
+
+/*!
+ *	Request low latency from the serial port driver.
+ *
+ *	With FTDI style USB adapters, this reduces the latency timer so received bytes are
+ *	forwarded immediately instead of every 16 ms.
+ *
+ *	\param[in]	fd								Serial port file descriptor.
+ *	\return										SBG_NO_ERROR if low latency has been enabled.
+ */
+SbgErrorCode sbgInterfaceSerialLinuxSetLowLatency(int fd);
+
+//----------------------------------------------------------------------//
+//- Footer (close extern C block)                                      -//
+//----------------------------------------------------------------------//
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_INTERFACE_SERIAL_LINUX_H
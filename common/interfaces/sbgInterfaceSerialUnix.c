@@ -11,6 +11,10 @@
 #include <sbgCommon.h>
 #include <interfaces/sbgInterfaceSerial.h>
 
+#ifdef __linux__
+#include <interfaces/sbgInterfaceSerialLinux.h>
+#endif
+
 //----------------------------------------------------------------------//
 //- Definitions                                                        -//
 //----------------------------------------------------------------------//
@@ -25,12 +29,18 @@
 /*!
  *	Returns the right unix baud rate const according to a baud rate value.
  *
+ *	On Linux, baud rates are always set using sbgInterfaceSerialLinuxSetBaudRate, as termios doesn't
+ *	reset the input baud rate previously defined with termios2.
+ *
  *	\param[in] baudRate		The baud rate value (ie 115200).
- *	\return					The Unix baud rate constant.
+ *	\param[out] pBaudRateConst	The Unix baud rate constant.
+ *	\return					true if the baud rate has a constant.
  */
-static uint32_t sbgInterfaceSerialGetBaudRateConst(uint32_t baudRate)
+static bool sbgInterfaceSerialGetBaudRateConst(uint32_t baudRate, speed_t *pBaudRateConst)
 {
-	uint32_t baudRateConst;
+	bool	found = true;
+
+	assert(pBaudRateConst);
 
 	//
 	// Create the right baud rate value for unix platforms
@@ -38,86 +48,94 @@ static uint32_t sbgInterfaceSerialGetBaudRateConst(uint32_t baudRate)
 	switch (baudRate)
 	{
 		case 9600:
-			baudRateConst = B9600;
+			*pBaudRateConst = B9600;
 			break;
 		case 19200:
-			baudRateConst = B19200;
+			*pBaudRateConst = B19200;
 			break;
 #ifdef B38400
 		case 38400:
-			baudRateConst = B38400;
+			*pBaudRateConst = B38400;
 			break;
 #endif
 #ifdef B57600
 		case 57600:
-			baudRateConst = B57600;
+			*pBaudRateConst = B57600;
 			break;
 #endif
 #ifdef B115200
 		case 115200:
-			baudRateConst = B115200;
+			*pBaudRateConst = B115200;
 			break;
 #endif
 #ifdef B230400
 		case 230400:
-			baudRateConst = B230400;
+			*pBaudRateConst = B230400;
 			break;
 #endif
 #ifdef B460800
 		case 460800:
-			baudRateConst = B460800;
+			*pBaudRateConst = B460800;
 			break;
 #endif
 #ifdef B921600
 		case 921600:
-			baudRateConst = B921600;
+			*pBaudRateConst = B921600;
 			break;
 #endif
 #ifdef B1000000
 		case 1000000:
-			baudRateConst = B1000000;
+			*pBaudRateConst = B1000000;
 			break;
 #endif
 #ifdef B1152000
 		case 1152000:
-			baudRateConst = B1152000;
+			*pBaudRateConst = B1152000;
 			break;
 #endif
 #ifdef B1500000
 		case 1500000:
-			baudRateConst = B1500000;
+			*pBaudRateConst = B1500000;
 			break;
 #endif
 #ifdef B2000000
 		case 2000000:
-			baudRateConst = B2000000;
+			*pBaudRateConst = B2000000;
 			break;
 #endif
 #ifdef B2500000
 		case 2500000:
-			baudRateConst = B2500000;
+			*pBaudRateConst = B2500000;
 			break;
 #endif
 #ifdef B3000000
 		case 3000000:
-			baudRateConst = B3000000;
+			*pBaudRateConst = B3000000;
 			break;
 #endif
 #ifdef B3500000
 		case 3500000:
-			baudRateConst = B3500000;
+			*pBaudRateConst = B3500000;
 			break;
 #endif
 #ifdef B4000000
 		case 4000000:
-			baudRateConst = B4000000;
+			*pBaudRateConst = B4000000;
 			break;
 #endif
 		default:
-			baudRateConst = baudRate;
+#ifdef __linux__
+			*pBaudRateConst	= B38400;
+			found			= false;
+#else
+			//
+			// Other platforms accept numeric baud rates
+			//
+			*pBaudRateConst = (speed_t)baudRate;
+#endif
 	}
 
-	return baudRateConst;
+	return found;
 }
 
 /*!
@@ -221,8 +239,10 @@ static SbgErrorCode sbgInterfaceSerialFlush(SbgInterface *pInterface, uint32_t f
 static SbgErrorCode sbgInterfaceSerialChangeBaudrate(SbgInterface *pInterface, uint32_t baudRate)
 {
 	int				hSerialHandle;
+#ifndef __linux__
 	struct termios	options;
-	uint32_t		baudRateConst;
+	speed_t			baudRateConst;
+#endif
 
 	assert(pInterface);
 	assert(pInterface->type == SBG_IF_TYPE_SERIAL);
@@ -231,11 +251,17 @@ static SbgErrorCode sbgInterfaceSerialChangeBaudrate(SbgInterface *pInterface, u
 	// Get the internal serial handle
 	//
 	hSerialHandle = *((int*)pInterface->handle);
-		
+
+#ifdef __linux__
+	//
+	// Use termios2 for all baud rates, termios doesn't reset an input baud rate previously defined with termios2
+	//
+	return sbgInterfaceSerialLinuxSetBaudRate(hSerialHandle, baudRate, true);
+#else
 	//
 	// Get the baud rate const for our Unix platform
 	//
-	baudRateConst = sbgInterfaceSerialGetBaudRateConst(baudRate);
+	sbgInterfaceSerialGetBaudRateConst(baudRate, &baudRateConst);
 		
 	//
 	// Retrieve current options
@@ -269,6 +295,7 @@ static SbgErrorCode sbgInterfaceSerialChangeBaudrate(SbgInterface *pInterface, u
 		fprintf(stderr, "sbgInterfaceSerialChangeBaudrate: tcgetattr fails.\n");
 		return SBG_ERROR;
 	}
+#endif
 }
 
 //----------------------------------------------------------------------//
@@ -404,13 +431,23 @@ static SbgErrorCode sbgInterfaceSerialRead(SbgInterface *pInterface, void *pBuff
 //----------------------------------------------------------------------//
 
 SbgErrorCode sbgInterfaceSerialCreate(SbgInterface *pInterface, const char *deviceName, uint32_t baudRate)
+{
+	SbgInterfaceSerialOptions	options;
+
+	sbgInterfaceSerialOptionsInit(&options, baudRate);
+
+	return sbgInterfaceSerialCreateEx(pInterface, deviceName, &options);
+}
+
+SbgErrorCode sbgInterfaceSerialCreateEx(SbgInterface *pInterface, const char *deviceName, const SbgInterfaceSerialOptions *pOptions)
 {
 	int				*pSerialHandle;
 	struct termios	 options;
-	uint32_t		 baudRateConst;
+	speed_t			 baudRateConst;
 
 	assert(pInterface);
 	assert(deviceName);
+	assert(pOptions);
 
 	//
 	// Always call the underlying zero init method to make sure we can correctly handle SbgInterface evolutions
@@ -420,7 +457,7 @@ SbgErrorCode sbgInterfaceSerialCreate(SbgInterface *pInterface, const char *devi
 	//
 	// Get our baud rate const for our Unix platform
 	//
-	baudRateConst = sbgInterfaceSerialGetBaudRateConst(baudRate);
+	sbgInterfaceSerialGetBaudRateConst(pOptions->baudRate, &baudRateConst);
 			
 	//
 	//	Allocate the serial handle
@@ -438,9 +475,9 @@ SbgErrorCode sbgInterfaceSerialCreate(SbgInterface *pInterface, const char *devi
 	if ((*pSerialHandle) != -1)
 	{
 		//
-		// Don't block on read call if no data are available
+		// Don't block on read call if no data are available, unless blocking reads are requested
 		//
-		if (fcntl((*pSerialHandle), F_SETFL, O_NONBLOCK) != -1)
+		if (fcntl((*pSerialHandle), F_SETFL, pOptions->blockingRead ? 0 : O_NONBLOCK) != -1)
 		{
 			//
 			// Retreive current options
@@ -467,10 +504,10 @@ SbgErrorCode sbgInterfaceSerialCreate(SbgInterface *pInterface, const char *devi
 				options.c_oflag &= ~OPOST;
 
 				//
-				// Set our timeout to 0
+				// Define the blocking read conditions, only used with blocking reads
 				//
-				options.c_cc[VMIN]     = 0;
-				options.c_cc[VTIME]    = 1;
+				options.c_cc[VMIN]     = pOptions->vMin;
+				options.c_cc[VTIME]    = pOptions->vTime;
 
 				//
 				// Set both input and output baud
@@ -481,7 +518,33 @@ SbgErrorCode sbgInterfaceSerialCreate(SbgInterface *pInterface, const char *devi
 					// Define options
 					//
 					if (tcsetattr((*pSerialHandle), TCSANOW, &options) != -1)
-					{								
+					{
+#ifdef __linux__
+						//
+						// Baud rates are set using termios2 once other options are defined, to also handle non standard ones
+						//
+						if (sbgInterfaceSerialLinuxSetBaudRate((*pSerialHandle), pOptions->baudRate, false) != SBG_NO_ERROR)
+						{
+							close((*pSerialHandle));
+							SBG_FREE(pSerialHandle);
+
+							return SBG_INVALID_PARAMETER;
+						}
+
+						//
+						// Low latency is only a hint, it is not supported by all drivers
+						//
+						if (pOptions->lowLatency)
+						{
+							sbgInterfaceSerialLinuxSetLowLatency((*pSerialHandle));
+						}
+#else
+						if (pOptions->lowLatency)
+						{
+							SBG_LOG_WARNING(SBG_INVALID_PARAMETER, "low latency is only supported on Linux");
+						}
+#endif
+
 						//
 						// The serial port is ready so create a new serial interface
 						//
@@ -539,3 +602,12 @@ SbgErrorCode sbgInterfaceSerialCreate(SbgInterface *pInterface, const char *devi
 
 	return SBG_ERROR;
 }
+
+intptr_t sbgInterfaceSerialGetDesc(SbgInterface *pInterface)
+{
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_SERIAL);
+	assert(pInterface->handle);
+
+	return *((int *)pInterface->handle);
+}
@@ -508,3 +508,22 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceSerialCreate(SbgInterface *pInterfac
 		return SBG_INVALID_PARAMETER;
 	}
 }
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceSerialCreateEx(SbgInterface *pInterface, const char *deviceName, const SbgInterfaceSerialOptions *pOptions)
+{
+	assert(pOptions);
+
+	//
+	// Windows accepts any baud rate, other options are not supported
+	//
+	return sbgInterfaceSerialCreate(pInterface, deviceName, pOptions->baudRate);
+}
+
+SBG_COMMON_LIB_API intptr_t sbgInterfaceSerialGetDesc(SbgInterface *pInterface)
+{
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_SERIAL);
+	assert(pInterface->handle);
+
+	return (intptr_t)*sbgInterfaceFileGetDesc(pInterface);
+}
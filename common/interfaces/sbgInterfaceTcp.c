@@ -0,0 +1,811 @@
+// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <interfaces/sbgInterfaceTcp.h>
+#include <network/sbgNetwork.h>
+
+// Standard headers
+#ifdef WIN32
+#include <winsock2.h>
+#include <WS2tcpip.h>
+#include <stdint.h>
+
+#define SOCKLEN				int
+#define MSG_NOSIGNAL		(0)
+#else // WIN32
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+
+#define SOCKADDR_IN			struct sockaddr_in
+#define SOCKADDR			struct sockaddr
+#define SOCKET				int
+#define SOCKLEN				socklen_t
+#define INVALID_SOCKET		(~((SOCKET)0))
+#define SOCKET_ERROR		(-1)
+#define NO_ERROR			(0)
+#define SD_BOTH				(2)
+
+#define closesocket			close
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL		(0)
+#endif
+#endif // WIN32
+
+//----------------------------------------------------------------------//
+//- Private definitions                                                -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Maximum number of pending connections of a listener.
+ */
+#define SBG_INTERFACE_TCP_LISTEN_BACKLOG		(4)
+
+/*!
+ * Structure that stores all internal data used by the TCP interface.
+ */
+typedef struct _SbgInterfaceTcp
+{
+	SOCKET 			tcpSocket;					/*!< The connected socket. */
+	sbgIpAddress	remoteAddr;					/*!< IP address of the remote host. */
+	uint32_t		remotePort;					/*!< Port of the remote host. */
+	bool			connected;					/*!< True while the connection is established. */
+	uint32_t		writeTimeOut;				/*!< Write time out in ms. */
+} SbgInterfaceTcp;
+
+//----------------------------------------------------------------------//
+//- Private functions                                                  -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Returns the TCP interface instance.
+ *
+ * \param[in]	pInterface								Interface instance.
+ * \return												The TCP interface instance.
+ */
+static SbgInterfaceTcp *sbgInterfaceTcpGet(SbgInterface *pInterface)
+{
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_ETH_TCP_IP);
+	assert(pInterface->handle);
+
+	return (SbgInterfaceTcp*)pInterface->handle;
+}
+
+/*!
+ * Initialize the socket API.
+ *
+ * \return										SBG_NO_ERROR if the socket API has been correctly initialized.
+ */
+static SbgErrorCode sbgInterfaceTcpInitSockets(void)
+{
+#ifdef WIN32
+	WSADATA wsaData;
+
+	if (WSAStartup(MAKEWORD(2, 2), &wsaData) == NO_ERROR)
+	{
+		return SBG_NO_ERROR;
+	}
+	else
+	{
+		return SBG_ERROR;
+	}
+#else
+	return SBG_NO_ERROR;
+#endif
+}
+
+/*!
+ * Uninitialize the socket API.
+ *
+ * \return										SBG_NO_ERROR if the socket API has been uninitialized.
+ */
+static SbgErrorCode sbgInterfaceTcpCloseSockets(void)
+{
+#ifdef WIN32
+	if (WSACleanup() == NO_ERROR)
+	{
+		return SBG_NO_ERROR;
+	}
+	else
+	{
+		return SBG_ERROR;
+	}
+#else
+	return SBG_NO_ERROR;
+#endif
+}
+
+/*!
+ * Returns true if the last socket operation would have blocked.
+ *
+ * \return										True if the last socket operation would have blocked.
+ */
+static bool sbgInterfaceTcpWouldBlock(void)
+{
+#ifdef WIN32
+	return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+	return (errno == EAGAIN) || (errno == EWOULDBLOCK);
+#endif
+}
+
+/*!
+ * Define if a socket should block or not on receive and send calls.
+ *
+ * \param[in]	tcpSocket						Socket.
+ * \param[in]	blocking						Set to true for a blocking socket or false for a non blocking socket.
+ * \return										SBG_NO_ERROR if the blocking status has been changed.
+ */
+static SbgErrorCode sbgInterfaceTcpSetSocketBlocking(SOCKET tcpSocket, bool blocking)
+{
+#ifdef WIN32
+	u_long blockingMode;
+
+	blockingMode = (blocking ? 0 : 1);
+
+	if (ioctlsocket(tcpSocket, FIONBIO, &blockingMode) == NO_ERROR)
+	{
+		return SBG_NO_ERROR;
+	}
+	else
+	{
+		return SBG_ERROR;
+	}
+#else // WIN32
+	int32_t flags;
+
+	flags = fcntl(tcpSocket, F_GETFL, 0);
+
+	if (flags >= 0)
+	{
+		flags = (blocking ? (flags & ~O_NONBLOCK) : (flags | O_NONBLOCK));
+
+		if (fcntl(tcpSocket, F_SETFL, flags) == 0)
+		{
+			return SBG_NO_ERROR;
+		}
+	}
+
+	return SBG_ERROR;
+#endif // WIN32
+}
+
+/*!
+ * Wait until a socket is ready.
+ *
+ * \param[in]	tcpSocket						Socket.
+ * \param[in]	write							True to wait until the socket is writable, false until it is readable.
+ * \param[in]	timeOut							Time out in ms.
+ * \return										SBG_NO_ERROR if the socket is ready, SBG_TIME_OUT if the time out has elapsed.
+ */
+static SbgErrorCode sbgInterfaceTcpWait(SOCKET tcpSocket, bool write, uint32_t timeOut)
+{
+	SbgErrorCode		errorCode;
+	int					ret;
+
+#ifdef WIN32
+	fd_set				fdSet;
+	fd_set				errorFdSet;
+	struct timeval		timeValue;
+
+	FD_ZERO(&fdSet);
+	FD_ZERO(&errorFdSet);
+	FD_SET(tcpSocket, &fdSet);
+	FD_SET(tcpSocket, &errorFdSet);
+
+	timeValue.tv_sec	= timeOut / 1000;
+	timeValue.tv_usec	= (timeOut % 1000) * 1000;
+
+	//
+	// Failed connections are reported in the exception set
+	//
+	ret = select(0, write ? NULL : &fdSet, write ? &fdSet : NULL, &errorFdSet, &timeValue);
+#else
+	struct pollfd		pollFd;
+
+	pollFd.fd		= tcpSocket;
+	pollFd.events	= write ? POLLOUT : POLLIN;
+	pollFd.revents	= 0;
+
+	ret = poll(&pollFd, 1, (int)sbgMin(timeOut, INT32_MAX));
+#endif // WIN32
+
+	if (ret > 0)
+	{
+		errorCode = SBG_NO_ERROR;
+	}
+	else if (ret == 0)
+	{
+		errorCode = SBG_TIME_OUT;
+	}
+	else
+	{
+		errorCode = SBG_ERROR;
+		SBG_LOG_ERROR(errorCode, "unable to wait for socket");
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Apply options to a socket.
+ *
+ * \param[in]	tcpSocket						Socket.
+ * \param[in]	pOptions						TCP interface options.
+ * \param[in]	buffers							True to set the buffer sizes, they must be set before connecting or listening.
+ * \return										SBG_NO_ERROR if the options have been applied.
+ */
+static SbgErrorCode sbgInterfaceTcpApplyOptions(SOCKET tcpSocket, const SbgInterfaceTcpOptions *pOptions, bool buffers)
+{
+	SbgErrorCode		errorCode = SBG_NO_ERROR;
+	int					optValue;
+
+	assert(pOptions);
+
+	optValue = pOptions->noDelay;
+
+	if (setsockopt(tcpSocket, IPPROTO_TCP, TCP_NODELAY, (const char *)&optValue, sizeof(optValue)) != NO_ERROR)
+	{
+		errorCode = SBG_ERROR;
+		SBG_LOG_ERROR(errorCode, "unable to set TCP_NODELAY");
+	}
+
+	if (buffers && (pOptions->sendBufferSize != 0))
+	{
+		optValue = (int)sbgMin(pOptions->sendBufferSize, INT32_MAX);
+
+		if (setsockopt(tcpSocket, SOL_SOCKET, SO_SNDBUF, (const char *)&optValue, sizeof(optValue)) != NO_ERROR)
+		{
+			errorCode = SBG_ERROR;
+			SBG_LOG_ERROR(errorCode, "unable to set send buffer size");
+		}
+	}
+
+	if (buffers && (pOptions->receiveBufferSize != 0))
+	{
+		optValue = (int)sbgMin(pOptions->receiveBufferSize, INT32_MAX);
+
+		if (setsockopt(tcpSocket, SOL_SOCKET, SO_RCVBUF, (const char *)&optValue, sizeof(optValue)) != NO_ERROR)
+		{
+			errorCode = SBG_ERROR;
+			SBG_LOG_ERROR(errorCode, "unable to set receive buffer size");
+		}
+	}
+
+#ifdef SO_NOSIGPIPE
+	//
+	// Platforms without MSG_NOSIGNAL
+	//
+	optValue = 1;
+	setsockopt(tcpSocket, SOL_SOCKET, SO_NOSIGPIPE, (const char *)&optValue, sizeof(optValue));
+#endif // SO_NOSIGPIPE
+
+	return errorCode;
+}
+
+/*!
+ * Destroy an interface initialized using sbgInterfaceTcpCreate or sbgInterfaceTcpListenerAccept.
+ *
+ * \param[in]	pInterface						Pointer on a valid TCP interface.
+ * \return										SBG_NO_ERROR if the interface has been closed and released.
+ */
+static SbgErrorCode sbgInterfaceTcpDestroy(SbgInterface *pInterface)
+{
+	SbgInterfaceTcp		*pTcpHandle;
+
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_ETH_TCP_IP);
+
+	pTcpHandle = sbgInterfaceTcpGet(pInterface);
+
+	shutdown(pTcpHandle->tcpSocket, SD_BOTH);
+	closesocket(pTcpHandle->tcpSocket);
+
+	free(pTcpHandle);
+
+	sbgInterfaceZeroInit(pInterface);
+
+	return sbgInterfaceTcpCloseSockets();
+}
+
+/*!
+ * Mark the connection of a TCP interface as lost.
+ *
+ * \param[in]	pTcpHandle								TCP interface.
+ * \param[in]	errorCode								Error code to log.
+ * \param[in]	pMessage								Reason of the connection loss.
+ */
+static void sbgInterfaceTcpSetDisconnected(SbgInterfaceTcp *pTcpHandle, SbgErrorCode errorCode, const char *pMessage)
+{
+	assert(pTcpHandle);
+	assert(pMessage);
+
+	if (pTcpHandle->connected)
+	{
+		SBG_LOG_ERROR(errorCode, "%s", pMessage);
+		pTcpHandle->connected = false;
+	}
+}
+
+/*!
+ * Try to write some data to an interface.
+ *
+ * \param[in]	pHandle									Valid handle on an initialized interface.
+ * \param[in]	pBuffer									Pointer on an allocated buffer that contains the data to write
+ * \param[in]	bytesToWrite							Number of bytes we would like to write.
+ * \return												SBG_NO_ERROR if all bytes have been written successfully,
+ *														SBG_TIME_OUT if the remote host hasn't read any data during the write time out.
+ */
+static SbgErrorCode sbgInterfaceTcpWrite(SbgInterface *pInterface, const void *pBuffer, size_t bytesToWrite)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+	SbgInterfaceTcp			*pTcpHandle;
+
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_ETH_TCP_IP);
+	assert(pBuffer);
+
+	pTcpHandle = sbgInterfaceTcpGet(pInterface);
+
+	while ((errorCode == SBG_NO_ERROR) && (bytesToWrite != 0))
+	{
+		int					 nrBytesSent;
+
+		nrBytesSent = send(pTcpHandle->tcpSocket, pBuffer, (int)sbgMin(bytesToWrite, INT32_MAX), MSG_NOSIGNAL);
+
+		if (nrBytesSent > 0)
+		{
+			bytesToWrite -= (size_t)nrBytesSent;
+			pBuffer = (const uint8_t *)pBuffer + nrBytesSent;
+		}
+		else if ((nrBytesSent == SOCKET_ERROR) && sbgInterfaceTcpWouldBlock())
+		{
+			//
+			// The send buffer is full, wait until the remote host reads some data
+			//
+			errorCode = sbgInterfaceTcpWait(pTcpHandle->tcpSocket, true, pTcpHandle->writeTimeOut);
+
+			if (errorCode == SBG_TIME_OUT)
+			{
+				SBG_LOG_ERROR(errorCode, "remote host doesn't read data, %zu bytes not sent", bytesToWrite);
+			}
+		}
+		else
+		{
+			errorCode = SBG_WRITE_ERROR;
+			sbgInterfaceTcpSetDisconnected(pTcpHandle, errorCode, "connection lost");
+		}
+	}
+
+	if ((errorCode != SBG_NO_ERROR) && (errorCode != SBG_TIME_OUT))
+	{
+		errorCode = SBG_WRITE_ERROR;
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Try to read some data from an interface.
+ *
+ * \param[in]	pHandle									Valid handle on an initialized interface.
+ * \param[in]	pBuffer									Pointer on an allocated buffer that can hold at least bytesToRead bytes of data.
+ * \param[out]	pReadBytes								Pointer on an uint32_t used to return the number of read bytes.
+ * \param[in]	bytesToRead								Number of bytes we would like to read.
+ * \return												SBG_NO_ERROR if no error occurs, please check the number of received bytes.
+ */
+static SbgErrorCode sbgInterfaceTcpRead(SbgInterface *pInterface, void *pBuffer, size_t *pReadBytes, size_t bytesToRead)
+{
+	SbgErrorCode			 errorCode;
+	SbgInterfaceTcp			*pTcpHandle;
+	int						 ret;
+
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_ETH_TCP_IP);
+	assert(pBuffer);
+	assert(pReadBytes);
+
+	pTcpHandle = sbgInterfaceTcpGet(pInterface);
+
+	ret = recv(pTcpHandle->tcpSocket, pBuffer, (int)sbgMin(bytesToRead, INT32_MAX), 0);
+
+	if (ret > 0)
+	{
+		errorCode = SBG_NO_ERROR;
+	}
+	else if (ret == 0)
+	{
+		errorCode = SBG_READ_ERROR;
+		sbgInterfaceTcpSetDisconnected(pTcpHandle, errorCode, "connection closed by the remote host");
+	}
+	else if (sbgInterfaceTcpWouldBlock())
+	{
+		errorCode = SBG_NO_ERROR;
+		ret = 0;
+	}
+	else
+	{
+		errorCode = SBG_READ_ERROR;
+		sbgInterfaceTcpSetDisconnected(pTcpHandle, errorCode, "connection lost");
+	}
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		*pReadBytes = (size_t)ret;
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Initialize an interface with a connected socket.
+ *
+ * \param[in]	pInterface						Pointer on an allocated interface instance to initialize.
+ * \param[in]	tcpSocket						Connected socket, closed if the interface can't be created.
+ * \param[in]	remoteAddr						IP address of the remote host.
+ * \param[in]	remotePort						Port of the remote host.
+ * \param[in]	writeTimeOut					Write time out in ms.
+ * \return										SBG_NO_ERROR if the interface has been created.
+ */
+static SbgErrorCode sbgInterfaceTcpCreateFromSocket(SbgInterface *pInterface, SOCKET tcpSocket, sbgIpAddress remoteAddr, uint32_t remotePort, uint32_t writeTimeOut)
+{
+	SbgErrorCode		 errorCode = SBG_NO_ERROR;
+	SbgInterfaceTcp		*pNewTcpHandle;
+
+	assert(pInterface);
+
+	pNewTcpHandle = malloc(sizeof(*pNewTcpHandle));
+
+	if (pNewTcpHandle)
+	{
+		char	interfaceName[48];
+		char	ipStr[16];
+
+		pNewTcpHandle->tcpSocket	= tcpSocket;
+		pNewTcpHandle->remoteAddr	= remoteAddr;
+		pNewTcpHandle->remotePort	= remotePort;
+		pNewTcpHandle->connected	= true;
+		pNewTcpHandle->writeTimeOut	= writeTimeOut;
+
+		pInterface->handle			= pNewTcpHandle;
+		pInterface->type			= SBG_IF_TYPE_ETH_TCP_IP;
+
+		//
+		// Define the interface name
+		//
+		sbgNetworkIpToString(remoteAddr, ipStr, sizeof(ipStr));
+		sprintf(interfaceName, "TCP: %s:%u", ipStr, remotePort);
+		sbgInterfaceNameSet(pInterface, interfaceName);
+
+		//
+		// Define all overloaded members
+		//
+		pInterface->pDestroyFunc	= sbgInterfaceTcpDestroy;
+		pInterface->pReadFunc		= sbgInterfaceTcpRead;
+		pInterface->pWriteFunc		= sbgInterfaceTcpWrite;
+	}
+	else
+	{
+		errorCode = SBG_MALLOC_FAILED;
+		SBG_LOG_ERROR(errorCode, "unable to allocate handle");
+
+		shutdown(tcpSocket, SD_BOTH);
+		closesocket(tcpSocket);
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Wait for a non blocking connection to complete.
+ *
+ * \param[in]	tcpSocket						Connecting socket.
+ * \param[in]	timeOut							Connection time out in ms.
+ * \return										SBG_NO_ERROR if the connection is established, SBG_TIME_OUT if it has timed out.
+ */
+static SbgErrorCode sbgInterfaceTcpWaitConnected(SOCKET tcpSocket, uint32_t timeOut)
+{
+	SbgErrorCode		errorCode;
+	int					socketError;
+	SOCKLEN				optLength;
+
+	errorCode = sbgInterfaceTcpWait(tcpSocket, true, timeOut);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		//
+		// The socket is also writable if the connection has failed
+		//
+		optLength = sizeof(socketError);
+
+		if (getsockopt(tcpSocket, SOL_SOCKET, SO_ERROR, (char *)&socketError, &optLength) != NO_ERROR)
+		{
+			errorCode = SBG_ERROR;
+			SBG_LOG_ERROR(errorCode, "unable to get socket error: %s", strerror(errno));
+		}
+		else if (socketError != 0)
+		{
+			errorCode = SBG_ERROR;
+			SBG_LOG_ERROR(errorCode, "unable to connect: %s", strerror(socketError));
+		}
+	}
+	else if (errorCode == SBG_TIME_OUT)
+	{
+		SBG_LOG_ERROR(errorCode, "connection timed out");
+	}
+
+	return errorCode;
+}
+
+//----------------------------------------------------------------------//
+//- Public functions                                                   -//
+//----------------------------------------------------------------------//
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceTcpCreate(SbgInterface *pInterface, sbgIpAddress remoteAddr, uint32_t remotePort, const SbgInterfaceTcpOptions *pOptions)
+{
+	SbgErrorCode				 errorCode;
+	SbgInterfaceTcpOptions		 defaultOptions;
+	SOCKET						 tcpSocket;
+
+	assert(pInterface);
+
+	//
+	// Always call the underlying zero init method to make sure we can correctly handle SbgInterface evolutions
+	//
+	sbgInterfaceZeroInit(pInterface);
+
+	if (!pOptions)
+	{
+		sbgInterfaceTcpOptionsInit(&defaultOptions);
+		pOptions = &defaultOptions;
+	}
+
+	errorCode = sbgInterfaceTcpInitSockets();
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		tcpSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+
+		if (tcpSocket != INVALID_SOCKET)
+		{
+			errorCode = sbgInterfaceTcpApplyOptions(tcpSocket, pOptions, true);
+
+			if (errorCode == SBG_NO_ERROR)
+			{
+				errorCode = sbgInterfaceTcpSetSocketBlocking(tcpSocket, false);
+
+				if (errorCode != SBG_NO_ERROR)
+				{
+					SBG_LOG_ERROR(errorCode, "unable to set non-blocking mode");
+				}
+			}
+
+			if (errorCode == SBG_NO_ERROR)
+			{
+				SOCKADDR_IN		 connectAddress;
+
+				connectAddress.sin_family		= AF_INET;
+				connectAddress.sin_addr.s_addr	= remoteAddr;
+				connectAddress.sin_port			= htons((uint16_t)remotePort);
+
+				if (connect(tcpSocket, (SOCKADDR *)&connectAddress, sizeof(connectAddress)) != SOCKET_ERROR)
+				{
+					errorCode = SBG_NO_ERROR;
+				}
+#ifdef WIN32
+				else if (WSAGetLastError() == WSAEWOULDBLOCK)
+#else
+				else if (errno == EINPROGRESS)
+#endif // WIN32
+				{
+					errorCode = sbgInterfaceTcpWaitConnected(tcpSocket, pOptions->connectTimeOut);
+				}
+				else
+				{
+					errorCode = SBG_ERROR;
+					SBG_LOG_ERROR(errorCode, "unable to connect: %s", strerror(errno));
+				}
+			}
+
+			if (errorCode == SBG_NO_ERROR)
+			{
+				return sbgInterfaceTcpCreateFromSocket(pInterface, tcpSocket, remoteAddr, remotePort, pOptions->writeTimeOut);
+			}
+
+			shutdown(tcpSocket, SD_BOTH);
+			closesocket(tcpSocket);
+		}
+		else
+		{
+			errorCode = SBG_ERROR;
+			SBG_LOG_ERROR(errorCode, "unable to create socket");
+		}
+
+		sbgInterfaceTcpCloseSockets();
+	}
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API intptr_t sbgInterfaceTcpGetDesc(SbgInterface *pInterface)
+{
+	assert(pInterface);
+
+	return (intptr_t)sbgInterfaceTcpGet(pInterface)->tcpSocket;
+}
+
+SBG_COMMON_LIB_API bool sbgInterfaceTcpIsConnected(SbgInterface *pInterface)
+{
+	assert(pInterface);
+
+	return sbgInterfaceTcpGet(pInterface)->connected;
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceTcpListenerOpen(SbgInterfaceTcpListener *pListener, uint32_t localPort, const SbgInterfaceTcpOptions *pOptions)
+{
+	SbgErrorCode			 errorCode;
+	SOCKET					 listenSocket;
+
+	assert(pListener);
+
+	pListener->socket		= SBG_INTERFACE_TCP_INVALID_DESC;
+	pListener->localPort	= localPort;
+
+	if (pOptions)
+	{
+		pListener->options = *pOptions;
+	}
+	else
+	{
+		sbgInterfaceTcpOptionsInit(&pListener->options);
+	}
+
+	errorCode = sbgInterfaceTcpInitSockets();
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+
+		if (listenSocket != INVALID_SOCKET)
+		{
+			SOCKADDR_IN		 bindAddress;
+			int				 optValue;
+
+			//
+			// Allow a gateway to restart immediately while previous connections are in TIME_WAIT
+			//
+			optValue = 1;
+			setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, (const char *)&optValue, sizeof(optValue));
+
+			//
+			// Accepted connections inherit the buffer sizes
+			//
+			errorCode = sbgInterfaceTcpApplyOptions(listenSocket, &pListener->options, true);
+
+			if (errorCode == SBG_NO_ERROR)
+			{
+				errorCode = sbgInterfaceTcpSetSocketBlocking(listenSocket, false);
+			}
+
+			if (errorCode == SBG_NO_ERROR)
+			{
+				bindAddress.sin_family			= AF_INET;
+				bindAddress.sin_addr.s_addr		= INADDR_ANY;
+				bindAddress.sin_port			= htons((uint16_t)localPort);
+
+				if ((bind(listenSocket, (SOCKADDR *)&bindAddress, sizeof(bindAddress)) != SOCKET_ERROR) &&
+					(listen(listenSocket, SBG_INTERFACE_TCP_LISTEN_BACKLOG) != SOCKET_ERROR))
+				{
+					pListener->socket = (intptr_t)listenSocket;
+
+					return SBG_NO_ERROR;
+				}
+				else
+				{
+					errorCode = SBG_ERROR;
+					SBG_LOG_ERROR(errorCode, "unable to listen on port %" PRIu32, localPort);
+				}
+			}
+
+			closesocket(listenSocket);
+		}
+		else
+		{
+			errorCode = SBG_ERROR;
+			SBG_LOG_ERROR(errorCode, "unable to create socket");
+		}
+
+		sbgInterfaceTcpCloseSockets();
+	}
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API void sbgInterfaceTcpListenerClose(SbgInterfaceTcpListener *pListener)
+{
+	assert(pListener);
+
+	if (pListener->socket != SBG_INTERFACE_TCP_INVALID_DESC)
+	{
+		closesocket((SOCKET)pListener->socket);
+		sbgInterfaceTcpCloseSockets();
+
+		pListener->socket = SBG_INTERFACE_TCP_INVALID_DESC;
+	}
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceTcpListenerAccept(SbgInterfaceTcpListener *pListener, SbgInterface *pInterface, uint32_t timeOut)
+{
+	SbgErrorCode			 errorCode;
+	SOCKET					 tcpSocket;
+	SOCKADDR_IN				 remoteAddr;
+	SOCKLEN					 remoteAddrLen;
+
+	assert(pListener);
+	assert(pListener->socket != SBG_INTERFACE_TCP_INVALID_DESC);
+	assert(pInterface);
+
+	sbgInterfaceZeroInit(pInterface);
+
+	errorCode = sbgInterfaceTcpWait((SOCKET)pListener->socket, false, timeOut);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		remoteAddrLen	= sizeof(remoteAddr);
+		tcpSocket		= accept((SOCKET)pListener->socket, (SOCKADDR *)&remoteAddr, &remoteAddrLen);
+
+		if (tcpSocket != INVALID_SOCKET)
+		{
+			//
+			// Each interface holds a reference on the socket API
+			//
+			errorCode = sbgInterfaceTcpInitSockets();
+
+			if (errorCode == SBG_NO_ERROR)
+			{
+				sbgInterfaceTcpApplyOptions(tcpSocket, &pListener->options, false);
+
+				errorCode = sbgInterfaceTcpSetSocketBlocking(tcpSocket, false);
+
+				if (errorCode == SBG_NO_ERROR)
+				{
+					errorCode = sbgInterfaceTcpCreateFromSocket(pInterface, tcpSocket, remoteAddr.sin_addr.s_addr, ntohs(remoteAddr.sin_port), pListener->options.writeTimeOut);
+				}
+				else
+				{
+					SBG_LOG_ERROR(errorCode, "unable to set non-blocking mode");
+					closesocket(tcpSocket);
+				}
+
+				if (errorCode != SBG_NO_ERROR)
+				{
+					sbgInterfaceTcpCloseSockets();
+				}
+			}
+			else
+			{
+				closesocket(tcpSocket);
+			}
+		}
+		else if (sbgInterfaceTcpWouldBlock())
+		{
+			//
+			// The pending connection has been aborted meanwhile
+			//
+			errorCode = SBG_TIME_OUT;
+		}
+		else
+		{
+			errorCode = SBG_ERROR;
+			SBG_LOG_ERROR(errorCode, "unable to accept connection");
+		}
+	}
+
+	return errorCode;
+}
@@ -0,0 +1,199 @@
+/*!
+ *      \file           sbgInterfaceTcp.h
+ *      \author         SBG Systems
+ *      \date           19 October 2026
+ *
+ *      \brief          This file implements a TCP/IP interface.
+ *
+ *                      A TCP interface is either a client connected to a device, or a connection
+ *                      accepted by a listener so a gateway can serve a stream to local tools.
+ *
+ *      \section CodeCopyright Copyright Notice
+ *      The MIT license
+ *
+ *      Copyright (C) 2007-2022, SBG Systems SAS. All rights reserved.
+ *
+ *      Permission is hereby granted, free of charge, to any person obtaining a copy
+ *      of this software and associated documentation files (the "Software"), to deal
+ *      in the Software without restriction, including without limitation the rights
+ *      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *      copies of the Software, and to permit persons to whom the Software is
+ *      furnished to do so, subject to the following conditions:
+ *
+ *      The above copyright notice and this permission notice shall be included in all
+ *      copies or substantial portions of the Software.
+ *
+ *      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *      SOFTWARE.
+ */
+
+#ifndef SBG_INTERFACE_TCP_H
+#define SBG_INTERFACE_TCP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <interfaces/sbgInterface.h>
+
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Default connection time out in ms.
+ */
+#define SBG_INTERFACE_TCP_DEFAULT_CONNECT_TIME_OUT	(5000)
+
+/*!
+ * Default write time out in ms.
+ */
+#define SBG_INTERFACE_TCP_DEFAULT_WRITE_TIME_OUT	(5000)
+
+/*!
+ * Invalid socket descriptor.
+ */
+#define SBG_INTERFACE_TCP_INVALID_DESC				(-1)
+
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * TCP interface options.
+ */
+typedef struct _SbgInterfaceTcpOptions
+{
+	bool			noDelay;							/*!< True to send small writes immediately (TCP_NODELAY). */
+	size_t			sendBufferSize;						/*!< Socket send buffer size in bytes, 0 to use the system default. */
+	size_t			receiveBufferSize;					/*!< Socket receive buffer size in bytes, 0 to use the system default. */
+	uint32_t		connectTimeOut;						/*!< Connection time out in ms. */
+	uint32_t		writeTimeOut;						/*!< Time out in ms while the send buffer is full and the remote host doesn't read any data. */
+} SbgInterfaceTcpOptions;
+
+/*!
+ * TCP listener, accepting connections on a local port.
+ */
+typedef struct _SbgInterfaceTcpListener
+{
+	intptr_t					socket;					/*!< Listening socket. */
+	uint32_t					localPort;				/*!< Port on which the listener accepts connections. */
+	SbgInterfaceTcpOptions		options;				/*!< Options of the accepted connections. */
+} SbgInterfaceTcpListener;
+
+//----------------------------------------------------------------------//
+//- Public functions                                                   -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Initialize TCP interface options with default values.
+ *
+ * TCP_NODELAY is enabled, buffers use the system default sizes and writes time out
+ * after SBG_INTERFACE_TCP_DEFAULT_WRITE_TIME_OUT ms without progress.
+ *
+ * \param[out]	pOptions						TCP interface options.
+ */
+SBG_INLINE void sbgInterfaceTcpOptionsInit(SbgInterfaceTcpOptions *pOptions)
+{
+	assert(pOptions);
+
+	pOptions->noDelay			= true;
+	pOptions->sendBufferSize	= 0;
+	pOptions->receiveBufferSize	= 0;
+	pOptions->connectTimeOut	= SBG_INTERFACE_TCP_DEFAULT_CONNECT_TIME_OUT;
+	pOptions->writeTimeOut		= SBG_INTERFACE_TCP_DEFAULT_WRITE_TIME_OUT;
+}
+
+/*!
+ * Initialize a TCP interface connected to a remote host.
+ *
+ * The connection is established before returning, the interface is then non blocking.
+ *
+ * A write waits while the send buffer is full, it fails with SBG_TIME_OUT if the remote host
+ * doesn't read any data during the write time out. Part of the data may then have been sent,
+ * the connection is kept and the remote host must resynchronize on the next frame.
+ *
+ * \param[in]	pInterface						Pointer on an allocated interface instance to initialize.
+ * \param[in]	remoteAddr						IP address to connect to.
+ * \param[in]	remotePort						Port to connect to.
+ * \param[in]	pOptions						TCP interface options, NULL to use default options.
+ * \return										SBG_NO_ERROR if the interface has been created, SBG_TIME_OUT if the connection has timed out.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceTcpCreate(SbgInterface *pInterface, sbgIpAddress remoteAddr, uint32_t remotePort, const SbgInterfaceTcpOptions *pOptions);
+
+/*!
+ * Returns the socket descriptor of a TCP interface.
+ *
+ * The descriptor can be used to wait for incoming data in an event loop, it must not be closed.
+ *
+ * \param[in]	pInterface						Pointer on a valid TCP interface.
+ * \return										Socket descriptor.
+ */
+SBG_COMMON_LIB_API intptr_t sbgInterfaceTcpGetDesc(SbgInterface *pInterface);
+
+/*!
+ * Returns true if the connection of a TCP interface is established.
+ *
+ * A connection is considered as lost once the remote host has closed it or an error has occurred.
+ *
+ * \param[in]	pInterface						Pointer on a valid TCP interface.
+ * \return										True if the connection is established.
+ */
+SBG_COMMON_LIB_API bool sbgInterfaceTcpIsConnected(SbgInterface *pInterface);
+
+/*!
+ * Open a TCP listener.
+ *
+ * \param[out]	pListener						TCP listener.
+ * \param[in]	localPort						Port on which connections are accepted.
+ * \param[in]	pOptions						Options of the accepted connections, NULL to use default options.
+ * \return										SBG_NO_ERROR if the listener has been opened.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceTcpListenerOpen(SbgInterfaceTcpListener *pListener, uint32_t localPort, const SbgInterfaceTcpOptions *pOptions);
+
+/*!
+ * Close a TCP listener.
+ *
+ * Accepted connections are not closed.
+ *
+ * \param[in]	pListener						TCP listener.
+ */
+SBG_COMMON_LIB_API void sbgInterfaceTcpListenerClose(SbgInterfaceTcpListener *pListener);
+
+/*!
+ * Accept a connection.
+ *
+ * \param[in]	pListener						TCP listener.
+ * \param[in]	pInterface						Pointer on an allocated interface instance to initialize with the accepted connection.
+ * \param[in]	timeOut							Time to wait for a connection in ms, 0 to return immediately.
+ * \return										SBG_NO_ERROR if a connection has been accepted, SBG_TIME_OUT if no connection is pending.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceTcpListenerAccept(SbgInterfaceTcpListener *pListener, SbgInterface *pInterface, uint32_t timeOut);
+
+/*!
+ * Returns the socket descriptor of a TCP listener.
+ *
+ * The descriptor becomes readable when a connection is pending, it must not be closed.
+ *
+ * \param[in]	pListener						TCP listener.
+ * \return										Socket descriptor.
+ */
+SBG_INLINE intptr_t sbgInterfaceTcpListenerGetDesc(const SbgInterfaceTcpListener *pListener)
+{
+	assert(pListener);
+
+	return pListener->socket;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_INTERFACE_TCP_H
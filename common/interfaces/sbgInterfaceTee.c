@@ -0,0 +1,550 @@
+// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <interfaces/sbgInterfaceTee.h>
+
+// Standard headers
+#if defined(__unix__) || defined(__APPLE__)
+	#include <pthread.h>
+	#include <sys/time.h>
+	#define SBG_INTERFACE_TEE_USE_THREADS
+#endif
+
+//----------------------------------------------------------------------//
+//- Private definitions                                                -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Structure that stores all internal data used by the tee interface.
+ *
+ * The staging ring indexes increase monotonically, the reader only moves the head
+ * and the writer thread only moves the tail.
+ */
+typedef struct _SbgInterfaceTee
+{
+	SbgInterface			*pSource;								/*!< Interface to read from. */
+	SbgInterface			*pSinks[SBG_INTERFACE_TEE_MAX_SINKS];	/*!< Sinks receiving the read data. */
+	size_t					 nrSinks;								/*!< Number of sinks. */
+	SbgInterfaceTeeStats	 stats;									/*!< Statistics. */
+
+#ifdef SBG_INTERFACE_TEE_USE_THREADS
+	uint8_t					*pBuffer;								/*!< Staging ring. */
+	size_t					 bufferSize;							/*!< Staging ring size in bytes. */
+	size_t					 head;									/*!< Index of the next byte to queue. */
+	size_t					 tail;									/*!< Index of the next byte to write to the sinks. */
+	bool					 stop;									/*!< True to stop the writer thread once the ring is empty. */
+
+	pthread_t				 thread;								/*!< Writer thread. */
+	pthread_mutex_t			 mutex;									/*!< Mutex protecting the ring indexes, the sinks and the statistics. */
+	pthread_cond_t			 cond;									/*!< Condition signaled when data is queued or written. */
+#endif // SBG_INTERFACE_TEE_USE_THREADS
+} SbgInterfaceTee;
+
+//----------------------------------------------------------------------//
+//- Private functions                                                  -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Returns the tee interface instance.
+ *
+ * \param[in]	pInterface								Interface instance.
+ * \return												The tee interface instance.
+ */
+static SbgInterfaceTee *sbgInterfaceTeeGet(SbgInterface *pInterface)
+{
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_TEE);
+	assert(pInterface->handle);
+
+	return (SbgInterfaceTee*)pInterface->handle;
+}
+
+/*!
+ * Returns the tee interface instance.
+ *
+ * \param[in]	pInterface								Interface instance.
+ * \return												The tee interface instance.
+ */
+static const SbgInterfaceTee *sbgInterfaceTeeGetConst(const SbgInterface *pInterface)
+{
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_TEE);
+	assert(pInterface->handle);
+
+	return (const SbgInterfaceTee*)pInterface->handle;
+}
+
+/*!
+ * Write a buffer to all sinks.
+ *
+ * \param[in]	pSinks									Sinks.
+ * \param[in]	nrSinks									Number of sinks.
+ * \param[in]	pBuffer									Data to write.
+ * \param[in]	size									Number of bytes to write.
+ * \return												Number of failed writes.
+ */
+static uint64_t sbgInterfaceTeeWriteSinks(SbgInterface * const *pSinks, size_t nrSinks, const uint8_t *pBuffer, size_t size)
+{
+	uint64_t				 nrWriteErrors = 0;
+
+	assert(pSinks || (nrSinks == 0));
+	assert(pBuffer);
+
+	for (size_t i = 0; i < nrSinks; i++)
+	{
+		if (sbgInterfaceWrite(pSinks[i], pBuffer, size) != SBG_NO_ERROR)
+		{
+			nrWriteErrors++;
+		}
+	}
+
+	return nrWriteErrors;
+}
+
+#ifdef SBG_INTERFACE_TEE_USE_THREADS
+/*!
+ * Writer thread, writes queued data to the sinks until stopped.
+ *
+ * Contiguous parts of the staging ring are written to the sinks without holding the mutex.
+ *
+ * \param[in]	pArg									Tee interface instance.
+ * \return												NULL.
+ */
+static void *sbgInterfaceTeeWriter(void *pArg)
+{
+	SbgInterfaceTee			*pTeeHandle = pArg;
+
+	assert(pTeeHandle);
+
+	pthread_mutex_lock(&pTeeHandle->mutex);
+
+	for (;;)
+	{
+		SbgInterface		*pSinks[SBG_INTERFACE_TEE_MAX_SINKS];
+		size_t				 nrSinks;
+		size_t				 offset;
+		size_t				 size;
+		uint64_t			 nrWriteErrors;
+
+		while ((pTeeHandle->head == pTeeHandle->tail) && !pTeeHandle->stop)
+		{
+			pthread_cond_wait(&pTeeHandle->cond, &pTeeHandle->mutex);
+		}
+
+		if (pTeeHandle->head == pTeeHandle->tail)
+		{
+			break;
+		}
+
+		offset	= pTeeHandle->tail % pTeeHandle->bufferSize;
+		size	= sbgMin(pTeeHandle->head - pTeeHandle->tail, pTeeHandle->bufferSize - offset);
+		nrSinks	= pTeeHandle->nrSinks;
+		memcpy(pSinks, pTeeHandle->pSinks, nrSinks * sizeof(*pSinks));
+
+		pthread_mutex_unlock(&pTeeHandle->mutex);
+
+		nrWriteErrors = sbgInterfaceTeeWriteSinks(pSinks, nrSinks, &pTeeHandle->pBuffer[offset], size);
+
+		pthread_mutex_lock(&pTeeHandle->mutex);
+
+		pTeeHandle->tail				+= size;
+		pTeeHandle->stats.nrWriteErrors	+= nrWriteErrors;
+
+		pthread_cond_broadcast(&pTeeHandle->cond);
+	}
+
+	pthread_mutex_unlock(&pTeeHandle->mutex);
+
+	return NULL;
+}
+
+/*!
+ * Queue read data for the writer thread.
+ *
+ * Data is copied outside of the mutex, the free part of the ring is only accessed by the reader.
+ *
+ * \param[in]	pTeeHandle								Tee interface instance.
+ * \param[in]	pBuffer									Read data.
+ * \param[in]	size									Number of bytes read.
+ */
+static void sbgInterfaceTeeQueue(SbgInterfaceTee *pTeeHandle, const uint8_t *pBuffer, size_t size)
+{
+	size_t					 head;
+	size_t					 freeSize;
+
+	assert(pTeeHandle);
+	assert(pBuffer);
+
+	pthread_mutex_lock(&pTeeHandle->mutex);
+
+	head		= pTeeHandle->head;
+	freeSize	= pTeeHandle->bufferSize - (head - pTeeHandle->tail);
+
+	if (freeSize < size)
+	{
+		pTeeHandle->stats.nrDroppedBytes += size;
+	}
+
+	pthread_mutex_unlock(&pTeeHandle->mutex);
+
+	if (freeSize >= size)
+	{
+		size_t				 offset;
+		size_t				 firstSize;
+
+		offset		= head % pTeeHandle->bufferSize;
+		firstSize	= sbgMin(size, pTeeHandle->bufferSize - offset);
+
+		memcpy(&pTeeHandle->pBuffer[offset], pBuffer, firstSize);
+		memcpy(pTeeHandle->pBuffer, &pBuffer[firstSize], size - firstSize);
+
+		pthread_mutex_lock(&pTeeHandle->mutex);
+
+		pTeeHandle->head			+= size;
+		pTeeHandle->stats.nrBytes	+= size;
+
+		pthread_cond_broadcast(&pTeeHandle->cond);
+		pthread_mutex_unlock(&pTeeHandle->mutex);
+	}
+}
+#endif // SBG_INTERFACE_TEE_USE_THREADS
+
+/*!
+ * Destroy an interface initialized using sbgInterfaceTeeCreate.
+ *
+ * Queued data is written to the sinks before returning.
+ *
+ * \param[in]	pInterface						Pointer on a valid tee interface.
+ * \return										SBG_NO_ERROR if the interface has been closed and released.
+ */
+static SbgErrorCode sbgInterfaceTeeDestroy(SbgInterface *pInterface)
+{
+	SbgInterfaceTee			*pTeeHandle;
+
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_TEE);
+
+	pTeeHandle = sbgInterfaceTeeGet(pInterface);
+
+#ifdef SBG_INTERFACE_TEE_USE_THREADS
+	pthread_mutex_lock(&pTeeHandle->mutex);
+	pTeeHandle->stop = true;
+	pthread_cond_broadcast(&pTeeHandle->cond);
+	pthread_mutex_unlock(&pTeeHandle->mutex);
+
+	pthread_join(pTeeHandle->thread, NULL);
+
+	pthread_cond_destroy(&pTeeHandle->cond);
+	pthread_mutex_destroy(&pTeeHandle->mutex);
+
+	free(pTeeHandle->pBuffer);
+#endif // SBG_INTERFACE_TEE_USE_THREADS
+
+	free(pTeeHandle);
+
+	sbgInterfaceZeroInit(pInterface);
+
+	return SBG_NO_ERROR;
+}
+
+/*!
+ * Try to write some data to an interface.
+ *
+ * \param[in]	pHandle									Valid handle on an initialized interface.
+ * \param[in]	pBuffer									Pointer on an allocated buffer that contains the data to write
+ * \param[in]	bytesToWrite							Number of bytes we would like to write.
+ * \return												SBG_NO_ERROR if all bytes have been written successfully.
+ */
+static SbgErrorCode sbgInterfaceTeeWrite(SbgInterface *pInterface, const void *pBuffer, size_t bytesToWrite)
+{
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_TEE);
+
+	return sbgInterfaceWrite(sbgInterfaceTeeGet(pInterface)->pSource, pBuffer, bytesToWrite);
+}
+
+/*!
+ * Try to read some data from an interface.
+ *
+ * \param[in]	pHandle									Valid handle on an initialized interface.
+ * \param[in]	pBuffer									Pointer on an allocated buffer that can hold at least bytesToRead bytes of data.
+ * \param[out]	pReadBytes								Pointer on an uint32_t used to return the number of read bytes.
+ * \param[in]	bytesToRead								Number of bytes we would like to read.
+ * \return												SBG_NO_ERROR if no error occurs, please check the number of received bytes.
+ */
+static SbgErrorCode sbgInterfaceTeeRead(SbgInterface *pInterface, void *pBuffer, size_t *pReadBytes, size_t bytesToRead)
+{
+	SbgErrorCode			 errorCode;
+	SbgInterfaceTee			*pTeeHandle;
+
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_TEE);
+	assert(pReadBytes);
+
+	pTeeHandle = sbgInterfaceTeeGet(pInterface);
+
+	errorCode = sbgInterfaceRead(pTeeHandle->pSource, pBuffer, pReadBytes, bytesToRead);
+
+	if ((errorCode == SBG_NO_ERROR) && (*pReadBytes != 0))
+	{
+#ifdef SBG_INTERFACE_TEE_USE_THREADS
+		sbgInterfaceTeeQueue(pTeeHandle, pBuffer, *pReadBytes);
+#else
+		pTeeHandle->stats.nrBytes		+= *pReadBytes;
+		pTeeHandle->stats.nrWriteErrors	+= sbgInterfaceTeeWriteSinks(pTeeHandle->pSinks, pTeeHandle->nrSinks, pBuffer, *pReadBytes);
+#endif // SBG_INTERFACE_TEE_USE_THREADS
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Make an interface flush pending input and/or output data.
+ *
+ * \param[in]	pInterface								Interface instance.
+ * \param[in]	flags									Combination of the SBG_IF_FLUSH_INPUT and SBG_IF_FLUSH_OUTPUT flags.
+ * \return												SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgInterfaceTeeFlush(SbgInterface *pInterface, uint32_t flags)
+{
+	assert(pInterface);
+
+	return sbgInterfaceFlush(sbgInterfaceTeeGet(pInterface)->pSource, flags);
+}
+
+/*!
+ * Change an interface input and output speed in bps.
+ *
+ * \param[in]	pInterface								Interface instance.
+ * \param[in]	speed									The new interface speed to set in bps.
+ * \return												SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgInterfaceTeeSetSpeed(SbgInterface *pInterface, uint32_t speed)
+{
+	assert(pInterface);
+
+	return sbgInterfaceSetSpeed(sbgInterfaceTeeGet(pInterface)->pSource, speed);
+}
+
+/*!
+ * Returns the current interface baud rate in bps.
+ *
+ * \param[in]	pInterface								Interface instance.
+ * \return												The current interface baud rate in bps or zero if not applicable.
+ */
+static uint32_t sbgInterfaceTeeGetSpeed(const SbgInterface *pInterface)
+{
+	assert(pInterface);
+
+	return sbgInterfaceGetSpeed(sbgInterfaceTeeGetConst(pInterface)->pSource);
+}
+
+/*!
+ * Compute and return the delay needed by the interface to transmit / receive X number of bytes.
+ *
+ * \param[in]	pInterface								Interface instance.
+ * \param[in]	numBytes								The number of bytes to transmit / receive to evaluate the needed delay.
+ * \return												The expected delay in us or 0 if not applicable.
+ */
+static uint32_t sbgInterfaceTeeGetDelay(const SbgInterface *pInterface, size_t numBytes)
+{
+	assert(pInterface);
+
+	return sbgInterfaceGetDelay(sbgInterfaceTeeGetConst(pInterface)->pSource, numBytes);
+}
+
+//----------------------------------------------------------------------//
+//- Public functions                                                   -//
+//----------------------------------------------------------------------//
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceTeeCreate(SbgInterface *pInterface, SbgInterface *pSource, size_t bufferSize)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+	SbgInterfaceTee			*pNewTeeHandle;
+
+	assert(pInterface);
+	assert(pSource);
+
+	//
+	// Always call the underlying zero init method to make sure we can correctly handle SbgInterface evolutions
+	//
+	sbgInterfaceZeroInit(pInterface);
+
+	if (bufferSize != 0)
+	{
+		pNewTeeHandle = calloc(1, sizeof(*pNewTeeHandle));
+
+		if (pNewTeeHandle)
+		{
+			pNewTeeHandle->pSource = pSource;
+
+#ifdef SBG_INTERFACE_TEE_USE_THREADS
+			pNewTeeHandle->pBuffer		= malloc(bufferSize);
+			pNewTeeHandle->bufferSize	= bufferSize;
+
+			if (pNewTeeHandle->pBuffer)
+			{
+				pthread_mutex_init(&pNewTeeHandle->mutex, NULL);
+				pthread_cond_init(&pNewTeeHandle->cond, NULL);
+
+				if (pthread_create(&pNewTeeHandle->thread, NULL, sbgInterfaceTeeWriter, pNewTeeHandle) != 0)
+				{
+					errorCode = SBG_ERROR;
+					SBG_LOG_ERROR(errorCode, "unable to create writer thread");
+
+					pthread_cond_destroy(&pNewTeeHandle->cond);
+					pthread_mutex_destroy(&pNewTeeHandle->mutex);
+					free(pNewTeeHandle->pBuffer);
+				}
+			}
+			else
+			{
+				errorCode = SBG_MALLOC_FAILED;
+				SBG_LOG_ERROR(errorCode, "unable to allocate staging buffer");
+			}
+#endif // SBG_INTERFACE_TEE_USE_THREADS
+
+			if (errorCode == SBG_NO_ERROR)
+			{
+				char		interfaceName[SBG_IF_NAME_MAX_SIZE + 8];
+
+				pInterface->handle			= pNewTeeHandle;
+				pInterface->type			= SBG_IF_TYPE_TEE;
+
+				//
+				// Define the interface name
+				//
+				snprintf(interfaceName, sizeof(interfaceName), "tee: %s", pSource->name);
+				sbgInterfaceNameSet(pInterface, interfaceName);
+
+				//
+				// Define all overloaded members
+				//
+				pInterface->pDestroyFunc	= sbgInterfaceTeeDestroy;
+				pInterface->pReadFunc		= sbgInterfaceTeeRead;
+				pInterface->pWriteFunc		= sbgInterfaceTeeWrite;
+				pInterface->pFlushFunc		= sbgInterfaceTeeFlush;
+				pInterface->pSetSpeedFunc	= sbgInterfaceTeeSetSpeed;
+				pInterface->pGetSpeedFunc	= sbgInterfaceTeeGetSpeed;
+				pInterface->pDelayFunc		= sbgInterfaceTeeGetDelay;
+			}
+			else
+			{
+				free(pNewTeeHandle);
+			}
+		}
+		else
+		{
+			errorCode = SBG_MALLOC_FAILED;
+			SBG_LOG_ERROR(errorCode, "unable to allocate handle");
+		}
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+		SBG_LOG_ERROR(errorCode, "invalid staging buffer size");
+	}
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceTeeAddSink(SbgInterface *pInterface, SbgInterface *pSink)
+{
+	SbgErrorCode			 errorCode;
+	SbgInterfaceTee			*pTeeHandle;
+
+	assert(pInterface);
+	assert(pSink);
+
+	pTeeHandle = sbgInterfaceTeeGet(pInterface);
+
+#ifdef SBG_INTERFACE_TEE_USE_THREADS
+	pthread_mutex_lock(&pTeeHandle->mutex);
+#endif // SBG_INTERFACE_TEE_USE_THREADS
+
+	if (pTeeHandle->nrSinks < SBG_ARRAY_SIZE(pTeeHandle->pSinks))
+	{
+		pTeeHandle->pSinks[pTeeHandle->nrSinks] = pSink;
+		pTeeHandle->nrSinks++;
+
+		errorCode = SBG_NO_ERROR;
+	}
+	else
+	{
+		errorCode = SBG_BUFFER_OVERFLOW;
+	}
+
+#ifdef SBG_INTERFACE_TEE_USE_THREADS
+	pthread_mutex_unlock(&pTeeHandle->mutex);
+#endif // SBG_INTERFACE_TEE_USE_THREADS
+
+	if (errorCode != SBG_NO_ERROR)
+	{
+		SBG_LOG_ERROR(errorCode, "too many sinks");
+	}
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceTeeDrain(SbgInterface *pInterface, uint32_t timeOut)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+	SbgInterfaceTee			*pTeeHandle;
+
+	assert(pInterface);
+
+	pTeeHandle = sbgInterfaceTeeGet(pInterface);
+
+#ifdef SBG_INTERFACE_TEE_USE_THREADS
+	{
+		struct timeval		 now;
+		struct timespec		 deadline;
+		uint64_t			 deadlineNs;
+
+		gettimeofday(&now, NULL);
+
+		deadlineNs			= ((uint64_t)now.tv_usec * 1000ull) + ((uint64_t)timeOut * 1000000ull);
+		deadline.tv_sec		= now.tv_sec + (time_t)(deadlineNs / 1000000000ull);
+		deadline.tv_nsec	= (long)(deadlineNs % 1000000000ull);
+
+		pthread_mutex_lock(&pTeeHandle->mutex);
+
+		while ((pTeeHandle->head != pTeeHandle->tail) && (errorCode == SBG_NO_ERROR))
+		{
+			if (pthread_cond_timedwait(&pTeeHandle->cond, &pTeeHandle->mutex, &deadline) != 0)
+			{
+				if (pTeeHandle->head != pTeeHandle->tail)
+				{
+					errorCode = SBG_TIME_OUT;
+				}
+			}
+		}
+
+		pthread_mutex_unlock(&pTeeHandle->mutex);
+	}
+#else
+	SBG_UNUSED_PARAMETER(pTeeHandle);
+	SBG_UNUSED_PARAMETER(timeOut);
+#endif // SBG_INTERFACE_TEE_USE_THREADS
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API void sbgInterfaceTeeGetStats(SbgInterface *pInterface, SbgInterfaceTeeStats *pStats)
+{
+	SbgInterfaceTee			*pTeeHandle;
+
+	assert(pInterface);
+	assert(pStats);
+
+	pTeeHandle = sbgInterfaceTeeGet(pInterface);
+
+#ifdef SBG_INTERFACE_TEE_USE_THREADS
+	pthread_mutex_lock(&pTeeHandle->mutex);
+#endif // SBG_INTERFACE_TEE_USE_THREADS
+
+	*pStats = pTeeHandle->stats;
+
+#ifdef SBG_INTERFACE_TEE_USE_THREADS
+	pthread_mutex_unlock(&pTeeHandle->mutex);
+#endif // SBG_INTERFACE_TEE_USE_THREADS
+}
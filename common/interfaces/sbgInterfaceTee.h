@@ -0,0 +1,131 @@
+/*!
+ *      \file           sbgInterfaceTee.h
+ *      \author         SBG Systems
+ *      \date           19 October 2026
+ *
+ *      \brief          Tee interface mirroring the data read from an interface to sinks.
+ *
+ *                      Received data is copied once to a staging ring and written to all sinks
+ *                      from a writer thread so slow sinks never stall the reader.
+ *
+ *      \section CodeCopyright Copyright Notice
+ *      The MIT license
+ *
+ *      Copyright (C) 2007-2022, SBG Systems SAS. All rights reserved.
+ *
+ *      Permission is hereby granted, free of charge, to any person obtaining a copy
+ *      of this software and associated documentation files (the "Software"), to deal
+ *      in the Software without restriction, including without limitation the rights
+ *      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *      copies of the Software, and to permit persons to whom the Software is
+ *      furnished to do so, subject to the following conditions:
+ *
+ *      The above copyright notice and this permission notice shall be included in all
+ *      copies or substantial portions of the Software.
+ *
+ *      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *      SOFTWARE.
+ */
+
+#ifndef SBG_INTERFACE_TEE_H
+#define SBG_INTERFACE_TEE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <interfaces/sbgInterface.h>
+
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Maximum number of sinks of a tee interface.
+ */
+#define SBG_INTERFACE_TEE_MAX_SINKS					(8)
+
+/*!
+ * Default staging ring size in bytes.
+ */
+#define SBG_INTERFACE_TEE_DEFAULT_BUFFER_SIZE		(4u * 1024u * 1024u)
+
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Tee interface statistics.
+ */
+typedef struct _SbgInterfaceTeeStats
+{
+	uint64_t		nrBytes;							/*!< Number of bytes read from the source and queued for the sinks. */
+	uint64_t		nrDroppedBytes;						/*!< Number of bytes not mirrored because the staging ring was full. */
+	uint64_t		nrWriteErrors;						/*!< Number of failed sink writes. */
+} SbgInterfaceTeeStats;
+
+//----------------------------------------------------------------------//
+//- Public functions                                                   -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Initialize a tee interface wrapping a source interface.
+ *
+ * Reads are forwarded to the source and the received data is mirrored to the sinks.
+ * Writes, flushes and speed changes are forwarded to the source and are not mirrored.
+ *
+ * Received data is copied once to a staging ring, all sinks then write directly from it on a writer
+ * thread. If the sinks can't keep up and the ring is full, received data is not mirrored and counted
+ * as dropped, reads are never delayed. Without thread support, sinks are written synchronously.
+ *
+ * The source and the sinks are not destroyed with the tee interface and must outlive it.
+ *
+ * \param[in]	pInterface						Pointer on an allocated interface instance to initialize.
+ * \param[in]	pSource							Interface to read from.
+ * \param[in]	bufferSize						Staging ring size in bytes.
+ * \return										SBG_NO_ERROR if the interface has been created.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceTeeCreate(SbgInterface *pInterface, SbgInterface *pSource, size_t bufferSize);
+
+/*!
+ * Add a sink to a tee interface.
+ *
+ * Any interface that supports write operations can be used, for example a file opened with
+ * sbgInterfaceFileWriteOpen, a UDP interface or a pipe interface. Sinks are only written from
+ * the writer thread.
+ *
+ * \param[in]	pInterface						Pointer on a valid tee interface.
+ * \param[in]	pSink							Sink interface.
+ * \return										SBG_NO_ERROR if the sink has been added.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceTeeAddSink(SbgInterface *pInterface, SbgInterface *pSink);
+
+/*!
+ * Wait until all mirrored data has been written to the sinks.
+ *
+ * \param[in]	pInterface						Pointer on a valid tee interface.
+ * \param[in]	timeOut							Maximum time to wait in ms.
+ * \return										SBG_NO_ERROR if all data has been written, SBG_TIME_OUT otherwise.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceTeeDrain(SbgInterface *pInterface, uint32_t timeOut);
+
+/*!
+ * Returns the statistics of a tee interface.
+ *
+ * \param[in]	pInterface						Pointer on a valid tee interface.
+ * \param[out]	pStats							Statistics.
+ */
+SBG_COMMON_LIB_API void sbgInterfaceTeeGetStats(SbgInterface *pInterface, SbgInterfaceTeeStats *pStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_INTERFACE_TEE_H
@@ -1,3 +1,8 @@
+// recvmmsg is a GNU extension
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+
 // sbgCommonLib headers
 #include <sbgCommon.h>
 #include <interfaces/sbgInterfaceUdp.h>
@@ -10,6 +15,7 @@
 #include <stdint.h>
 
 #define SOCKLEN				int
+#define MULTICAST_OPT		DWORD
 #else // WIN32
 #include <fcntl.h>
 #include <unistd.h>
@@ -23,6 +29,7 @@
 #define SOCKADDR			struct sockaddr
 #define SOCKET				int
 #define SOCKLEN				socklen_t
+#define MULTICAST_OPT		unsigned char
 #define INVALID_SOCKET		(~((SOCKET)0))
 #define SOCKET_ERROR		(-1)
 #define NO_ERROR			(0)
@@ -37,15 +44,45 @@
 
 #define SBG_INTERFACE_UDP_PACKET_MAX_SIZE		(1400)
 
+#ifdef __linux__
+/*!
+ * Batch reception state.
+ *
+ * Datagrams are received in fixed size slots of a staging buffer and copied to the
+ * caller buffer as a byte stream.
+ */
+typedef struct _SbgInterfaceUdpBatch
+{
+	struct mmsghdr		 messages[SBG_INTERFACE_UDP_BATCH_SIZE];			/*!< Received messages. */
+	struct iovec		 iovecs[SBG_INTERFACE_UDP_BATCH_SIZE];				/*!< Reception slots. */
+	SOCKADDR_IN			 remoteAddrs[SBG_INTERFACE_UDP_BATCH_SIZE];			/*!< Source addresses of the received datagrams. */
+	union
+	{
+		struct cmsghdr	 header;
+		uint8_t			 buffer[CMSG_SPACE(sizeof(uint32_t))];
+	}					 controls[SBG_INTERFACE_UDP_BATCH_SIZE];			/*!< Control messages, used to report kernel drops. */
+	size_t				 lengths[SBG_INTERFACE_UDP_BATCH_SIZE];				/*!< Sizes of the datagrams to deliver, 0 if discarded. */
+	size_t				 nrDatagrams;										/*!< Number of received datagrams. */
+	size_t				 index;												/*!< Index of the datagram being delivered. */
+	size_t				 offset;											/*!< Number of bytes already delivered from the current datagram. */
+	uint8_t				 slots[SBG_INTERFACE_UDP_BATCH_SIZE][SBG_INTERFACE_UDP_BATCH_SLOT_SIZE];	/*!< Staging buffer. */
+} SbgInterfaceUdpBatch;
+#endif // __linux__
+
 /*!
  * Structure that stores all internal data used by the UDP interface.
  */
 typedef struct _SbgInterfaceUdp
 {
-	SOCKET 			udpSocket;					/*!< The socket used to send and / or receive some UDP data. */
-	sbgIpAddress	remoteAddr;					/*!< IP address to send data to. */
-	uint32_t		remotePort;					/*!< Ethernet port to send data to. */
-	uint32_t		localPort;					/*!< Ethernet port on which the interface is listening. */
+	SOCKET 					 udpSocket;			/*!< The socket used to send and / or receive some UDP data. */
+	sbgIpAddress			 remoteAddr;		/*!< IP address to send data to. */
+	uint32_t				 remotePort;		/*!< Ethernet port to send data to. */
+	uint32_t				 localPort;			/*!< Ethernet port on which the interface is listening. */
+	SbgInterfaceUdpStats	 stats;				/*!< Reception statistics. */
+	bool					 promiscuous;		/*!< True if datagrams are accepted from any sender. */
+#ifdef __linux__
+	SbgInterfaceUdpBatch	*pBatch;			/*!< Batch reception state, NULL if datagrams are received one by one. */
+#endif // __linux__
 } SbgInterfaceUdp;
 
 //----------------------------------------------------------------------//
@@ -178,6 +215,9 @@ static SbgErrorCode sbgInterfaceUdpDestroy(SbgInterface *pInterface)
 	//
 	// free the allocated sbgInterfaceUdp instance
 	//
+#ifdef __linux__
+	free(pUdpHandle->pBatch);
+#endif // __linux__
 	free(pUdpHandle);
 
 	sbgInterfaceZeroInit(pInterface);
@@ -185,6 +225,48 @@ static SbgErrorCode sbgInterfaceUdpDestroy(SbgInterface *pInterface)
 	return sbgInterfaceUpdateCloseSockets();
 }
 
+/*!
+ * Check the source of a received datagram.
+ *
+ * If the interface has no remote host yet, the source becomes the remote host.
+ * In promiscuous mode, all datagrams are accepted.
+ *
+ * \param[in]	pUdpHandle								UDP interface.
+ * \param[in]	pRemoteAddr								Source address of the datagram.
+ * \return												true if the datagram comes from the remote host, false if it must be discarded.
+ */
+static bool sbgInterfaceUdpCheckRemoteHost(SbgInterfaceUdp *pUdpHandle, const SOCKADDR_IN *pRemoteAddr)
+{
+	bool					 valid = true;
+
+	assert(pUdpHandle);
+	assert(pRemoteAddr);
+
+	if (pUdpHandle->promiscuous)
+	{
+		valid = true;
+	}
+	else if ((pUdpHandle->remoteAddr == 0) &&
+		(pUdpHandle->remotePort == 0))
+	{
+		pUdpHandle->remoteAddr = pRemoteAddr->sin_addr.s_addr;
+		pUdpHandle->remotePort = ntohs(pRemoteAddr->sin_port);
+	}
+	else if ((pUdpHandle->remoteAddr != pRemoteAddr->sin_addr.s_addr) ||
+		(pUdpHandle->remotePort != ntohs(pRemoteAddr->sin_port)))
+	{
+		char			 remoteAddrString[16];
+
+		sbgNetworkIpToString(pRemoteAddr->sin_addr.s_addr, remoteAddrString, sizeof(remoteAddrString));
+		SBG_LOG_WARNING(SBG_READ_ERROR, "received data from invalid remote host (%s:%u)", remoteAddrString, ntohs(pRemoteAddr->sin_port));
+
+		pUdpHandle->stats.nrRejectedDatagrams++;
+		valid = false;
+	}
+
+	return valid;
+}
+
 /*!
  * Try to write some data to an interface.
  *
@@ -273,19 +355,11 @@ static SbgErrorCode sbgInterfaceUdpRead(SbgInterface *pInterface, void *pBuffer,
 
 	if (ret != -1)
 	{
-		if ((pUdpHandle->remoteAddr == 0) &&
-			(pUdpHandle->remotePort == 0))
-		{
-			pUdpHandle->remoteAddr = remoteAddr.sin_addr.s_addr;
-			pUdpHandle->remotePort = ntohs(remoteAddr.sin_port);
-		}
-		else if ((pUdpHandle->remoteAddr != remoteAddr.sin_addr.s_addr) ||
-			(pUdpHandle->remotePort != ntohs(remoteAddr.sin_port)))
-		{
-			char			 remoteAddrString[16];
+		pUdpHandle->stats.nrReceiveCalls++;
+		pUdpHandle->stats.nrDatagrams++;
 
-			sbgNetworkIpToString(remoteAddr.sin_addr.s_addr, remoteAddrString, sizeof(remoteAddrString));
-			SBG_LOG_WARNING(SBG_READ_ERROR, "received data from invalid remote host (%s:%u)", remoteAddrString, ntohs(remoteAddr.sin_port));
+		if (!sbgInterfaceUdpCheckRemoteHost(pUdpHandle, &remoteAddr))
+		{
 			ret = 0;
 		}
 
@@ -314,12 +388,178 @@ static SbgErrorCode sbgInterfaceUdpRead(SbgInterface *pInterface, void *pBuffer,
 	return errorCode;
 }
 
+#ifdef __linux__
+/*!
+ * Receive a batch of datagrams in the staging buffer.
+ *
+ * \param[in]	pUdpHandle								UDP interface with batch reception enabled.
+ * \return												SBG_NO_ERROR if no error occurs, the batch is empty if no datagram is available.
+ */
+static SbgErrorCode sbgInterfaceUdpReceiveBatch(SbgInterfaceUdp *pUdpHandle)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+	SbgInterfaceUdpBatch	*pBatch;
+	int						 ret;
 
-//----------------------------------------------------------------------//
-//- Public functions                                                   -//
-//----------------------------------------------------------------------//
+	assert(pUdpHandle);
+	assert(pUdpHandle->pBatch);
 
-SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpCreate(SbgInterface *pInterface, sbgIpAddress remoteAddr, uint32_t remotePort, uint32_t localPort)
+	pBatch = pUdpHandle->pBatch;
+
+	//
+	// Message headers are updated by the kernel and must be set again before each call
+	//
+	for (size_t i = 0; i < SBG_ARRAY_SIZE(pBatch->messages); i++)
+	{
+		struct msghdr		*pMessage = &pBatch->messages[i].msg_hdr;
+
+		pBatch->iovecs[i].iov_base	= pBatch->slots[i];
+		pBatch->iovecs[i].iov_len	= sizeof(pBatch->slots[i]);
+
+		pMessage->msg_name			= &pBatch->remoteAddrs[i];
+		pMessage->msg_namelen		= sizeof(pBatch->remoteAddrs[i]);
+		pMessage->msg_iov			= &pBatch->iovecs[i];
+		pMessage->msg_iovlen		= 1;
+		pMessage->msg_control		= pBatch->controls[i].buffer;
+		pMessage->msg_controllen	= sizeof(pBatch->controls[i].buffer);
+		pMessage->msg_flags			= 0;
+	}
+
+	pBatch->nrDatagrams	= 0;
+	pBatch->index		= 0;
+	pBatch->offset		= 0;
+
+	ret = recvmmsg(pUdpHandle->udpSocket, pBatch->messages, SBG_ARRAY_SIZE(pBatch->messages), 0, NULL);
+
+	if (ret > 0)
+	{
+		pUdpHandle->stats.nrReceiveCalls++;
+		pUdpHandle->stats.nrDatagrams	+= (uint64_t)ret;
+		pBatch->nrDatagrams				 = (size_t)ret;
+
+		for (size_t i = 0; i < pBatch->nrDatagrams; i++)
+		{
+			struct msghdr		*pMessage = &pBatch->messages[i].msg_hdr;
+			struct cmsghdr		*pControl;
+
+			pBatch->lengths[i] = pBatch->messages[i].msg_len;
+
+			//
+			// The kernel reports the total number of datagrams dropped on the socket
+			//
+			for (pControl = CMSG_FIRSTHDR(pMessage); pControl; pControl = CMSG_NXTHDR(pMessage, pControl))
+			{
+				if ((pControl->cmsg_level == SOL_SOCKET) && (pControl->cmsg_type == SO_RXQ_OVFL))
+				{
+					memcpy(&pUdpHandle->stats.nrKernelDrops, CMSG_DATA(pControl), sizeof(uint32_t));
+				}
+			}
+
+			if (pMessage->msg_flags & MSG_TRUNC)
+			{
+				SBG_LOG_WARNING(SBG_BUFFER_OVERFLOW, "datagram larger than %u bytes truncated", SBG_INTERFACE_UDP_BATCH_SLOT_SIZE);
+				pUdpHandle->stats.nrTruncatedDatagrams++;
+			}
+
+			if (!sbgInterfaceUdpCheckRemoteHost(pUdpHandle, &pBatch->remoteAddrs[i]))
+			{
+				pBatch->lengths[i] = 0;
+			}
+		}
+	}
+	else if ((ret == -1) && (errno != EAGAIN) && (errno != EWOULDBLOCK))
+	{
+		errorCode = SBG_READ_ERROR;
+		SBG_LOG_ERROR(errorCode, "unable to receive data");
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Try to read some data from an interface with batch reception enabled.
+ *
+ * Datagrams are delivered as a byte stream, a datagram can be split between several reads.
+ *
+ * \param[in]	pHandle									Valid handle on an initialized interface.
+ * \param[in]	pBuffer									Pointer on an allocated buffer that can hold at least bytesToRead bytes of data.
+ * \param[out]	pReadBytes								Pointer on an uint32_t used to return the number of read bytes.
+ * \param[in]	bytesToRead								Number of bytes we would like to read.
+ * \return												SBG_NO_ERROR if no error occurs, please check the number of received bytes.
+ */
+static SbgErrorCode sbgInterfaceUdpReadBatch(SbgInterface *pInterface, void *pBuffer, size_t *pReadBytes, size_t bytesToRead)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+	SbgInterfaceUdp			*pUdpHandle;
+	SbgInterfaceUdpBatch	*pBatch;
+	size_t					 nrBytes = 0;
+
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
+	assert(pBuffer);
+	assert(pReadBytes);
+
+	pUdpHandle	= sbgInterfaceUdpGet(pInterface);
+	pBatch		= pUdpHandle->pBatch;
+
+	while (nrBytes < bytesToRead)
+	{
+		if (pBatch->index < pBatch->nrDatagrams)
+		{
+			size_t		 size;
+
+			size = sbgMin(pBatch->lengths[pBatch->index] - pBatch->offset, bytesToRead - nrBytes);
+
+			memcpy((uint8_t*)pBuffer + nrBytes, &pBatch->slots[pBatch->index][pBatch->offset], size);
+
+			nrBytes			+= size;
+			pBatch->offset	+= size;
+
+			if (pBatch->offset == pBatch->lengths[pBatch->index])
+			{
+				pBatch->index++;
+				pBatch->offset = 0;
+			}
+		}
+		else if (nrBytes == 0)
+		{
+			//
+			// Only one system call per read, the next datagrams are received by the next read
+			//
+			errorCode = sbgInterfaceUdpReceiveBatch(pUdpHandle);
+
+			if ((errorCode != SBG_NO_ERROR) || (pBatch->nrDatagrams == 0))
+			{
+				break;
+			}
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		*pReadBytes = nrBytes;
+	}
+
+	return errorCode;
+}
+#endif // __linux__
+
+
+/*!
+ * Initialize an unconnected UDP interface for read and write operations.
+ *
+ * \param[in]	pInterface						Pointer on an allocated interface instance to initialize.
+ * \param[in]	remoteAddr						IP address to send data to.
+ * \param[in]	remotePort						Ethernet port to send data to.
+ * \param[in]	localPort						Ethernet port on which the interface is listening.
+ * \param[in]	reuseAddress					Set to true to share the local port with other sockets.
+ * \return										SBG_NO_ERROR if the interface has been created.
+ */
+static SbgErrorCode sbgInterfaceUdpCreateSocket(SbgInterface *pInterface, sbgIpAddress remoteAddr, uint32_t remotePort, uint32_t localPort, bool reuseAddress)
 {
 	SbgErrorCode					 errorCode;
 	
@@ -340,6 +580,8 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpCreate(SbgInterface *pInterface,
 
 		if (pNewUdpHandle)
 		{
+			memset(pNewUdpHandle, 0, sizeof(*pNewUdpHandle));
+
 			pNewUdpHandle->remoteAddr	= remoteAddr;
 			pNewUdpHandle->remotePort	= remotePort;
 			pNewUdpHandle->localPort	= localPort;
@@ -350,6 +592,18 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpCreate(SbgInterface *pInterface,
 			{
 				errorCode = sbgInterfaceUdpSetSocketBlocking(pNewUdpHandle, false);
 
+				if ((errorCode == SBG_NO_ERROR) && reuseAddress)
+				{
+					int			 optValue;
+
+					optValue = 1;
+
+					if (setsockopt(pNewUdpHandle->udpSocket, SOL_SOCKET, SO_REUSEADDR, (const char *)&optValue, sizeof(optValue)) != NO_ERROR)
+					{
+						SBG_LOG_WARNING(SBG_ERROR, "unable to share the local port");
+					}
+				}
+
 				if (errorCode == SBG_NO_ERROR)
 				{
 					SOCKADDR_IN	 bindAddress;
@@ -423,7 +677,112 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpCreate(SbgInterface *pInterface,
 	return errorCode;
 }
 
+/*!
+ * Join or leave a multicast group.
+ *
+ * \param[in]	pInterface						Pointer on a valid UDP interface.
+ * \param[in]	groupAddr						Multicast group IP address.
+ * \param[in]	interfaceAddr					IP address of the local network interface, 0 to let the system choose.
+ * \param[in]	join							Set to true to join the group, false to leave it.
+ * \return										SBG_NO_ERROR if the membership has been changed.
+ */
+static SbgErrorCode sbgInterfaceUdpSetMembership(SbgInterface *pInterface, sbgIpAddress groupAddr, sbgIpAddress interfaceAddr, bool join)
+{
+	SbgErrorCode			 errorCode;
+	SbgInterfaceUdp			*pUdpHandle;
+	struct ip_mreq			 membership;
+	int						 socketError;
+
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
+
+	pUdpHandle = sbgInterfaceUdpGet(pInterface);
+
+	if (sbgIpAddressIsMulticast(groupAddr))
+	{
+		membership.imr_multiaddr.s_addr		= groupAddr;
+		membership.imr_interface.s_addr		= interfaceAddr;
+
+		socketError = setsockopt(pUdpHandle->udpSocket, IPPROTO_IP, join ? IP_ADD_MEMBERSHIP : IP_DROP_MEMBERSHIP, (const char *)&membership, sizeof(membership));
+
+		if (socketError == NO_ERROR)
+		{
+			errorCode = SBG_NO_ERROR;
+		}
+		else
+		{
+			char			 groupAddrString[16];
+
+			errorCode = SBG_ERROR;
+			sbgNetworkIpToString(groupAddr, groupAddrString, sizeof(groupAddrString));
+			SBG_LOG_ERROR(errorCode, "unable to %s multicast group %s", join ? "join" : "leave", groupAddrString);
+		}
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+		SBG_LOG_ERROR(errorCode, "invalid multicast group address");
+	}
+
+	return errorCode;
+}
+
+//----------------------------------------------------------------------//
+//- Public functions                                                   -//
+//----------------------------------------------------------------------//
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpCreate(SbgInterface *pInterface, sbgIpAddress remoteAddr, uint32_t remotePort, uint32_t localPort)
+{
+	return sbgInterfaceUdpCreateSocket(pInterface, remoteAddr, remotePort, localPort, false);
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpCreateMulticast(SbgInterface *pInterface, sbgIpAddress groupAddr, uint32_t port, sbgIpAddress interfaceAddr)
+{
+	SbgErrorCode			 errorCode;
+
+	assert(pInterface);
+
+	if (sbgIpAddressIsMulticast(groupAddr))
+	{
+		errorCode = sbgInterfaceUdpCreateSocket(pInterface, groupAddr, port, port, true);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+#ifdef IP_MULTICAST_ALL
+			int					 optValue;
+
+			//
+			// Linux delivers datagrams of groups joined by any socket sharing the port by default
+			//
+			optValue = 0;
+			setsockopt(sbgInterfaceUdpGet(pInterface)->udpSocket, IPPROTO_IP, IP_MULTICAST_ALL, (const char *)&optValue, sizeof(optValue));
+#endif // IP_MULTICAST_ALL
+
+			errorCode = sbgInterfaceUdpJoinMulticastGroup(pInterface, groupAddr, interfaceAddr);
+
+			if ((errorCode == SBG_NO_ERROR) && (interfaceAddr != 0))
+			{
+				errorCode = sbgInterfaceUdpSetMulticastInterface(pInterface, interfaceAddr);
+			}
+
+			if (errorCode == SBG_NO_ERROR)
+			{
+				sbgInterfaceUdpSetPromiscuous(pInterface, true);
+			}
+			else
+			{
+				sbgInterfaceDestroy(pInterface);
+			}
+		}
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+		SBG_LOG_ERROR(errorCode, "invalid multicast group address");
+	}
 
+	return errorCode;
+}
 
 SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpAllowBroadcast(SbgInterface *pInterface, bool allowBroadcast)
 {
@@ -455,3 +814,272 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpAllowBroadcast(SbgInterface *pInt
 
 	return errorCode;
 }
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpJoinMulticastGroup(SbgInterface *pInterface, sbgIpAddress groupAddr, sbgIpAddress interfaceAddr)
+{
+	return sbgInterfaceUdpSetMembership(pInterface, groupAddr, interfaceAddr, true);
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpLeaveMulticastGroup(SbgInterface *pInterface, sbgIpAddress groupAddr, sbgIpAddress interfaceAddr)
+{
+	return sbgInterfaceUdpSetMembership(pInterface, groupAddr, interfaceAddr, false);
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpSetMulticastLoop(SbgInterface *pInterface, bool enable)
+{
+	SbgErrorCode			 errorCode;
+	SbgInterfaceUdp			*pUdpHandle;
+	int						 socketError;
+	MULTICAST_OPT			 optValue;
+
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
+
+	pUdpHandle = sbgInterfaceUdpGet(pInterface);
+
+	optValue = enable;
+	socketError = setsockopt(pUdpHandle->udpSocket, IPPROTO_IP, IP_MULTICAST_LOOP, (const char *)&optValue, sizeof(optValue));
+
+	if (socketError == NO_ERROR)
+	{
+		errorCode = SBG_NO_ERROR;
+	}
+	else
+	{
+		errorCode = SBG_ERROR;
+		SBG_LOG_ERROR(errorCode, "unable to set multicast loopback");
+	}
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpSetMulticastTtl(SbgInterface *pInterface, uint8_t ttl)
+{
+	SbgErrorCode			 errorCode;
+	SbgInterfaceUdp			*pUdpHandle;
+	int						 socketError;
+	MULTICAST_OPT			 optValue;
+
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
+
+	pUdpHandle = sbgInterfaceUdpGet(pInterface);
+
+	optValue = ttl;
+	socketError = setsockopt(pUdpHandle->udpSocket, IPPROTO_IP, IP_MULTICAST_TTL, (const char *)&optValue, sizeof(optValue));
+
+	if (socketError == NO_ERROR)
+	{
+		errorCode = SBG_NO_ERROR;
+	}
+	else
+	{
+		errorCode = SBG_ERROR;
+		SBG_LOG_ERROR(errorCode, "unable to set multicast time to live");
+	}
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpSetMulticastInterface(SbgInterface *pInterface, sbgIpAddress interfaceAddr)
+{
+	SbgErrorCode			 errorCode;
+	SbgInterfaceUdp			*pUdpHandle;
+	int						 socketError;
+	struct in_addr			 localInterface;
+
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
+
+	pUdpHandle = sbgInterfaceUdpGet(pInterface);
+
+	localInterface.s_addr = interfaceAddr;
+	socketError = setsockopt(pUdpHandle->udpSocket, IPPROTO_IP, IP_MULTICAST_IF, (const char *)&localInterface, sizeof(localInterface));
+
+	if (socketError == NO_ERROR)
+	{
+		errorCode = SBG_NO_ERROR;
+	}
+	else
+	{
+		errorCode = SBG_ERROR;
+		SBG_LOG_ERROR(errorCode, "unable to set multicast interface");
+	}
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API void sbgInterfaceUdpSetPromiscuous(SbgInterface *pInterface, bool enable)
+{
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
+
+	sbgInterfaceUdpGet(pInterface)->promiscuous = enable;
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpSetReceiveBufferSize(SbgInterface *pInterface, size_t size)
+{
+	SbgErrorCode			 errorCode;
+	SbgInterfaceUdp			*pUdpHandle;
+	int						 socketError;
+	int						 optValue;
+	SOCKLEN					 optLength;
+
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
+
+	pUdpHandle = sbgInterfaceUdpGet(pInterface);
+
+	optValue = (int)sbgMin(size, INT32_MAX);
+
+#ifdef __linux__
+	//
+	// Privileged processes can exceed net.core.rmem_max
+	//
+	socketError = setsockopt(pUdpHandle->udpSocket, SOL_SOCKET, SO_RCVBUFFORCE, (const char *)&optValue, sizeof(optValue));
+
+	if (socketError != NO_ERROR)
+	{
+		socketError = setsockopt(pUdpHandle->udpSocket, SOL_SOCKET, SO_RCVBUF, (const char *)&optValue, sizeof(optValue));
+	}
+#else
+	socketError = setsockopt(pUdpHandle->udpSocket, SOL_SOCKET, SO_RCVBUF, (const char *)&optValue, sizeof(optValue));
+#endif // __linux__
+
+	if (socketError == NO_ERROR)
+	{
+		errorCode = SBG_NO_ERROR;
+
+		//
+		// The system silently limits the size, Linux also doubles it for its own bookkeeping
+		//
+		optLength = sizeof(optValue);
+
+		if (getsockopt(pUdpHandle->udpSocket, SOL_SOCKET, SO_RCVBUF, (char *)&optValue, &optLength) == NO_ERROR)
+		{
+#ifdef __linux__
+			optValue /= 2;
+#endif // __linux__
+
+			if ((size_t)optValue < size)
+			{
+				SBG_LOG_WARNING(SBG_INVALID_PARAMETER, "receive buffer size limited to %d bytes", optValue);
+			}
+		}
+	}
+	else
+	{
+		errorCode = SBG_ERROR;
+		SBG_LOG_ERROR(errorCode, "unable to set socket options");
+	}
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpSetBusyPoll(SbgInterface *pInterface, uint32_t busyPollUs)
+{
+	SbgErrorCode			 errorCode;
+
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
+
+#ifdef __linux__
+	SbgInterfaceUdp			*pUdpHandle;
+	int						 optValue;
+
+	pUdpHandle = sbgInterfaceUdpGet(pInterface);
+
+	optValue = (int)sbgMin(busyPollUs, INT32_MAX);
+
+	if (setsockopt(pUdpHandle->udpSocket, SOL_SOCKET, SO_BUSY_POLL, (const char *)&optValue, sizeof(optValue)) == NO_ERROR)
+	{
+		errorCode = SBG_NO_ERROR;
+	}
+	else
+	{
+		errorCode = SBG_ERROR;
+		SBG_LOG_ERROR(errorCode, "unable to set busy poll time: %s", strerror(errno));
+	}
+#else
+	SBG_UNUSED_PARAMETER(busyPollUs);
+
+	errorCode = SBG_ERROR;
+	SBG_LOG_ERROR(errorCode, "busy polling not supported on this platform");
+#endif // __linux__
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpSetBatchReceive(SbgInterface *pInterface, bool enable)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
+
+#ifdef __linux__
+	SbgInterfaceUdp			*pUdpHandle;
+	int						 optValue;
+
+	pUdpHandle = sbgInterfaceUdpGet(pInterface);
+
+	if (enable && !pUdpHandle->pBatch)
+	{
+		pUdpHandle->pBatch = calloc(1, sizeof(*pUdpHandle->pBatch));
+
+		if (pUdpHandle->pBatch)
+		{
+			//
+			// Drop counts are only reported through control messages
+			//
+			optValue = 1;
+
+			if (setsockopt(pUdpHandle->udpSocket, SOL_SOCKET, SO_RXQ_OVFL, (const char *)&optValue, sizeof(optValue)) != NO_ERROR)
+			{
+				SBG_LOG_WARNING(SBG_ERROR, "kernel drop counts not available");
+			}
+
+			pInterface->pReadFunc = sbgInterfaceUdpReadBatch;
+		}
+		else
+		{
+			errorCode = SBG_MALLOC_FAILED;
+			SBG_LOG_ERROR(errorCode, "unable to allocate batch reception buffer");
+		}
+	}
+	else if (!enable && pUdpHandle->pBatch)
+	{
+		//
+		// Datagrams not delivered yet are lost
+		//
+		SBG_FREE(pUdpHandle->pBatch);
+
+		pInterface->pReadFunc = sbgInterfaceUdpRead;
+	}
+#else
+	if (enable)
+	{
+		errorCode = SBG_ERROR;
+		SBG_LOG_ERROR(errorCode, "batch reception not supported on this platform");
+	}
+#endif // __linux__
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API void sbgInterfaceUdpGetStats(SbgInterface *pInterface, SbgInterfaceUdpStats *pStats)
+{
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
+	assert(pStats);
+
+	*pStats = sbgInterfaceUdpGet(pInterface)->stats;
+}
+
+SBG_COMMON_LIB_API intptr_t sbgInterfaceUdpGetDesc(SbgInterface *pInterface)
+{
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_ETH_UDP);
+
+	return (intptr_t)sbgInterfaceUdpGet(pInterface)->udpSocket;
+}
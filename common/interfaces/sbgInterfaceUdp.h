@@ -39,6 +39,38 @@ extern "C" {
 #include <sbgCommon.h>
 #include <interfaces/sbgInterface.h>
 
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Maximum number of datagrams received per system call with batch reception.
+ */
+#define SBG_INTERFACE_UDP_BATCH_SIZE				(32)
+
+/*!
+ * Maximum datagram size with batch reception, in bytes.
+ *
+ * Large enough for jumbo frames.
+ */
+#define SBG_INTERFACE_UDP_BATCH_SLOT_SIZE			(9216)
+
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * UDP interface reception statistics.
+ */
+typedef struct _SbgInterfaceUdpStats
+{
+	uint64_t		nrDatagrams;						/*!< Number of received datagrams. */
+	uint64_t		nrReceiveCalls;						/*!< Number of receive system calls that returned data. */
+	uint64_t		nrRejectedDatagrams;				/*!< Number of datagrams received from another remote host and discarded. */
+	uint64_t		nrTruncatedDatagrams;				/*!< Number of datagrams larger than the reception slots, batch reception only. */
+	uint32_t		nrKernelDrops;						/*!< Number of datagrams dropped by the kernel because the socket buffer was full, batch reception only, updated on the next received datagram. */
+} SbgInterfaceUdpStats;
+
 //----------------------------------------------------------------------//
 //- Public functions                                                   -//
 //----------------------------------------------------------------------//
@@ -58,6 +90,21 @@ extern "C" {
  */
 SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpCreate(SbgInterface *pInterface, sbgIpAddress remoteAddr, uint32_t remotePort, uint32_t localPort);
 
+/*!
+ * Initialize a UDP interface subscribed to a multicast group.
+ *
+ * The local port can be shared by several processes on the same host so a single gateway can
+ * publish a device stream to many local consumers. Written data is sent to the group and received
+ * datagrams are accepted from any sender.
+ *
+ * \param[in]	pInterface						Pointer on an allocated interface instance to initialize.
+ * \param[in]	groupAddr						Multicast group IP address.
+ * \param[in]	port							Ethernet port of the group, used to send and receive data.
+ * \param[in]	interfaceAddr					IP address of the local network interface to use, 0 to let the system choose.
+ * \return										SBG_NO_ERROR if the interface has been created and has joined the group.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpCreateMulticast(SbgInterface *pInterface, sbgIpAddress groupAddr, uint32_t port, sbgIpAddress interfaceAddr);
+
 /*!
  * Define if a socket can send broadcasted packets.
  *
@@ -67,6 +114,122 @@ SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpCreate(SbgInterface *pInterface,
  */
 SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpAllowBroadcast(SbgInterface *pInterface, bool allowBroadcast);
 
+/*!
+ * Join a multicast group to receive the datagrams sent to it.
+ *
+ * \param[in]	pInterface						Pointer on a valid UDP interface created using sbgInterfaceUdpCreate.
+ * \param[in]	groupAddr						Multicast group IP address.
+ * \param[in]	interfaceAddr					IP address of the local network interface on which to join the group, 0 to let the system choose.
+ * \return										SBG_NO_ERROR if the group has been joined.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpJoinMulticastGroup(SbgInterface *pInterface, sbgIpAddress groupAddr, sbgIpAddress interfaceAddr);
+
+/*!
+ * Leave a multicast group previously joined.
+ *
+ * \param[in]	pInterface						Pointer on a valid UDP interface created using sbgInterfaceUdpCreate.
+ * \param[in]	groupAddr						Multicast group IP address.
+ * \param[in]	interfaceAddr					IP address of the local network interface used to join the group.
+ * \return										SBG_NO_ERROR if the group has been left.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpLeaveMulticastGroup(SbgInterface *pInterface, sbgIpAddress groupAddr, sbgIpAddress interfaceAddr);
+
+/*!
+ * Define if multicast datagrams sent by this interface are looped back to local receivers.
+ *
+ * Loopback is enabled by default and is required for consumers running on the same host.
+ *
+ * \param[in]	pInterface						Pointer on a valid UDP interface created using sbgInterfaceUdpCreate.
+ * \param[in]	enable							Set to true to loop back sent multicast datagrams.
+ * \return										SBG_NO_ERROR if the loopback status has been changed.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpSetMulticastLoop(SbgInterface *pInterface, bool enable);
+
+/*!
+ * Define the time to live of sent multicast datagrams.
+ *
+ * The default of 1 keeps datagrams on the local network.
+ *
+ * \param[in]	pInterface						Pointer on a valid UDP interface created using sbgInterfaceUdpCreate.
+ * \param[in]	ttl								Number of routers a datagram can cross.
+ * \return										SBG_NO_ERROR if the time to live has been changed.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpSetMulticastTtl(SbgInterface *pInterface, uint8_t ttl);
+
+/*!
+ * Define the local network interface used to send multicast datagrams.
+ *
+ * \param[in]	pInterface						Pointer on a valid UDP interface created using sbgInterfaceUdpCreate.
+ * \param[in]	interfaceAddr					IP address of the local network interface, 0 to let the system choose.
+ * \return										SBG_NO_ERROR if the network interface has been changed.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpSetMulticastInterface(SbgInterface *pInterface, sbgIpAddress interfaceAddr);
+
+/*!
+ * Define if datagrams are accepted from any sender.
+ *
+ * By default, datagrams that don't come from the remote host are discarded. In promiscuous
+ * mode, they are all accepted and the remote host, used to send data, is left unchanged.
+ *
+ * \param[in]	pInterface						Pointer on a valid UDP interface created using sbgInterfaceUdpCreate.
+ * \param[in]	enable							Set to true to accept datagrams from any sender.
+ */
+SBG_COMMON_LIB_API void sbgInterfaceUdpSetPromiscuous(SbgInterface *pInterface, bool enable);
+
+/*!
+ * Define the socket receive buffer size.
+ *
+ * A larger buffer absorbs reception bursts while the application doesn't read the interface.
+ * The size may be limited by the system, net.core.rmem_max on Linux.
+ *
+ * \param[in]	pInterface						Pointer on a valid UDP interface created using sbgInterfaceUdpCreate.
+ * \param[in]	size							Receive buffer size in bytes.
+ * \return										SBG_NO_ERROR if the receive buffer size has been changed.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpSetReceiveBufferSize(SbgInterface *pInterface, size_t size);
+
+/*!
+ * Define the time the kernel busy polls the network device for new datagrams when reading.
+ *
+ * Busy polling reduces the reception latency at the cost of CPU usage. Only supported on Linux,
+ * values above net.core.busy_read require the CAP_NET_ADMIN capability.
+ *
+ * \param[in]	pInterface						Pointer on a valid UDP interface created using sbgInterfaceUdpCreate.
+ * \param[in]	busyPollUs						Busy poll time in us, 0 to disable busy polling.
+ * \return										SBG_NO_ERROR if the busy poll time has been changed.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpSetBusyPoll(SbgInterface *pInterface, uint32_t busyPollUs);
+
+/*!
+ * Define if datagrams are received in batches.
+ *
+ * Batch reception receives up to SBG_INTERFACE_UDP_BATCH_SIZE datagrams per system call
+ * using recvmmsg and reports the number of datagrams dropped by the kernel. Only supported on Linux.
+ *
+ * \param[in]	pInterface						Pointer on a valid UDP interface created using sbgInterfaceUdpCreate.
+ * \param[in]	enable							Set to true to receive datagrams in batches.
+ * \return										SBG_NO_ERROR if the reception mode has been changed.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUdpSetBatchReceive(SbgInterface *pInterface, bool enable);
+
+/*!
+ * Returns the reception statistics of a UDP interface.
+ *
+ * \param[in]	pInterface						Pointer on a valid UDP interface created using sbgInterfaceUdpCreate.
+ * \param[out]	pStats							Reception statistics.
+ */
+SBG_COMMON_LIB_API void sbgInterfaceUdpGetStats(SbgInterface *pInterface, SbgInterfaceUdpStats *pStats);
+
+/*!
+ * Returns the socket descriptor of a UDP interface.
+ *
+ * The descriptor can be used to wait for data in an event loop, it must not be closed.
+ *
+ * \param[in]	pInterface						Pointer on a valid UDP interface created using sbgInterfaceUdpCreate.
+ * \return										Socket descriptor.
+ */
+SBG_COMMON_LIB_API intptr_t sbgInterfaceUdpGetDesc(SbgInterface *pInterface);
+
 #ifdef __cplusplus
 }
 #endif
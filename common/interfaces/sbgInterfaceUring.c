@@ -0,0 +1,1133 @@
+// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <interfaces/sbgInterfaceUring.h>
+
+// Standard headers
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+#endif
+
+//
+// Multishot receives and provided buffer rings require recent kernel headers
+//
+#ifdef IORING_RECV_MULTISHOT
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#define SBG_INTERFACE_URING_SUPPORTED
+#endif // IORING_RECV_MULTISHOT
+
+#ifdef SBG_INTERFACE_URING_SUPPORTED
+
+//----------------------------------------------------------------------//
+//- Private definitions                                                -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Number of submission queue entries.
+ */
+#define SBG_INTERFACE_URING_SQ_ENTRIES					(128)
+
+/*!
+ * Maximum number of provided buffers, limited by the 16 bits buffer ids.
+ */
+#define SBG_INTERFACE_URING_MAX_NR_BUFFERS				(32768)
+
+/*!
+ * Provided buffer group id.
+ */
+#define SBG_INTERFACE_URING_BUFFER_GROUP				(0)
+
+/*!
+ * Invalid buffer id, used to terminate buffer lists.
+ */
+#define SBG_INTERFACE_URING_NO_BUFFER					(UINT32_MAX)
+
+/*!
+ * Maximum time in ms to wait for a request to be canceled.
+ */
+#define SBG_INTERFACE_URING_CANCEL_TIME_OUT				(1000)
+
+/*!
+ * Interface attached to a context.
+ *
+ * Received buffers are queued in a singly linked list until they are read.
+ */
+typedef struct _SbgInterfaceUringSlot
+{
+	SbgInterfaceUringContext	*pContext;			/*!< Context owning the slot. */
+	SbgInterface				*pBase;				/*!< Base interface. */
+	int							 fd;				/*!< Descriptor of the base interface. */
+	bool						 used;				/*!< True if the slot is used by an interface. */
+	bool						 multishot;			/*!< True to use a multishot receive, false for re-armed reads. */
+	bool						 stream;			/*!< True if a zero length completion means the end of the stream. */
+	bool						 armed;				/*!< True while a receive request is in flight. */
+	bool						 closed;			/*!< True once the end of the stream or an error has been reached. */
+	uint32_t					 firstBuffer;		/*!< First received buffer, SBG_INTERFACE_URING_NO_BUFFER if none. */
+	uint32_t					 lastBuffer;		/*!< Last received buffer. */
+	size_t						 offset;			/*!< Number of bytes already read from the first buffer. */
+} SbgInterfaceUringSlot;
+
+/*!
+ * io_uring context.
+ */
+struct _SbgInterfaceUringContext
+{
+	int							 ringFd;								/*!< io_uring descriptor. */
+	void						*pSqRing;								/*!< Mapped submission queue ring. */
+	size_t						 sqRingSize;							/*!< Mapped submission queue ring size. */
+	void						*pCqRing;								/*!< Mapped completion queue ring, may be the submission ring. */
+	size_t						 cqRingSize;							/*!< Mapped completion queue ring size. */
+	struct io_uring_sqe			*pSqes;									/*!< Mapped submission queue entries. */
+	size_t						 sqesSize;								/*!< Mapped submission queue entries size. */
+
+	uint32_t					*pSqHead;								/*!< Submission queue head, written by the kernel. */
+	uint32_t					*pSqTail;								/*!< Submission queue tail. */
+	uint32_t					*pSqArray;								/*!< Submission queue indirection array. */
+	uint32_t					 sqMask;								/*!< Submission queue mask. */
+	uint32_t					 sqEntries;								/*!< Number of submission queue entries. */
+	uint32_t					 sqTail;								/*!< Local submission queue tail. */
+	uint32_t					 nrPending;								/*!< Number of queued submissions. */
+
+	uint32_t					*pCqHead;								/*!< Completion queue head. */
+	uint32_t					*pCqTail;								/*!< Completion queue tail, written by the kernel. */
+	struct io_uring_cqe			*pCqes;									/*!< Completion queue entries. */
+	uint32_t					 cqMask;								/*!< Completion queue mask. */
+
+	struct io_uring_buf_ring	*pBufRing;								/*!< Provided buffer ring, shared with the kernel. */
+	size_t						 bufRingSize;							/*!< Provided buffer ring size in bytes. */
+	uint16_t					 bufTail;								/*!< Local provided buffer ring tail. */
+	uint8_t						*pBuffers;								/*!< Provided buffers. */
+	size_t						 bufferSize;							/*!< Size of each provided buffer. */
+	uint32_t					 nrBuffers;								/*!< Number of provided buffers. */
+	uint32_t					 nrFreeBuffers;							/*!< Number of buffers available to the kernel. */
+	uint32_t					*pBufferLengths;						/*!< Received length of each buffer. */
+	uint32_t					*pBufferNext;							/*!< Next buffer of each buffer in the slot lists. */
+
+	SbgInterfaceUringSlot		 slots[SBG_INTERFACE_URING_MAX_INTERFACES];	/*!< Attached interfaces. */
+	SbgInterfaceUringStats		 stats;									/*!< Statistics. */
+};
+
+//----------------------------------------------------------------------//
+//- Private functions                                                  -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Returns the slot of an io_uring interface.
+ *
+ * \param[in]	pInterface								Interface instance.
+ * \return												The interface slot.
+ */
+static SbgInterfaceUringSlot *sbgInterfaceUringGet(SbgInterface *pInterface)
+{
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_URING);
+	assert(pInterface->handle);
+
+	return (SbgInterfaceUringSlot*)pInterface->handle;
+}
+
+/*!
+ * Returns the slot of an io_uring interface.
+ *
+ * \param[in]	pInterface								Interface instance.
+ * \return												The interface slot.
+ */
+static const SbgInterfaceUringSlot *sbgInterfaceUringGetConst(const SbgInterface *pInterface)
+{
+	assert(pInterface);
+	assert(pInterface->type == SBG_IF_TYPE_URING);
+	assert(pInterface->handle);
+
+	return (const SbgInterfaceUringSlot*)pInterface->handle;
+}
+
+/*!
+ * Enter the ring to submit queued requests and optionally wait for a completion.
+ *
+ * \param[in]	pContext								Context.
+ * \param[in]	wait									True to wait for at least one completion.
+ * \param[in]	timeOut									Maximum time to wait in ms.
+ * \return												SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgInterfaceUringEnter(SbgInterfaceUringContext *pContext, bool wait, uint32_t timeOut)
+{
+	SbgErrorCode						 errorCode = SBG_NO_ERROR;
+	struct io_uring_getevents_arg		 arg;
+	struct __kernel_timespec			 timeSpec;
+	uint32_t							 flags = 0;
+	long								 ret;
+
+	assert(pContext);
+
+	__atomic_store_n(pContext->pSqTail, pContext->sqTail, __ATOMIC_RELEASE);
+
+	memset(&arg, 0, sizeof(arg));
+
+	if (wait)
+	{
+		timeSpec.tv_sec		= timeOut / 1000;
+		timeSpec.tv_nsec	= (long long)(timeOut % 1000) * 1000000ll;
+
+		arg.ts				= (uint64_t)(uintptr_t)&timeSpec;
+		flags				= IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+	}
+
+	ret = syscall(__NR_io_uring_enter, pContext->ringFd, pContext->nrPending, wait ? 1 : 0, flags, wait ? &arg : NULL, wait ? sizeof(arg) : 0);
+
+	pContext->stats.nrSubmitCalls++;
+
+	if (ret >= 0)
+	{
+		assert((uint32_t)ret <= pContext->nrPending);
+
+		pContext->stats.nrSubmissions	+= (uint64_t)ret;
+		pContext->nrPending				-= (uint32_t)ret;
+	}
+	else if ((errno != ETIME) && (errno != EINTR) && (errno != EAGAIN) && (errno != EBUSY))
+	{
+		errorCode = SBG_ERROR;
+		SBG_LOG_ERROR(errorCode, "io_uring_enter failed: %s", strerror(errno));
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Returns a cleared submission queue entry.
+ *
+ * Queued requests are submitted if the submission queue is full.
+ *
+ * \param[in]	pContext								Context.
+ * \return												Submission queue entry, NULL if the submission queue is full.
+ */
+static struct io_uring_sqe *sbgInterfaceUringGetSqe(SbgInterfaceUringContext *pContext)
+{
+	struct io_uring_sqe			*pSqe = NULL;
+	uint32_t					 index;
+
+	assert(pContext);
+
+	if ((pContext->sqTail - __atomic_load_n(pContext->pSqHead, __ATOMIC_ACQUIRE)) >= pContext->sqEntries)
+	{
+		sbgInterfaceUringEnter(pContext, false, 0);
+	}
+
+	if ((pContext->sqTail - __atomic_load_n(pContext->pSqHead, __ATOMIC_ACQUIRE)) < pContext->sqEntries)
+	{
+		index = pContext->sqTail & pContext->sqMask;
+		pSqe = &pContext->pSqes[index];
+
+		memset(pSqe, 0, sizeof(*pSqe));
+
+		pContext->pSqArray[index] = index;
+		pContext->sqTail++;
+		pContext->nrPending++;
+	}
+
+	return pSqe;
+}
+
+/*!
+ * Give a buffer back to the kernel.
+ *
+ * The buffer is only visible to the kernel once sbgInterfaceUringPublishBuffers is called.
+ *
+ * \param[in]	pContext								Context.
+ * \param[in]	bufferId								Buffer id.
+ */
+static void sbgInterfaceUringRecycleBuffer(SbgInterfaceUringContext *pContext, uint32_t bufferId)
+{
+	struct io_uring_buf			*pBuf;
+
+	assert(pContext);
+	assert(bufferId < pContext->nrBuffers);
+
+	pBuf = &pContext->pBufRing->bufs[pContext->bufTail & (pContext->nrBuffers - 1)];
+
+	pBuf->addr	= (uint64_t)(uintptr_t)&pContext->pBuffers[bufferId * pContext->bufferSize];
+	pBuf->len	= (uint32_t)pContext->bufferSize;
+	pBuf->bid	= (uint16_t)bufferId;
+
+	pContext->bufTail++;
+	pContext->nrFreeBuffers++;
+}
+
+/*!
+ * Make recycled buffers visible to the kernel.
+ *
+ * \param[in]	pContext								Context.
+ */
+static void sbgInterfaceUringPublishBuffers(SbgInterfaceUringContext *pContext)
+{
+	assert(pContext);
+
+	__atomic_store_n(&pContext->pBufRing->tail, pContext->bufTail, __ATOMIC_RELEASE);
+}
+
+/*!
+ * Queue the receive request of a slot.
+ *
+ * \param[in]	pContext								Context.
+ * \param[in]	pSlot									Slot.
+ */
+static void sbgInterfaceUringArm(SbgInterfaceUringContext *pContext, SbgInterfaceUringSlot *pSlot)
+{
+	struct io_uring_sqe			*pSqe;
+
+	assert(pContext);
+	assert(pSlot);
+
+	pSqe = sbgInterfaceUringGetSqe(pContext);
+
+	if (pSqe)
+	{
+		if (pSlot->multishot)
+		{
+			pSqe->opcode	= IORING_OP_RECV;
+			pSqe->ioprio	= IORING_RECV_MULTISHOT;
+		}
+		else
+		{
+			pSqe->opcode	= IORING_OP_READ;
+			pSqe->off		= (uint64_t)-1;
+			pSqe->len		= (uint32_t)pContext->bufferSize;
+		}
+
+		pSqe->fd			= pSlot->fd;
+		pSqe->flags			= IOSQE_BUFFER_SELECT;
+		pSqe->buf_group		= SBG_INTERFACE_URING_BUFFER_GROUP;
+		pSqe->user_data		= (uint64_t)(pSlot - pContext->slots) + 1;
+
+		pSlot->armed		= true;
+	}
+}
+
+/*!
+ * Queue the receive requests of all slots that need one.
+ *
+ * Requests are not queued while no buffer is available as they would immediately fail.
+ *
+ * \param[in]	pContext								Context.
+ */
+static void sbgInterfaceUringArmAll(SbgInterfaceUringContext *pContext)
+{
+	assert(pContext);
+
+	for (size_t i = 0; i < SBG_ARRAY_SIZE(pContext->slots); i++)
+	{
+		SbgInterfaceUringSlot		*pSlot = &pContext->slots[i];
+
+		if (pSlot->used && !pSlot->armed && !pSlot->closed && (pContext->nrFreeBuffers != 0))
+		{
+			sbgInterfaceUringArm(pContext, pSlot);
+		}
+	}
+}
+
+/*!
+ * Handle a completion.
+ *
+ * \param[in]	pContext								Context.
+ * \param[in]	pCqe									Completion queue entry.
+ */
+static void sbgInterfaceUringHandleCompletion(SbgInterfaceUringContext *pContext, const struct io_uring_cqe *pCqe)
+{
+	SbgInterfaceUringSlot		*pSlot;
+
+	assert(pContext);
+	assert(pCqe);
+
+	pContext->stats.nrCompletions++;
+
+	//
+	// Cancel requests don't refer to a slot
+	//
+	if ((pCqe->user_data != 0) && (pCqe->user_data <= SBG_ARRAY_SIZE(pContext->slots)))
+	{
+		pSlot = &pContext->slots[pCqe->user_data - 1];
+
+		if (pCqe->flags & IORING_CQE_F_BUFFER)
+		{
+			uint32_t			 bufferId;
+
+			bufferId = pCqe->flags >> IORING_CQE_BUFFER_SHIFT;
+
+			assert(bufferId < pContext->nrBuffers);
+			assert(pContext->nrFreeBuffers != 0);
+
+			pContext->nrFreeBuffers--;
+
+			if (pCqe->res > 0)
+			{
+				pContext->pBufferLengths[bufferId]	= (uint32_t)pCqe->res;
+				pContext->pBufferNext[bufferId]		= SBG_INTERFACE_URING_NO_BUFFER;
+
+				if (pSlot->firstBuffer == SBG_INTERFACE_URING_NO_BUFFER)
+				{
+					pSlot->firstBuffer = bufferId;
+				}
+				else
+				{
+					pContext->pBufferNext[pSlot->lastBuffer] = bufferId;
+				}
+
+				pSlot->lastBuffer = bufferId;
+			}
+			else
+			{
+				sbgInterfaceUringRecycleBuffer(pContext, bufferId);
+			}
+		}
+
+		if (pCqe->res == -ENOBUFS)
+		{
+			pContext->stats.nrBufferShortages++;
+		}
+		else if ((pCqe->res < 0) && (pCqe->res != -ECANCELED) && (pCqe->res != -EAGAIN) && (pCqe->res != -EINTR))
+		{
+			pSlot->closed = true;
+			SBG_LOG_ERROR(SBG_READ_ERROR, "receive failed: %s", strerror(-pCqe->res));
+		}
+		else if ((pCqe->res == 0) && pSlot->stream)
+		{
+			pSlot->closed = true;
+		}
+
+		if (!(pCqe->flags & IORING_CQE_F_MORE))
+		{
+			pSlot->armed = false;
+		}
+	}
+}
+
+/*!
+ * Handle all available completions.
+ *
+ * Only shared memory is accessed, no system call is made.
+ *
+ * \param[in]	pContext								Context.
+ */
+static void sbgInterfaceUringReap(SbgInterfaceUringContext *pContext)
+{
+	uint32_t					 head;
+	uint32_t					 tail;
+
+	assert(pContext);
+
+	head	= *pContext->pCqHead;
+	tail	= __atomic_load_n(pContext->pCqTail, __ATOMIC_ACQUIRE);
+
+	if (head != tail)
+	{
+		while (head != tail)
+		{
+			sbgInterfaceUringHandleCompletion(pContext, &pContext->pCqes[head & pContext->cqMask]);
+			head++;
+		}
+
+		__atomic_store_n(pContext->pCqHead, head, __ATOMIC_RELEASE);
+
+		sbgInterfaceUringPublishBuffers(pContext);
+	}
+}
+
+/*!
+ * Reap completions, re-arm receive requests and submit them.
+ *
+ * \param[in]	pContext								Context.
+ */
+static void sbgInterfaceUringPoll(SbgInterfaceUringContext *pContext)
+{
+	assert(pContext);
+
+	sbgInterfaceUringReap(pContext);
+	sbgInterfaceUringArmAll(pContext);
+
+	if (pContext->nrPending != 0)
+	{
+		sbgInterfaceUringEnter(pContext, false, 0);
+	}
+}
+
+/*!
+ * Returns true if an interface has data to read or has been closed.
+ *
+ * \param[in]	pContext								Context.
+ * \return												true if a read would return data or an error.
+ */
+static bool sbgInterfaceUringIsReady(const SbgInterfaceUringContext *pContext)
+{
+	assert(pContext);
+
+	for (size_t i = 0; i < SBG_ARRAY_SIZE(pContext->slots); i++)
+	{
+		const SbgInterfaceUringSlot		*pSlot = &pContext->slots[i];
+
+		if (pSlot->used && ((pSlot->firstBuffer != SBG_INTERFACE_URING_NO_BUFFER) || pSlot->closed))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*!
+ * Release all context resources.
+ *
+ * \param[in]	pContext								Context, possibly partially initialized.
+ */
+static void sbgInterfaceUringRelease(SbgInterfaceUringContext *pContext)
+{
+	assert(pContext);
+
+	if (pContext->ringFd >= 0)
+	{
+		close(pContext->ringFd);
+	}
+
+	if (pContext->pBufRing != MAP_FAILED)
+	{
+		munmap(pContext->pBufRing, pContext->bufRingSize);
+	}
+
+	if (pContext->pSqes != MAP_FAILED)
+	{
+		munmap(pContext->pSqes, pContext->sqesSize);
+	}
+
+	if ((pContext->pCqRing != MAP_FAILED) && (pContext->pCqRing != pContext->pSqRing))
+	{
+		munmap(pContext->pCqRing, pContext->cqRingSize);
+	}
+
+	if (pContext->pSqRing != MAP_FAILED)
+	{
+		munmap(pContext->pSqRing, pContext->sqRingSize);
+	}
+
+	free(pContext->pBuffers);
+	free(pContext->pBufferLengths);
+	free(pContext->pBufferNext);
+	free(pContext);
+}
+
+/*!
+ * Map the rings of a context.
+ *
+ * \param[in]	pContext								Context.
+ * \param[in]	pParams									Parameters returned by io_uring_setup.
+ * \return												SBG_NO_ERROR if the rings have been mapped.
+ */
+static SbgErrorCode sbgInterfaceUringMap(SbgInterfaceUringContext *pContext, const struct io_uring_params *pParams)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+
+	assert(pContext);
+	assert(pParams);
+
+	pContext->sqRingSize	= pParams->sq_off.array + (pParams->sq_entries * sizeof(uint32_t));
+	pContext->cqRingSize	= pParams->cq_off.cqes + (pParams->cq_entries * sizeof(struct io_uring_cqe));
+	pContext->sqesSize		= pParams->sq_entries * sizeof(struct io_uring_sqe);
+
+	if (pParams->features & IORING_FEAT_SINGLE_MMAP)
+	{
+		pContext->sqRingSize = sbgMax(pContext->sqRingSize, pContext->cqRingSize);
+	}
+
+	pContext->pSqRing = mmap(NULL, pContext->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, pContext->ringFd, IORING_OFF_SQ_RING);
+
+	if (pParams->features & IORING_FEAT_SINGLE_MMAP)
+	{
+		pContext->pCqRing = pContext->pSqRing;
+	}
+	else
+	{
+		pContext->pCqRing = mmap(NULL, pContext->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, pContext->ringFd, IORING_OFF_CQ_RING);
+	}
+
+	pContext->pSqes = mmap(NULL, pContext->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, pContext->ringFd, IORING_OFF_SQES);
+
+	if ((pContext->pSqRing != MAP_FAILED) && (pContext->pCqRing != MAP_FAILED) && (pContext->pSqes != MAP_FAILED))
+	{
+		uint8_t					*pSqRing = pContext->pSqRing;
+		uint8_t					*pCqRing = pContext->pCqRing;
+
+		pContext->pSqHead		= (uint32_t *)(pSqRing + pParams->sq_off.head);
+		pContext->pSqTail		= (uint32_t *)(pSqRing + pParams->sq_off.tail);
+		pContext->pSqArray		= (uint32_t *)(pSqRing + pParams->sq_off.array);
+		pContext->sqMask		= *(uint32_t *)(pSqRing + pParams->sq_off.ring_mask);
+		pContext->sqEntries		= *(uint32_t *)(pSqRing + pParams->sq_off.ring_entries);
+		pContext->sqTail		= *pContext->pSqTail;
+
+		pContext->pCqHead		= (uint32_t *)(pCqRing + pParams->cq_off.head);
+		pContext->pCqTail		= (uint32_t *)(pCqRing + pParams->cq_off.tail);
+		pContext->pCqes			= (struct io_uring_cqe *)(pCqRing + pParams->cq_off.cqes);
+		pContext->cqMask		= *(uint32_t *)(pCqRing + pParams->cq_off.ring_mask);
+	}
+	else
+	{
+		errorCode = SBG_ERROR;
+		SBG_LOG_ERROR(errorCode, "unable to map io_uring rings");
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Register the provided buffer ring of a context.
+ *
+ * \param[in]	pContext								Context.
+ * \return												SBG_NO_ERROR if the buffers have been registered.
+ */
+static SbgErrorCode sbgInterfaceUringRegisterBuffers(SbgInterfaceUringContext *pContext)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+
+	assert(pContext);
+
+	pContext->bufRingSize	= pContext->nrBuffers * sizeof(struct io_uring_buf);
+	pContext->pBufRing		= mmap(NULL, pContext->bufRingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	pContext->pBuffers		= malloc(pContext->nrBuffers * pContext->bufferSize);
+	pContext->pBufferLengths= malloc(pContext->nrBuffers * sizeof(*pContext->pBufferLengths));
+	pContext->pBufferNext	= malloc(pContext->nrBuffers * sizeof(*pContext->pBufferNext));
+
+	if ((pContext->pBufRing != MAP_FAILED) && pContext->pBuffers && pContext->pBufferLengths && pContext->pBufferNext)
+	{
+		struct io_uring_buf_reg		 bufReg;
+
+		memset(&bufReg, 0, sizeof(bufReg));
+
+		bufReg.ring_addr	= (uint64_t)(uintptr_t)pContext->pBufRing;
+		bufReg.ring_entries	= pContext->nrBuffers;
+		bufReg.bgid			= SBG_INTERFACE_URING_BUFFER_GROUP;
+
+		if (syscall(__NR_io_uring_register, pContext->ringFd, IORING_REGISTER_PBUF_RING, &bufReg, 1) == 0)
+		{
+			for (uint32_t i = 0; i < pContext->nrBuffers; i++)
+			{
+				sbgInterfaceUringRecycleBuffer(pContext, i);
+			}
+
+			sbgInterfaceUringPublishBuffers(pContext);
+		}
+		else
+		{
+			errorCode = SBG_ERROR;
+			SBG_LOG_ERROR(errorCode, "provided buffer rings not supported: %s", strerror(errno));
+		}
+	}
+	else
+	{
+		errorCode = SBG_MALLOC_FAILED;
+		SBG_LOG_ERROR(errorCode, "unable to allocate buffers");
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Destroy an interface initialized using sbgInterfaceUringCreate.
+ *
+ * The receive request is canceled and the received buffers are given back to the kernel.
+ *
+ * \param[in]	pInterface						Pointer on a valid io_uring interface.
+ * \return										SBG_NO_ERROR if the interface has been closed and released.
+ */
+static SbgErrorCode sbgInterfaceUringDestroy(SbgInterface *pInterface)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+	SbgInterfaceUringSlot		*pSlot;
+	SbgInterfaceUringContext	*pContext;
+	uint32_t					 bufferId;
+
+	assert(pInterface);
+
+	pSlot		= sbgInterfaceUringGet(pInterface);
+	pContext	= pSlot->pContext;
+
+	//
+	// Prevent the slot from being re-armed while canceling
+	//
+	pSlot->closed = true;
+
+	sbgInterfaceUringReap(pContext);
+
+	if (pSlot->armed)
+	{
+		struct io_uring_sqe		*pSqe;
+		uint32_t				 startTime;
+
+		pSqe = sbgInterfaceUringGetSqe(pContext);
+
+		if (pSqe)
+		{
+			pSqe->opcode	= IORING_OP_ASYNC_CANCEL;
+			pSqe->addr		= (uint64_t)(pSlot - pContext->slots) + 1;
+			pSqe->user_data	= 0;
+		}
+
+		startTime = sbgGetTime();
+
+		while (pSlot->armed && ((sbgGetTime() - startTime) < SBG_INTERFACE_URING_CANCEL_TIME_OUT))
+		{
+			sbgInterfaceUringEnter(pContext, true, SBG_INTERFACE_URING_CANCEL_TIME_OUT);
+			sbgInterfaceUringReap(pContext);
+		}
+
+		if (pSlot->armed)
+		{
+			errorCode = SBG_TIME_OUT;
+			SBG_LOG_ERROR(errorCode, "unable to cancel receive request");
+		}
+	}
+
+	for (bufferId = pSlot->firstBuffer; bufferId != SBG_INTERFACE_URING_NO_BUFFER; )
+	{
+		uint32_t				 nextBufferId;
+
+		nextBufferId = pContext->pBufferNext[bufferId];
+		sbgInterfaceUringRecycleBuffer(pContext, bufferId);
+		bufferId = nextBufferId;
+	}
+
+	sbgInterfaceUringPublishBuffers(pContext);
+
+	//
+	// A slot still armed can't be reused as completions would be delivered to the new interface
+	//
+	if (errorCode == SBG_NO_ERROR)
+	{
+		pSlot->used = false;
+	}
+
+	sbgInterfaceZeroInit(pInterface);
+
+	return errorCode;
+}
+
+/*!
+ * Try to write some data to an interface.
+ *
+ * \param[in]	pHandle									Valid handle on an initialized interface.
+ * \param[in]	pBuffer									Pointer on an allocated buffer that contains the data to write
+ * \param[in]	bytesToWrite							Number of bytes we would like to write.
+ * \return												SBG_NO_ERROR if all bytes have been written successfully.
+ */
+static SbgErrorCode sbgInterfaceUringWrite(SbgInterface *pInterface, const void *pBuffer, size_t bytesToWrite)
+{
+	assert(pInterface);
+
+	return sbgInterfaceWrite(sbgInterfaceUringGet(pInterface)->pBase, pBuffer, bytesToWrite);
+}
+
+/*!
+ * Try to read some data from an interface.
+ *
+ * \param[in]	pHandle									Valid handle on an initialized interface.
+ * \param[in]	pBuffer									Pointer on an allocated buffer that can hold at least bytesToRead bytes of data.
+ * \param[out]	pReadBytes								Pointer on an uint32_t used to return the number of read bytes.
+ * \param[in]	bytesToRead								Number of bytes we would like to read.
+ * \return												SBG_NO_ERROR if no error occurs, please check the number of received bytes.
+ */
+static SbgErrorCode sbgInterfaceUringRead(SbgInterface *pInterface, void *pBuffer, size_t *pReadBytes, size_t bytesToRead)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+	SbgInterfaceUringSlot		*pSlot;
+	SbgInterfaceUringContext	*pContext;
+	size_t						 readBytes = 0;
+	bool						 recycled = false;
+
+	assert(pInterface);
+	assert(pBuffer);
+	assert(pReadBytes);
+
+	pSlot		= sbgInterfaceUringGet(pInterface);
+	pContext	= pSlot->pContext;
+
+	if (pSlot->firstBuffer == SBG_INTERFACE_URING_NO_BUFFER)
+	{
+		sbgInterfaceUringPoll(pContext);
+	}
+
+	while ((readBytes < bytesToRead) && (pSlot->firstBuffer != SBG_INTERFACE_URING_NO_BUFFER))
+	{
+		uint32_t				 bufferId = pSlot->firstBuffer;
+		size_t					 size;
+
+		size = sbgMin(pContext->pBufferLengths[bufferId] - pSlot->offset, bytesToRead - readBytes);
+
+		memcpy((uint8_t *)pBuffer + readBytes, &pContext->pBuffers[(bufferId * pContext->bufferSize) + pSlot->offset], size);
+
+		readBytes		+= size;
+		pSlot->offset	+= size;
+
+		if (pSlot->offset == pContext->pBufferLengths[bufferId])
+		{
+			pSlot->firstBuffer	= pContext->pBufferNext[bufferId];
+			pSlot->offset		= 0;
+
+			sbgInterfaceUringRecycleBuffer(pContext, bufferId);
+			recycled = true;
+		}
+	}
+
+	if (recycled)
+	{
+		sbgInterfaceUringPublishBuffers(pContext);
+	}
+
+	if ((readBytes == 0) && pSlot->closed)
+	{
+		errorCode = SBG_READ_ERROR;
+	}
+
+	*pReadBytes = readBytes;
+
+	return errorCode;
+}
+
+/*!
+ * Make an interface flush pending input and/or output data.
+ *
+ * \param[in]	pInterface								Interface instance.
+ * \param[in]	flags									Combination of the SBG_IF_FLUSH_INPUT and SBG_IF_FLUSH_OUTPUT flags.
+ * \return												SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgInterfaceUringFlush(SbgInterface *pInterface, uint32_t flags)
+{
+	assert(pInterface);
+
+	return sbgInterfaceFlush(sbgInterfaceUringGet(pInterface)->pBase, flags);
+}
+
+/*!
+ * Change an interface input and output speed in bps.
+ *
+ * \param[in]	pInterface								Interface instance.
+ * \param[in]	speed									The new interface speed to set in bps.
+ * \return												SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgInterfaceUringSetSpeed(SbgInterface *pInterface, uint32_t speed)
+{
+	assert(pInterface);
+
+	return sbgInterfaceSetSpeed(sbgInterfaceUringGet(pInterface)->pBase, speed);
+}
+
+/*!
+ * Returns the current interface baud rate in bps.
+ *
+ * \param[in]	pInterface								Interface instance.
+ * \return												The current interface baud rate in bps or zero if not applicable.
+ */
+static uint32_t sbgInterfaceUringGetSpeed(const SbgInterface *pInterface)
+{
+	assert(pInterface);
+
+	return sbgInterfaceGetSpeed(sbgInterfaceUringGetConst(pInterface)->pBase);
+}
+
+/*!
+ * Compute and return the delay needed by the interface to transmit / receive X number of bytes.
+ *
+ * \param[in]	pInterface								Interface instance.
+ * \param[in]	numBytes								The number of bytes to transmit / receive to evaluate the needed delay.
+ * \return												The expected delay in us or 0 if not applicable.
+ */
+static uint32_t sbgInterfaceUringGetDelay(const SbgInterface *pInterface, size_t numBytes)
+{
+	assert(pInterface);
+
+	return sbgInterfaceGetDelay(sbgInterfaceUringGetConst(pInterface)->pBase, numBytes);
+}
+
+//----------------------------------------------------------------------//
+//- Public functions                                                   -//
+//----------------------------------------------------------------------//
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUringContextCreate(SbgInterfaceUringContext **ppContext, size_t bufferSize, uint32_t nrBuffers)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+	SbgInterfaceUringContext	*pContext;
+
+	assert(ppContext);
+
+	if ((bufferSize != 0) && (bufferSize <= UINT32_MAX) && (nrBuffers != 0) && (nrBuffers <= SBG_INTERFACE_URING_MAX_NR_BUFFERS))
+	{
+		pContext = calloc(1, sizeof(*pContext));
+
+		if (pContext)
+		{
+			struct io_uring_params		 params;
+			uint32_t					 roundedNrBuffers = 1;
+
+			while (roundedNrBuffers < nrBuffers)
+			{
+				roundedNrBuffers <<= 1;
+			}
+
+			pContext->ringFd		= -1;
+			pContext->pSqRing		= MAP_FAILED;
+			pContext->pCqRing		= MAP_FAILED;
+			pContext->pSqes			= MAP_FAILED;
+			pContext->pBufRing		= MAP_FAILED;
+			pContext->bufferSize	= bufferSize;
+			pContext->nrBuffers		= roundedNrBuffers;
+
+			for (size_t i = 0; i < SBG_ARRAY_SIZE(pContext->slots); i++)
+			{
+				pContext->slots[i].pContext = pContext;
+			}
+
+			//
+			// Each buffer produces at most one completion, size the completion queue so it never overflows
+			//
+			memset(&params, 0, sizeof(params));
+
+			params.flags		= IORING_SETUP_CQSIZE;
+			params.cq_entries	= roundedNrBuffers + (2 * SBG_INTERFACE_URING_MAX_INTERFACES);
+
+			pContext->ringFd = (int)syscall(__NR_io_uring_setup, SBG_INTERFACE_URING_SQ_ENTRIES, &params);
+
+			if (pContext->ringFd >= 0)
+			{
+				errorCode = sbgInterfaceUringMap(pContext, &params);
+
+				if (errorCode == SBG_NO_ERROR)
+				{
+					errorCode = sbgInterfaceUringRegisterBuffers(pContext);
+				}
+			}
+			else
+			{
+				errorCode = SBG_ERROR;
+				SBG_LOG_ERROR(errorCode, "io_uring not available: %s", strerror(errno));
+			}
+
+			if (errorCode == SBG_NO_ERROR)
+			{
+				*ppContext = pContext;
+			}
+			else
+			{
+				sbgInterfaceUringRelease(pContext);
+			}
+		}
+		else
+		{
+			errorCode = SBG_MALLOC_FAILED;
+			SBG_LOG_ERROR(errorCode, "unable to allocate context");
+		}
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+		SBG_LOG_ERROR(errorCode, "invalid buffer configuration");
+	}
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API void sbgInterfaceUringContextDestroy(SbgInterfaceUringContext *pContext)
+{
+	assert(pContext);
+
+	for (size_t i = 0; i < SBG_ARRAY_SIZE(pContext->slots); i++)
+	{
+		assert(!pContext->slots[i].used);
+	}
+
+	sbgInterfaceUringRelease(pContext);
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUringWait(SbgInterfaceUringContext *pContext, uint32_t timeOut)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+
+	assert(pContext);
+
+	sbgInterfaceUringReap(pContext);
+
+	if (!sbgInterfaceUringIsReady(pContext))
+	{
+		sbgInterfaceUringArmAll(pContext);
+
+		errorCode = sbgInterfaceUringEnter(pContext, true, timeOut);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			sbgInterfaceUringReap(pContext);
+
+			if (!sbgInterfaceUringIsReady(pContext))
+			{
+				errorCode = SBG_TIME_OUT;
+			}
+		}
+	}
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API void sbgInterfaceUringGetStats(const SbgInterfaceUringContext *pContext, SbgInterfaceUringStats *pStats)
+{
+	assert(pContext);
+	assert(pStats);
+
+	*pStats = pContext->stats;
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUringCreate(SbgInterface *pInterface, SbgInterfaceUringContext *pContext, SbgInterface *pBase, intptr_t desc)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+	SbgInterfaceUringSlot		*pSlot = NULL;
+	struct stat					 fileStat;
+
+	assert(pInterface);
+	assert(pContext);
+	assert(pBase);
+
+	//
+	// Always call the underlying zero init method to make sure we can correctly handle SbgInterface evolutions
+	//
+	sbgInterfaceZeroInit(pInterface);
+
+	for (size_t i = 0; i < SBG_ARRAY_SIZE(pContext->slots); i++)
+	{
+		if (!pContext->slots[i].used)
+		{
+			pSlot = &pContext->slots[i];
+			break;
+		}
+	}
+
+	if (pSlot)
+	{
+		if (fstat((int)desc, &fileStat) == 0)
+		{
+			char				 interfaceName[SBG_IF_NAME_MAX_SIZE + 8];
+
+			pSlot->pBase		= pBase;
+			pSlot->fd			= (int)desc;
+			pSlot->used			= true;
+			pSlot->armed		= false;
+			pSlot->closed		= false;
+			pSlot->firstBuffer	= SBG_INTERFACE_URING_NO_BUFFER;
+			pSlot->lastBuffer	= SBG_INTERFACE_URING_NO_BUFFER;
+			pSlot->offset		= 0;
+			pSlot->multishot	= S_ISSOCK(fileStat.st_mode);
+			pSlot->stream		= true;
+
+			if (pSlot->multishot)
+			{
+				int				 socketType;
+				socklen_t		 optLength = sizeof(socketType);
+
+				if ((getsockopt(pSlot->fd, SOL_SOCKET, SO_TYPE, &socketType, &optLength) == 0) && (socketType != SOCK_STREAM))
+				{
+					pSlot->stream = false;
+				}
+			}
+
+			pInterface->handle			= pSlot;
+			pInterface->type			= SBG_IF_TYPE_URING;
+
+			//
+			// Define the interface name
+			//
+			snprintf(interfaceName, sizeof(interfaceName), "uring: %s", pBase->name);
+			sbgInterfaceNameSet(pInterface, interfaceName);
+
+			//
+			// Define all overloaded members
+			//
+			pInterface->pDestroyFunc	= sbgInterfaceUringDestroy;
+			pInterface->pReadFunc		= sbgInterfaceUringRead;
+			pInterface->pWriteFunc		= sbgInterfaceUringWrite;
+			pInterface->pFlushFunc		= sbgInterfaceUringFlush;
+			pInterface->pSetSpeedFunc	= sbgInterfaceUringSetSpeed;
+			pInterface->pGetSpeedFunc	= sbgInterfaceUringGetSpeed;
+			pInterface->pDelayFunc		= sbgInterfaceUringGetDelay;
+
+			//
+			// Receive requests of several interfaces are submitted together on the next read
+			//
+			sbgInterfaceUringArm(pContext, pSlot);
+		}
+		else
+		{
+			errorCode = SBG_INVALID_PARAMETER;
+			SBG_LOG_ERROR(errorCode, "invalid descriptor");
+		}
+	}
+	else
+	{
+		errorCode = SBG_BUFFER_OVERFLOW;
+		SBG_LOG_ERROR(errorCode, "too many interfaces");
+	}
+
+	return errorCode;
+}
+
+#else // SBG_INTERFACE_URING_SUPPORTED
+
+//----------------------------------------------------------------------//
+//- Public functions                                                   -//
+//----------------------------------------------------------------------//
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUringContextCreate(SbgInterfaceUringContext **ppContext, size_t bufferSize, uint32_t nrBuffers)
+{
+	SbgErrorCode				 errorCode = SBG_ERROR;
+
+	assert(ppContext);
+
+	SBG_UNUSED_PARAMETER(bufferSize);
+	SBG_UNUSED_PARAMETER(nrBuffers);
+
+	SBG_LOG_ERROR(errorCode, "io_uring not supported on this platform");
+
+	return errorCode;
+}
+
+SBG_COMMON_LIB_API void sbgInterfaceUringContextDestroy(SbgInterfaceUringContext *pContext)
+{
+	SBG_UNUSED_PARAMETER(pContext);
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUringWait(SbgInterfaceUringContext *pContext, uint32_t timeOut)
+{
+	SBG_UNUSED_PARAMETER(pContext);
+	SBG_UNUSED_PARAMETER(timeOut);
+
+	return SBG_ERROR;
+}
+
+SBG_COMMON_LIB_API void sbgInterfaceUringGetStats(const SbgInterfaceUringContext *pContext, SbgInterfaceUringStats *pStats)
+{
+	assert(pStats);
+
+	SBG_UNUSED_PARAMETER(pContext);
+
+	memset(pStats, 0, sizeof(*pStats));
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUringCreate(SbgInterface *pInterface, SbgInterfaceUringContext *pContext, SbgInterface *pBase, intptr_t desc)
+{
+	assert(pInterface);
+
+	SBG_UNUSED_PARAMETER(pContext);
+	SBG_UNUSED_PARAMETER(pBase);
+	SBG_UNUSED_PARAMETER(desc);
+
+	sbgInterfaceZeroInit(pInterface);
+
+	return SBG_ERROR;
+}
+
+#endif // SBG_INTERFACE_URING_SUPPORTED
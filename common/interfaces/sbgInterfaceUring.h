@@ -0,0 +1,158 @@
+/*!
+ *      \file           sbgInterfaceUring.h
+ *      \author         SBG Systems
+ *      \date           19 October 2026
+ *
+ *      \brief          io_uring reception backend for serial, UDP and TCP interfaces.
+ *
+ *                      A context shares one io_uring instance and a ring of provided buffers between
+ *                      many interfaces. Sockets use multishot receives and completions are reaped
+ *                      from shared memory so steady state reads don't need any system call.
+ *
+ *      \section CodeCopyright Copyright Notice
+ *      The MIT license
+ *
+ *      Copyright (C) 2007-2022, SBG Systems SAS. All rights reserved.
+ *
+ *      Permission is hereby granted, free of charge, to any person obtaining a copy
+ *      of this software and associated documentation files (the "Software"), to deal
+ *      in the Software without restriction, including without limitation the rights
+ *      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *      copies of the Software, and to permit persons to whom the Software is
+ *      furnished to do so, subject to the following conditions:
+ *
+ *      The above copyright notice and this permission notice shall be included in all
+ *      copies or substantial portions of the Software.
+ *
+ *      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *      SOFTWARE.
+ */
+
+#ifndef SBG_INTERFACE_URING_H
+#define SBG_INTERFACE_URING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <interfaces/sbgInterface.h>
+
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Maximum number of interfaces attached to a context.
+ */
+#define SBG_INTERFACE_URING_MAX_INTERFACES			(64)
+
+/*!
+ * Default size of each provided buffer, in bytes.
+ */
+#define SBG_INTERFACE_URING_DEFAULT_BUFFER_SIZE		(4096)
+
+/*!
+ * Default number of provided buffers shared by all interfaces of a context.
+ */
+#define SBG_INTERFACE_URING_DEFAULT_NR_BUFFERS		(1024)
+
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Opaque io_uring context.
+ */
+typedef struct _SbgInterfaceUringContext SbgInterfaceUringContext;
+
+/*!
+ * io_uring context statistics.
+ */
+typedef struct _SbgInterfaceUringStats
+{
+	uint64_t		nrCompletions;						/*!< Number of completions reaped. */
+	uint64_t		nrSubmitCalls;						/*!< Number of io_uring_enter system calls. */
+	uint64_t		nrSubmissions;						/*!< Number of submitted requests. */
+	uint64_t		nrBufferShortages;					/*!< Number of receives stopped because no provided buffer was available. */
+} SbgInterfaceUringStats;
+
+//----------------------------------------------------------------------//
+//- Public functions                                                   -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Create an io_uring context.
+ *
+ * The context fails to be created on platforms other than Linux or when the kernel doesn't support
+ * io_uring with provided buffer rings (Linux 6.0 and later), or forbids it. Existing interfaces
+ * must then be used directly.
+ *
+ * A context and its interfaces must only be used by a single thread.
+ *
+ * \param[out]	ppContext						Created context.
+ * \param[in]	bufferSize						Size of each provided buffer, in bytes.
+ * \param[in]	nrBuffers						Number of provided buffers, rounded up to a power of two.
+ * \return										SBG_NO_ERROR if the context has been created.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUringContextCreate(SbgInterfaceUringContext **ppContext, size_t bufferSize, uint32_t nrBuffers);
+
+/*!
+ * Destroy an io_uring context.
+ *
+ * All interfaces using the context must have been destroyed.
+ *
+ * \param[in]	pContext						Context.
+ */
+SBG_COMMON_LIB_API void sbgInterfaceUringContextDestroy(SbgInterfaceUringContext *pContext);
+
+/*!
+ * Wait until data is available on any interface of a context.
+ *
+ * Pending submissions are sent in the same system call.
+ *
+ * \param[in]	pContext						Context.
+ * \param[in]	timeOut							Maximum time to wait in ms.
+ * \return										SBG_NO_ERROR if data is available, SBG_TIME_OUT otherwise.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUringWait(SbgInterfaceUringContext *pContext, uint32_t timeOut);
+
+/*!
+ * Returns the statistics of an io_uring context.
+ *
+ * \param[in]	pContext						Context.
+ * \param[out]	pStats							Statistics.
+ */
+SBG_COMMON_LIB_API void sbgInterfaceUringGetStats(const SbgInterfaceUringContext *pContext, SbgInterfaceUringStats *pStats);
+
+/*!
+ * Initialize an interface receiving the data of a base interface through io_uring.
+ *
+ * Data is received from the descriptor of the base interface, for example returned by sbgInterfaceSerialGetDesc,
+ * sbgInterfaceUdpGetDesc or sbgInterfaceTcpGetDesc, into the provided buffers and then copied to the read buffers.
+ * Sockets use a multishot receive, other descriptors a read request re-armed after each completion.
+ *
+ * Writes, flushes and speed changes are forwarded to the base interface. The UDP remote host check
+ * is not applied to received datagrams.
+ *
+ * The base interface is not destroyed with the interface and must outlive it.
+ *
+ * \param[in]	pInterface						Pointer on an allocated interface instance to initialize.
+ * \param[in]	pContext						Context.
+ * \param[in]	pBase							Base interface.
+ * \param[in]	desc							Descriptor of the base interface.
+ * \return										SBG_NO_ERROR if the interface has been created.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgInterfaceUringCreate(SbgInterface *pInterface, SbgInterfaceUringContext *pContext, SbgInterface *pBase, intptr_t desc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_INTERFACE_URING_H
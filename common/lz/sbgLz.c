@@ -0,0 +1,365 @@
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+// Local headers
+#include "sbgLz.h"
+
+//----------------------------------------------------------------------//
+//- Private definitions                                                -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Number of bits of the match finder hash, the hash table has 2^SBG_LZ_HASH_LOG entries.
+ */
+#define SBG_LZ_HASH_LOG								(12)
+
+/*!
+ * Value of a token length nibble meaning that extension bytes follow.
+ */
+#define SBG_LZ_TOKEN_LENGTH_MAX						(15)
+
+/*!
+ * Number of consecutive failed match attempts before the match finder starts skipping bytes.
+ *
+ * Skipping quickly goes through data that can't be compressed.
+ */
+#define SBG_LZ_SKIP_TRIGGER							(6)
+
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Read four bytes in host order.
+ *
+ * \param[in]	pBuffer						Buffer.
+ * \return									Read value.
+ */
+static uint32_t sbgLzRead32(const uint8_t *pBuffer)
+{
+	uint32_t	value;
+
+	memcpy(&value, pBuffer, sizeof(value));
+
+	return value;
+}
+
+/*!
+ * Hash four bytes for the match finder.
+ *
+ * \param[in]	value						Four bytes read with sbgLzRead32.
+ * \return									Hash table index.
+ */
+static uint32_t sbgLzHash(uint32_t value)
+{
+	return (value * 2654435761u) >> (32 - SBG_LZ_HASH_LOG);
+}
+
+/*!
+ * Write the extension bytes of a length that doesn't fit in a token nibble.
+ *
+ * \param[in]	pOut						Output pointer.
+ * \param[in]	length						Length minus SBG_LZ_TOKEN_LENGTH_MAX.
+ * \return									Output pointer after the extension bytes.
+ */
+static uint8_t *sbgLzWriteLengthExtension(uint8_t *pOut, size_t length)
+{
+	assert(pOut);
+
+	while (length >= 255)
+	{
+		*pOut++	= 255;
+		length	-= 255;
+	}
+
+	*pOut++ = (uint8_t)length;
+
+	return pOut;
+}
+
+/*!
+ * Read the extension bytes of a length.
+ *
+ * \param[in,out]	ppIn					Input pointer, moved after the extension bytes.
+ * \param[in]		pInEnd					End of the input.
+ * \param[in,out]	pLength					Length to extend.
+ * \return									SBG_NO_ERROR if successful, SBG_INVALID_FRAME if the input is truncated.
+ */
+static SbgErrorCode sbgLzReadLengthExtension(const uint8_t **ppIn, const uint8_t *pInEnd, size_t *pLength)
+{
+	SbgErrorCode	 errorCode = SBG_INVALID_FRAME;
+	const uint8_t	*pIn;
+
+	assert(ppIn);
+	assert(pLength);
+
+	pIn = *ppIn;
+
+	while (pIn < pInEnd)
+	{
+		uint8_t		 byte = *pIn++;
+
+		*pLength += byte;
+
+		if (byte != 255)
+		{
+			errorCode = SBG_NO_ERROR;
+			break;
+		}
+	}
+
+	*ppIn = pIn;
+
+	return errorCode;
+}
+
+/*!
+ * Write a sequence made of literals optionally followed by a back reference.
+ *
+ * \param[in]	pOut						Output pointer.
+ * \param[in]	pOutEnd						End of the output buffer.
+ * \param[in]	pLiterals					Literals.
+ * \param[in]	literalLength				Number of literals.
+ * \param[in]	offset						Back reference distance, 0 for the last sequence.
+ * \param[in]	matchLength					Back reference length, at least SBG_LZ_MIN_MATCH.
+ * \return									Output pointer after the sequence, NULL if the output buffer is too small.
+ */
+static uint8_t *sbgLzWriteSequence(uint8_t *pOut, const uint8_t *pOutEnd, const uint8_t *pLiterals, size_t literalLength, size_t offset, size_t matchLength)
+{
+	uint8_t		*pToken;
+
+	assert(pOut);
+	assert(pOutEnd);
+
+	//
+	// Conservative size check: token, length extensions, literals and offset
+	//
+	if ((size_t)(pOutEnd - pOut) >= (1 + (literalLength / 255) + 1 + literalLength + 2 + (matchLength / 255) + 1))
+	{
+		pToken = pOut++;
+
+		if (literalLength >= SBG_LZ_TOKEN_LENGTH_MAX)
+		{
+			*pToken	= SBG_LZ_TOKEN_LENGTH_MAX << 4;
+			pOut	= sbgLzWriteLengthExtension(pOut, literalLength - SBG_LZ_TOKEN_LENGTH_MAX);
+		}
+		else
+		{
+			*pToken = (uint8_t)(literalLength << 4);
+		}
+
+		memcpy(pOut, pLiterals, literalLength);
+		pOut += literalLength;
+
+		if (offset != 0)
+		{
+			assert(offset <= SBG_LZ_MAX_OFFSET);
+			assert(matchLength >= SBG_LZ_MIN_MATCH);
+
+			*pOut++ = (uint8_t)(offset);
+			*pOut++ = (uint8_t)(offset >> 8);
+
+			matchLength -= SBG_LZ_MIN_MATCH;
+
+			if (matchLength >= SBG_LZ_TOKEN_LENGTH_MAX)
+			{
+				*pToken	|= SBG_LZ_TOKEN_LENGTH_MAX;
+				pOut	= sbgLzWriteLengthExtension(pOut, matchLength - SBG_LZ_TOKEN_LENGTH_MAX);
+			}
+			else
+			{
+				*pToken |= (uint8_t)matchLength;
+			}
+		}
+	}
+	else
+	{
+		pOut = NULL;
+	}
+
+	return pOut;
+}
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+SBG_COMMON_LIB_API size_t sbgLzCompress(const void *pSrc, size_t srcSize, void *pDst, size_t dstSize)
+{
+	const uint8_t	*pIn = pSrc;
+	uint8_t			*pOut = pDst;
+	const uint8_t	*pOutEnd;
+	uint32_t		 hashTable[1 << SBG_LZ_HASH_LOG];
+	size_t			 anchor = 0;
+	size_t			 pos = 0;
+	uint32_t		 nrMisses = 0;
+
+	assert(pSrc || (srcSize == 0));
+	assert(pDst);
+
+	pOutEnd = pOut + dstSize;
+
+	//
+	// Entries store the position plus one, zero means empty
+	//
+	memset(hashTable, 0, sizeof(hashTable));
+
+	while (pOut && (srcSize >= SBG_LZ_MIN_MATCH) && (pos <= (srcSize - SBG_LZ_MIN_MATCH)))
+	{
+		uint32_t	 value;
+		uint32_t	 hash;
+		size_t		 candidate;
+
+		value				= sbgLzRead32(&pIn[pos]);
+		hash				= sbgLzHash(value);
+		candidate			= hashTable[hash];
+		hashTable[hash]		= (uint32_t)(pos + 1);
+
+		if ((candidate != 0) && ((pos - (candidate - 1)) <= SBG_LZ_MAX_OFFSET) && (sbgLzRead32(&pIn[candidate - 1]) == value))
+		{
+			size_t		 reference = candidate - 1;
+			size_t		 length = SBG_LZ_MIN_MATCH;
+
+			while (((pos + length + sizeof(uint64_t)) <= srcSize) && (memcmp(&pIn[reference + length], &pIn[pos + length], sizeof(uint64_t)) == 0))
+			{
+				length += sizeof(uint64_t);
+			}
+
+			while (((pos + length) < srcSize) && (pIn[reference + length] == pIn[pos + length]))
+			{
+				length++;
+			}
+
+			pOut = sbgLzWriteSequence(pOut, pOutEnd, &pIn[anchor], pos - anchor, pos - reference, length);
+
+			pos			+= length;
+			anchor		 = pos;
+			nrMisses	 = 0;
+		}
+		else
+		{
+			nrMisses++;
+			pos += 1 + (nrMisses >> SBG_LZ_SKIP_TRIGGER);
+		}
+	}
+
+	//
+	// The last sequence holds the remaining literals and no back reference
+	//
+	if (pOut)
+	{
+		pOut = sbgLzWriteSequence(pOut, pOutEnd, &pIn[anchor], srcSize - anchor, 0, 0);
+	}
+
+	return pOut ? (size_t)(pOut - (uint8_t*)pDst) : 0;
+}
+
+SBG_COMMON_LIB_API SbgErrorCode sbgLzDecompress(const void *pSrc, size_t srcSize, void *pDst, size_t dstSize, size_t *pDecompressedSize)
+{
+	SbgErrorCode	 errorCode = SBG_NO_ERROR;
+	const uint8_t	*pIn = pSrc;
+	const uint8_t	*pInEnd;
+	uint8_t			*pOut = pDst;
+	uint8_t			*pOutEnd;
+
+	assert(pSrc || (srcSize == 0));
+	assert(pDst || (dstSize == 0));
+	assert(pDecompressedSize);
+
+	pInEnd	= pIn + srcSize;
+	pOutEnd	= pOut + dstSize;
+
+	while ((errorCode == SBG_NO_ERROR) && (pIn < pInEnd))
+	{
+		uint8_t		 token;
+		size_t		 literalLength;
+		size_t		 matchLength;
+		size_t		 offset;
+
+		token			= *pIn++;
+		literalLength	= token >> 4;
+		matchLength		= (token & SBG_LZ_TOKEN_LENGTH_MAX) + SBG_LZ_MIN_MATCH;
+
+		if (literalLength == SBG_LZ_TOKEN_LENGTH_MAX)
+		{
+			errorCode = sbgLzReadLengthExtension(&pIn, pInEnd, &literalLength);
+		}
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			if (literalLength > (size_t)(pInEnd - pIn))
+			{
+				errorCode = SBG_INVALID_FRAME;
+			}
+			else if (literalLength > (size_t)(pOutEnd - pOut))
+			{
+				errorCode = SBG_BUFFER_OVERFLOW;
+			}
+			else
+			{
+				memcpy(pOut, pIn, literalLength);
+				pIn		+= literalLength;
+				pOut	+= literalLength;
+
+				//
+				// The last sequence ends with its literals
+				//
+				if (pIn == pInEnd)
+				{
+					break;
+				}
+			}
+		}
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			if ((pInEnd - pIn) >= 2)
+			{
+				offset	 = pIn[0] | ((size_t)pIn[1] << 8);
+				pIn		+= 2;
+
+				if (matchLength == (SBG_LZ_TOKEN_LENGTH_MAX + SBG_LZ_MIN_MATCH))
+				{
+					errorCode = sbgLzReadLengthExtension(&pIn, pInEnd, &matchLength);
+				}
+			}
+			else
+			{
+				errorCode = SBG_INVALID_FRAME;
+			}
+		}
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			if ((offset == 0) || (offset > (size_t)(pOut - (uint8_t*)pDst)))
+			{
+				errorCode = SBG_INVALID_FRAME;
+			}
+			else if (matchLength > (size_t)(pOutEnd - pOut))
+			{
+				errorCode = SBG_BUFFER_OVERFLOW;
+			}
+			else if (offset >= matchLength)
+			{
+				memcpy(pOut, pOut - offset, matchLength);
+				pOut += matchLength;
+			}
+			else
+			{
+				//
+				// Overlapping reference, repeats the last offset bytes
+				//
+				for (size_t i = 0; i < matchLength; i++)
+				{
+					pOut[i] = pOut[i - offset];
+				}
+
+				pOut += matchLength;
+			}
+		}
+	}
+
+	*pDecompressedSize = (size_t)(pOut - (uint8_t*)pDst);
+
+	return errorCode;
+}
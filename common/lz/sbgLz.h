@@ -0,0 +1,107 @@
+/*!
+ *      \file           sbgLz.h
+ *      \author         SBG Systems
+ *      \date           19 October 2026
+ *
+ *      \brief          Small and fast LZ77 family codec.
+ *
+ *                      The compressed format is a sequence of literal runs and back references
+ *                      within a 64 KiB window, similar to LZ4 blocks. It favors speed over ratio
+ *                      and is used to compress opaque data such as raw GNSS streams.
+ *
+ *      \section CodeCopyright Copyright Notice
+ *      The MIT license
+ *
+ *      Copyright (C) 2007-2022, SBG Systems SAS. All rights reserved.
+ *
+ *      Permission is hereby granted, free of charge, to any person obtaining a copy
+ *      of this software and associated documentation files (the "Software"), to deal
+ *      in the Software without restriction, including without limitation the rights
+ *      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *      copies of the Software, and to permit persons to whom the Software is
+ *      furnished to do so, subject to the following conditions:
+ *
+ *      The above copyright notice and this permission notice shall be included in all
+ *      copies or substantial portions of the Software.
+ *
+ *      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *      SOFTWARE.
+ */
+
+#ifndef SBG_LZ_H
+#define SBG_LZ_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Maximum distance of a back reference in bytes.
+ */
+#define SBG_LZ_MAX_OFFSET							(65535)
+
+/*!
+ * Minimum match length in bytes.
+ */
+#define SBG_LZ_MIN_MATCH							(4)
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Returns the maximum compressed size of some data.
+ *
+ * Compressing data that can't be compressed slightly expands it.
+ *
+ * \param[in]	size						Uncompressed size in bytes.
+ * \return									Maximum compressed size in bytes.
+ */
+SBG_INLINE size_t sbgLzCompressBound(size_t size)
+{
+	return size + (size / 255) + 16;
+}
+
+/*!
+ * Compress a buffer.
+ *
+ * \param[in]	pSrc						Data to compress.
+ * \param[in]	srcSize						Size of the data to compress, in bytes.
+ * \param[out]	pDst						Compressed data.
+ * \param[in]	dstSize						Size of the compressed data buffer, in bytes.
+ * \return									Compressed size in bytes, 0 if the destination buffer is too small.
+ */
+SBG_COMMON_LIB_API size_t sbgLzCompress(const void *pSrc, size_t srcSize, void *pDst, size_t dstSize);
+
+/*!
+ * Decompress a buffer.
+ *
+ * All references are checked so corrupted data can't lead to out of bounds accesses.
+ *
+ * \param[in]	pSrc						Compressed data.
+ * \param[in]	srcSize						Compressed data size in bytes.
+ * \param[out]	pDst						Decompressed data.
+ * \param[in]	dstSize						Size of the decompressed data buffer, in bytes.
+ * \param[out]	pDecompressedSize			Decompressed size in bytes.
+ * \return									SBG_NO_ERROR if successful, SBG_INVALID_FRAME if the compressed data is corrupted,
+ *											SBG_BUFFER_OVERFLOW if the destination buffer is too small.
+ */
+SBG_COMMON_LIB_API SbgErrorCode sbgLzDecompress(const void *pSrc, size_t srcSize, void *pDst, size_t dstSize, size_t *pDecompressedSize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_LZ_H
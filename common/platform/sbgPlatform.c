@@ -50,6 +50,42 @@ SBG_COMMON_LIB_API uint32_t sbgGetTime(void)
 #endif
 }
 
+/*!
+ *	Returns the current time in us from a monotonic clock.
+ *	\return				The current time in us.
+ */
+SBG_COMMON_LIB_API uint64_t sbgGetTimeInUs(void)
+{
+#ifdef WIN32
+	LARGE_INTEGER	counter;
+	LARGE_INTEGER	frequency;
+
+	QueryPerformanceCounter(&counter);
+	QueryPerformanceFrequency(&frequency);
+
+	//
+	// Return the current time in us, split the computation to avoid overflows
+	//
+	return (uint64_t)(counter.QuadPart / frequency.QuadPart) * 1000000ull + (uint64_t)((counter.QuadPart % frequency.QuadPart) * 1000000ll / frequency.QuadPart);
+#elif defined(__APPLE__)
+	mach_timebase_info_data_t	timeInfo;
+	mach_timebase_info(&timeInfo);
+
+	//
+	// Return the current time in us
+	//
+	return (mach_absolute_time() * timeInfo.numer / timeInfo.denom) / 1000ull;
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	//
+	// Return the current time in us
+	//
+	return (uint64_t)now.tv_sec * 1000000ull + (uint64_t)now.tv_nsec / 1000ull;
+#endif
+}
+
 /*!
  *	Sleep for the specified number of ms.
  *	\param[in]	ms		Number of millisecondes to wait.
@@ -64,6 +64,14 @@
  */
 SBG_COMMON_LIB_API uint32_t sbgGetTime(void);
 
+/*!
+ *	Returns the current time in us from a monotonic clock.
+ *
+ *	The time origin is undefined so this value should only be used to measure durations.
+ *	\return				The current time in us.
+ */
+SBG_COMMON_LIB_API uint64_t sbgGetTimeInUs(void);
+
 /*!
  *	Sleep for the specified number of ms.
  *	\param[in]	ms		Number of millisecondes to wait.
@@ -38,14 +38,28 @@
 //----------------------------------------------------------------------//
 
 /*!
- * Windows x86 & x64 support both aligned and unaligned access
+ * x86, x64 and ARM platforms with unaligned access support are detected at compile time.
+ * Other platforms only use aligned accesses unless SBG_CONFIG_UNALIGNED_ACCESS_AUTH is defined.
  */
-#define SBG_CONFIG_UNALIGNED_ACCESS_AUTH			(0)
+#ifndef SBG_CONFIG_UNALIGNED_ACCESS_AUTH
+	#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64) || defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_FEATURE_UNALIGNED)
+		#define SBG_CONFIG_UNALIGNED_ACCESS_AUTH	(1)
+	#else
+		#define SBG_CONFIG_UNALIGNED_ACCESS_AUTH	(0)
+	#endif
+#endif
 
 /*!
- * Windows is using little endianess
+ * The platform endianness is detected at compile time when the compiler reports it.
+ * Other platforms are assumed to be little endian unless SBG_CONFIG_BIG_ENDIAN is defined.
  */
-#define SBG_CONFIG_BIG_ENDIAN						(0)
+#ifndef SBG_CONFIG_BIG_ENDIAN
+	#if (defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)) || defined(__BIG_ENDIAN__) || defined(__ARMEB__)
+		#define SBG_CONFIG_BIG_ENDIAN				(1)
+	#else
+		#define SBG_CONFIG_BIG_ENDIAN				(0)
+	#endif
+#endif
 
 //----------------------------------------------------------------------//
 //- Logging configuration                                              -//
@@ -34,6 +34,134 @@
 
 #include "sbgStreamBufferCommon.h"
 
+//----------------------------------------------------------------------//
+//- Internal load and store methods                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Load a big endian unsigned value of up to 4 bytes from a buffer.
+ *
+ * If the platform supports unaligned accesses, the bytes are copied using memcpy and only swapped
+ * if the platform endianness differs so compilers fold this into a single load.
+ * Otherwise, the value is built byte per byte.
+ *
+ * \param[in]	pBuffer				Buffer to load the value from, no alignment is required.
+ * \param[in]	size				Size of the value in bytes, from 1 to 4.
+ * \return							The loaded value.
+ */
+SBG_INLINE uint32_t sbgStreamBufferLoadUint32BE(const uint8_t *pBuffer, size_t size)
+{
+	uint32_t	value = 0;
+
+	assert(pBuffer);
+	assert((size > 0) && (size <= sizeof(value)));
+
+#if SBG_CONFIG_UNALIGNED_ACCESS_AUTH == 1
+	memcpy((uint8_t*)&value + (sizeof(value) - size), pBuffer, size);
+
+	#if SBG_CONFIG_BIG_ENDIAN == 0
+		value = sbgSwap32(value);
+	#endif
+#else
+	for (size_t i = 0; i < size; i++)
+	{
+		value = (value << 8) | pBuffer[i];
+	}
+#endif
+
+	return value;
+}
+
+/*!
+ * Store a big endian unsigned value of up to 4 bytes into a buffer.
+ *
+ * The bytes are copied using memcpy if the platform supports unaligned accesses.
+ *
+ * \param[out]	pBuffer				Buffer to store the value into, no alignment is required.
+ * \param[in]	value				Value to store.
+ * \param[in]	size				Size of the value in bytes, from 1 to 4.
+ */
+SBG_INLINE void sbgStreamBufferStoreUint32BE(uint8_t *pBuffer, uint32_t value, size_t size)
+{
+	assert(pBuffer);
+	assert((size > 0) && (size <= sizeof(value)));
+
+#if SBG_CONFIG_UNALIGNED_ACCESS_AUTH == 1
+	#if SBG_CONFIG_BIG_ENDIAN == 0
+		value = sbgSwap32(value);
+	#endif
+
+	memcpy(pBuffer, (const uint8_t*)&value + (sizeof(value) - size), size);
+#else
+	for (size_t i = 0; i < size; i++)
+	{
+		pBuffer[i] = (uint8_t)(value >> (8 * (size - 1 - i)));
+	}
+#endif
+}
+
+/*!
+ * Load a big endian unsigned value of up to 8 bytes from a buffer.
+ *
+ * If the platform supports unaligned accesses, the bytes are copied using memcpy and only swapped
+ * if the platform endianness differs so compilers fold this into a single load.
+ * Otherwise, the value is built byte per byte.
+ *
+ * \param[in]	pBuffer				Buffer to load the value from, no alignment is required.
+ * \param[in]	size				Size of the value in bytes, from 1 to 8.
+ * \return							The loaded value.
+ */
+SBG_INLINE uint64_t sbgStreamBufferLoadUint64BE(const uint8_t *pBuffer, size_t size)
+{
+	uint64_t	value = 0;
+
+	assert(pBuffer);
+	assert((size > 0) && (size <= sizeof(value)));
+
+#if SBG_CONFIG_UNALIGNED_ACCESS_AUTH == 1
+	memcpy((uint8_t*)&value + (sizeof(value) - size), pBuffer, size);
+
+	#if SBG_CONFIG_BIG_ENDIAN == 0
+		value = sbgSwap64(value);
+	#endif
+#else
+	for (size_t i = 0; i < size; i++)
+	{
+		value = (value << 8) | pBuffer[i];
+	}
+#endif
+
+	return value;
+}
+
+/*!
+ * Store a big endian unsigned value of up to 8 bytes into a buffer.
+ *
+ * The bytes are copied using memcpy if the platform supports unaligned accesses.
+ *
+ * \param[out]	pBuffer				Buffer to store the value into, no alignment is required.
+ * \param[in]	value				Value to store.
+ * \param[in]	size				Size of the value in bytes, from 1 to 8.
+ */
+SBG_INLINE void sbgStreamBufferStoreUint64BE(uint8_t *pBuffer, uint64_t value, size_t size)
+{
+	assert(pBuffer);
+	assert((size > 0) && (size <= sizeof(value)));
+
+#if SBG_CONFIG_UNALIGNED_ACCESS_AUTH == 1
+	#if SBG_CONFIG_BIG_ENDIAN == 0
+		value = sbgSwap64(value);
+	#endif
+
+	memcpy(pBuffer, (const uint8_t*)&value + (sizeof(value) - size), size);
+#else
+	for (size_t i = 0; i < size; i++)
+	{
+		pBuffer[i] = (uint8_t)(value >> (8 * (size - 1 - i)));
+	}
+#endif
+}
+
 //----------------------------------------------------------------------//
 //- Read operations methods                                            -//
 //----------------------------------------------------------------------//
@@ -46,7 +174,7 @@
  */
 SBG_INLINE int16_t sbgStreamBufferReadInt16BE(SbgStreamBuffer *pHandle)
 {
-	int16_t bytesValues[2];
+	uint32_t		value;
 
 	assert(pHandle);
 
@@ -61,36 +189,15 @@ SBG_INLINE int16_t sbgStreamBufferReadInt16BE(SbgStreamBuffer *pHandle)
 		if (sbgStreamBufferGetSpace(pHandle) >= sizeof(int16_t))
 		{
 			//
-			// Test if the platform supports un-aligned access and if the endianness is the same
+			// Load the value and increment the current pointer
 			//
-			#if (SBG_CONFIG_UNALIGNED_ACCESS_AUTH == 1) && (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				// Read the current value
-				//
-				bytesValues[0] = *((int16_t*)pHandle->pCurrentPtr);
-
-				//
-				//	Increment the current pointer
-				//
-				pHandle->pCurrentPtr += sizeof(int16_t);
-
-				return bytesValues[0];
-			#else
-				//
-				// Read the each bytes
-				//
-				bytesValues[1] = *(pHandle->pCurrentPtr++);
-				bytesValues[0] = *(pHandle->pCurrentPtr++);
+			value = sbgStreamBufferLoadUint32BE(pHandle->pCurrentPtr, sizeof(int16_t));
+			pHandle->pCurrentPtr += sizeof(int16_t);
 
-				//
-				// Store data according to platform endianness
-				//
-				#if (SBG_CONFIG_BIG_ENDIAN == 1)
-					return bytesValues[1] | (bytesValues[0] << 8);
-				#else
-					return bytesValues[0] | (bytesValues[1] << 8);
-				#endif
-			#endif
+			//
+			// Shift the value to handle the sign correctly for a 16 bits
+			//
+			return (int32_t)(value << (32-16)) >> (32-16);
 		}
 		else
 		{
@@ -115,7 +222,7 @@ SBG_INLINE int16_t sbgStreamBufferReadInt16BE(SbgStreamBuffer *pHandle)
  */
 SBG_INLINE uint16_t sbgStreamBufferReadUint16BE(SbgStreamBuffer *pHandle)
 {
-	uint16_t bytesValues[2];
+	uint32_t		value;
 
 	assert(pHandle);
 
@@ -130,36 +237,12 @@ SBG_INLINE uint16_t sbgStreamBufferReadUint16BE(SbgStreamBuffer *pHandle)
 		if (sbgStreamBufferGetSpace(pHandle) >= sizeof(uint16_t))
 		{
 			//
-			// Test if the platform supports un-aligned access and if the endianness is the same
+			// Load the value and increment the current pointer
 			//
-			#if (SBG_CONFIG_UNALIGNED_ACCESS_AUTH == 1) && (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				// Read the current value
-				//
-				bytesValues[0] = *((uint16_t*)pHandle->pCurrentPtr);
+			value = sbgStreamBufferLoadUint32BE(pHandle->pCurrentPtr, sizeof(uint16_t));
+			pHandle->pCurrentPtr += sizeof(uint16_t);
 
-				//
-				//	Increment the current pointer
-				//
-				pHandle->pCurrentPtr += sizeof(uint16_t);
-
-				return bytesValues[0];
-			#else
-				//
-				// Read the each bytes
-				//
-				bytesValues[1] = *(pHandle->pCurrentPtr++);
-				bytesValues[0] = *(pHandle->pCurrentPtr++);
-
-				//
-				// Store data according to platform endianness
-				//
-				#if (SBG_CONFIG_BIG_ENDIAN == 1)
-					return bytesValues[1] | (bytesValues[0] << 8);
-				#else
-					return bytesValues[0] | (bytesValues[1] << 8);
-				#endif
-			#endif
+			return (uint16_t)value;
 		}
 		else
 		{
@@ -184,7 +267,7 @@ SBG_INLINE uint16_t sbgStreamBufferReadUint16BE(SbgStreamBuffer *pHandle)
  */
 SBG_INLINE int32_t sbgStreamBufferReadInt24BE(SbgStreamBuffer *pHandle)
 {
-	Uint8ToInt32	value;
+	uint32_t		value;
 
 	assert(pHandle);
 
@@ -199,33 +282,15 @@ SBG_INLINE int32_t sbgStreamBufferReadInt24BE(SbgStreamBuffer *pHandle)
 		if (sbgStreamBufferGetSpace(pHandle) >= 3*sizeof(uint8_t))
 		{
 			//
-			// Make sure the value is zero init
-			//
-			value.value = 0;
-
-			//
-			// Store data according to platform endianness
+			// Load the value and increment the current pointer
 			//
-			#if (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				// Read the each bytes
-				//
-				value.buffer[0] = *(pHandle->pCurrentPtr++);	// MSB
-				value.buffer[1] = *(pHandle->pCurrentPtr++);
-				value.buffer[2] = *(pHandle->pCurrentPtr++);	// LSB
-			#else
-				//
-				// Read the each bytes
-				//
-				value.buffer[3] = *(pHandle->pCurrentPtr++);	// MSB
-				value.buffer[2] = *(pHandle->pCurrentPtr++);
-				value.buffer[1] = *(pHandle->pCurrentPtr++);	// LSB
-			#endif
+			value = sbgStreamBufferLoadUint32BE(pHandle->pCurrentPtr, 3*sizeof(uint8_t));
+			pHandle->pCurrentPtr += 3*sizeof(uint8_t);
 
 			//
 			// Shift the value to handle the sign correctly for a 24 bits
 			//
-			return value.value >> (32-24);
+			return (int32_t)(value << (32-24)) >> (32-24);
 		}
 		else
 		{
@@ -250,7 +315,7 @@ SBG_INLINE int32_t sbgStreamBufferReadInt24BE(SbgStreamBuffer *pHandle)
  */
 SBG_INLINE uint32_t sbgStreamBufferReadUint24BE(SbgStreamBuffer *pHandle)
 {
-	Uint8ToUint32	value;
+	uint32_t		value;
 
 	assert(pHandle);
 
@@ -265,33 +330,12 @@ SBG_INLINE uint32_t sbgStreamBufferReadUint24BE(SbgStreamBuffer *pHandle)
 		if (sbgStreamBufferGetSpace(pHandle) >= 3*sizeof(uint8_t))
 		{
 			//
-			// Make sure the value is zero init
+			// Load the value and increment the current pointer
 			//
-			value.value = 0;
+			value = sbgStreamBufferLoadUint32BE(pHandle->pCurrentPtr, 3*sizeof(uint8_t));
+			pHandle->pCurrentPtr += 3*sizeof(uint8_t);
 
-			//
-			// Store data according to platform endianness
-			//
-			#if (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				// Read the each bytes
-				//
-				value.buffer[0] = *(pHandle->pCurrentPtr++);	// MSB
-				value.buffer[1] = *(pHandle->pCurrentPtr++);
-				value.buffer[2] = *(pHandle->pCurrentPtr++);	// LSB
-			#else
-				//
-				// Read the each bytes
-				//
-				value.buffer[3] = *(pHandle->pCurrentPtr++);	// MSB
-				value.buffer[2] = *(pHandle->pCurrentPtr++);
-				value.buffer[1] = *(pHandle->pCurrentPtr++);	// LSB
-			#endif
-
-			//
-			// Shift the value to handle the sign correctly for a 24 bits
-			//
-			return value.value >> (32-24);
+			return (uint32_t)value;
 		}
 		else
 		{
@@ -316,7 +360,7 @@ SBG_INLINE uint32_t sbgStreamBufferReadUint24BE(SbgStreamBuffer *pHandle)
  */
 SBG_INLINE int32_t sbgStreamBufferReadInt32BE(SbgStreamBuffer *pHandle)
 {
-	int32_t bytesValues[4];
+	uint32_t		value;
 
 	assert(pHandle);
 
@@ -331,38 +375,12 @@ SBG_INLINE int32_t sbgStreamBufferReadInt32BE(SbgStreamBuffer *pHandle)
 		if (sbgStreamBufferGetSpace(pHandle) >= sizeof(int32_t))
 		{
 			//
-			// Test if the platform supports un-aligned access and if the endianness is the same
+			// Load the value and increment the current pointer
 			//
-			#if (SBG_CONFIG_UNALIGNED_ACCESS_AUTH == 1) && (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				// Read the current value
-				//
-				bytesValues[0] = *((int32_t*)pHandle->pCurrentPtr);
-
-				//
-				//	Increment the current pointer
-				//
-				pHandle->pCurrentPtr += sizeof(int32_t);
-
-				return bytesValues[0];
-			#else
-				//
-				// Read the each bytes
-				//
-				bytesValues[3] = *(pHandle->pCurrentPtr++);
-				bytesValues[2] = *(pHandle->pCurrentPtr++);
-				bytesValues[1] = *(pHandle->pCurrentPtr++);
-				bytesValues[0] = *(pHandle->pCurrentPtr++);
+			value = sbgStreamBufferLoadUint32BE(pHandle->pCurrentPtr, sizeof(int32_t));
+			pHandle->pCurrentPtr += sizeof(int32_t);
 
-				//
-				// Store data according to platform endianness
-				//
-				#if (SBG_CONFIG_BIG_ENDIAN == 1)
-					return bytesValues[3] | (bytesValues[2] << 8) | (bytesValues[1] << 16) | (bytesValues[0] << 24);
-				#else
-					return bytesValues[0] | (bytesValues[1] << 8) | (bytesValues[2] << 16) | (bytesValues[3] << 24);
-				#endif
-			#endif
+			return (int32_t)value;
 		}
 		else
 		{
@@ -387,7 +405,7 @@ SBG_INLINE int32_t sbgStreamBufferReadInt32BE(SbgStreamBuffer *pHandle)
  */
 SBG_INLINE uint32_t sbgStreamBufferReadUint32BE(SbgStreamBuffer *pHandle)
 {
-	uint32_t bytesValues[4];
+	uint32_t		value;
 
 	assert(pHandle);
 
@@ -402,38 +420,12 @@ SBG_INLINE uint32_t sbgStreamBufferReadUint32BE(SbgStreamBuffer *pHandle)
 		if (sbgStreamBufferGetSpace(pHandle) >= sizeof(uint32_t))
 		{
 			//
-			// Test if the platform supports un-aligned access and if the endianness is the same
+			// Load the value and increment the current pointer
 			//
-			#if (SBG_CONFIG_UNALIGNED_ACCESS_AUTH == 1) && (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				// Read the current value
-				//
-				bytesValues[0] = *((uint32_t*)pHandle->pCurrentPtr);
-
-				//
-				//	Increment the current pointer
-				//
-				pHandle->pCurrentPtr += sizeof(uint32_t);
-
-				return bytesValues[0];
-			#else
-				//
-				// Read the each bytes
-				//
-				bytesValues[3] = *(pHandle->pCurrentPtr++);
-				bytesValues[2] = *(pHandle->pCurrentPtr++);
-				bytesValues[1] = *(pHandle->pCurrentPtr++);
-				bytesValues[0] = *(pHandle->pCurrentPtr++);
+			value = sbgStreamBufferLoadUint32BE(pHandle->pCurrentPtr, sizeof(uint32_t));
+			pHandle->pCurrentPtr += sizeof(uint32_t);
 
-				//
-				// Store data according to platform endianness
-				//
-				#if (SBG_CONFIG_BIG_ENDIAN == 1)
-					return bytesValues[3] | (bytesValues[2] << 8) | (bytesValues[1] << 16) | (bytesValues[0] << 24);
-				#else
-					return bytesValues[0] | (bytesValues[1] << 8) | (bytesValues[2] << 16) | (bytesValues[3] << 24);
-				#endif
-			#endif
+			return (uint32_t)value;
 		}
 		else
 		{
@@ -458,7 +450,7 @@ SBG_INLINE uint32_t sbgStreamBufferReadUint32BE(SbgStreamBuffer *pHandle)
  */
 SBG_INLINE int64_t sbgStreamBufferReadInt40BE(SbgStreamBuffer *pHandle)
 {
-	Uint8ToInt64	value;
+	uint64_t		value;
 
 	assert(pHandle);
 
@@ -473,37 +465,15 @@ SBG_INLINE int64_t sbgStreamBufferReadInt40BE(SbgStreamBuffer *pHandle)
 		if (sbgStreamBufferGetSpace(pHandle) >= 5*sizeof(uint8_t))
 		{
 			//
-			// Make sure the value is zero init
+			// Load the value and increment the current pointer
 			//
-			value.value = 0;
-
-			//
-			// Store data according to platform endianness
-			//
-			#if (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				// Read the each bytes
-				//
-				value.buffer[0] = *(pHandle->pCurrentPtr++);	// MSB
-				value.buffer[1] = *(pHandle->pCurrentPtr++);
-				value.buffer[2] = *(pHandle->pCurrentPtr++);
-				value.buffer[3] = *(pHandle->pCurrentPtr++);
-				value.buffer[4] = *(pHandle->pCurrentPtr++);	// LSB
-			#else
-				//
-				// Read the each bytes
-				//
-				value.buffer[7] = *(pHandle->pCurrentPtr++);	// MSB
-				value.buffer[6] = *(pHandle->pCurrentPtr++);
-				value.buffer[5] = *(pHandle->pCurrentPtr++);
-				value.buffer[4] = *(pHandle->pCurrentPtr++);
-				value.buffer[3] = *(pHandle->pCurrentPtr++);	// LSB
-			#endif
+			value = sbgStreamBufferLoadUint64BE(pHandle->pCurrentPtr, 5*sizeof(uint8_t));
+			pHandle->pCurrentPtr += 5*sizeof(uint8_t);
 
 			//
 			// Shift the value to handle the sign correctly for a 40 bits
 			//
-			return value.value >> (64-40);
+			return (int64_t)(value << (64-40)) >> (64-40);
 		}
 		else
 		{
@@ -528,7 +498,7 @@ SBG_INLINE int64_t sbgStreamBufferReadInt40BE(SbgStreamBuffer *pHandle)
  */
 SBG_INLINE uint64_t sbgStreamBufferReadUint40BE(SbgStreamBuffer *pHandle)
 {
-	Uint8ToUint64	value;
+	uint64_t		value;
 
 	assert(pHandle);
 
@@ -543,37 +513,12 @@ SBG_INLINE uint64_t sbgStreamBufferReadUint40BE(SbgStreamBuffer *pHandle)
 		if (sbgStreamBufferGetSpace(pHandle) >= 5*sizeof(uint8_t))
 		{
 			//
-			// Make sure the value is zero init
+			// Load the value and increment the current pointer
 			//
-			value.value = 0;
+			value = sbgStreamBufferLoadUint64BE(pHandle->pCurrentPtr, 5*sizeof(uint8_t));
+			pHandle->pCurrentPtr += 5*sizeof(uint8_t);
 
-			//
-			// Store data according to platform endianness
-			//
-			#if (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				// Read the each bytes
-				//
-				value.buffer[0] = *(pHandle->pCurrentPtr++);	// MSB
-				value.buffer[1] = *(pHandle->pCurrentPtr++);
-				value.buffer[2] = *(pHandle->pCurrentPtr++);
-				value.buffer[3] = *(pHandle->pCurrentPtr++);
-				value.buffer[4] = *(pHandle->pCurrentPtr++);	// LSB
-			#else
-				//
-				// Read the each bytes
-				//
-				value.buffer[7] = *(pHandle->pCurrentPtr++);	// MSB
-				value.buffer[6] = *(pHandle->pCurrentPtr++);
-				value.buffer[5] = *(pHandle->pCurrentPtr++);
-				value.buffer[4] = *(pHandle->pCurrentPtr++);
-				value.buffer[3] = *(pHandle->pCurrentPtr++);	// LSB
-			#endif
-
-			//
-			// Shift the value to handle the sign correctly for a 40 bits
-			//
-			return value.value >> (64-40);
+			return (uint64_t)value;
 		}
 		else
 		{
@@ -598,7 +543,7 @@ SBG_INLINE uint64_t sbgStreamBufferReadUint40BE(SbgStreamBuffer *pHandle)
  */
 SBG_INLINE int64_t sbgStreamBufferReadInt48BE(SbgStreamBuffer *pHandle)
 {
-	Uint8ToInt64	value;
+	uint64_t		value;
 
 	assert(pHandle);
 
@@ -613,39 +558,15 @@ SBG_INLINE int64_t sbgStreamBufferReadInt48BE(SbgStreamBuffer *pHandle)
 		if (sbgStreamBufferGetSpace(pHandle) >= 6*sizeof(uint8_t))
 		{
 			//
-			// Make sure the value is zero init
-			//
-			value.value = 0;
-
-			//
-			// Store data according to platform endianness
+			// Load the value and increment the current pointer
 			//
-			#if (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				// Read the each bytes
-				//
-				value.buffer[0] = *(pHandle->pCurrentPtr++);	// MSB
-				value.buffer[1] = *(pHandle->pCurrentPtr++);
-				value.buffer[2] = *(pHandle->pCurrentPtr++);
-				value.buffer[3] = *(pHandle->pCurrentPtr++);
-				value.buffer[4] = *(pHandle->pCurrentPtr++);
-				value.buffer[5] = *(pHandle->pCurrentPtr++);	// LSB
-			#else
-				//
-				// Read the each bytes
-				//
-				value.buffer[7] = *(pHandle->pCurrentPtr++);	// MSB
-				value.buffer[6] = *(pHandle->pCurrentPtr++);
-				value.buffer[5] = *(pHandle->pCurrentPtr++);
-				value.buffer[4] = *(pHandle->pCurrentPtr++);
-				value.buffer[3] = *(pHandle->pCurrentPtr++);
-				value.buffer[2] = *(pHandle->pCurrentPtr++);	// LSB
-			#endif
+			value = sbgStreamBufferLoadUint64BE(pHandle->pCurrentPtr, 6*sizeof(uint8_t));
+			pHandle->pCurrentPtr += 6*sizeof(uint8_t);
 
 			//
 			// Shift the value to handle the sign correctly for a 48 bits
 			//
-			return value.value >> (64-48);
+			return (int64_t)(value << (64-48)) >> (64-48);
 		}
 		else
 		{
@@ -670,7 +591,7 @@ SBG_INLINE int64_t sbgStreamBufferReadInt48BE(SbgStreamBuffer *pHandle)
  */
 SBG_INLINE uint64_t sbgStreamBufferReadUint48BE(SbgStreamBuffer *pHandle)
 {
-	Uint8ToUint64	value;
+	uint64_t		value;
 
 	assert(pHandle);
 
@@ -685,39 +606,12 @@ SBG_INLINE uint64_t sbgStreamBufferReadUint48BE(SbgStreamBuffer *pHandle)
 		if (sbgStreamBufferGetSpace(pHandle) >= 6*sizeof(uint8_t))
 		{
 			//
-			// Make sure the value is zero init
+			// Load the value and increment the current pointer
 			//
-			value.value = 0;
+			value = sbgStreamBufferLoadUint64BE(pHandle->pCurrentPtr, 6*sizeof(uint8_t));
+			pHandle->pCurrentPtr += 6*sizeof(uint8_t);
 
-			//
-			// Store data according to platform endianness
-			//
-			#if (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				// Read the each bytes
-				//
-				value.buffer[0] = *(pHandle->pCurrentPtr++);	// MSB
-				value.buffer[1] = *(pHandle->pCurrentPtr++);
-				value.buffer[2] = *(pHandle->pCurrentPtr++);
-				value.buffer[3] = *(pHandle->pCurrentPtr++);
-				value.buffer[4] = *(pHandle->pCurrentPtr++);
-				value.buffer[5] = *(pHandle->pCurrentPtr++);	// LSB
-			#else
-				//
-				// Read the each bytes
-				//
-				value.buffer[7] = *(pHandle->pCurrentPtr++);	// MSB
-				value.buffer[6] = *(pHandle->pCurrentPtr++);
-				value.buffer[5] = *(pHandle->pCurrentPtr++);
-				value.buffer[4] = *(pHandle->pCurrentPtr++);
-				value.buffer[3] = *(pHandle->pCurrentPtr++);
-				value.buffer[2] = *(pHandle->pCurrentPtr++);	// LSB
-			#endif
-
-			//
-			// Shift the value to handle the sign correctly for a 48 bits
-			//
-			return value.value >> (64-48);
+			return (uint64_t)value;
 		}
 		else
 		{
@@ -742,7 +636,7 @@ SBG_INLINE uint64_t sbgStreamBufferReadUint48BE(SbgStreamBuffer *pHandle)
  */
 SBG_INLINE int64_t sbgStreamBufferReadInt56BE(SbgStreamBuffer *pHandle)
 {
-	Uint8ToInt64	value;
+	uint64_t		value;
 
 	assert(pHandle);
 
@@ -757,41 +651,15 @@ SBG_INLINE int64_t sbgStreamBufferReadInt56BE(SbgStreamBuffer *pHandle)
 		if (sbgStreamBufferGetSpace(pHandle) >= 7*sizeof(uint8_t))
 		{
 			//
-			// Make sure the value is zero init
+			// Load the value and increment the current pointer
 			//
-			value.value = 0;
-
-			//
-			// Store data according to platform endianness
-			//
-			#if (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				// Read the each bytes
-				//
-				value.buffer[0] = *(pHandle->pCurrentPtr++);	// MSB
-				value.buffer[1] = *(pHandle->pCurrentPtr++);
-				value.buffer[2] = *(pHandle->pCurrentPtr++);
-				value.buffer[3] = *(pHandle->pCurrentPtr++);
-				value.buffer[4] = *(pHandle->pCurrentPtr++);
-				value.buffer[5] = *(pHandle->pCurrentPtr++);
-				value.buffer[6] = *(pHandle->pCurrentPtr++);	// LSB
-			#else
-				//
-				// Read the each bytes
-				//
-				value.buffer[7] = *(pHandle->pCurrentPtr++);	// MSB
-				value.buffer[6] = *(pHandle->pCurrentPtr++);
-				value.buffer[5] = *(pHandle->pCurrentPtr++);
-				value.buffer[4] = *(pHandle->pCurrentPtr++);
-				value.buffer[3] = *(pHandle->pCurrentPtr++);
-				value.buffer[2] = *(pHandle->pCurrentPtr++);
-				value.buffer[1] = *(pHandle->pCurrentPtr++);	// LSB
-			#endif
+			value = sbgStreamBufferLoadUint64BE(pHandle->pCurrentPtr, 7*sizeof(uint8_t));
+			pHandle->pCurrentPtr += 7*sizeof(uint8_t);
 
 			//
 			// Shift the value to handle the sign correctly for a 56 bits
 			//
-			return value.value >> (64-56);
+			return (int64_t)(value << (64-56)) >> (64-56);
 		}
 		else
 		{
@@ -816,7 +684,7 @@ SBG_INLINE int64_t sbgStreamBufferReadInt56BE(SbgStreamBuffer *pHandle)
  */
 SBG_INLINE int64_t sbgStreamBufferReadUint56BE(SbgStreamBuffer *pHandle)
 {
-	Uint8ToUint64	value;
+	uint64_t		value;
 
 	assert(pHandle);
 
@@ -831,41 +699,12 @@ SBG_INLINE int64_t sbgStreamBufferReadUint56BE(SbgStreamBuffer *pHandle)
 		if (sbgStreamBufferGetSpace(pHandle) >= 7*sizeof(uint8_t))
 		{
 			//
-			// Make sure the value is zero init
-			//
-			value.value = 0;
-
-			//
-			// Store data according to platform endianness
+			// Load the value and increment the current pointer
 			//
-			#if (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				// Read the each bytes
-				//
-				value.buffer[0] = *(pHandle->pCurrentPtr++);	// MSB
-				value.buffer[1] = *(pHandle->pCurrentPtr++);
-				value.buffer[2] = *(pHandle->pCurrentPtr++);
-				value.buffer[3] = *(pHandle->pCurrentPtr++);
-				value.buffer[4] = *(pHandle->pCurrentPtr++);
-				value.buffer[5] = *(pHandle->pCurrentPtr++);
-				value.buffer[6] = *(pHandle->pCurrentPtr++);	// LSB
-			#else
-				//
-				// Read the each bytes
-				//
-				value.buffer[7] = *(pHandle->pCurrentPtr++);	// MSB
-				value.buffer[6] = *(pHandle->pCurrentPtr++);
-				value.buffer[5] = *(pHandle->pCurrentPtr++);
-				value.buffer[4] = *(pHandle->pCurrentPtr++);
-				value.buffer[3] = *(pHandle->pCurrentPtr++);
-				value.buffer[2] = *(pHandle->pCurrentPtr++);
-				value.buffer[1] = *(pHandle->pCurrentPtr++);	// LSB
-			#endif
+			value = sbgStreamBufferLoadUint64BE(pHandle->pCurrentPtr, 7*sizeof(uint8_t));
+			pHandle->pCurrentPtr += 7*sizeof(uint8_t);
 
-			//
-			// Shift the value to handle the sign correctly for a 56 bits
-			//
-			return value.value >> (64-56);
+			return (int64_t)value;
 		}
 		else
 		{
@@ -890,8 +729,7 @@ SBG_INLINE int64_t sbgStreamBufferReadUint56BE(SbgStreamBuffer *pHandle)
  */
 SBG_INLINE int64_t sbgStreamBufferReadInt64BE(SbgStreamBuffer *pHandle)
 {
-	int64_t lowPart;
-	int64_t highPart;
+	uint64_t		value;
 
 	assert(pHandle);
 
@@ -906,36 +744,12 @@ SBG_INLINE int64_t sbgStreamBufferReadInt64BE(SbgStreamBuffer *pHandle)
 		if (sbgStreamBufferGetSpace(pHandle) >= sizeof(int64_t))
 		{
 			//
-			// Test if the platform supports un-aligned access and if the endianness is the same
+			// Load the value and increment the current pointer
 			//
-			#if (SBG_CONFIG_UNALIGNED_ACCESS_AUTH == 1) && (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				// Read the current value
-				//
-				lowPart = *((int64_t*)pHandle->pCurrentPtr);
-
-				//
-				//	Increment the current pointer
-				//
-				pHandle->pCurrentPtr += sizeof(int64_t);
-
-				return lowPart;
-			#else
-				//
-				// Read 64 bit value using two 32 bits read to avoid too much 64 bits operations
-				//
-				highPart = sbgStreamBufferReadUint32BE(pHandle);
-				lowPart = sbgStreamBufferReadUint32BE(pHandle);
+			value = sbgStreamBufferLoadUint64BE(pHandle->pCurrentPtr, sizeof(int64_t));
+			pHandle->pCurrentPtr += sizeof(int64_t);
 
-				//
-				// Store data according to platform endianness
-				//
-				#if (SBG_CONFIG_BIG_ENDIAN == 1)
-					return (lowPart << 32) | highPart;
-				#else
-					return lowPart | (highPart << 32);
-				#endif
-			#endif
+			return (int64_t)value;
 		}
 		else
 		{
@@ -949,7 +763,7 @@ SBG_INLINE int64_t sbgStreamBufferReadInt64BE(SbgStreamBuffer *pHandle)
 	//
 	// If we are here, it means we have an error so return 0
 	//
-	return 0ll;
+	return 0;
 }
 
 /*!
@@ -960,8 +774,7 @@ SBG_INLINE int64_t sbgStreamBufferReadInt64BE(SbgStreamBuffer *pHandle)
  */
 SBG_INLINE uint64_t sbgStreamBufferReadUint64BE(SbgStreamBuffer *pHandle)
 {
-	uint64_t lowPart;
-	uint64_t highPart;
+	uint64_t		value;
 
 	assert(pHandle);
 
@@ -976,36 +789,12 @@ SBG_INLINE uint64_t sbgStreamBufferReadUint64BE(SbgStreamBuffer *pHandle)
 		if (sbgStreamBufferGetSpace(pHandle) >= sizeof(uint64_t))
 		{
 			//
-			// Test if the platform supports un-aligned access and if the endianness is the same
+			// Load the value and increment the current pointer
 			//
-			#if (SBG_CONFIG_UNALIGNED_ACCESS_AUTH == 1) && (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				// Read the current value
-				//
-				lowPart = *((uint64_t*)pHandle->pCurrentPtr);
+			value = sbgStreamBufferLoadUint64BE(pHandle->pCurrentPtr, sizeof(uint64_t));
+			pHandle->pCurrentPtr += sizeof(uint64_t);
 
-				//
-				//	Increment the current pointer
-				//
-				pHandle->pCurrentPtr += sizeof(uint64_t);
-
-				return lowPart;
-			#else
-				//
-				// Read 64 bit value using two 32 bits read to avoid too much 64 bits operations
-				//
-				highPart = sbgStreamBufferReadUint32BE(pHandle);
-				lowPart = sbgStreamBufferReadUint32BE(pHandle);
-
-				//
-				// Store data according to platform endianness
-				//
-				#if (SBG_CONFIG_BIG_ENDIAN == 1)
-					return (lowPart << 32) | highPart;
-				#else
-					return lowPart | (highPart << 32);
-				#endif
-			#endif
+			return (uint64_t)value;
 		}
 		else
 		{
@@ -1019,7 +808,7 @@ SBG_INLINE uint64_t sbgStreamBufferReadUint64BE(SbgStreamBuffer *pHandle)
 	//
 	// If we are here, it means we have an error so return 0
 	//
-	return 0ll;
+	return 0;
 }
 
 /*!
@@ -1187,30 +976,10 @@ SBG_INLINE SbgErrorCode sbgStreamBufferWriteInt16BE(SbgStreamBuffer *pHandle, in
 		if (sbgStreamBufferGetSpace(pHandle) >= sizeof(int16_t))
 		{
 			//
-			// Test if the platform supports un-aligned access and if the endianness is the same
+			// Store the value and increment the current pointer
 			//
-			#if (SBG_CONFIG_UNALIGNED_ACCESS_AUTH == 1) && (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				//	Write the value
-				//
-				*((int16_t*)(pHandle->pCurrentPtr)) = value;
-
-				//
-				//	Increment the current pointer
-				//
-				pHandle->pCurrentPtr += sizeof(int16_t);
-			#else
-				//
-				// Store data according to platform endianness
-				//
-				#if (SBG_CONFIG_BIG_ENDIAN == 1)
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 8);
-				#else
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 8);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value);
-				#endif
-			#endif
+			sbgStreamBufferStoreUint32BE(pHandle->pCurrentPtr, (uint32_t)value, sizeof(int16_t));
+			pHandle->pCurrentPtr += sizeof(int16_t);
 		}
 		else
 		{
@@ -1246,30 +1015,10 @@ SBG_INLINE SbgErrorCode sbgStreamBufferWriteUint16BE(SbgStreamBuffer *pHandle, u
 		if (sbgStreamBufferGetSpace(pHandle) >= sizeof(uint16_t))
 		{
 			//
-			// Test if the platform supports un-aligned access and if the endianness is the same
+			// Store the value and increment the current pointer
 			//
-			#if (SBG_CONFIG_UNALIGNED_ACCESS_AUTH == 1) && (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				//	Write the value
-				//
-				*((uint16_t*)(pHandle->pCurrentPtr)) = value;
-
-				//
-				//	Increment the current pointer
-				//
-				pHandle->pCurrentPtr += sizeof(uint16_t);
-			#else
-				//
-				// Store data according to platform endianness
-				//
-				#if (SBG_CONFIG_BIG_ENDIAN == 1)
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 8);
-				#else
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 8);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value);
-				#endif
-			#endif
+			sbgStreamBufferStoreUint32BE(pHandle->pCurrentPtr, (uint32_t)value, sizeof(uint16_t));
+			pHandle->pCurrentPtr += sizeof(uint16_t);
 		}
 		else
 		{
@@ -1307,20 +1056,13 @@ SBG_INLINE SbgErrorCode sbgStreamBufferWriteInt24BE(SbgStreamBuffer *pHandle, in
 			//
 			// Test if we can access this item
 			//
-			if (sbgStreamBufferGetSpace(pHandle) >= 3*sizeof(int8_t))
+			if (sbgStreamBufferGetSpace(pHandle) >= 3 * sizeof(uint8_t))
 			{
 				//
-				// Store data according to platform endianness
+				// Store the value and increment the current pointer
 				//
-				#if (SBG_CONFIG_BIG_ENDIAN == 1)
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 8);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 16);
-				#else
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 16);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 8);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value);
-				#endif
+				sbgStreamBufferStoreUint32BE(pHandle->pCurrentPtr, (uint32_t)value, 3 * sizeof(uint8_t));
+				pHandle->pCurrentPtr += 3 * sizeof(uint8_t);
 			}
 			else
 			{
@@ -1366,20 +1108,13 @@ SBG_INLINE SbgErrorCode sbgStreamBufferWriteUint24BE(SbgStreamBuffer *pHandle, u
 			//
 			// Test if we can access this item
 			//
-			if (sbgStreamBufferGetSpace(pHandle) >= 3*sizeof(uint8_t))
+			if (sbgStreamBufferGetSpace(pHandle) >= 3 * sizeof(uint8_t))
 			{
 				//
-				// Store data according to platform endianness
+				// Store the value and increment the current pointer
 				//
-				#if (SBG_CONFIG_BIG_ENDIAN == 1)
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 8);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 16);
-				#else
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 16);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 8);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value);
-				#endif
+				sbgStreamBufferStoreUint32BE(pHandle->pCurrentPtr, value, 3 * sizeof(uint8_t));
+				pHandle->pCurrentPtr += 3 * sizeof(uint8_t);
 			}
 			else
 			{
@@ -1423,34 +1158,10 @@ SBG_INLINE SbgErrorCode sbgStreamBufferWriteInt32BE(SbgStreamBuffer *pHandle, in
 		if (sbgStreamBufferGetSpace(pHandle) >= sizeof(int32_t))
 		{
 			//
-			// Test if the platform supports un-aligned access and if the endianness is the same
+			// Store the value and increment the current pointer
 			//
-			#if (SBG_CONFIG_UNALIGNED_ACCESS_AUTH == 1) && (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				//	Write the value
-				//
-				*((int32_t*)(pHandle->pCurrentPtr)) = value;
-
-				//
-				//	Increment the current pointer
-				//
-				pHandle->pCurrentPtr += sizeof(int32_t);
-			#else
-				//
-				// Store data according to platform endianness
-				//
-				#if (SBG_CONFIG_BIG_ENDIAN == 1)
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 8);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 16);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 24);
-				#else
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 24);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 16);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 8);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value);
-				#endif
-			#endif
+			sbgStreamBufferStoreUint32BE(pHandle->pCurrentPtr, (uint32_t)value, sizeof(int32_t));
+			pHandle->pCurrentPtr += sizeof(int32_t);
 		}
 		else
 		{
@@ -1486,34 +1197,10 @@ SBG_INLINE SbgErrorCode sbgStreamBufferWriteUint32BE(SbgStreamBuffer *pHandle, u
 		if (sbgStreamBufferGetSpace(pHandle) >= sizeof(uint32_t))
 		{
 			//
-			// Test if the platform supports un-aligned access and if the endianness is the same
+			// Store the value and increment the current pointer
 			//
-			#if (SBG_CONFIG_UNALIGNED_ACCESS_AUTH == 1) && (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				//	Write the value
-				//
-				*((uint32_t*)(pHandle->pCurrentPtr)) = value;
-
-				//
-				//	Increment the current pointer
-				//
-				pHandle->pCurrentPtr += sizeof(uint32_t);
-			#else
-				//
-				// Store data according to platform endianness
-				//
-				#if (SBG_CONFIG_BIG_ENDIAN == 1)
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 8);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 16);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 24);
-				#else
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 24);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 16);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 8);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value);
-				#endif
-			#endif
+			sbgStreamBufferStoreUint32BE(pHandle->pCurrentPtr, value, sizeof(uint32_t));
+			pHandle->pCurrentPtr += sizeof(uint32_t);
 		}
 		else
 		{
@@ -1550,23 +1237,10 @@ SBG_INLINE SbgErrorCode sbgStreamBufferWriteUint48BE(SbgStreamBuffer *pHandle, u
 		if (sbgStreamBufferGetSpace(pHandle) >= 6 * sizeof(uint8_t))
 		{
 			//
-			// Store data according to platform endianness
-			//
-			#if (SBG_CONFIG_BIG_ENDIAN == 1)
-				*(pHandle->pCurrentPtr++) = (uint8_t)(value);
-				*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 8);
-				*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 16);
-				*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 24);
-				*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 32);
-				*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 40);
-			#else
-				*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 40);
-				*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 32);
-				*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 24);
-				*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 16);
-				*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 8);
-				*(pHandle->pCurrentPtr++) = (uint8_t)(value);
-			#endif
+			// Store the value and increment the current pointer
+			//
+			sbgStreamBufferStoreUint64BE(pHandle->pCurrentPtr, value, 6 * sizeof(uint8_t));
+			pHandle->pCurrentPtr += 6 * sizeof(uint8_t);
 		}
 		else
 		{
@@ -1602,42 +1276,10 @@ SBG_INLINE SbgErrorCode sbgStreamBufferWriteInt64BE(SbgStreamBuffer *pHandle, in
 		if (sbgStreamBufferGetSpace(pHandle) >= sizeof(int64_t))
 		{
 			//
-			// Test if the platform supports un-aligned access and if the endianness is the same
+			// Store the value and increment the current pointer
 			//
-			#if (SBG_CONFIG_UNALIGNED_ACCESS_AUTH == 1) && (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				//	Write the value
-				//
-				*((int64_t*)(pHandle->pCurrentPtr)) = value;
-
-				//
-				//	Increment the current pointer
-				//
-				pHandle->pCurrentPtr += sizeof(int64_t);
-			#else
-				//
-				// Store data according to platform endianness
-				//
-				#if (SBG_CONFIG_BIG_ENDIAN == 1)
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 8);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 16);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 24);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 32);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 40);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 48);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 56);
-				#else
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 56);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 48);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 40);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 32);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 24);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 16);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 8);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value);
-				#endif
-			#endif
+			sbgStreamBufferStoreUint64BE(pHandle->pCurrentPtr, (uint64_t)value, sizeof(int64_t));
+			pHandle->pCurrentPtr += sizeof(int64_t);
 		}
 		else
 		{
@@ -1673,42 +1315,10 @@ SBG_INLINE SbgErrorCode sbgStreamBufferWriteUint64BE(SbgStreamBuffer *pHandle, u
 		if (sbgStreamBufferGetSpace(pHandle) >= sizeof(uint64_t))
 		{
 			//
-			// Test if the platform supports un-aligned access and if the endianness is the same
+			// Store the value and increment the current pointer
 			//
-			#if (SBG_CONFIG_UNALIGNED_ACCESS_AUTH == 1) && (SBG_CONFIG_BIG_ENDIAN == 1)
-				//
-				//	Write the value
-				//
-				*((uint64_t*)(pHandle->pCurrentPtr)) = value;
-
-				//
-				//	Increment the current pointer
-				//
-				pHandle->pCurrentPtr += sizeof(uint64_t);
-			#else
-				//
-				// Store data according to platform endianness
-				//
-				#if (SBG_CONFIG_BIG_ENDIAN == 1)
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 8);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 16);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 24);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 32);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 40);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 48);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 56);
-				#else
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 56);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 48);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 40);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 32);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 24);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 16);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value >> 8);
-					*(pHandle->pCurrentPtr++) = (uint8_t)(value);
-				#endif
-			#endif
+			sbgStreamBufferStoreUint64BE(pHandle->pCurrentPtr, value, sizeof(uint64_t));
+			pHandle->pCurrentPtr += sizeof(uint64_t);
 		}
 		else
 		{
@@ -1920,4 +1530,361 @@ SBG_INLINE SbgErrorCode sbgStreamBufferWriteStringBE(SbgStreamBuffer *pHandle, c
 	return pHandle->errorCode;
 }
 
+//----------------------------------------------------------------------//
+//- Array operations methods                                           -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Read an array of int16_t from a stream buffer (Big Endian version).
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports read operations.
+ * \param[out]	pArray				Array used to hold the read values, set to 0 if we have an error.
+ * \param[in]	nrElements			Number of values to read.
+ * \return							SBG_NO_ERROR if the values have been read.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferReadInt16ArrayBE(SbgStreamBuffer *pHandle, int16_t *pArray, size_t nrElements)
+{
+	return sbgStreamBufferReadArray(pHandle, pArray, nrElements, sizeof(int16_t), (SBG_CONFIG_BIG_ENDIAN == 0));
+}
+
+/*!
+ * Read an array of uint16_t from a stream buffer (Big Endian version).
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports read operations.
+ * \param[out]	pArray				Array used to hold the read values, set to 0 if we have an error.
+ * \param[in]	nrElements			Number of values to read.
+ * \return							SBG_NO_ERROR if the values have been read.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferReadUint16ArrayBE(SbgStreamBuffer *pHandle, uint16_t *pArray, size_t nrElements)
+{
+	return sbgStreamBufferReadArray(pHandle, pArray, nrElements, sizeof(uint16_t), (SBG_CONFIG_BIG_ENDIAN == 0));
+}
+
+/*!
+ * Read an array of int32_t from a stream buffer (Big Endian version).
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports read operations.
+ * \param[out]	pArray				Array used to hold the read values, set to 0 if we have an error.
+ * \param[in]	nrElements			Number of values to read.
+ * \return							SBG_NO_ERROR if the values have been read.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferReadInt32ArrayBE(SbgStreamBuffer *pHandle, int32_t *pArray, size_t nrElements)
+{
+	return sbgStreamBufferReadArray(pHandle, pArray, nrElements, sizeof(int32_t), (SBG_CONFIG_BIG_ENDIAN == 0));
+}
+
+/*!
+ * Read an array of uint32_t from a stream buffer (Big Endian version).
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports read operations.
+ * \param[out]	pArray				Array used to hold the read values, set to 0 if we have an error.
+ * \param[in]	nrElements			Number of values to read.
+ * \return							SBG_NO_ERROR if the values have been read.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferReadUint32ArrayBE(SbgStreamBuffer *pHandle, uint32_t *pArray, size_t nrElements)
+{
+	return sbgStreamBufferReadArray(pHandle, pArray, nrElements, sizeof(uint32_t), (SBG_CONFIG_BIG_ENDIAN == 0));
+}
+
+/*!
+ * Read an array of int64_t from a stream buffer (Big Endian version).
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports read operations.
+ * \param[out]	pArray				Array used to hold the read values, set to 0 if we have an error.
+ * \param[in]	nrElements			Number of values to read.
+ * \return							SBG_NO_ERROR if the values have been read.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferReadInt64ArrayBE(SbgStreamBuffer *pHandle, int64_t *pArray, size_t nrElements)
+{
+	return sbgStreamBufferReadArray(pHandle, pArray, nrElements, sizeof(int64_t), (SBG_CONFIG_BIG_ENDIAN == 0));
+}
+
+/*!
+ * Read an array of uint64_t from a stream buffer (Big Endian version).
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports read operations.
+ * \param[out]	pArray				Array used to hold the read values, set to 0 if we have an error.
+ * \param[in]	nrElements			Number of values to read.
+ * \return							SBG_NO_ERROR if the values have been read.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferReadUint64ArrayBE(SbgStreamBuffer *pHandle, uint64_t *pArray, size_t nrElements)
+{
+	return sbgStreamBufferReadArray(pHandle, pArray, nrElements, sizeof(uint64_t), (SBG_CONFIG_BIG_ENDIAN == 0));
+}
+
+/*!
+ * Read an array of float from a stream buffer (Big Endian version).
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports read operations.
+ * \param[out]	pArray				Array used to hold the read values, set to 0 if we have an error.
+ * \param[in]	nrElements			Number of values to read.
+ * \return							SBG_NO_ERROR if the values have been read.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferReadFloatArrayBE(SbgStreamBuffer *pHandle, float *pArray, size_t nrElements)
+{
+	return sbgStreamBufferReadArray(pHandle, pArray, nrElements, sizeof(float), (SBG_CONFIG_BIG_ENDIAN == 0));
+}
+
+/*!
+ * Read an array of double from a stream buffer (Big Endian version).
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports read operations.
+ * \param[out]	pArray				Array used to hold the read values, set to 0 if we have an error.
+ * \param[in]	nrElements			Number of values to read.
+ * \return							SBG_NO_ERROR if the values have been read.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferReadDoubleArrayBE(SbgStreamBuffer *pHandle, double *pArray, size_t nrElements)
+{
+	return sbgStreamBufferReadArray(pHandle, pArray, nrElements, sizeof(double), (SBG_CONFIG_BIG_ENDIAN == 0));
+}
+
+/*!
+ * Write an array of int16_t into a stream buffer (Big Endian version).
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports write operations.
+ * \param[in]	pArray				Values to write.
+ * \param[in]	nrElements			Number of values to write.
+ * \return							SBG_NO_ERROR if the values have been written.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferWriteInt16ArrayBE(SbgStreamBuffer *pHandle, const int16_t *pArray, size_t nrElements)
+{
+	return sbgStreamBufferWriteArray(pHandle, pArray, nrElements, sizeof(int16_t), (SBG_CONFIG_BIG_ENDIAN == 0));
+}
+
+/*!
+ * Write an array of uint16_t into a stream buffer (Big Endian version).
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports write operations.
+ * \param[in]	pArray				Values to write.
+ * \param[in]	nrElements			Number of values to write.
+ * \return							SBG_NO_ERROR if the values have been written.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferWriteUint16ArrayBE(SbgStreamBuffer *pHandle, const uint16_t *pArray, size_t nrElements)
+{
+	return sbgStreamBufferWriteArray(pHandle, pArray, nrElements, sizeof(uint16_t), (SBG_CONFIG_BIG_ENDIAN == 0));
+}
+
+/*!
+ * Write an array of int32_t into a stream buffer (Big Endian version).
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports write operations.
+ * \param[in]	pArray				Values to write.
+ * \param[in]	nrElements			Number of values to write.
+ * \return							SBG_NO_ERROR if the values have been written.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferWriteInt32ArrayBE(SbgStreamBuffer *pHandle, const int32_t *pArray, size_t nrElements)
+{
+	return sbgStreamBufferWriteArray(pHandle, pArray, nrElements, sizeof(int32_t), (SBG_CONFIG_BIG_ENDIAN == 0));
+}
+
+/*!
+ * Write an array of uint32_t into a stream buffer (Big Endian version).
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports write operations.
+ * \param[in]	pArray				Values to write.
+ * \param[in]	nrElements			Number of values to write.
+ * \return							SBG_NO_ERROR if the values have been written.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferWriteUint32ArrayBE(SbgStreamBuffer *pHandle, const uint32_t *pArray, size_t nrElements)
+{
+	return sbgStreamBufferWriteArray(pHandle, pArray, nrElements, sizeof(uint32_t), (SBG_CONFIG_BIG_ENDIAN == 0));
+}
+
+/*!
+ * Write an array of int64_t into a stream buffer (Big Endian version).
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports write operations.
+ * \param[in]	pArray				Values to write.
+ * \param[in]	nrElements			Number of values to write.
+ * \return							SBG_NO_ERROR if the values have been written.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferWriteInt64ArrayBE(SbgStreamBuffer *pHandle, const int64_t *pArray, size_t nrElements)
+{
+	return sbgStreamBufferWriteArray(pHandle, pArray, nrElements, sizeof(int64_t), (SBG_CONFIG_BIG_ENDIAN == 0));
+}
+
+/*!
+ * Write an array of uint64_t into a stream buffer (Big Endian version).
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports write operations.
+ * \param[in]	pArray				Values to write.
+ * \param[in]	nrElements			Number of values to write.
+ * \return							SBG_NO_ERROR if the values have been written.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferWriteUint64ArrayBE(SbgStreamBuffer *pHandle, const uint64_t *pArray, size_t nrElements)
+{
+	return sbgStreamBufferWriteArray(pHandle, pArray, nrElements, sizeof(uint64_t), (SBG_CONFIG_BIG_ENDIAN == 0));
+}
+
+/*!
+ * Write an array of float into a stream buffer (Big Endian version).
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports write operations.
+ * \param[in]	pArray				Values to write.
+ * \param[in]	nrElements			Number of values to write.
+ * \return							SBG_NO_ERROR if the values have been written.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferWriteFloatArrayBE(SbgStreamBuffer *pHandle, const float *pArray, size_t nrElements)
+{
+	return sbgStreamBufferWriteArray(pHandle, pArray, nrElements, sizeof(float), (SBG_CONFIG_BIG_ENDIAN == 0));
+}
+
+/*!
+ * Write an array of double into a stream buffer (Big Endian version).
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports write operations.
+ * \param[in]	pArray				Values to write.
+ * \param[in]	nrElements			Number of values to write.
+ * \return							SBG_NO_ERROR if the values have been written.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferWriteDoubleArrayBE(SbgStreamBuffer *pHandle, const double *pArray, size_t nrElements)
+{
+	return sbgStreamBufferWriteArray(pHandle, pArray, nrElements, sizeof(double), (SBG_CONFIG_BIG_ENDIAN == 0));
+}
+
+//----------------------------------------------------------------------//
+//- Reserved read operations methods                                   -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Read an uint16_t from a stream buffer reader without any check (Big Endian version).
+ *
+ * \param[in]	pReader				Valid stream buffer reader with at least 2 bytes left.
+ * \return							The read value.
+ */
+SBG_INLINE uint16_t sbgStreamBufferReaderReadUint16BE(SbgStreamBufferReader *pReader)
+{
+	uint16_t		value;
+
+	assert(pReader);
+	assert(sbgStreamBufferReaderGetSpace(pReader) >= sizeof(value));
+
+	//
+	// Copy the bytes so that unaligned accesses are handled by the compiler
+	//
+	memcpy(&value, pReader->pCurrentPtr, sizeof(value));
+	pReader->pCurrentPtr += sizeof(value);
+
+#if SBG_CONFIG_BIG_ENDIAN == 0
+	value = sbgSwap16(value);
+#endif
+
+	return value;
+}
+
+/*!
+ * Read an int16_t from a stream buffer reader without any check (Big Endian version).
+ *
+ * \param[in]	pReader				Valid stream buffer reader with at least 2 bytes left.
+ * \return							The read value.
+ */
+SBG_INLINE int16_t sbgStreamBufferReaderReadInt16BE(SbgStreamBufferReader *pReader)
+{
+	return (int16_t)sbgStreamBufferReaderReadUint16BE(pReader);
+}
+
+/*!
+ * Read an uint32_t from a stream buffer reader without any check (Big Endian version).
+ *
+ * \param[in]	pReader				Valid stream buffer reader with at least 4 bytes left.
+ * \return							The read value.
+ */
+SBG_INLINE uint32_t sbgStreamBufferReaderReadUint32BE(SbgStreamBufferReader *pReader)
+{
+	uint32_t		value;
+
+	assert(pReader);
+	assert(sbgStreamBufferReaderGetSpace(pReader) >= sizeof(value));
+
+	//
+	// Copy the bytes so that unaligned accesses are handled by the compiler
+	//
+	memcpy(&value, pReader->pCurrentPtr, sizeof(value));
+	pReader->pCurrentPtr += sizeof(value);
+
+#if SBG_CONFIG_BIG_ENDIAN == 0
+	value = sbgSwap32(value);
+#endif
+
+	return value;
+}
+
+/*!
+ * Read an int32_t from a stream buffer reader without any check (Big Endian version).
+ *
+ * \param[in]	pReader				Valid stream buffer reader with at least 4 bytes left.
+ * \return							The read value.
+ */
+SBG_INLINE int32_t sbgStreamBufferReaderReadInt32BE(SbgStreamBufferReader *pReader)
+{
+	return (int32_t)sbgStreamBufferReaderReadUint32BE(pReader);
+}
+
+/*!
+ * Read an uint64_t from a stream buffer reader without any check (Big Endian version).
+ *
+ * \param[in]	pReader				Valid stream buffer reader with at least 8 bytes left.
+ * \return							The read value.
+ */
+SBG_INLINE uint64_t sbgStreamBufferReaderReadUint64BE(SbgStreamBufferReader *pReader)
+{
+	uint64_t		value;
+
+	assert(pReader);
+	assert(sbgStreamBufferReaderGetSpace(pReader) >= sizeof(value));
+
+	//
+	// Copy the bytes so that unaligned accesses are handled by the compiler
+	//
+	memcpy(&value, pReader->pCurrentPtr, sizeof(value));
+	pReader->pCurrentPtr += sizeof(value);
+
+#if SBG_CONFIG_BIG_ENDIAN == 0
+	value = sbgSwap64(value);
+#endif
+
+	return value;
+}
+
+/*!
+ * Read an int64_t from a stream buffer reader without any check (Big Endian version).
+ *
+ * \param[in]	pReader				Valid stream buffer reader with at least 8 bytes left.
+ * \return							The read value.
+ */
+SBG_INLINE int64_t sbgStreamBufferReaderReadInt64BE(SbgStreamBufferReader *pReader)
+{
+	return (int64_t)sbgStreamBufferReaderReadUint64BE(pReader);
+}
+
+/*!
+ * Read a float from a stream buffer reader without any check (Big Endian version).
+ *
+ * \param[in]	pReader				Valid stream buffer reader with at least 4 bytes left.
+ * \return							The read value.
+ */
+SBG_INLINE float sbgStreamBufferReaderReadFloatBE(SbgStreamBufferReader *pReader)
+{
+	FloatNint floatInt;
+
+	floatInt.valU = sbgStreamBufferReaderReadUint32BE(pReader);
+
+	return floatInt.valF;
+}
+
+/*!
+ * Read a double from a stream buffer reader without any check (Big Endian version).
+ *
+ * \param[in]	pReader				Valid stream buffer reader with at least 8 bytes left.
+ * \return							The read value.
+ */
+SBG_INLINE double sbgStreamBufferReaderReadDoubleBE(SbgStreamBufferReader *pReader)
+{
+	DoubleNint doubleInt;
+
+	doubleInt.valU = sbgStreamBufferReaderReadUint64BE(pReader);
+
+	return doubleInt.valF;
+}
+
 #endif /* SBG_STREAM_BUFFER_BE_H */
@@ -33,6 +33,7 @@
 #define SBG_STREAM_BUFFER_COMMON_H
 
 #include <sbgCommon.h>
+#include <swap/sbgSwap.h>
 
 //----------------------------------------------------------------------//
 //- General definitions	                                               -//
@@ -205,6 +206,18 @@ typedef struct _SbgStreamBuffer
 	SbgErrorCode		 errorCode;			/*!< Current error code on stream buffer. */
 } SbgStreamBuffer;
 
+/*!
+ * Defines a reader on a reserved part of a stream buffer.
+ *
+ * The reserved size is checked once by sbgStreamBufferReserveRead so reads
+ * done through this reader don't check the remaining space nor the error code.
+ */
+typedef struct _SbgStreamBufferReader
+{
+	const uint8_t		*pCurrentPtr;		/*!< Current pointer within the reserved area. */
+	const uint8_t		*pEndPtr;			/*!< Pointer on the end of the reserved area. */
+} SbgStreamBufferReader;
+
 //----------------------------------------------------------------------//
 //- Common operations methods                                          -//
 //----------------------------------------------------------------------//
@@ -827,4 +840,275 @@ SBG_INLINE SbgErrorCode sbgStreamBufferWriteBuffer(SbgStreamBuffer *pHandle, con
 	return pHandle->errorCode;
 }
 
+//----------------------------------------------------------------------//
+//- Array operations methods                                           -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Swap the byte order of each element of an array.
+ *
+ * The array doesn't need to be aligned.
+ *
+ * \param[in,out]	pArray			Array to swap.
+ * \param[in]	nrElements			Number of elements in the array.
+ * \param[in]	elementSize			Size of each element in bytes, 2, 4 or 8.
+ */
+SBG_INLINE void sbgStreamBufferSwapArray(void *pArray, size_t nrElements, size_t elementSize)
+{
+	uint8_t		*pBytes = (uint8_t*)pArray;
+
+	assert((pArray) || (nrElements == 0));
+
+	//
+	// Each loop only uses fixed size copies so that compilers can vectorize it
+	//
+	if (elementSize == sizeof(uint16_t))
+	{
+		for (size_t i = 0; i < nrElements; i++)
+		{
+			uint16_t	value;
+
+			memcpy(&value, &pBytes[i * sizeof(value)], sizeof(value));
+			value = sbgSwap16(value);
+			memcpy(&pBytes[i * sizeof(value)], &value, sizeof(value));
+		}
+	}
+	else if (elementSize == sizeof(uint32_t))
+	{
+		for (size_t i = 0; i < nrElements; i++)
+		{
+			uint32_t	value;
+
+			memcpy(&value, &pBytes[i * sizeof(value)], sizeof(value));
+			value = sbgSwap32(value);
+			memcpy(&pBytes[i * sizeof(value)], &value, sizeof(value));
+		}
+	}
+	else
+	{
+		assert(elementSize == sizeof(uint64_t));
+
+		for (size_t i = 0; i < nrElements; i++)
+		{
+			uint64_t	value;
+
+			memcpy(&value, &pBytes[i * sizeof(value)], sizeof(value));
+			value = sbgSwap64(value);
+			memcpy(&pBytes[i * sizeof(value)], &value, sizeof(value));
+		}
+	}
+}
+
+/*!
+ * Read an array of 16, 32 or 64 bits elements from a stream buffer.
+ *
+ * The remaining space is only checked once for the whole array. The array is set to 0 if we have an error.
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports read operations.
+ * \param[out]	pArray				Array used to hold the read elements.
+ * \param[in]	nrElements			Number of elements to read.
+ * \param[in]	elementSize			Size of each element in bytes, 2, 4 or 8.
+ * \param[in]	swap				True if the stream byte order differs from the platform one.
+ * \return							SBG_NO_ERROR if the elements have been read.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferReadArray(SbgStreamBuffer *pHandle, void *pArray, size_t nrElements, size_t elementSize, bool swap)
+{
+	assert(pHandle);
+	assert((pArray) || (nrElements == 0));
+	assert((elementSize == 2) || (elementSize == 4) || (elementSize == 8));
+
+	//
+	// Test if we haven't already an error
+	//
+	if (pHandle->errorCode == SBG_NO_ERROR)
+	{
+		//
+		// Test if enough bytes in stream, the number of elements is compared to avoid overflows
+		//
+		if (nrElements <= (sbgStreamBufferGetSpace(pHandle) / elementSize))
+		{
+			memcpy(pArray, pHandle->pCurrentPtr, nrElements * elementSize);
+
+			if (swap)
+			{
+				sbgStreamBufferSwapArray(pArray, nrElements, elementSize);
+			}
+
+			pHandle->pCurrentPtr += nrElements * elementSize;
+		}
+		else
+		{
+			//
+			// Not enough data in stream
+			//
+			pHandle->errorCode = SBG_BUFFER_OVERFLOW;
+		}
+	}
+
+	//
+	// If we have an error, return 0 values
+	//
+	if ((pHandle->errorCode != SBG_NO_ERROR) && (nrElements != 0))
+	{
+		memset(pArray, 0, nrElements * elementSize);
+	}
+
+	return pHandle->errorCode;
+}
+
+/*!
+ * Write an array of 16, 32 or 64 bits elements into a stream buffer.
+ *
+ * The remaining space is only checked once for the whole array.
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports write operations.
+ * \param[in]	pArray				Elements to write.
+ * \param[in]	nrElements			Number of elements to write.
+ * \param[in]	elementSize			Size of each element in bytes, 2, 4 or 8.
+ * \param[in]	swap				True if the stream byte order differs from the platform one.
+ * \return							SBG_NO_ERROR if the elements have been written.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferWriteArray(SbgStreamBuffer *pHandle, const void *pArray, size_t nrElements, size_t elementSize, bool swap)
+{
+	assert(pHandle);
+	assert((pArray) || (nrElements == 0));
+	assert((elementSize == 2) || (elementSize == 4) || (elementSize == 8));
+
+	//
+	// Test if we haven't already an error
+	//
+	if (pHandle->errorCode == SBG_NO_ERROR)
+	{
+		//
+		// Test if we can access these items, the number of elements is compared to avoid overflows
+		//
+		if (nrElements <= (sbgStreamBufferGetSpace(pHandle) / elementSize))
+		{
+			memcpy(pHandle->pCurrentPtr, pArray, nrElements * elementSize);
+
+			if (swap)
+			{
+				sbgStreamBufferSwapArray(pHandle->pCurrentPtr, nrElements, elementSize);
+			}
+
+			pHandle->pCurrentPtr += nrElements * elementSize;
+		}
+		else
+		{
+			//
+			// We are accessing a data that is outside the stream buffer
+			//
+			pHandle->errorCode = SBG_BUFFER_OVERFLOW;
+		}
+	}
+
+	return pHandle->errorCode;
+}
+
+//----------------------------------------------------------------------//
+//- Reserved read operations methods                                   -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Reserve a number of bytes to read from a stream buffer.
+ *
+ * The error code and the remaining space are only checked once. If the reservation succeeds,
+ * the stream cursor is moved after the reserved bytes and these bytes have to be read
+ * using the reader methods such as sbgStreamBufferReaderReadUint32LE.
+ *
+ * If the reservation fails, the reader is empty and must not be used.
+ *
+ * \param[in]	pHandle				Valid stream buffer handle that supports read operations.
+ * \param[in]	size				Number of bytes to reserve.
+ * \param[out]	pReader				Reader on the reserved bytes.
+ * \return							SBG_NO_ERROR if the bytes have been reserved.
+ */
+SBG_INLINE SbgErrorCode sbgStreamBufferReserveRead(SbgStreamBuffer *pHandle, size_t size, SbgStreamBufferReader *pReader)
+{
+	assert(pHandle);
+	assert(pReader);
+
+	pReader->pCurrentPtr	= pHandle->pCurrentPtr;
+	pReader->pEndPtr		= pHandle->pCurrentPtr;
+
+	//
+	// Test if we haven't already an error
+	//
+	if (pHandle->errorCode == SBG_NO_ERROR)
+	{
+		//
+		// Test if we can access these items
+		//
+		if (sbgStreamBufferGetSpace(pHandle) >= size)
+		{
+			pReader->pEndPtr		= pHandle->pCurrentPtr + size;
+			pHandle->pCurrentPtr	+= size;
+		}
+		else
+		{
+			//
+			// We have a buffer overflow
+			//
+			pHandle->errorCode = SBG_BUFFER_OVERFLOW;
+		}
+	}
+
+	return pHandle->errorCode;
+}
+
+/*!
+ * Returns the number of reserved bytes that haven't been read yet.
+ *
+ * \param[in]	pReader				Valid stream buffer reader.
+ * \return							Number of bytes left in the reader.
+ */
+SBG_INLINE size_t sbgStreamBufferReaderGetSpace(const SbgStreamBufferReader *pReader)
+{
+	assert(pReader);
+
+	return (size_t)(pReader->pEndPtr - pReader->pCurrentPtr);
+}
+
+/*!
+ * Copy bytes from a stream buffer reader without any check.
+ *
+ * \param[in]	pReader				Valid stream buffer reader with at least size bytes left.
+ * \param[out]	pBuffer				Buffer used to hold the read bytes.
+ * \param[in]	size				Number of bytes to read.
+ */
+SBG_INLINE void sbgStreamBufferReaderReadBuffer(SbgStreamBufferReader *pReader, void *pBuffer, size_t size)
+{
+	assert(pReader);
+	assert((pBuffer) || (size == 0));
+	assert(sbgStreamBufferReaderGetSpace(pReader) >= size);
+
+	memcpy(pBuffer, pReader->pCurrentPtr, size);
+	pReader->pCurrentPtr += size;
+}
+
+/*!
+ * Read an uint8_t from a stream buffer reader without any check.
+ *
+ * \param[in]	pReader				Valid stream buffer reader with at least one byte left.
+ * \return							The read value.
+ */
+SBG_INLINE uint8_t sbgStreamBufferReaderReadUint8(SbgStreamBufferReader *pReader)
+{
+	assert(pReader);
+	assert(sbgStreamBufferReaderGetSpace(pReader) >= sizeof(uint8_t));
+
+	return *(pReader->pCurrentPtr++);
+}
+
+/*!
+ * Read an int8_t from a stream buffer reader without any check.
+ *
+ * \param[in]	pReader				Valid stream buffer reader with at least one byte left.
+ * \return							The read value.
+ */
+SBG_INLINE int8_t sbgStreamBufferReaderReadInt8(SbgStreamBufferReader *pReader)
+{
+	return (int8_t)sbgStreamBufferReaderReadUint8(pReader);
+}
+
 #endif /* SBG_STREAM_BUFFER_COMMON_H */
@@ -41,6 +41,10 @@ extern "C" {
 
 #include <sbgCommon.h>
 
+#if defined(_MSC_VER)
+#include <stdlib.h>
+#endif
+
 //----------------------------------------------------------------------//
 //- Internal swap functions                                            -//
 //----------------------------------------------------------------------//
@@ -52,7 +56,13 @@ extern "C" {
  */
 SBG_INLINE uint16_t sbgSwap16(uint16_t x)
 {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_bswap16(x);
+#elif defined(_MSC_VER)
+	return _byteswap_ushort(x);
+#else
 	return ((x<<8)|(x>>8));
+#endif
 }
 
 /*!
@@ -62,7 +72,13 @@ SBG_INLINE uint16_t sbgSwap16(uint16_t x)
  */
 SBG_INLINE uint32_t sbgSwap32(uint32_t x)
 {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_bswap32(x);
+#elif defined(_MSC_VER)
+	return _byteswap_ulong(x);
+#else
 	return ((x << 24) | ((x << 8) & (0xFF0000)) | ((x >> 8) & (0xFF00)) | (x >> 24));
+#endif
 }
 
 /*!
@@ -72,6 +88,11 @@ SBG_INLINE uint32_t sbgSwap32(uint32_t x)
  */
 SBG_INLINE uint64_t sbgSwap64(uint64_t x)
 {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_bswap64(x);
+#elif defined(_MSC_VER)
+	return _byteswap_uint64(x);
+#else
 	uint32_t hi, lo;
 
 	//
@@ -89,6 +110,7 @@ SBG_INLINE uint64_t sbgSwap64(uint64_t x)
 	x |= sbgSwap32(hi);
 
 	return x;
+#endif
 }
 
 /*!
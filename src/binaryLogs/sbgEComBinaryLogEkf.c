@@ -1,5 +1,71 @@
 ﻿#include "sbgEComBinaryLogEkf.h"
 
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+#if SBG_CONFIG_BIG_ENDIAN == 0
+/*!
+ * Directly load an EKF euler payload on a little endian platform.
+ *
+ * The payload size has to be checked by the caller.
+ *
+ * \param[out]	pOutputData					Pointer on the output structure.
+ * \param[in]	pPayload					Pointer on the payload, at least SBG_ECOM_LOG_EKF_EULER_PAYLOAD_SIZE bytes.
+ */
+static void sbgEComBinaryLogLoadEkfEulerData(SbgLogEkfEulerData *pOutputData, const uint8_t *pPayload)
+{
+	assert(pOutputData);
+	assert(pPayload);
+
+	memcpy(&pOutputData->timeStamp,		&pPayload[0],	sizeof(pOutputData->timeStamp));
+	memcpy(pOutputData->euler,			&pPayload[4],	sizeof(pOutputData->euler));
+	memcpy(pOutputData->eulerStdDev,	&pPayload[16],	sizeof(pOutputData->eulerStdDev));
+	memcpy(&pOutputData->status,		&pPayload[28],	sizeof(pOutputData->status));
+}
+
+/*!
+ * Directly load an EKF quaternion payload on a little endian platform.
+ *
+ * The payload size has to be checked by the caller.
+ *
+ * \param[out]	pOutputData					Pointer on the output structure.
+ * \param[in]	pPayload					Pointer on the payload, at least SBG_ECOM_LOG_EKF_QUAT_PAYLOAD_SIZE bytes.
+ */
+static void sbgEComBinaryLogLoadEkfQuatData(SbgLogEkfQuatData *pOutputData, const uint8_t *pPayload)
+{
+	assert(pOutputData);
+	assert(pPayload);
+
+	memcpy(&pOutputData->timeStamp,		&pPayload[0],	sizeof(pOutputData->timeStamp));
+	memcpy(pOutputData->quaternion,		&pPayload[4],	sizeof(pOutputData->quaternion));
+	memcpy(pOutputData->eulerStdDev,	&pPayload[20],	sizeof(pOutputData->eulerStdDev));
+	memcpy(&pOutputData->status,		&pPayload[32],	sizeof(pOutputData->status));
+}
+
+/*!
+ * Directly load an EKF navigation payload on a little endian platform.
+ *
+ * The payload size has to be checked by the caller.
+ *
+ * \param[out]	pOutputData					Pointer on the output structure.
+ * \param[in]	pPayload					Pointer on the payload, at least SBG_ECOM_LOG_EKF_NAV_PAYLOAD_SIZE bytes.
+ */
+static void sbgEComBinaryLogLoadEkfNavData(SbgLogEkfNavData *pOutputData, const uint8_t *pPayload)
+{
+	assert(pOutputData);
+	assert(pPayload);
+
+	memcpy(&pOutputData->timeStamp,			&pPayload[0],	sizeof(pOutputData->timeStamp));
+	memcpy(pOutputData->velocity,			&pPayload[4],	sizeof(pOutputData->velocity));
+	memcpy(pOutputData->velocityStdDev,		&pPayload[16],	sizeof(pOutputData->velocityStdDev));
+	memcpy(pOutputData->position,			&pPayload[28],	sizeof(pOutputData->position));
+	memcpy(&pOutputData->undulation,		&pPayload[52],	sizeof(pOutputData->undulation));
+	memcpy(pOutputData->positionStdDev,		&pPayload[56],	sizeof(pOutputData->positionStdDev));
+	memcpy(&pOutputData->status,			&pPayload[68],	sizeof(pOutputData->status));
+}
+#endif // SBG_CONFIG_BIG_ENDIAN == 0
+
 //----------------------------------------------------------------------//
 //- Public methods                                                     -//
 //----------------------------------------------------------------------//
@@ -9,20 +75,29 @@ SbgErrorCode sbgEComBinaryLogParseEkfEulerData(SbgStreamBuffer *pInputStream, Sb
 	assert(pInputStream);
 	assert(pOutputData);
 
+#if SBG_CONFIG_BIG_ENDIAN == 0
 	//
-	// Read the frame payload
+	// The payload layout matches the platform one so check the size once and load fields directly
 	//
-	pOutputData->timeStamp		= sbgStreamBufferReadUint32LE(pInputStream);
-
-	pOutputData->euler[0]		= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->euler[1]		= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->euler[2]		= sbgStreamBufferReadFloatLE(pInputStream);
-
-	pOutputData->eulerStdDev[0]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->eulerStdDev[1]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->eulerStdDev[2]	= sbgStreamBufferReadFloatLE(pInputStream);
-
-	pOutputData->status			= sbgStreamBufferReadUint32LE(pInputStream);
+	if ((sbgStreamBufferGetLastError(pInputStream) == SBG_NO_ERROR) && (sbgStreamBufferGetSpace(pInputStream) >= SBG_ECOM_LOG_EKF_EULER_PAYLOAD_SIZE))
+	{
+		sbgEComBinaryLogLoadEkfEulerData(pOutputData, sbgStreamBufferGetCursor(pInputStream));
+		sbgStreamBufferSeek(pInputStream, SBG_ECOM_LOG_EKF_EULER_PAYLOAD_SIZE, SB_SEEK_CUR_INC);
+	}
+	else
+#endif
+	{
+		//
+		// Read the frame payload
+		//
+		pOutputData->timeStamp		= sbgStreamBufferReadUint32LE(pInputStream);
+
+		sbgStreamBufferReadFloatArrayLE(pInputStream, pOutputData->euler, SBG_ARRAY_SIZE(pOutputData->euler));
+
+		sbgStreamBufferReadFloatArrayLE(pInputStream, pOutputData->eulerStdDev, SBG_ARRAY_SIZE(pOutputData->eulerStdDev));
+
+		pOutputData->status			= sbgStreamBufferReadUint32LE(pInputStream);
+	}
 
 	//
 	// Return if any error has occurred while parsing the frame
@@ -40,13 +115,9 @@ SbgErrorCode sbgEComBinaryLogWriteEkfEulerData(SbgStreamBuffer *pOutputStream, c
 	//
 	sbgStreamBufferWriteUint32LE(pOutputStream, pInputData->timeStamp);
 	
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->euler[0]);
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->euler[1]);
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->euler[2]);
+	sbgStreamBufferWriteFloatArrayLE(pOutputStream, pInputData->euler, SBG_ARRAY_SIZE(pInputData->euler));
 
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->eulerStdDev[0]);
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->eulerStdDev[1]);
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->eulerStdDev[2]);
+	sbgStreamBufferWriteFloatArrayLE(pOutputStream, pInputData->eulerStdDev, SBG_ARRAY_SIZE(pInputData->eulerStdDev));
 
 	sbgStreamBufferWriteUint32LE(pOutputStream, pInputData->status);
 
@@ -61,21 +132,29 @@ SbgErrorCode sbgEComBinaryLogParseEkfQuatData(SbgStreamBuffer *pInputStream, Sbg
 	assert(pInputStream);
 	assert(pOutputData);
 
+#if SBG_CONFIG_BIG_ENDIAN == 0
 	//
-	// Read the frame payload
+	// The payload layout matches the platform one so check the size once and load fields directly
 	//
-	pOutputData->timeStamp		= sbgStreamBufferReadUint32LE(pInputStream);
-
-	pOutputData->quaternion[0]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->quaternion[1]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->quaternion[2]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->quaternion[3]	= sbgStreamBufferReadFloatLE(pInputStream);
-
-	pOutputData->eulerStdDev[0]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->eulerStdDev[1]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->eulerStdDev[2]	= sbgStreamBufferReadFloatLE(pInputStream);
-
-	pOutputData->status			= sbgStreamBufferReadUint32LE(pInputStream);
+	if ((sbgStreamBufferGetLastError(pInputStream) == SBG_NO_ERROR) && (sbgStreamBufferGetSpace(pInputStream) >= SBG_ECOM_LOG_EKF_QUAT_PAYLOAD_SIZE))
+	{
+		sbgEComBinaryLogLoadEkfQuatData(pOutputData, sbgStreamBufferGetCursor(pInputStream));
+		sbgStreamBufferSeek(pInputStream, SBG_ECOM_LOG_EKF_QUAT_PAYLOAD_SIZE, SB_SEEK_CUR_INC);
+	}
+	else
+#endif
+	{
+		//
+		// Read the frame payload
+		//
+		pOutputData->timeStamp		= sbgStreamBufferReadUint32LE(pInputStream);
+
+		sbgStreamBufferReadFloatArrayLE(pInputStream, pOutputData->quaternion, SBG_ARRAY_SIZE(pOutputData->quaternion));
+
+		sbgStreamBufferReadFloatArrayLE(pInputStream, pOutputData->eulerStdDev, SBG_ARRAY_SIZE(pOutputData->eulerStdDev));
+
+		pOutputData->status			= sbgStreamBufferReadUint32LE(pInputStream);
+	}
 
 	//
 	// Return if any error has occurred while parsing the frame
@@ -93,14 +172,9 @@ SbgErrorCode sbgEComBinaryLogWriteEkfQuatData(SbgStreamBuffer *pOutputStream, co
 	//
 	sbgStreamBufferWriteUint32LE(pOutputStream, pInputData->timeStamp);
 
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->quaternion[0]); 
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->quaternion[1]); 
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->quaternion[2]); 
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->quaternion[3]); 
+	sbgStreamBufferWriteFloatArrayLE(pOutputStream, pInputData->quaternion, SBG_ARRAY_SIZE(pInputData->quaternion));
 
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->eulerStdDev[0]); 
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->eulerStdDev[1]); 
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->eulerStdDev[2]);
+	sbgStreamBufferWriteFloatArrayLE(pOutputStream, pInputData->eulerStdDev, SBG_ARRAY_SIZE(pInputData->eulerStdDev));
 
 	sbgStreamBufferWriteUint32LE(pOutputStream, pInputData->status);
 
@@ -115,30 +189,35 @@ SbgErrorCode sbgEComBinaryLogParseEkfNavData(SbgStreamBuffer *pInputStream, SbgL
 	assert(pInputStream);
 	assert(pOutputData);
 
+#if SBG_CONFIG_BIG_ENDIAN == 0
 	//
-	// Read the frame payload
+	// The payload layout matches the platform one so check the size once and load fields directly
 	//
-	pOutputData->timeStamp			= sbgStreamBufferReadUint32LE(pInputStream);
+	if ((sbgStreamBufferGetLastError(pInputStream) == SBG_NO_ERROR) && (sbgStreamBufferGetSpace(pInputStream) >= SBG_ECOM_LOG_EKF_NAV_PAYLOAD_SIZE))
+	{
+		sbgEComBinaryLogLoadEkfNavData(pOutputData, sbgStreamBufferGetCursor(pInputStream));
+		sbgStreamBufferSeek(pInputStream, SBG_ECOM_LOG_EKF_NAV_PAYLOAD_SIZE, SB_SEEK_CUR_INC);
+	}
+	else
+#endif
+	{
+		//
+		// Read the frame payload
+		//
+		pOutputData->timeStamp			= sbgStreamBufferReadUint32LE(pInputStream);
 
-	pOutputData->velocity[0]		= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->velocity[1]		= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->velocity[2]		= sbgStreamBufferReadFloatLE(pInputStream);
+		sbgStreamBufferReadFloatArrayLE(pInputStream, pOutputData->velocity, SBG_ARRAY_SIZE(pOutputData->velocity));
 
-	pOutputData->velocityStdDev[0]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->velocityStdDev[1]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->velocityStdDev[2]	= sbgStreamBufferReadFloatLE(pInputStream);
+		sbgStreamBufferReadFloatArrayLE(pInputStream, pOutputData->velocityStdDev, SBG_ARRAY_SIZE(pOutputData->velocityStdDev));
 
-	pOutputData->position[0]		= sbgStreamBufferReadDoubleLE(pInputStream);
-	pOutputData->position[1]		= sbgStreamBufferReadDoubleLE(pInputStream);
-	pOutputData->position[2]		= sbgStreamBufferReadDoubleLE(pInputStream);
+		sbgStreamBufferReadDoubleArrayLE(pInputStream, pOutputData->position, SBG_ARRAY_SIZE(pOutputData->position));
 
-	pOutputData->undulation			= sbgStreamBufferReadFloatLE(pInputStream);
+		pOutputData->undulation			= sbgStreamBufferReadFloatLE(pInputStream);
 
-	pOutputData->positionStdDev[0]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->positionStdDev[1]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->positionStdDev[2]	= sbgStreamBufferReadFloatLE(pInputStream);
+		sbgStreamBufferReadFloatArrayLE(pInputStream, pOutputData->positionStdDev, SBG_ARRAY_SIZE(pOutputData->positionStdDev));
 
-	pOutputData->status				= sbgStreamBufferReadUint32LE(pInputStream);
+		pOutputData->status				= sbgStreamBufferReadUint32LE(pInputStream);
+	}
 
 	//
 	// Return if any error has occurred while parsing the frame
@@ -156,23 +235,15 @@ SbgErrorCode sbgEComBinaryLogWriteEkfNavData(SbgStreamBuffer *pOutputStream, con
 	//
 	sbgStreamBufferWriteUint32LE(pOutputStream, pInputData->timeStamp);
 
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->velocity[0]);
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->velocity[1]);
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->velocity[2]);
+	sbgStreamBufferWriteFloatArrayLE(pOutputStream, pInputData->velocity, SBG_ARRAY_SIZE(pInputData->velocity));
 
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->velocityStdDev[0]);
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->velocityStdDev[1]);
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->velocityStdDev[2]);
+	sbgStreamBufferWriteFloatArrayLE(pOutputStream, pInputData->velocityStdDev, SBG_ARRAY_SIZE(pInputData->velocityStdDev));
 
-	sbgStreamBufferWriteDoubleLE(pOutputStream, pInputData->position[0]);
-	sbgStreamBufferWriteDoubleLE(pOutputStream, pInputData->position[1]);
-	sbgStreamBufferWriteDoubleLE(pOutputStream, pInputData->position[2]);
+	sbgStreamBufferWriteDoubleArrayLE(pOutputStream, pInputData->position, SBG_ARRAY_SIZE(pInputData->position));
 
 	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->undulation);
 
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->positionStdDev[0]);
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->positionStdDev[1]);
-	sbgStreamBufferWriteFloatLE(pOutputStream, pInputData->positionStdDev[2]);
+	sbgStreamBufferWriteFloatArrayLE(pOutputStream, pInputData->positionStdDev, SBG_ARRAY_SIZE(pInputData->positionStdDev));
 
 	sbgStreamBufferWriteUint32LE(pOutputStream, pInputData->status);
 
@@ -181,3 +252,64 @@ SbgErrorCode sbgEComBinaryLogWriteEkfNavData(SbgStreamBuffer *pOutputStream, con
 	//
 	return sbgStreamBufferGetLastError(pOutputStream);
 }
+
+//----------------------------------------------------------------------//
+//- Log views methods                                                  -//
+//----------------------------------------------------------------------//
+
+SbgErrorCode sbgLogEkfEulerViewInit(SbgLogEkfEulerView *pView, const void *pPayload, size_t payloadSize)
+{
+	SbgErrorCode	errorCode = SBG_NO_ERROR;
+
+	assert(pView);
+	assert(pPayload);
+
+	if (payloadSize >= SBG_ECOM_LOG_EKF_EULER_PAYLOAD_SIZE)
+	{
+		pView->pPayload = (const uint8_t*)pPayload;
+	}
+	else
+	{
+		errorCode = SBG_BUFFER_OVERFLOW;
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgLogEkfQuatViewInit(SbgLogEkfQuatView *pView, const void *pPayload, size_t payloadSize)
+{
+	SbgErrorCode	errorCode = SBG_NO_ERROR;
+
+	assert(pView);
+	assert(pPayload);
+
+	if (payloadSize >= SBG_ECOM_LOG_EKF_QUAT_PAYLOAD_SIZE)
+	{
+		pView->pPayload = (const uint8_t*)pPayload;
+	}
+	else
+	{
+		errorCode = SBG_BUFFER_OVERFLOW;
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgLogEkfNavViewInit(SbgLogEkfNavView *pView, const void *pPayload, size_t payloadSize)
+{
+	SbgErrorCode	errorCode = SBG_NO_ERROR;
+
+	assert(pView);
+	assert(pPayload);
+
+	if (payloadSize >= SBG_ECOM_LOG_EKF_NAV_PAYLOAD_SIZE)
+	{
+		pView->pPayload = (const uint8_t*)pPayload;
+	}
+	else
+	{
+		errorCode = SBG_BUFFER_OVERFLOW;
+	}
+
+	return errorCode;
+}
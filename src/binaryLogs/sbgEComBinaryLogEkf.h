@@ -36,6 +36,9 @@
 #include <sbgCommon.h>
 #include <streamBuffer/sbgStreamBuffer.h>
 
+// Local headers
+#include "sbgEComBinaryLogView.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -161,6 +164,74 @@ typedef struct _SbgLogEkfNavData
 	uint32_t	status;					/*!< EKF solution status bitmask and enum. */
 } SbgLogEkfNavData;
 
+//----------------------------------------------------------------------//
+//- Log views definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Payload size in bytes of the fixed layout EKF logs.
+ */
+#define SBG_ECOM_LOG_EKF_EULER_PAYLOAD_SIZE					(32)
+#define SBG_ECOM_LOG_EKF_QUAT_PAYLOAD_SIZE					(36)
+#define SBG_ECOM_LOG_EKF_NAV_PAYLOAD_SIZE					(72)
+
+/*!
+ * Offsets in bytes of each SBG_ECOM_LOG_EKF_EULER field.
+ */
+#define SBG_ECOM_LOG_EKF_EULER_OFFSET_TIME_STAMP			(0)
+#define SBG_ECOM_LOG_EKF_EULER_OFFSET_EULER					(4)
+#define SBG_ECOM_LOG_EKF_EULER_OFFSET_EULER_STD_DEV			(16)
+#define SBG_ECOM_LOG_EKF_EULER_OFFSET_STATUS				(28)
+
+/*!
+ * Offsets in bytes of each SBG_ECOM_LOG_EKF_QUAT field.
+ */
+#define SBG_ECOM_LOG_EKF_QUAT_OFFSET_TIME_STAMP				(0)
+#define SBG_ECOM_LOG_EKF_QUAT_OFFSET_QUATERNION				(4)
+#define SBG_ECOM_LOG_EKF_QUAT_OFFSET_EULER_STD_DEV			(20)
+#define SBG_ECOM_LOG_EKF_QUAT_OFFSET_STATUS					(32)
+
+/*!
+ * Offsets in bytes of each SBG_ECOM_LOG_EKF_NAV field.
+ */
+#define SBG_ECOM_LOG_EKF_NAV_OFFSET_TIME_STAMP				(0)
+#define SBG_ECOM_LOG_EKF_NAV_OFFSET_VELOCITY				(4)
+#define SBG_ECOM_LOG_EKF_NAV_OFFSET_VELOCITY_STD_DEV		(16)
+#define SBG_ECOM_LOG_EKF_NAV_OFFSET_POSITION				(28)
+#define SBG_ECOM_LOG_EKF_NAV_OFFSET_UNDULATION				(52)
+#define SBG_ECOM_LOG_EKF_NAV_OFFSET_POSITION_STD_DEV		(56)
+#define SBG_ECOM_LOG_EKF_NAV_OFFSET_STATUS					(68)
+
+/*!
+ * Lazy view on a SBG_ECOM_LOG_EKF_EULER payload.
+ *
+ * Fields are only decoded when accessed.
+ */
+typedef struct _SbgLogEkfEulerView
+{
+	const uint8_t	*pPayload;			/*!< Log payload, referenced and not copied. */
+} SbgLogEkfEulerView;
+
+/*!
+ * Lazy view on a SBG_ECOM_LOG_EKF_QUAT payload.
+ *
+ * Fields are only decoded when accessed.
+ */
+typedef struct _SbgLogEkfQuatView
+{
+	const uint8_t	*pPayload;			/*!< Log payload, referenced and not copied. */
+} SbgLogEkfQuatView;
+
+/*!
+ * Lazy view on a SBG_ECOM_LOG_EKF_NAV payload.
+ *
+ * Fields are only decoded when accessed.
+ */
+typedef struct _SbgLogEkfNavView
+{
+	const uint8_t	*pPayload;			/*!< Log payload, referenced and not copied. */
+} SbgLogEkfNavView;
+
 //----------------------------------------------------------------------//
 //- Public methods                                                     -//
 //----------------------------------------------------------------------//
@@ -219,6 +290,257 @@ SbgErrorCode sbgEComBinaryLogParseEkfNavData(SbgStreamBuffer *pInputStream, SbgL
  */
 SbgErrorCode sbgEComBinaryLogWriteEkfNavData(SbgStreamBuffer *pOutputStream, const SbgLogEkfNavData *pInputData);
 
+//----------------------------------------------------------------------//
+//- Log views methods                                                  -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Initialize a SBG_ECOM_LOG_EKF_EULER view on a received payload.
+ *
+ * The payload is referenced and must remain valid as long as the view is used.
+ *
+ * \param[out]	pView						Log view to initialize.
+ * \param[in]	pPayload					Log payload.
+ * \param[in]	payloadSize					Payload size in bytes.
+ * \return									SBG_NO_ERROR if successful, SBG_BUFFER_OVERFLOW if the payload is too short.
+ */
+SbgErrorCode sbgLogEkfEulerViewInit(SbgLogEkfEulerView *pView, const void *pPayload, size_t payloadSize);
+
+/*!
+ * Initialize a SBG_ECOM_LOG_EKF_QUAT view on a received payload.
+ *
+ * The payload is referenced and must remain valid as long as the view is used.
+ *
+ * \param[out]	pView						Log view to initialize.
+ * \param[in]	pPayload					Log payload.
+ * \param[in]	payloadSize					Payload size in bytes.
+ * \return									SBG_NO_ERROR if successful, SBG_BUFFER_OVERFLOW if the payload is too short.
+ */
+SbgErrorCode sbgLogEkfQuatViewInit(SbgLogEkfQuatView *pView, const void *pPayload, size_t payloadSize);
+
+/*!
+ * Initialize a SBG_ECOM_LOG_EKF_NAV view on a received payload.
+ *
+ * The payload is referenced and must remain valid as long as the view is used.
+ *
+ * \param[out]	pView						Log view to initialize.
+ * \param[in]	pPayload					Log payload.
+ * \param[in]	payloadSize					Payload size in bytes.
+ * \return									SBG_NO_ERROR if successful, SBG_BUFFER_OVERFLOW if the payload is too short.
+ */
+SbgErrorCode sbgLogEkfNavViewInit(SbgLogEkfNavView *pView, const void *pPayload, size_t payloadSize);
+
+/*!
+ * Returns the time stamp.
+ *
+ * \param[in]	pView						Log view.
+ * \return									Time in us since the sensor power up.
+ */
+SBG_INLINE uint32_t sbgLogEkfEulerViewGetTimeStamp(const SbgLogEkfEulerView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadUint32(pView->pPayload, SBG_ECOM_LOG_EKF_EULER_OFFSET_TIME_STAMP);
+}
+
+/*!
+ * Returns the euler angle.
+ *
+ * \param[in]	pView						Log view.
+ * \param[in]	idx							Component index from 0 to 2.
+ * \return									Roll, Pitch or Yaw angle in rad.
+ */
+SBG_INLINE float sbgLogEkfEulerViewGetEuler(const SbgLogEkfEulerView *pView, size_t idx)
+{
+	assert(pView);
+	assert(idx < 3);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_EKF_EULER_OFFSET_EULER + idx * sizeof(float));
+}
+
+/*!
+ * Returns the euler angle standard deviation.
+ *
+ * \param[in]	pView						Log view.
+ * \param[in]	idx							Component index from 0 to 2.
+ * \return									Roll, Pitch or Yaw angle 1 sigma standard deviation in rad.
+ */
+SBG_INLINE float sbgLogEkfEulerViewGetEulerStdDev(const SbgLogEkfEulerView *pView, size_t idx)
+{
+	assert(pView);
+	assert(idx < 3);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_EKF_EULER_OFFSET_EULER_STD_DEV + idx * sizeof(float));
+}
+
+/*!
+ * Returns the EKF solution status.
+ *
+ * \param[in]	pView						Log view.
+ * \return									EKF solution status bitmask and enum.
+ */
+SBG_INLINE uint32_t sbgLogEkfEulerViewGetStatus(const SbgLogEkfEulerView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadUint32(pView->pPayload, SBG_ECOM_LOG_EKF_EULER_OFFSET_STATUS);
+}
+
+/*!
+ * Returns the time stamp.
+ *
+ * \param[in]	pView						Log view.
+ * \return									Time in us since the sensor power up.
+ */
+SBG_INLINE uint32_t sbgLogEkfQuatViewGetTimeStamp(const SbgLogEkfQuatView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadUint32(pView->pPayload, SBG_ECOM_LOG_EKF_QUAT_OFFSET_TIME_STAMP);
+}
+
+/*!
+ * Returns the orientation quaternion component.
+ *
+ * \param[in]	pView						Log view.
+ * \param[in]	idx							Component index from 0 to 3.
+ * \return									Quaternion W, X, Y or Z component.
+ */
+SBG_INLINE float sbgLogEkfQuatViewGetQuaternion(const SbgLogEkfQuatView *pView, size_t idx)
+{
+	assert(pView);
+	assert(idx < 4);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_EKF_QUAT_OFFSET_QUATERNION + idx * sizeof(float));
+}
+
+/*!
+ * Returns the euler angle standard deviation.
+ *
+ * \param[in]	pView						Log view.
+ * \param[in]	idx							Component index from 0 to 2.
+ * \return									Roll, Pitch or Yaw angle 1 sigma standard deviation in rad.
+ */
+SBG_INLINE float sbgLogEkfQuatViewGetEulerStdDev(const SbgLogEkfQuatView *pView, size_t idx)
+{
+	assert(pView);
+	assert(idx < 3);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_EKF_QUAT_OFFSET_EULER_STD_DEV + idx * sizeof(float));
+}
+
+/*!
+ * Returns the EKF solution status.
+ *
+ * \param[in]	pView						Log view.
+ * \return									EKF solution status bitmask and enum.
+ */
+SBG_INLINE uint32_t sbgLogEkfQuatViewGetStatus(const SbgLogEkfQuatView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadUint32(pView->pPayload, SBG_ECOM_LOG_EKF_QUAT_OFFSET_STATUS);
+}
+
+/*!
+ * Returns the time stamp.
+ *
+ * \param[in]	pView						Log view.
+ * \return									Time in us since the sensor power up.
+ */
+SBG_INLINE uint32_t sbgLogEkfNavViewGetTimeStamp(const SbgLogEkfNavView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadUint32(pView->pPayload, SBG_ECOM_LOG_EKF_NAV_OFFSET_TIME_STAMP);
+}
+
+/*!
+ * Returns the velocity.
+ *
+ * \param[in]	pView						Log view.
+ * \param[in]	idx							Component index from 0 to 2.
+ * \return									North, East or Down velocity in m.s^-1.
+ */
+SBG_INLINE float sbgLogEkfNavViewGetVelocity(const SbgLogEkfNavView *pView, size_t idx)
+{
+	assert(pView);
+	assert(idx < 3);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_EKF_NAV_OFFSET_VELOCITY + idx * sizeof(float));
+}
+
+/*!
+ * Returns the velocity standard deviation.
+ *
+ * \param[in]	pView						Log view.
+ * \param[in]	idx							Component index from 0 to 2.
+ * \return									North, East or Down velocity 1 sigma standard deviation in m.s^-1.
+ */
+SBG_INLINE float sbgLogEkfNavViewGetVelocityStdDev(const SbgLogEkfNavView *pView, size_t idx)
+{
+	assert(pView);
+	assert(idx < 3);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_EKF_NAV_OFFSET_VELOCITY_STD_DEV + idx * sizeof(float));
+}
+
+/*!
+ * Returns the position.
+ *
+ * \param[in]	pView						Log view.
+ * \param[in]	idx							Component index from 0 to 2.
+ * \return									Latitude, Longitude in degrees or Altitude above Mean Sea Level in meters.
+ */
+SBG_INLINE double sbgLogEkfNavViewGetPosition(const SbgLogEkfNavView *pView, size_t idx)
+{
+	assert(pView);
+	assert(idx < 3);
+
+	return sbgEComBinaryLogViewReadDouble(pView->pPayload, SBG_ECOM_LOG_EKF_NAV_OFFSET_POSITION + idx * sizeof(double));
+}
+
+/*!
+ * Returns the undulation.
+ *
+ * \param[in]	pView						Log view.
+ * \return									Altitude difference between the geoid and the Ellipsoid in meters.
+ */
+SBG_INLINE float sbgLogEkfNavViewGetUndulation(const SbgLogEkfNavView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_EKF_NAV_OFFSET_UNDULATION);
+}
+
+/*!
+ * Returns the position standard deviation.
+ *
+ * \param[in]	pView						Log view.
+ * \param[in]	idx							Component index from 0 to 2.
+ * \return									Latitude, longitude or altitude 1 sigma standard deviation in meters.
+ */
+SBG_INLINE float sbgLogEkfNavViewGetPositionStdDev(const SbgLogEkfNavView *pView, size_t idx)
+{
+	assert(pView);
+	assert(idx < 3);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_EKF_NAV_OFFSET_POSITION_STD_DEV + idx * sizeof(float));
+}
+
+/*!
+ * Returns the EKF solution status.
+ *
+ * \param[in]	pView						Log view.
+ * \return									EKF solution status bitmask and enum.
+ */
+SBG_INLINE uint32_t sbgLogEkfNavViewGetStatus(const SbgLogEkfNavView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadUint32(pView->pPayload, SBG_ECOM_LOG_EKF_NAV_OFFSET_STATUS);
+}
+
 #ifdef __cplusplus
 }
 #endif
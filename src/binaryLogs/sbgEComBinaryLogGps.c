@@ -6,28 +6,33 @@
 
 SbgErrorCode sbgEComBinaryLogParseGpsVelData(SbgStreamBuffer *pInputStream, SbgLogGpsVel *pOutputData)
 {
+	SbgErrorCode			errorCode;
+	SbgStreamBufferReader	reader;
+
 	assert(pInputStream);
 	assert(pOutputData);
 
 	//
-	// Read the frame payload
+	// Reserve the whole payload at once so that each field is read without any check
 	//
-	pOutputData->timeStamp		= sbgStreamBufferReadUint32LE(pInputStream);
-	pOutputData->status			= sbgStreamBufferReadUint32LE(pInputStream);
-	pOutputData->timeOfWeek		= sbgStreamBufferReadUint32LE(pInputStream);
-	pOutputData->velocity[0]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->velocity[1]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->velocity[2]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->velocityAcc[0]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->velocityAcc[1]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->velocityAcc[2]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->course			= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->courseAcc		= sbgStreamBufferReadFloatLE(pInputStream);
+	errorCode = sbgStreamBufferReserveRead(pInputStream, SBG_ECOM_LOG_GPS_VEL_PAYLOAD_SIZE, &reader);
 
-	//
-	// Return if any error has occurred while parsing the frame
-	//
-	return sbgStreamBufferGetLastError(pInputStream);
+	if (errorCode == SBG_NO_ERROR)
+	{
+		pOutputData->timeStamp		= sbgStreamBufferReaderReadUint32LE(&reader);
+		pOutputData->status			= sbgStreamBufferReaderReadUint32LE(&reader);
+		pOutputData->timeOfWeek		= sbgStreamBufferReaderReadUint32LE(&reader);
+		pOutputData->velocity[0]	= sbgStreamBufferReaderReadFloatLE(&reader);
+		pOutputData->velocity[1]	= sbgStreamBufferReaderReadFloatLE(&reader);
+		pOutputData->velocity[2]	= sbgStreamBufferReaderReadFloatLE(&reader);
+		pOutputData->velocityAcc[0]	= sbgStreamBufferReaderReadFloatLE(&reader);
+		pOutputData->velocityAcc[1]	= sbgStreamBufferReaderReadFloatLE(&reader);
+		pOutputData->velocityAcc[2]	= sbgStreamBufferReaderReadFloatLE(&reader);
+		pOutputData->course			= sbgStreamBufferReaderReadFloatLE(&reader);
+		pOutputData->courseAcc		= sbgStreamBufferReaderReadFloatLE(&reader);
+	}
+
+	return errorCode;
 }
 
 SbgErrorCode sbgEComBinaryLogWriteGpsVelData(SbgStreamBuffer *pOutputStream, const SbgLogGpsVel *pInputData)
@@ -200,7 +205,55 @@ SbgErrorCode sbgEComBinaryLogParseGpsRawData(SbgStreamBuffer *pInputStream, SbgL
 	return sbgEComBinaryLogParseRawData(pInputStream, pOutputData);
 }
 
+SbgErrorCode sbgEComBinaryLogParseGpsRawDataView(SbgStreamBuffer *pInputStream, SbgLogRawDataView *pOutputData)
+{
+	return sbgEComBinaryLogParseRawDataView(pInputStream, pOutputData);
+}
+
 SbgErrorCode sbgEComBinaryLogWriteGpsRawData(SbgStreamBuffer *pOutputStream, const SbgLogRawData *pInputData)
 {
 	return sbgEComBinaryLogWriteRawData(pOutputStream, pInputData);
 }
+
+//----------------------------------------------------------------------//
+//- Log views methods                                                  -//
+//----------------------------------------------------------------------//
+
+SbgErrorCode sbgLogGpsVelViewInit(SbgLogGpsVelView *pView, const void *pPayload, size_t payloadSize)
+{
+	SbgErrorCode	errorCode = SBG_NO_ERROR;
+
+	assert(pView);
+	assert(pPayload);
+
+	if (payloadSize >= SBG_ECOM_LOG_GPS_VEL_PAYLOAD_SIZE)
+	{
+		pView->pPayload = (const uint8_t*)pPayload;
+	}
+	else
+	{
+		errorCode = SBG_BUFFER_OVERFLOW;
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgLogGpsPosViewInit(SbgLogGpsPosView *pView, const void *pPayload, size_t payloadSize)
+{
+	SbgErrorCode	errorCode = SBG_NO_ERROR;
+
+	assert(pView);
+	assert(pPayload);
+
+	if (payloadSize >= SBG_ECOM_LOG_GPS_POS_MIN_PAYLOAD_SIZE)
+	{
+		pView->pPayload		= (const uint8_t*)pPayload;
+		pView->payloadSize	= payloadSize;
+	}
+	else
+	{
+		errorCode = SBG_BUFFER_OVERFLOW;
+	}
+
+	return errorCode;
+}
@@ -37,6 +37,7 @@
 #include <streamBuffer/sbgStreamBuffer.h>
 
 // Local headers
+#include "sbgEComBinaryLogView.h"
 #include "sbgEComBinaryLogRawData.h"
 
 #ifdef __cplusplus
@@ -349,6 +350,68 @@ typedef struct _SbgLogGpsHdt
 	float			baseline;				/*!< The distance between the main and aux antenna in meters. */
 } SbgLogGpsHdt;
 
+//----------------------------------------------------------------------//
+//- Log views definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Payload size in bytes of the GPS velocity and position logs.
+ *
+ * The GPS position log is only SBG_ECOM_LOG_GPS_POS_MIN_PAYLOAD_SIZE bytes for firmware older than version 1.4.
+ */
+#define SBG_ECOM_LOG_GPS_VEL_PAYLOAD_SIZE					(44)
+#define SBG_ECOM_LOG_GPS_POS_MIN_PAYLOAD_SIZE				(52)
+#define SBG_ECOM_LOG_GPS_POS_PAYLOAD_SIZE					(57)
+
+/*!
+ * Offsets in bytes of each SBG_ECOM_LOG_GPS#_VEL field.
+ */
+#define SBG_ECOM_LOG_GPS_VEL_OFFSET_TIME_STAMP				(0)
+#define SBG_ECOM_LOG_GPS_VEL_OFFSET_STATUS					(4)
+#define SBG_ECOM_LOG_GPS_VEL_OFFSET_TIME_OF_WEEK			(8)
+#define SBG_ECOM_LOG_GPS_VEL_OFFSET_VELOCITY				(12)
+#define SBG_ECOM_LOG_GPS_VEL_OFFSET_VELOCITY_ACC			(24)
+#define SBG_ECOM_LOG_GPS_VEL_OFFSET_COURSE					(36)
+#define SBG_ECOM_LOG_GPS_VEL_OFFSET_COURSE_ACC				(40)
+
+/*!
+ * Offsets in bytes of each SBG_ECOM_LOG_GPS#_POS field.
+ */
+#define SBG_ECOM_LOG_GPS_POS_OFFSET_TIME_STAMP				(0)
+#define SBG_ECOM_LOG_GPS_POS_OFFSET_STATUS					(4)
+#define SBG_ECOM_LOG_GPS_POS_OFFSET_TIME_OF_WEEK			(8)
+#define SBG_ECOM_LOG_GPS_POS_OFFSET_LATITUDE				(12)
+#define SBG_ECOM_LOG_GPS_POS_OFFSET_LONGITUDE				(20)
+#define SBG_ECOM_LOG_GPS_POS_OFFSET_ALTITUDE				(28)
+#define SBG_ECOM_LOG_GPS_POS_OFFSET_UNDULATION				(36)
+#define SBG_ECOM_LOG_GPS_POS_OFFSET_LATITUDE_ACCURACY		(40)
+#define SBG_ECOM_LOG_GPS_POS_OFFSET_LONGITUDE_ACCURACY		(44)
+#define SBG_ECOM_LOG_GPS_POS_OFFSET_ALTITUDE_ACCURACY		(48)
+#define SBG_ECOM_LOG_GPS_POS_OFFSET_NUM_SV_USED				(52)
+#define SBG_ECOM_LOG_GPS_POS_OFFSET_BASE_STATION_ID			(53)
+#define SBG_ECOM_LOG_GPS_POS_OFFSET_DIFFERENTIAL_AGE		(55)
+
+/*!
+ * Lazy view on a SBG_ECOM_LOG_GPS#_VEL payload.
+ *
+ * Fields are only decoded when accessed.
+ */
+typedef struct _SbgLogGpsVelView
+{
+	const uint8_t	*pPayload;			/*!< Log payload, referenced and not copied. */
+} SbgLogGpsVelView;
+
+/*!
+ * Lazy view on a SBG_ECOM_LOG_GPS#_POS payload.
+ *
+ * Fields are only decoded when accessed.
+ */
+typedef struct _SbgLogGpsPosView
+{
+	const uint8_t	*pPayload;			/*!< Log payload, referenced and not copied. */
+	size_t			 payloadSize;		/*!< Payload size in bytes. */
+} SbgLogGpsPosView;
+
 //----------------------------------------------------------------------//
 //- Public methods                                                     -//
 //----------------------------------------------------------------------//
@@ -416,6 +479,15 @@ SbgErrorCode sbgEComBinaryLogWriteGpsHdtData(SbgStreamBuffer *pOutputStream, con
  */
 SbgErrorCode sbgEComBinaryLogParseGpsRawData(SbgStreamBuffer *pInputStream, SbgLogRawData *pOutputData);
 
+/*!
+ * Parse data for the SBG_ECOM_LOG_GPS#_RAW message and reference it from the corresponding view, without any copy.
+ *
+ * \param[in]	pInputStream				Input stream buffer to read the payload from.
+ * \param[out]	pOutputData					Pointer on the output view that references the raw data.
+ * \return									SBG_NO_ERROR if the payload has been parsed.
+ */
+SbgErrorCode sbgEComBinaryLogParseGpsRawDataView(SbgStreamBuffer *pInputStream, SbgLogRawDataView *pOutputData);
+
 /*!
  * Write data for the SBG_ECOM_LOG_GPS#_RAW message to the output stream buffer from the provided structure.
  * 
@@ -425,6 +497,340 @@ SbgErrorCode sbgEComBinaryLogParseGpsRawData(SbgStreamBuffer *pInputStream, SbgL
  */
 SbgErrorCode sbgEComBinaryLogWriteGpsRawData(SbgStreamBuffer *pOutputStream, const SbgLogRawData *pInputData);
 
+//----------------------------------------------------------------------//
+//- Log views methods                                                  -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Initialize a SBG_ECOM_LOG_GPS#_VEL view on a received payload.
+ *
+ * The payload is referenced and must remain valid as long as the view is used.
+ *
+ * \param[out]	pView						Log view to initialize.
+ * \param[in]	pPayload					Log payload.
+ * \param[in]	payloadSize					Payload size in bytes.
+ * \return									SBG_NO_ERROR if successful, SBG_BUFFER_OVERFLOW if the payload is too short.
+ */
+SbgErrorCode sbgLogGpsVelViewInit(SbgLogGpsVelView *pView, const void *pPayload, size_t payloadSize);
+
+/*!
+ * Initialize a SBG_ECOM_LOG_GPS#_POS view on a received payload.
+ *
+ * The payload is referenced and must remain valid as long as the view is used.
+ *
+ * \param[out]	pView						Log view to initialize.
+ * \param[in]	pPayload					Log payload.
+ * \param[in]	payloadSize					Payload size in bytes.
+ * \return									SBG_NO_ERROR if successful, SBG_BUFFER_OVERFLOW if the payload is too short.
+ */
+SbgErrorCode sbgLogGpsPosViewInit(SbgLogGpsPosView *pView, const void *pPayload, size_t payloadSize);
+
+/*!
+ * Returns the time stamp.
+ *
+ * \param[in]	pView						Log view.
+ * \return									Time in us since the sensor power up.
+ */
+SBG_INLINE uint32_t sbgLogGpsVelViewGetTimeStamp(const SbgLogGpsVelView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadUint32(pView->pPayload, SBG_ECOM_LOG_GPS_VEL_OFFSET_TIME_STAMP);
+}
+
+/*!
+ * Returns the GPS velocity status.
+ *
+ * \param[in]	pView						Log view.
+ * \return									GPS velocity status, type and bitmask.
+ */
+SBG_INLINE uint32_t sbgLogGpsVelViewGetStatus(const SbgLogGpsVelView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadUint32(pView->pPayload, SBG_ECOM_LOG_GPS_VEL_OFFSET_STATUS);
+}
+
+/*!
+ * Returns the GPS time of week.
+ *
+ * \param[in]	pView						Log view.
+ * \return									GPS time of week in ms.
+ */
+SBG_INLINE uint32_t sbgLogGpsVelViewGetTimeOfWeek(const SbgLogGpsVelView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadUint32(pView->pPayload, SBG_ECOM_LOG_GPS_VEL_OFFSET_TIME_OF_WEEK);
+}
+
+/*!
+ * Returns the velocity.
+ *
+ * \param[in]	pView						Log view.
+ * \param[in]	idx							Component index from 0 to 2.
+ * \return									GPS North, East or Down velocity in m.s^-1.
+ */
+SBG_INLINE float sbgLogGpsVelViewGetVelocity(const SbgLogGpsVelView *pView, size_t idx)
+{
+	assert(pView);
+	assert(idx < 3);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_GPS_VEL_OFFSET_VELOCITY + idx * sizeof(float));
+}
+
+/*!
+ * Returns the velocity accuracy.
+ *
+ * \param[in]	pView						Log view.
+ * \param[in]	idx							Component index from 0 to 2.
+ * \return									GPS North, East or Down velocity 1 sigma accuracy in m.s^-1.
+ */
+SBG_INLINE float sbgLogGpsVelViewGetVelocityAcc(const SbgLogGpsVelView *pView, size_t idx)
+{
+	assert(pView);
+	assert(idx < 3);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_GPS_VEL_OFFSET_VELOCITY_ACC + idx * sizeof(float));
+}
+
+/*!
+ * Returns the track ground course.
+ *
+ * \param[in]	pView						Log view.
+ * \return									Track ground course in degrees.
+ */
+SBG_INLINE float sbgLogGpsVelViewGetCourse(const SbgLogGpsVelView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_GPS_VEL_OFFSET_COURSE);
+}
+
+/*!
+ * Returns the course accuracy.
+ *
+ * \param[in]	pView						Log view.
+ * \return									Course accuracy in degrees.
+ */
+SBG_INLINE float sbgLogGpsVelViewGetCourseAcc(const SbgLogGpsVelView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_GPS_VEL_OFFSET_COURSE_ACC);
+}
+
+/*!
+ * Returns the time stamp.
+ *
+ * \param[in]	pView						Log view.
+ * \return									Time in us since the sensor power up.
+ */
+SBG_INLINE uint32_t sbgLogGpsPosViewGetTimeStamp(const SbgLogGpsPosView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadUint32(pView->pPayload, SBG_ECOM_LOG_GPS_POS_OFFSET_TIME_STAMP);
+}
+
+/*!
+ * Returns the GPS position status.
+ *
+ * \param[in]	pView						Log view.
+ * \return									GPS position status, type and bitmask.
+ */
+SBG_INLINE uint32_t sbgLogGpsPosViewGetStatus(const SbgLogGpsPosView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadUint32(pView->pPayload, SBG_ECOM_LOG_GPS_POS_OFFSET_STATUS);
+}
+
+/*!
+ * Returns the GPS time of week.
+ *
+ * \param[in]	pView						Log view.
+ * \return									GPS time of week in ms.
+ */
+SBG_INLINE uint32_t sbgLogGpsPosViewGetTimeOfWeek(const SbgLogGpsPosView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadUint32(pView->pPayload, SBG_ECOM_LOG_GPS_POS_OFFSET_TIME_OF_WEEK);
+}
+
+/*!
+ * Returns the latitude.
+ *
+ * \param[in]	pView						Log view.
+ * \return									Latitude in degrees, positive north.
+ */
+SBG_INLINE double sbgLogGpsPosViewGetLatitude(const SbgLogGpsPosView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadDouble(pView->pPayload, SBG_ECOM_LOG_GPS_POS_OFFSET_LATITUDE);
+}
+
+/*!
+ * Returns the longitude.
+ *
+ * \param[in]	pView						Log view.
+ * \return									Longitude in degrees, positive east.
+ */
+SBG_INLINE double sbgLogGpsPosViewGetLongitude(const SbgLogGpsPosView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadDouble(pView->pPayload, SBG_ECOM_LOG_GPS_POS_OFFSET_LONGITUDE);
+}
+
+/*!
+ * Returns the altitude.
+ *
+ * \param[in]	pView						Log view.
+ * \return									Altitude above Mean Sea Level in meters.
+ */
+SBG_INLINE double sbgLogGpsPosViewGetAltitude(const SbgLogGpsPosView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadDouble(pView->pPayload, SBG_ECOM_LOG_GPS_POS_OFFSET_ALTITUDE);
+}
+
+/*!
+ * Returns the undulation.
+ *
+ * \param[in]	pView						Log view.
+ * \return									Altitude difference between the geoid and the Ellipsoid in meters.
+ */
+SBG_INLINE float sbgLogGpsPosViewGetUndulation(const SbgLogGpsPosView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_GPS_POS_OFFSET_UNDULATION);
+}
+
+/*!
+ * Returns the latitude accuracy.
+ *
+ * \param[in]	pView						Log view.
+ * \return									1 sigma latitude accuracy in meters.
+ */
+SBG_INLINE float sbgLogGpsPosViewGetLatitudeAccuracy(const SbgLogGpsPosView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_GPS_POS_OFFSET_LATITUDE_ACCURACY);
+}
+
+/*!
+ * Returns the longitude accuracy.
+ *
+ * \param[in]	pView						Log view.
+ * \return									1 sigma longitude accuracy in meters.
+ */
+SBG_INLINE float sbgLogGpsPosViewGetLongitudeAccuracy(const SbgLogGpsPosView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_GPS_POS_OFFSET_LONGITUDE_ACCURACY);
+}
+
+/*!
+ * Returns the altitude accuracy.
+ *
+ * \param[in]	pView						Log view.
+ * \return									1 sigma altitude accuracy in meters.
+ */
+SBG_INLINE float sbgLogGpsPosViewGetAltitudeAccuracy(const SbgLogGpsPosView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_GPS_POS_OFFSET_ALTITUDE_ACCURACY);
+}
+
+/*!
+ * Returns the number of space vehicles used.
+ *
+ * \param[in]	pView						Log view.
+ * \return									Number of space vehicles used, 0 if not provided by the device.
+ */
+SBG_INLINE uint8_t sbgLogGpsPosViewGetNumSvUsed(const SbgLogGpsPosView *pView)
+{
+	uint8_t	value;
+
+	assert(pView);
+
+	//
+	// Optional field only sent by recent firmware versions
+	//
+	if (pView->payloadSize >= SBG_ECOM_LOG_GPS_POS_PAYLOAD_SIZE)
+	{
+		value = sbgEComBinaryLogViewReadUint8(pView->pPayload, SBG_ECOM_LOG_GPS_POS_OFFSET_NUM_SV_USED);
+	}
+	else
+	{
+		value = 0;
+	}
+
+	return value;
+}
+
+/*!
+ * Returns the base station id.
+ *
+ * \param[in]	pView						Log view.
+ * \return									Base station id, 0xFFFF if not used or not provided by the device.
+ */
+SBG_INLINE uint16_t sbgLogGpsPosViewGetBaseStationId(const SbgLogGpsPosView *pView)
+{
+	uint16_t	value;
+
+	assert(pView);
+
+	//
+	// Optional field only sent by recent firmware versions
+	//
+	if (pView->payloadSize >= SBG_ECOM_LOG_GPS_POS_PAYLOAD_SIZE)
+	{
+		value = sbgEComBinaryLogViewReadUint16(pView->pPayload, SBG_ECOM_LOG_GPS_POS_OFFSET_BASE_STATION_ID);
+	}
+	else
+	{
+		value = 0xFFFF;
+	}
+
+	return value;
+}
+
+/*!
+ * Returns the differential correction age.
+ *
+ * \param[in]	pView						Log view.
+ * \return									Differential correction age in 0.01 seconds, 0xFFFF if not used or not provided by the device.
+ */
+SBG_INLINE uint16_t sbgLogGpsPosViewGetDifferentialAge(const SbgLogGpsPosView *pView)
+{
+	uint16_t	value;
+
+	assert(pView);
+
+	//
+	// Optional field only sent by recent firmware versions
+	//
+	if (pView->payloadSize >= SBG_ECOM_LOG_GPS_POS_PAYLOAD_SIZE)
+	{
+		value = sbgEComBinaryLogViewReadUint16(pView->pPayload, SBG_ECOM_LOG_GPS_POS_OFFSET_DIFFERENTIAL_AGE);
+	}
+	else
+	{
+		value = 0xFFFF;
+	}
+
+	return value;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,5 +1,226 @@
 ﻿#include "sbgEComBinaryLogImu.h"
 
+//
+// Select at compile time the SIMD instruction set used by batch conversions
+//
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SBG_ECOM_LOG_IMU_USE_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define SBG_ECOM_LOG_IMU_USE_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define SBG_ECOM_LOG_IMU_USE_NEON
+#endif
+
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Number of values converted at once using an intermediate single precision buffer.
+ */
+#define SBG_ECOM_LOG_IMU_CONVERT_BLOCK_SIZE			(64)
+
+/*!
+ * IMU short fixed point scale factors.
+ */
+#define SBG_ECOM_LOG_IMU_SHORT_DELTA_VELOCITY_LSB	(1048576.0f)
+#define SBG_ECOM_LOG_IMU_SHORT_DELTA_ANGLE_LSB		(67108864.0f)
+#define SBG_ECOM_LOG_IMU_SHORT_TEMPERATURE_LSB		(256.0f)
+
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+#if SBG_CONFIG_BIG_ENDIAN == 0
+/*!
+ * Directly load an IMU data payload on a little endian platform.
+ *
+ * The payload size has to be checked by the caller.
+ *
+ * \param[out]	pOutputData					Pointer on the output structure.
+ * \param[in]	pPayload					Pointer on the payload, at least SBG_ECOM_LOG_IMU_DATA_PAYLOAD_SIZE bytes.
+ */
+static void sbgEComBinaryLogLoadImuData(SbgLogImuData *pOutputData, const uint8_t *pPayload)
+{
+	assert(pOutputData);
+	assert(pPayload);
+
+	memcpy(&pOutputData->timeStamp,		&pPayload[0],	sizeof(pOutputData->timeStamp));
+	memcpy(&pOutputData->status,		&pPayload[4],	sizeof(pOutputData->status));
+	memcpy(pOutputData->accelerometers,	&pPayload[6],	sizeof(pOutputData->accelerometers));
+	memcpy(pOutputData->gyroscopes,		&pPayload[18],	sizeof(pOutputData->gyroscopes));
+	memcpy(&pOutputData->temperature,	&pPayload[30],	sizeof(pOutputData->temperature));
+	memcpy(pOutputData->deltaVelocity,	&pPayload[34],	sizeof(pOutputData->deltaVelocity));
+	memcpy(pOutputData->deltaAngle,		&pPayload[46],	sizeof(pOutputData->deltaAngle));
+}
+
+/*!
+ * Directly load an IMU short payload on a little endian platform.
+ *
+ * The payload size has to be checked by the caller.
+ *
+ * \param[out]	pOutputData					Pointer on the output structure.
+ * \param[in]	pPayload					Pointer on the payload, at least SBG_ECOM_LOG_IMU_SHORT_PAYLOAD_SIZE bytes.
+ */
+static void sbgEComBinaryLogLoadImuShort(SbgLogImuShort *pOutputData, const uint8_t *pPayload)
+{
+	assert(pOutputData);
+	assert(pPayload);
+
+	memcpy(&pOutputData->timeStamp,		&pPayload[0],	sizeof(pOutputData->timeStamp));
+	memcpy(&pOutputData->status,		&pPayload[4],	sizeof(pOutputData->status));
+	memcpy(pOutputData->deltaVelocity,	&pPayload[6],	sizeof(pOutputData->deltaVelocity));
+	memcpy(pOutputData->deltaAngle,		&pPayload[18],	sizeof(pOutputData->deltaAngle));
+	memcpy(&pOutputData->temperature,	&pPayload[30],	sizeof(pOutputData->temperature));
+}
+
+/*!
+ * Directly load a fast IMU data payload on a little endian platform.
+ *
+ * The payload size has to be checked by the caller.
+ *
+ * \param[out]	pOutputData					Pointer on the output structure.
+ * \param[in]	pPayload					Pointer on the payload, at least SBG_ECOM_LOG_FAST_IMU_DATA_PAYLOAD_SIZE bytes.
+ */
+static void sbgEComBinaryLogLoadFastImuData(SbgLogFastImuData *pOutputData, const uint8_t *pPayload)
+{
+	int16_t		accelerometers[3];
+	int16_t		gyroscopes[3];
+
+	assert(pOutputData);
+	assert(pPayload);
+
+	memcpy(&pOutputData->timeStamp,		&pPayload[0],	sizeof(pOutputData->timeStamp));
+	memcpy(&pOutputData->status,		&pPayload[4],	sizeof(pOutputData->status));
+	memcpy(accelerometers,				&pPayload[6],	sizeof(accelerometers));
+	memcpy(gyroscopes,					&pPayload[12],	sizeof(gyroscopes));
+
+	//
+	// Apply the same scaling as the generic parser so both paths are bit identical
+	//
+	pOutputData->accelerometers[0]	= (float)accelerometers[0] * 0.01f;
+	pOutputData->accelerometers[1]	= (float)accelerometers[1] * 0.01f;
+	pOutputData->accelerometers[2]	= (float)accelerometers[2] * 0.01f;
+
+	pOutputData->gyroscopes[0]		= (float)gyroscopes[0] * 0.001f;
+	pOutputData->gyroscopes[1]		= (float)gyroscopes[1] * 0.001f;
+	pOutputData->gyroscopes[2]		= (float)gyroscopes[2] * 0.001f;
+}
+#endif // SBG_CONFIG_BIG_ENDIAN == 0
+
+/*!
+ * Convert a strided column of fixed point int32 values to single precision.
+ *
+ * The divisor must be a power of two so multiplying by its inverse gives exactly the same
+ * result as the division used by the scalar getters.
+ *
+ * \param[in]	pSrc						Pointer on the first value to convert.
+ * \param[in]	stride						Distance in bytes between two consecutive values.
+ * \param[in]	count						Number of values to convert.
+ * \param[in]	divisor						Number of LSB for one unit.
+ * \param[out]	pDst						Output array of count values.
+ */
+static void sbgEComBinaryLogImuConvertInt32Column(const int32_t *pSrc, size_t stride, size_t count, float divisor, float *pDst)
+{
+	const uint8_t	*pSrcBytes = (const uint8_t*)pSrc;
+	size_t			 i = 0;
+
+	assert(pSrc);
+	assert(pDst);
+
+#if defined(SBG_ECOM_LOG_IMU_USE_AVX2)
+	{
+		__m256		scale = _mm256_set1_ps(1.0f / divisor);
+		__m256i		offsets = _mm256_mullo_epi32(_mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0), _mm256_set1_epi32((int)stride));
+
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256i		values;
+
+			values = _mm256_i32gather_epi32((const int*)(pSrcBytes + i * stride), offsets, 1);
+			_mm256_storeu_ps(&pDst[i], _mm256_mul_ps(_mm256_cvtepi32_ps(values), scale));
+		}
+	}
+#elif defined(SBG_ECOM_LOG_IMU_USE_SSE2)
+	{
+		__m128		scale = _mm_set1_ps(1.0f / divisor);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i		values;
+
+			values = _mm_set_epi32(	*(const int32_t*)(pSrcBytes + (i + 3) * stride),
+									*(const int32_t*)(pSrcBytes + (i + 2) * stride),
+									*(const int32_t*)(pSrcBytes + (i + 1) * stride),
+									*(const int32_t*)(pSrcBytes + (i + 0) * stride));
+
+			_mm_storeu_ps(&pDst[i], _mm_mul_ps(_mm_cvtepi32_ps(values), scale));
+		}
+	}
+#elif defined(SBG_ECOM_LOG_IMU_USE_NEON)
+	{
+		float32_t	scale = 1.0f / divisor;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			int32_t		values[4];
+
+			values[0] = *(const int32_t*)(pSrcBytes + (i + 0) * stride);
+			values[1] = *(const int32_t*)(pSrcBytes + (i + 1) * stride);
+			values[2] = *(const int32_t*)(pSrcBytes + (i + 2) * stride);
+			values[3] = *(const int32_t*)(pSrcBytes + (i + 3) * stride);
+
+			vst1q_f32(&pDst[i], vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(values)), scale));
+		}
+	}
+#endif
+
+	//
+	// Scalar conversion for the remaining values or if no SIMD instruction set is available
+	//
+	for (; i < count; i++)
+	{
+		pDst[i] = *(const int32_t*)(pSrcBytes + i * stride) / divisor;
+	}
+}
+
+/*!
+ * Convert a strided column of fixed point int32 values to double precision.
+ *
+ * Values are first converted in single precision to match the scalar getters and then promoted.
+ *
+ * \param[in]	pSrc						Pointer on the first value to convert.
+ * \param[in]	stride						Distance in bytes between two consecutive values.
+ * \param[in]	count						Number of values to convert.
+ * \param[in]	divisor						Number of LSB for one unit.
+ * \param[out]	pDst						Output array of count values.
+ */
+static void sbgEComBinaryLogImuConvertInt32ColumnDouble(const int32_t *pSrc, size_t stride, size_t count, float divisor, double *pDst)
+{
+	float		values[SBG_ECOM_LOG_IMU_CONVERT_BLOCK_SIZE];
+	size_t		offset;
+	size_t		blockSize;
+	size_t		i;
+
+	assert(pSrc);
+	assert(pDst);
+
+	for (offset = 0; offset < count; offset += blockSize)
+	{
+		blockSize = sbgMin(count - offset, SBG_ECOM_LOG_IMU_CONVERT_BLOCK_SIZE);
+
+		sbgEComBinaryLogImuConvertInt32Column((const int32_t*)((const uint8_t*)pSrc + offset * stride), stride, blockSize, divisor, values);
+
+		for (i = 0; i < blockSize; i++)
+		{
+			pDst[offset + i] = values[i];
+		}
+	}
+}
+
 //----------------------------------------------------------------------//
 //- Public getters                                                     -//
 //----------------------------------------------------------------------//
@@ -9,7 +230,7 @@ float sbgLogImuShortGetDeltaAngle(const SbgLogImuShort *pImuShort, size_t idx)
 	assert(pImuShort);
 	assert(idx < 3);
 
-	return pImuShort->deltaAngle[idx] / 67108864.0f;
+	return pImuShort->deltaAngle[idx] / SBG_ECOM_LOG_IMU_SHORT_DELTA_ANGLE_LSB;
 }
 
 float sbgLogImuShortGetDeltaVelocity(const SbgLogImuShort *pImuShort, size_t idx)
@@ -17,14 +238,169 @@ float sbgLogImuShortGetDeltaVelocity(const SbgLogImuShort *pImuShort, size_t idx
 	assert(pImuShort);
 	assert(idx < 3);
 
-	return pImuShort->deltaVelocity[idx] / 1048576.0f;
+	return pImuShort->deltaVelocity[idx] / SBG_ECOM_LOG_IMU_SHORT_DELTA_VELOCITY_LSB;
 }
 
 float sbgLogImuShortGetTemperature(const SbgLogImuShort *pImuShort)
 {
 	assert(pImuShort);
 
-	return pImuShort->temperature / 256.0f;
+	return pImuShort->temperature / SBG_ECOM_LOG_IMU_SHORT_TEMPERATURE_LSB;
+}
+
+//----------------------------------------------------------------------//
+//- Public batch conversion methods                                    -//
+//----------------------------------------------------------------------//
+
+void sbgLogImuShortToArrays(const SbgLogImuShort *pImuShorts, size_t count, const SbgLogImuShortArrays *pArrays)
+{
+	size_t		i;
+
+	assert(pImuShorts);
+	assert(pArrays);
+
+	for (i = 0; i < 3; i++)
+	{
+		if (pArrays->pDeltaVelocity[i])
+		{
+			sbgEComBinaryLogImuConvertInt32Column(&pImuShorts->deltaVelocity[i], sizeof(*pImuShorts), count, SBG_ECOM_LOG_IMU_SHORT_DELTA_VELOCITY_LSB, pArrays->pDeltaVelocity[i]);
+		}
+
+		if (pArrays->pDeltaAngle[i])
+		{
+			sbgEComBinaryLogImuConvertInt32Column(&pImuShorts->deltaAngle[i], sizeof(*pImuShorts), count, SBG_ECOM_LOG_IMU_SHORT_DELTA_ANGLE_LSB, pArrays->pDeltaAngle[i]);
+		}
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		if (pArrays->pTimeStamp)
+		{
+			pArrays->pTimeStamp[i] = pImuShorts[i].timeStamp;
+		}
+
+		if (pArrays->pStatus)
+		{
+			pArrays->pStatus[i] = pImuShorts[i].status;
+		}
+
+		if (pArrays->pTemperature)
+		{
+			pArrays->pTemperature[i] = pImuShorts[i].temperature / SBG_ECOM_LOG_IMU_SHORT_TEMPERATURE_LSB;
+		}
+	}
+}
+
+void sbgLogImuShortToArraysDouble(const SbgLogImuShort *pImuShorts, size_t count, const SbgLogImuShortArraysDouble *pArrays)
+{
+	size_t		i;
+
+	assert(pImuShorts);
+	assert(pArrays);
+
+	for (i = 0; i < 3; i++)
+	{
+		if (pArrays->pDeltaVelocity[i])
+		{
+			sbgEComBinaryLogImuConvertInt32ColumnDouble(&pImuShorts->deltaVelocity[i], sizeof(*pImuShorts), count, SBG_ECOM_LOG_IMU_SHORT_DELTA_VELOCITY_LSB, pArrays->pDeltaVelocity[i]);
+		}
+
+		if (pArrays->pDeltaAngle[i])
+		{
+			sbgEComBinaryLogImuConvertInt32ColumnDouble(&pImuShorts->deltaAngle[i], sizeof(*pImuShorts), count, SBG_ECOM_LOG_IMU_SHORT_DELTA_ANGLE_LSB, pArrays->pDeltaAngle[i]);
+		}
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		if (pArrays->pTimeStamp)
+		{
+			pArrays->pTimeStamp[i] = pImuShorts[i].timeStamp;
+		}
+
+		if (pArrays->pStatus)
+		{
+			pArrays->pStatus[i] = pImuShorts[i].status;
+		}
+
+		if (pArrays->pTemperature)
+		{
+			pArrays->pTemperature[i] = (float)(pImuShorts[i].temperature / SBG_ECOM_LOG_IMU_SHORT_TEMPERATURE_LSB);
+		}
+	}
+}
+
+void sbgLogFastImuToArrays(const SbgLogFastImuData *pFastImus, size_t count, const SbgLogFastImuArrays *pArrays)
+{
+	size_t		i;
+	size_t		j;
+
+	assert(pFastImus);
+	assert(pArrays);
+
+	//
+	// Values are already scaled by the parser so this is only a transposition
+	//
+	for (i = 0; i < count; i++)
+	{
+		if (pArrays->pTimeStamp)
+		{
+			pArrays->pTimeStamp[i] = pFastImus[i].timeStamp;
+		}
+
+		if (pArrays->pStatus)
+		{
+			pArrays->pStatus[i] = pFastImus[i].status;
+		}
+
+		for (j = 0; j < 3; j++)
+		{
+			if (pArrays->pAccelerometers[j])
+			{
+				pArrays->pAccelerometers[j][i] = pFastImus[i].accelerometers[j];
+			}
+
+			if (pArrays->pGyroscopes[j])
+			{
+				pArrays->pGyroscopes[j][i] = pFastImus[i].gyroscopes[j];
+			}
+		}
+	}
+}
+
+void sbgLogFastImuToArraysDouble(const SbgLogFastImuData *pFastImus, size_t count, const SbgLogFastImuArraysDouble *pArrays)
+{
+	size_t		i;
+	size_t		j;
+
+	assert(pFastImus);
+	assert(pArrays);
+
+	for (i = 0; i < count; i++)
+	{
+		if (pArrays->pTimeStamp)
+		{
+			pArrays->pTimeStamp[i] = pFastImus[i].timeStamp;
+		}
+
+		if (pArrays->pStatus)
+		{
+			pArrays->pStatus[i] = pFastImus[i].status;
+		}
+
+		for (j = 0; j < 3; j++)
+		{
+			if (pArrays->pAccelerometers[j])
+			{
+				pArrays->pAccelerometers[j][i] = pFastImus[i].accelerometers[j];
+			}
+
+			if (pArrays->pGyroscopes[j])
+			{
+				pArrays->pGyroscopes[j][i] = pFastImus[i].gyroscopes[j];
+			}
+		}
+	}
 }
 
 //----------------------------------------------------------------------//
@@ -36,29 +412,42 @@ SbgErrorCode sbgEComBinaryLogParseImuData(SbgStreamBuffer *pInputStream, SbgLogI
 	assert(pInputStream);
 	assert(pOutputData);
 
+#if SBG_CONFIG_BIG_ENDIAN == 0
 	//
-	// Read the frame payload
+	// The payload layout matches the platform one so check the size once and load fields directly
 	//
-	pOutputData->timeStamp			= sbgStreamBufferReadUint32LE(pInputStream);
-	pOutputData->status				= sbgStreamBufferReadUint16LE(pInputStream);
+	if ((sbgStreamBufferGetLastError(pInputStream) == SBG_NO_ERROR) && (sbgStreamBufferGetSpace(pInputStream) >= SBG_ECOM_LOG_IMU_DATA_PAYLOAD_SIZE))
+	{
+		sbgEComBinaryLogLoadImuData(pOutputData, sbgStreamBufferGetCursor(pInputStream));
+		sbgStreamBufferSeek(pInputStream, SBG_ECOM_LOG_IMU_DATA_PAYLOAD_SIZE, SB_SEEK_CUR_INC);
+	}
+	else
+#endif
+	{
+		//
+		// Read the frame payload
+		//
+		pOutputData->timeStamp			= sbgStreamBufferReadUint32LE(pInputStream);
+		pOutputData->status				= sbgStreamBufferReadUint16LE(pInputStream);
 				
-	pOutputData->accelerometers[0]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->accelerometers[1]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->accelerometers[2]	= sbgStreamBufferReadFloatLE(pInputStream);
+		pOutputData->accelerometers[0]	= sbgStreamBufferReadFloatLE(pInputStream);
+		pOutputData->accelerometers[1]	= sbgStreamBufferReadFloatLE(pInputStream);
+		pOutputData->accelerometers[2]	= sbgStreamBufferReadFloatLE(pInputStream);
 
-	pOutputData->gyroscopes[0]		= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->gyroscopes[1]		= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->gyroscopes[2]		= sbgStreamBufferReadFloatLE(pInputStream);
+		pOutputData->gyroscopes[0]		= sbgStreamBufferReadFloatLE(pInputStream);
+		pOutputData->gyroscopes[1]		= sbgStreamBufferReadFloatLE(pInputStream);
+		pOutputData->gyroscopes[2]		= sbgStreamBufferReadFloatLE(pInputStream);
 
-	pOutputData->temperature		= sbgStreamBufferReadFloatLE(pInputStream);
+		pOutputData->temperature		= sbgStreamBufferReadFloatLE(pInputStream);
 
-	pOutputData->deltaVelocity[0]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->deltaVelocity[1]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->deltaVelocity[2]	= sbgStreamBufferReadFloatLE(pInputStream);
+		pOutputData->deltaVelocity[0]	= sbgStreamBufferReadFloatLE(pInputStream);
+		pOutputData->deltaVelocity[1]	= sbgStreamBufferReadFloatLE(pInputStream);
+		pOutputData->deltaVelocity[2]	= sbgStreamBufferReadFloatLE(pInputStream);
 				
-	pOutputData->deltaAngle[0]		= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->deltaAngle[1]		= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->deltaAngle[2]		= sbgStreamBufferReadFloatLE(pInputStream);
+		pOutputData->deltaAngle[0]		= sbgStreamBufferReadFloatLE(pInputStream);
+		pOutputData->deltaAngle[1]		= sbgStreamBufferReadFloatLE(pInputStream);
+		pOutputData->deltaAngle[2]		= sbgStreamBufferReadFloatLE(pInputStream);
+	}
 
 	//
 	// Return if any error has occurred while parsing the frame
@@ -106,21 +495,34 @@ SbgErrorCode sbgEComBinaryLogParseImuShort(SbgStreamBuffer *pInputStream, SbgLog
 	assert(pInputStream);
 	assert(pOutputData);
 
+#if SBG_CONFIG_BIG_ENDIAN == 0
 	//
-	// Read the frame payload
+	// The payload layout matches the platform one so check the size once and load fields directly
 	//
-	pOutputData->timeStamp			= sbgStreamBufferReadUint32LE(pInputStream);
-	pOutputData->status				= sbgStreamBufferReadUint16LE(pInputStream);
-
-	pOutputData->deltaVelocity[0]	= sbgStreamBufferReadInt32LE(pInputStream);
-	pOutputData->deltaVelocity[1]	= sbgStreamBufferReadInt32LE(pInputStream);
-	pOutputData->deltaVelocity[2]	= sbgStreamBufferReadInt32LE(pInputStream);
-
-	pOutputData->deltaAngle[0]		= sbgStreamBufferReadInt32LE(pInputStream);
-	pOutputData->deltaAngle[1]		= sbgStreamBufferReadInt32LE(pInputStream);
-	pOutputData->deltaAngle[2]		= sbgStreamBufferReadInt32LE(pInputStream);
-
-	pOutputData->temperature		= sbgStreamBufferReadInt16LE(pInputStream);
+	if ((sbgStreamBufferGetLastError(pInputStream) == SBG_NO_ERROR) && (sbgStreamBufferGetSpace(pInputStream) >= SBG_ECOM_LOG_IMU_SHORT_PAYLOAD_SIZE))
+	{
+		sbgEComBinaryLogLoadImuShort(pOutputData, sbgStreamBufferGetCursor(pInputStream));
+		sbgStreamBufferSeek(pInputStream, SBG_ECOM_LOG_IMU_SHORT_PAYLOAD_SIZE, SB_SEEK_CUR_INC);
+	}
+	else
+#endif
+	{
+		//
+		// Read the frame payload
+		//
+		pOutputData->timeStamp			= sbgStreamBufferReadUint32LE(pInputStream);
+		pOutputData->status				= sbgStreamBufferReadUint16LE(pInputStream);
+
+		pOutputData->deltaVelocity[0]	= sbgStreamBufferReadInt32LE(pInputStream);
+		pOutputData->deltaVelocity[1]	= sbgStreamBufferReadInt32LE(pInputStream);
+		pOutputData->deltaVelocity[2]	= sbgStreamBufferReadInt32LE(pInputStream);
+
+		pOutputData->deltaAngle[0]		= sbgStreamBufferReadInt32LE(pInputStream);
+		pOutputData->deltaAngle[1]		= sbgStreamBufferReadInt32LE(pInputStream);
+		pOutputData->deltaAngle[2]		= sbgStreamBufferReadInt32LE(pInputStream);
+
+		pOutputData->temperature		= sbgStreamBufferReadInt16LE(pInputStream);
+	}
 
 	//
 	// Return if any error has occurred while parsing the frame
@@ -160,19 +562,32 @@ SbgErrorCode sbgEComBinaryLogParseFastImuData(SbgStreamBuffer *pInputStream, Sbg
 	assert(pInputStream);
 	assert(pOutputData);
 
+#if SBG_CONFIG_BIG_ENDIAN == 0
 	//
-	// Read the frame payload
+	// The payload layout matches the platform one so check the size once and load fields directly
 	//
-	pOutputData->timeStamp			= sbgStreamBufferReadUint32LE(pInputStream);
-	pOutputData->status				= sbgStreamBufferReadUint16LE(pInputStream);
+	if ((sbgStreamBufferGetLastError(pInputStream) == SBG_NO_ERROR) && (sbgStreamBufferGetSpace(pInputStream) >= SBG_ECOM_LOG_FAST_IMU_DATA_PAYLOAD_SIZE))
+	{
+		sbgEComBinaryLogLoadFastImuData(pOutputData, sbgStreamBufferGetCursor(pInputStream));
+		sbgStreamBufferSeek(pInputStream, SBG_ECOM_LOG_FAST_IMU_DATA_PAYLOAD_SIZE, SB_SEEK_CUR_INC);
+	}
+	else
+#endif
+	{
+		//
+		// Read the frame payload
+		//
+		pOutputData->timeStamp			= sbgStreamBufferReadUint32LE(pInputStream);
+		pOutputData->status				= sbgStreamBufferReadUint16LE(pInputStream);
 				
-	pOutputData->accelerometers[0]	= (float)sbgStreamBufferReadInt16LE(pInputStream) * 0.01f;
-	pOutputData->accelerometers[1]	= (float)sbgStreamBufferReadInt16LE(pInputStream) * 0.01f;
-	pOutputData->accelerometers[2]	= (float)sbgStreamBufferReadInt16LE(pInputStream) * 0.01f;
+		pOutputData->accelerometers[0]	= (float)sbgStreamBufferReadInt16LE(pInputStream) * 0.01f;
+		pOutputData->accelerometers[1]	= (float)sbgStreamBufferReadInt16LE(pInputStream) * 0.01f;
+		pOutputData->accelerometers[2]	= (float)sbgStreamBufferReadInt16LE(pInputStream) * 0.01f;
 
-	pOutputData->gyroscopes[0]		= (float)sbgStreamBufferReadInt16LE(pInputStream) * 0.001f;
-	pOutputData->gyroscopes[1]		= (float)sbgStreamBufferReadInt16LE(pInputStream) * 0.001f;
-	pOutputData->gyroscopes[2]		= (float)sbgStreamBufferReadInt16LE(pInputStream) * 0.001f;
+		pOutputData->gyroscopes[0]		= (float)sbgStreamBufferReadInt16LE(pInputStream) * 0.001f;
+		pOutputData->gyroscopes[1]		= (float)sbgStreamBufferReadInt16LE(pInputStream) * 0.001f;
+		pOutputData->gyroscopes[2]		= (float)sbgStreamBufferReadInt16LE(pInputStream) * 0.001f;
+	}
 
 	//
 	// Return if any error has occurred while parsing the frame
@@ -204,3 +619,26 @@ SbgErrorCode sbgEComBinaryLogWriteFastImuData(SbgStreamBuffer *pOutputStream, co
 	//
 	return sbgStreamBufferGetLastError(pOutputStream);
 }
+
+//----------------------------------------------------------------------//
+//- Log views methods                                                  -//
+//----------------------------------------------------------------------//
+
+SbgErrorCode sbgLogImuDataViewInit(SbgLogImuDataView *pView, const void *pPayload, size_t payloadSize)
+{
+	SbgErrorCode	errorCode = SBG_NO_ERROR;
+
+	assert(pView);
+	assert(pPayload);
+
+	if (payloadSize >= SBG_ECOM_LOG_IMU_DATA_PAYLOAD_SIZE)
+	{
+		pView->pPayload = (const uint8_t*)pPayload;
+	}
+	else
+	{
+		errorCode = SBG_BUFFER_OVERFLOW;
+	}
+
+	return errorCode;
+}
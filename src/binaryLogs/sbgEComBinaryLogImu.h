@@ -36,6 +36,9 @@
 #include <sbgCommon.h>
 #include <streamBuffer/sbgStreamBuffer.h>
 
+// Local headers
+#include "sbgEComBinaryLogView.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -103,6 +106,64 @@ typedef struct _SbgLogFastImuData
 	float		gyroscopes[3];				/*!< X, Y, Z gyroscopes in rad.s^-1. */
 } SbgLogFastImuData;
 
+/*!
+ * Structure of arrays that receives converted SBG_ECOM_LOG_IMU_SHORT records in single precision.
+ *
+ * Each array must be able to store the number of converted records.
+ * An array set to NULL is skipped.
+ */
+typedef struct _SbgLogImuShortArrays
+{
+	uint32_t	*pTimeStamp;				/*!< Time in us since the sensor power up. */
+	uint16_t	*pStatus;					/*!< IMU status bitmask. */
+	float		*pDeltaVelocity[3];			/*!< X, Y, Z delta velocity in m.s^-2. */
+	float		*pDeltaAngle[3];			/*!< X, Y, Z delta angle in rad.s^-1. */
+	float		*pTemperature;				/*!< IMU average temperature in °C. */
+} SbgLogImuShortArrays;
+
+/*!
+ * Structure of arrays that receives converted SBG_ECOM_LOG_IMU_SHORT records in double precision.
+ *
+ * Each array must be able to store the number of converted records.
+ * An array set to NULL is skipped.
+ */
+typedef struct _SbgLogImuShortArraysDouble
+{
+	uint32_t	*pTimeStamp;				/*!< Time in us since the sensor power up. */
+	uint16_t	*pStatus;					/*!< IMU status bitmask. */
+	double		*pDeltaVelocity[3];			/*!< X, Y, Z delta velocity in m.s^-2. */
+	double		*pDeltaAngle[3];			/*!< X, Y, Z delta angle in rad.s^-1. */
+	double		*pTemperature;				/*!< IMU average temperature in °C. */
+} SbgLogImuShortArraysDouble;
+
+/*!
+ * Structure of arrays that receives converted SBG_ECOM_LOG_FAST_IMU_DATA records in single precision.
+ *
+ * Each array must be able to store the number of converted records.
+ * An array set to NULL is skipped.
+ */
+typedef struct _SbgLogFastImuArrays
+{
+	uint32_t	*pTimeStamp;				/*!< Time in us since the sensor power up. */
+	uint16_t	*pStatus;					/*!< IMU status bitmask. */
+	float		*pAccelerometers[3];		/*!< X, Y, Z accelerometers in m.s^-2. */
+	float		*pGyroscopes[3];			/*!< X, Y, Z gyroscopes in rad.s^-1. */
+} SbgLogFastImuArrays;
+
+/*!
+ * Structure of arrays that receives converted SBG_ECOM_LOG_FAST_IMU_DATA records in double precision.
+ *
+ * Each array must be able to store the number of converted records.
+ * An array set to NULL is skipped.
+ */
+typedef struct _SbgLogFastImuArraysDouble
+{
+	uint32_t	*pTimeStamp;				/*!< Time in us since the sensor power up. */
+	uint16_t	*pStatus;					/*!< IMU status bitmask. */
+	double		*pAccelerometers[3];		/*!< X, Y, Z accelerometers in m.s^-2. */
+	double		*pGyroscopes[3];			/*!< X, Y, Z gyroscopes in rad.s^-1. */
+} SbgLogFastImuArraysDouble;
+
 //----------------------------------------------------------------------//
 //- Public getters                                                     -//
 //----------------------------------------------------------------------//
@@ -133,6 +194,83 @@ float sbgLogImuShortGetDeltaVelocity(const SbgLogImuShort *pImuShort, size_t idx
  */
 float sbgLogImuShortGetTemperature(const SbgLogImuShort *pImuShort);
 
+//----------------------------------------------------------------------//
+//- Public batch conversion methods                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Convert an array of IMU Short logs into single precision structure of arrays.
+ *
+ * Converted values are strictly identical to the ones returned by the scalar getters.
+ * SSE2, AVX2 or NEON kernels are used when enabled at compile time.
+ *
+ * \param[in]	pImuShorts					Array of IMU short message instances.
+ * \param[in]	count						Number of records to convert.
+ * \param[out]	pArrays						Output arrays, each one able to store count elements.
+ */
+void sbgLogImuShortToArrays(const SbgLogImuShort *pImuShorts, size_t count, const SbgLogImuShortArrays *pArrays);
+
+/*!
+ * Convert an array of IMU Short logs into double precision structure of arrays.
+ *
+ * Each converted value is the scalar getter single precision result promoted to double.
+ *
+ * \param[in]	pImuShorts					Array of IMU short message instances.
+ * \param[in]	count						Number of records to convert.
+ * \param[out]	pArrays						Output arrays, each one able to store count elements.
+ */
+void sbgLogImuShortToArraysDouble(const SbgLogImuShort *pImuShorts, size_t count, const SbgLogImuShortArraysDouble *pArrays);
+
+/*!
+ * Convert an array of fast IMU logs into single precision structure of arrays.
+ *
+ * \param[in]	pFastImus					Array of fast IMU message instances.
+ * \param[in]	count						Number of records to convert.
+ * \param[out]	pArrays						Output arrays, each one able to store count elements.
+ */
+void sbgLogFastImuToArrays(const SbgLogFastImuData *pFastImus, size_t count, const SbgLogFastImuArrays *pArrays);
+
+/*!
+ * Convert an array of fast IMU logs into double precision structure of arrays.
+ *
+ * \param[in]	pFastImus					Array of fast IMU message instances.
+ * \param[in]	count						Number of records to convert.
+ * \param[out]	pArrays						Output arrays, each one able to store count elements.
+ */
+void sbgLogFastImuToArraysDouble(const SbgLogFastImuData *pFastImus, size_t count, const SbgLogFastImuArraysDouble *pArrays);
+
+//----------------------------------------------------------------------//
+//- Log views definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Payload size in bytes of the fixed layout IMU logs.
+ */
+#define SBG_ECOM_LOG_IMU_DATA_PAYLOAD_SIZE					(58)
+#define SBG_ECOM_LOG_IMU_SHORT_PAYLOAD_SIZE					(32)
+#define SBG_ECOM_LOG_FAST_IMU_DATA_PAYLOAD_SIZE				(18)
+
+/*!
+ * Offsets in bytes of each SBG_ECOM_LOG_IMU_DATA field.
+ */
+#define SBG_ECOM_LOG_IMU_DATA_OFFSET_TIME_STAMP				(0)
+#define SBG_ECOM_LOG_IMU_DATA_OFFSET_STATUS					(4)
+#define SBG_ECOM_LOG_IMU_DATA_OFFSET_ACCELEROMETER			(6)
+#define SBG_ECOM_LOG_IMU_DATA_OFFSET_GYROSCOPE				(18)
+#define SBG_ECOM_LOG_IMU_DATA_OFFSET_TEMPERATURE			(30)
+#define SBG_ECOM_LOG_IMU_DATA_OFFSET_DELTA_VELOCITY			(34)
+#define SBG_ECOM_LOG_IMU_DATA_OFFSET_DELTA_ANGLE			(46)
+
+/*!
+ * Lazy view on a SBG_ECOM_LOG_IMU_DATA payload.
+ *
+ * Fields are only decoded when accessed.
+ */
+typedef struct _SbgLogImuDataView
+{
+	const uint8_t	*pPayload;			/*!< Log payload, referenced and not copied. */
+} SbgLogImuDataView;
+
 //----------------------------------------------------------------------//
 //- Public methods                                                     -//
 //----------------------------------------------------------------------//
@@ -191,6 +329,121 @@ SbgErrorCode sbgEComBinaryLogParseFastImuData(SbgStreamBuffer *pInputStream, Sbg
  */
 SbgErrorCode sbgEComBinaryLogWriteFastImuData(SbgStreamBuffer *pOutputStream, const SbgLogFastImuData *pInputData);
 
+//----------------------------------------------------------------------//
+//- Log views methods                                                  -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Initialize a SBG_ECOM_LOG_IMU_DATA view on a received payload.
+ *
+ * The payload is referenced and must remain valid as long as the view is used.
+ *
+ * \param[out]	pView						Log view to initialize.
+ * \param[in]	pPayload					Log payload.
+ * \param[in]	payloadSize					Payload size in bytes.
+ * \return									SBG_NO_ERROR if successful, SBG_BUFFER_OVERFLOW if the payload is too short.
+ */
+SbgErrorCode sbgLogImuDataViewInit(SbgLogImuDataView *pView, const void *pPayload, size_t payloadSize);
+
+/*!
+ * Returns the time stamp.
+ *
+ * \param[in]	pView						Log view.
+ * \return									Time in us since the sensor power up.
+ */
+SBG_INLINE uint32_t sbgLogImuDataViewGetTimeStamp(const SbgLogImuDataView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadUint32(pView->pPayload, SBG_ECOM_LOG_IMU_DATA_OFFSET_TIME_STAMP);
+}
+
+/*!
+ * Returns the IMU status.
+ *
+ * \param[in]	pView						Log view.
+ * \return									IMU status bitmask.
+ */
+SBG_INLINE uint16_t sbgLogImuDataViewGetStatus(const SbgLogImuDataView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadUint16(pView->pPayload, SBG_ECOM_LOG_IMU_DATA_OFFSET_STATUS);
+}
+
+/*!
+ * Returns the accelerometer.
+ *
+ * \param[in]	pView						Log view.
+ * \param[in]	idx							Component index from 0 to 2.
+ * \return									X, Y or Z accelerometer in m.s^-2.
+ */
+SBG_INLINE float sbgLogImuDataViewGetAccelerometer(const SbgLogImuDataView *pView, size_t idx)
+{
+	assert(pView);
+	assert(idx < 3);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_IMU_DATA_OFFSET_ACCELEROMETER + idx * sizeof(float));
+}
+
+/*!
+ * Returns the gyroscope.
+ *
+ * \param[in]	pView						Log view.
+ * \param[in]	idx							Component index from 0 to 2.
+ * \return									X, Y or Z gyroscope in rad.s^-1.
+ */
+SBG_INLINE float sbgLogImuDataViewGetGyroscope(const SbgLogImuDataView *pView, size_t idx)
+{
+	assert(pView);
+	assert(idx < 3);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_IMU_DATA_OFFSET_GYROSCOPE + idx * sizeof(float));
+}
+
+/*!
+ * Returns the internal temperature.
+ *
+ * \param[in]	pView						Log view.
+ * \return									Internal temperature in °C.
+ */
+SBG_INLINE float sbgLogImuDataViewGetTemperature(const SbgLogImuDataView *pView)
+{
+	assert(pView);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_IMU_DATA_OFFSET_TEMPERATURE);
+}
+
+/*!
+ * Returns the delta velocity.
+ *
+ * \param[in]	pView						Log view.
+ * \param[in]	idx							Component index from 0 to 2.
+ * \return									X, Y or Z delta velocity in m.s^-2.
+ */
+SBG_INLINE float sbgLogImuDataViewGetDeltaVelocity(const SbgLogImuDataView *pView, size_t idx)
+{
+	assert(pView);
+	assert(idx < 3);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_IMU_DATA_OFFSET_DELTA_VELOCITY + idx * sizeof(float));
+}
+
+/*!
+ * Returns the delta angle.
+ *
+ * \param[in]	pView						Log view.
+ * \param[in]	idx							Component index from 0 to 2.
+ * \return									X, Y or Z delta angle in rad.s^-1.
+ */
+SBG_INLINE float sbgLogImuDataViewGetDeltaAngle(const SbgLogImuDataView *pView, size_t idx)
+{
+	assert(pView);
+	assert(idx < 3);
+
+	return sbgEComBinaryLogViewReadFloat(pView->pPayload, SBG_ECOM_LOG_IMU_DATA_OFFSET_DELTA_ANGLE + idx * sizeof(float));
+}
+
 #ifdef __cplusplus
 }
 #endif
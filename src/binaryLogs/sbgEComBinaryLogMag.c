@@ -6,27 +6,32 @@
 
 SbgErrorCode sbgEComBinaryLogParseMagData(SbgStreamBuffer *pInputStream, SbgLogMag *pOutputData)
 {
+	SbgErrorCode			errorCode;
+	SbgStreamBufferReader	reader;
+
 	assert(pInputStream);
 	assert(pOutputData);
 
 	//
-	// Read the frame payload
+	// Reserve the whole payload at once so that each field is read without any check
 	//
-	pOutputData->timeStamp			= sbgStreamBufferReadUint32LE(pInputStream);
-	pOutputData->status				= sbgStreamBufferReadUint16LE(pInputStream);
+	errorCode = sbgStreamBufferReserveRead(pInputStream, SBG_ECOM_LOG_MAG_PAYLOAD_SIZE, &reader);
 
-	pOutputData->magnetometers[0]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->magnetometers[1]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->magnetometers[2]	= sbgStreamBufferReadFloatLE(pInputStream);
-				
-	pOutputData->accelerometers[0]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->accelerometers[1]	= sbgStreamBufferReadFloatLE(pInputStream);
-	pOutputData->accelerometers[2]	= sbgStreamBufferReadFloatLE(pInputStream);
+	if (errorCode == SBG_NO_ERROR)
+	{
+		pOutputData->timeStamp			= sbgStreamBufferReaderReadUint32LE(&reader);
+		pOutputData->status				= sbgStreamBufferReaderReadUint16LE(&reader);
 
-	//
-	// Return if any error has occurred while parsing the frame
-	//
-	return sbgStreamBufferGetLastError(pInputStream);
+		pOutputData->magnetometers[0]	= sbgStreamBufferReaderReadFloatLE(&reader);
+		pOutputData->magnetometers[1]	= sbgStreamBufferReaderReadFloatLE(&reader);
+		pOutputData->magnetometers[2]	= sbgStreamBufferReaderReadFloatLE(&reader);
+
+		pOutputData->accelerometers[0]	= sbgStreamBufferReaderReadFloatLE(&reader);
+		pOutputData->accelerometers[1]	= sbgStreamBufferReaderReadFloatLE(&reader);
+		pOutputData->accelerometers[2]	= sbgStreamBufferReaderReadFloatLE(&reader);
+	}
+
+	return errorCode;
 }
 
 SbgErrorCode sbgEComBinaryLogWriteMagData(SbgStreamBuffer *pOutputStream, const SbgLogMag *pInputData)
@@ -75,6 +75,11 @@ typedef struct _SbgLogMag
 	float		accelerometers[3];			/*!< X, Y, Z accelerometers in m.s^-2. */
 } SbgLogMag;
 
+/*!
+ * Payload size in bytes of the SBG_ECOM_LOG_MAG message.
+ */
+#define SBG_ECOM_LOG_MAG_PAYLOAD_SIZE					(30)
+
 /*!
  * Structure that stores data for the SBG_ECOM_LOG_MAG_CALIB message.
  */
@@ -31,6 +31,26 @@ SbgErrorCode sbgEComBinaryLogParseRawData(SbgStreamBuffer *pInputStream, SbgLogR
 	return errorCode;
 }
 
+SbgErrorCode sbgEComBinaryLogParseRawDataView(SbgStreamBuffer *pInputStream, SbgLogRawDataView *pOutputData)
+{
+	SbgErrorCode	errorCode;
+
+	assert(pInputStream);
+	assert(pOutputData);
+
+	errorCode = sbgStreamBufferGetLastError(pInputStream);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		pOutputData->pRawBuffer	= sbgStreamBufferGetCursor(pInputStream);
+		pOutputData->bufferSize	= sbgStreamBufferGetSpace(pInputStream);
+
+		errorCode = sbgStreamBufferSeek(pInputStream, pOutputData->bufferSize, SB_SEEK_CUR_INC);
+	}
+
+	return errorCode;
+}
+
 SbgErrorCode sbgEComBinaryLogWriteRawData(SbgStreamBuffer *pOutputStream, const SbgLogRawData *pInputData)
 {
 	assert(pOutputStream);
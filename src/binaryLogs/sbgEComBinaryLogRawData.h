@@ -59,6 +59,18 @@ typedef struct _SbgLogRawData
 	size_t			bufferSize;										/*!< Raw buffer size in bytes. */
 } SbgLogRawData;
 
+/*!
+ * Structure that references raw data message payload without copying it.
+ *
+ * The referenced buffer belongs to the payload that has been parsed and is only valid as long as it is.
+ * When received through the sbgECom log callback, it's valid until the callback returns.
+ */
+typedef struct _SbgLogRawDataView
+{
+	const uint8_t	*pRawBuffer;									/*!< Pointer on the raw data in the payload. */
+	size_t			 bufferSize;									/*!< Raw buffer size in bytes. */
+} SbgLogRawDataView;
+
 //----------------------------------------------------------------------//
 //- Public methods                                                     -//
 //----------------------------------------------------------------------//
@@ -72,6 +84,17 @@ typedef struct _SbgLogRawData
  */
 SbgErrorCode sbgEComBinaryLogParseRawData(SbgStreamBuffer *pInputStream, SbgLogRawData *pOutputData);
 
+/*!
+ * Parse raw data message and reference it from the corresponding view, without any copy.
+ *
+ * All the remaining bytes of the input stream are referenced.
+ *
+ * \param[in]	pInputStream				Input stream buffer to read the payload from.
+ * \param[out]	pOutputData					Pointer on the output view that references the raw data.
+ * \return									SBG_NO_ERROR if the payload has been parsed.
+ */
+SbgErrorCode sbgEComBinaryLogParseRawDataView(SbgStreamBuffer *pInputStream, SbgLogRawDataView *pOutputData);
+
 /*!
  * Write raw data message to the output stream buffer from the provided structure.
  *
@@ -13,6 +13,11 @@ SbgErrorCode sbgEComBinaryLogParseRtcmRawData(SbgStreamBuffer *pInputStream, Sbg
 	return sbgEComBinaryLogParseRawData(pInputStream, pOutputData);
 }
 
+SbgErrorCode sbgEComBinaryLogParseRtcmRawDataView(SbgStreamBuffer *pInputStream, SbgLogRawDataView *pOutputData)
+{
+	return sbgEComBinaryLogParseRawDataView(pInputStream, pOutputData);
+}
+
 SbgErrorCode sbgEComBinaryLogWriteRtcmRawData(SbgStreamBuffer *pOutputStream, const SbgLogRawData *pInputData)
 {
 	return sbgEComBinaryLogWriteRawData(pOutputStream, pInputData);
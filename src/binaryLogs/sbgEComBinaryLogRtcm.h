@@ -56,6 +56,15 @@ extern "C" {
  */
 SbgErrorCode sbgEComBinaryLogParseRtcmRawData(SbgStreamBuffer *pInputStream, SbgLogRawData *pOutputData);
 
+/*!
+ * Parse data for the SBG_ECOM_LOG_RTCM_RAW message and reference it from the corresponding view, without any copy.
+ *
+ * \param[in]	pInputStream				Input stream buffer to read the payload from.
+ * \param[out]	pOutputData					Pointer on the output view that references the raw data.
+ * \return									SBG_NO_ERROR if the payload has been parsed.
+ */
+SbgErrorCode sbgEComBinaryLogParseRtcmRawDataView(SbgStreamBuffer *pInputStream, SbgLogRawDataView *pOutputData);
+
 /*!
  * Write data for the SBG_ECOM_LOG_RTCM_RAW message to the output stream buffer from the provided structure.
  *
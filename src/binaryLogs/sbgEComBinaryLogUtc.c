@@ -51,27 +51,32 @@ const char *sbgEcomLogUtcGetUtcStatusAsString(const SbgLogUtcData *pLogUtc)
 
 SbgErrorCode sbgEComBinaryLogParseUtcData(SbgStreamBuffer *pInputStream, SbgLogUtcData *pOutputData)
 {
+	SbgErrorCode			errorCode;
+	SbgStreamBufferReader	reader;
+
 	assert(pInputStream);
 	assert(pOutputData);
 
 	//
-	// Read the frame payload
-	//
-	pOutputData->timeStamp		= sbgStreamBufferReadUint32LE(pInputStream);
-	pOutputData->status			= sbgStreamBufferReadUint16LE(pInputStream);
-	pOutputData->year			= sbgStreamBufferReadUint16LE(pInputStream);
-	pOutputData->month			= sbgStreamBufferReadInt8LE(pInputStream);
-	pOutputData->day			= sbgStreamBufferReadInt8LE(pInputStream);
-	pOutputData->hour			= sbgStreamBufferReadInt8LE(pInputStream);
-	pOutputData->minute			= sbgStreamBufferReadInt8LE(pInputStream);
-	pOutputData->second			= sbgStreamBufferReadInt8LE(pInputStream);
-	pOutputData->nanoSecond		= sbgStreamBufferReadInt32LE(pInputStream);
-	pOutputData->gpsTimeOfWeek	= sbgStreamBufferReadUint32LE(pInputStream);
-
-	//
-	// Return if any error has occurred while parsing the frame
+	// Reserve the whole payload at once so that each field is read without any check
 	//
-	return sbgStreamBufferGetLastError(pInputStream);
+	errorCode = sbgStreamBufferReserveRead(pInputStream, SBG_ECOM_LOG_UTC_PAYLOAD_SIZE, &reader);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		pOutputData->timeStamp		= sbgStreamBufferReaderReadUint32LE(&reader);
+		pOutputData->status			= sbgStreamBufferReaderReadUint16LE(&reader);
+		pOutputData->year			= sbgStreamBufferReaderReadUint16LE(&reader);
+		pOutputData->month			= sbgStreamBufferReaderReadInt8(&reader);
+		pOutputData->day			= sbgStreamBufferReaderReadInt8(&reader);
+		pOutputData->hour			= sbgStreamBufferReaderReadInt8(&reader);
+		pOutputData->minute			= sbgStreamBufferReaderReadInt8(&reader);
+		pOutputData->second			= sbgStreamBufferReaderReadInt8(&reader);
+		pOutputData->nanoSecond		= sbgStreamBufferReaderReadInt32LE(&reader);
+		pOutputData->gpsTimeOfWeek	= sbgStreamBufferReaderReadUint32LE(&reader);
+	}
+
+	return errorCode;
 }
 
 SbgErrorCode sbgEComBinaryLogWriteUtcData(SbgStreamBuffer *pOutputStream, const SbgLogUtcData *pInputData)
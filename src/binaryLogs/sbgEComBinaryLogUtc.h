@@ -143,6 +143,11 @@ typedef struct _SbgLogUtcData
 	uint32_t	gpsTimeOfWeek;				/*!< GPS time of week in ms. */
 } SbgLogUtcData;
 
+/*!
+ * Payload size in bytes of the SBG_ECOM_LOG_UTC_TIME message.
+ */
+#define SBG_ECOM_LOG_UTC_PAYLOAD_SIZE					(21)
+
 //----------------------------------------------------------------------//
 //- Public methods                                                     -//
 //----------------------------------------------------------------------//
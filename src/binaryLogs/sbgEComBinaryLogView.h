@@ -0,0 +1,179 @@
+﻿/*!
+ * \file			sbgEComBinaryLogView.h
+ * \author			SBG Systems
+ * \date			19 October 2026
+ *
+ * \brief			Helpers used to decode single fields of a log payload on demand.
+ *
+ *				Log views reference a received payload and only decode the fields that
+ *				are actually accessed. The payload size is checked once when the view is
+ *				initialized so each field accessor is a single unchecked load.
+ *
+ * \copyright		Copyright (C) 2022, SBG Systems SAS. All rights reserved.
+ * \beginlicense	The MIT license
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * \endlicense
+ */
+
+#ifndef SBG_ECOM_BINARY_LOG_VIEW_H
+#define SBG_ECOM_BINARY_LOG_VIEW_H
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Read an uint8_t from a little endian payload at a given offset.
+ *
+ * The payload size must have been checked by the caller.
+ *
+ * \param[in]	pPayload					Payload.
+ * \param[in]	offset						Offset in bytes.
+ * \return									Read value.
+ */
+SBG_INLINE uint8_t sbgEComBinaryLogViewReadUint8(const uint8_t *pPayload, size_t offset)
+{
+	assert(pPayload);
+
+	return pPayload[offset];
+}
+
+/*!
+ * Read an uint16_t from a little endian payload at a given offset.
+ *
+ * The payload size must have been checked by the caller.
+ *
+ * \param[in]	pPayload					Payload.
+ * \param[in]	offset						Offset in bytes.
+ * \return									Read value.
+ */
+SBG_INLINE uint16_t sbgEComBinaryLogViewReadUint16(const uint8_t *pPayload, size_t offset)
+{
+	uint16_t	value;
+
+	assert(pPayload);
+
+#if SBG_CONFIG_BIG_ENDIAN == 0
+	memcpy(&value, &pPayload[offset], sizeof(value));
+#else
+	value = (uint16_t)pPayload[offset] | ((uint16_t)pPayload[offset + 1] << 8);
+#endif
+
+	return value;
+}
+
+/*!
+ * Read an uint32_t from a little endian payload at a given offset.
+ *
+ * The payload size must have been checked by the caller.
+ *
+ * \param[in]	pPayload					Payload.
+ * \param[in]	offset						Offset in bytes.
+ * \return									Read value.
+ */
+SBG_INLINE uint32_t sbgEComBinaryLogViewReadUint32(const uint8_t *pPayload, size_t offset)
+{
+	uint32_t	value;
+
+	assert(pPayload);
+
+#if SBG_CONFIG_BIG_ENDIAN == 0
+	memcpy(&value, &pPayload[offset], sizeof(value));
+#else
+	value =	(uint32_t)pPayload[offset]				| ((uint32_t)pPayload[offset + 1] << 8) |
+			((uint32_t)pPayload[offset + 2] << 16)	| ((uint32_t)pPayload[offset + 3] << 24);
+#endif
+
+	return value;
+}
+
+/*!
+ * Read an uint64_t from a little endian payload at a given offset.
+ *
+ * The payload size must have been checked by the caller.
+ *
+ * \param[in]	pPayload					Payload.
+ * \param[in]	offset						Offset in bytes.
+ * \return									Read value.
+ */
+SBG_INLINE uint64_t sbgEComBinaryLogViewReadUint64(const uint8_t *pPayload, size_t offset)
+{
+	uint64_t	value;
+
+	assert(pPayload);
+
+#if SBG_CONFIG_BIG_ENDIAN == 0
+	memcpy(&value, &pPayload[offset], sizeof(value));
+#else
+	value = (uint64_t)sbgEComBinaryLogViewReadUint32(pPayload, offset) | ((uint64_t)sbgEComBinaryLogViewReadUint32(pPayload, offset + 4) << 32);
+#endif
+
+	return value;
+}
+
+/*!
+ * Read a float from a little endian payload at a given offset.
+ *
+ * The payload size must have been checked by the caller.
+ *
+ * \param[in]	pPayload					Payload.
+ * \param[in]	offset						Offset in bytes.
+ * \return									Read value.
+ */
+SBG_INLINE float sbgEComBinaryLogViewReadFloat(const uint8_t *pPayload, size_t offset)
+{
+	FloatNint	value;
+
+	value.valU = sbgEComBinaryLogViewReadUint32(pPayload, offset);
+
+	return value.valF;
+}
+
+/*!
+ * Read a double from a little endian payload at a given offset.
+ *
+ * The payload size must have been checked by the caller.
+ *
+ * \param[in]	pPayload					Payload.
+ * \param[in]	offset						Offset in bytes.
+ * \return									Read value.
+ */
+SBG_INLINE double sbgEComBinaryLogViewReadDouble(const uint8_t *pPayload, size_t offset)
+{
+	DoubleNint	value;
+
+	value.valU = sbgEComBinaryLogViewReadUint64(pPayload, offset);
+
+	return value.valF;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_ECOM_BINARY_LOG_VIEW_H
@@ -160,3 +160,138 @@ SbgErrorCode sbgEComBinaryLogParse(SbgEComClass msgClass, SbgEComMsgId msg, cons
 
 	return errorCode;
 }
+
+SbgErrorCode sbgEComBinaryLogParseWithRawViews(SbgEComClass msgClass, SbgEComMsgId msg, const void *pPayload, size_t payloadSize, SbgBinaryLogData *pOutputData)
+{
+	SbgErrorCode		errorCode = SBG_NO_ERROR;
+	SbgStreamBuffer		inputStream;
+
+	assert(pPayload);
+	assert(payloadSize > 0);
+	assert(pOutputData);
+
+	if ((msgClass == SBG_ECOM_CLASS_LOG_ECOM_0) && ((msg == SBG_ECOM_LOG_GPS1_RAW) || (msg == SBG_ECOM_LOG_GPS2_RAW)))
+	{
+		sbgStreamBufferInitForRead(&inputStream, pPayload, payloadSize);
+		errorCode = sbgEComBinaryLogParseGpsRawDataView(&inputStream, &pOutputData->gpsRawView);
+	}
+	else if ((msgClass == SBG_ECOM_CLASS_LOG_ECOM_0) && (msg == SBG_ECOM_LOG_RTCM_RAW))
+	{
+		sbgStreamBufferInitForRead(&inputStream, pPayload, payloadSize);
+		errorCode = sbgEComBinaryLogParseRtcmRawDataView(&inputStream, &pOutputData->rtcmRawView);
+	}
+	else
+	{
+		errorCode = sbgEComBinaryLogParse(msgClass, msg, pPayload, payloadSize, pOutputData);
+	}
+
+	return errorCode;
+}
+
+size_t sbgEComBinaryLogGetSize(SbgEComClass msgClass, SbgEComMsgId msg, bool rawViews)
+{
+	size_t		size;
+
+	if (msgClass == SBG_ECOM_CLASS_LOG_ECOM_0)
+	{
+		switch (msg)
+		{
+		case SBG_ECOM_LOG_STATUS:
+			size = sizeof(SbgLogStatusData);
+			break;
+		case SBG_ECOM_LOG_IMU_DATA:
+			size = sizeof(SbgLogImuData);
+			break;
+		case SBG_ECOM_LOG_IMU_SHORT:
+			size = sizeof(SbgLogImuShort);
+			break;
+		case SBG_ECOM_LOG_EKF_EULER:
+			size = sizeof(SbgLogEkfEulerData);
+			break;
+		case SBG_ECOM_LOG_EKF_QUAT:
+			size = sizeof(SbgLogEkfQuatData);
+			break;
+		case SBG_ECOM_LOG_EKF_NAV:
+			size = sizeof(SbgLogEkfNavData);
+			break;
+		case SBG_ECOM_LOG_SHIP_MOTION:
+		case SBG_ECOM_LOG_SHIP_MOTION_HP:
+			size = sizeof(SbgLogShipMotionData);
+			break;
+		case SBG_ECOM_LOG_ODO_VEL:
+			size = sizeof(SbgLogOdometerData);
+			break;
+		case SBG_ECOM_LOG_UTC_TIME:
+			size = sizeof(SbgLogUtcData);
+			break;
+		case SBG_ECOM_LOG_GPS1_VEL:
+		case SBG_ECOM_LOG_GPS2_VEL:
+			size = sizeof(SbgLogGpsVel);
+			break;
+		case SBG_ECOM_LOG_GPS1_POS:
+		case SBG_ECOM_LOG_GPS2_POS:
+			size = sizeof(SbgLogGpsPos);
+			break;
+		case SBG_ECOM_LOG_GPS1_HDT:
+		case SBG_ECOM_LOG_GPS2_HDT:
+			size = sizeof(SbgLogGpsHdt);
+			break;
+		case SBG_ECOM_LOG_GPS1_RAW:
+		case SBG_ECOM_LOG_GPS2_RAW:
+		case SBG_ECOM_LOG_RTCM_RAW:
+			size = rawViews ? sizeof(SbgLogRawDataView) : sizeof(SbgLogRawData);
+			break;
+		case SBG_ECOM_LOG_MAG:
+			size = sizeof(SbgLogMag);
+			break;
+		case SBG_ECOM_LOG_MAG_CALIB:
+			size = sizeof(SbgLogMagCalib);
+			break;
+		case SBG_ECOM_LOG_DVL_BOTTOM_TRACK:
+		case SBG_ECOM_LOG_DVL_WATER_TRACK:
+			size = sizeof(SbgLogDvlData);
+			break;
+		case SBG_ECOM_LOG_AIR_DATA:
+			size = sizeof(SbgLogAirData);
+			break;
+		case SBG_ECOM_LOG_USBL:
+			size = sizeof(SbgLogUsblData);
+			break;
+		case SBG_ECOM_LOG_DEPTH:
+			size = sizeof(SbgLogDepth);
+			break;
+		case SBG_ECOM_LOG_EVENT_A:
+		case SBG_ECOM_LOG_EVENT_B:
+		case SBG_ECOM_LOG_EVENT_C:
+		case SBG_ECOM_LOG_EVENT_D:
+		case SBG_ECOM_LOG_EVENT_E:
+		case SBG_ECOM_LOG_EVENT_OUT_A:
+		case SBG_ECOM_LOG_EVENT_OUT_B:
+			size = sizeof(SbgLogEvent);
+			break;
+		case SBG_ECOM_LOG_DIAG:
+			size = sizeof(SbgLogDiagData);
+			break;
+
+		default:
+			size = 0;
+		}
+	}
+	else if (msgClass == SBG_ECOM_CLASS_LOG_ECOM_1)
+	{
+		switch ((SbgEComLog1)msg)
+		{
+		case SBG_ECOM_LOG_FAST_IMU_DATA:
+			size = sizeof(SbgLogFastImuData);
+			break;
+		default:
+			size = 0;
+		}
+	}
+	else
+	{
+		size = 0;
+	}
+
+	return size;
+}
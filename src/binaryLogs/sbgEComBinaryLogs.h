@@ -92,6 +92,10 @@ typedef union _SbgBinaryLogData
 	SbgLogEvent						eventMarker;		/*!< Stores data for the SBG_ECOM_LOG_EVENT_# message. */
 	SbgLogDiagData					diagData;			/*!< Stores data for the SBG_ECOM_LOG_DIAG message. */
 
+	/* Zero copy raw logs */
+	SbgLogRawDataView				gpsRawView;			/*!< References data for the SBG_ECOM_LOG_GPS#_RAW message, see sbgEComBinaryLogParseWithRawViews. */
+	SbgLogRawDataView				rtcmRawView;		/*!< References data for the SBG_ECOM_LOG_RTCM_RAW message, see sbgEComBinaryLogParseWithRawViews. */
+
 	/* Fast logs */
 	SbgLogFastImuData				fastImuData;		/*!< Stores Fast Imu Data for 1KHz output */
 
@@ -112,6 +116,33 @@ typedef union _SbgBinaryLogData
  */
 SbgErrorCode sbgEComBinaryLogParse(SbgEComClass msgClass, SbgEComMsgId msg, const void *pPayload, size_t payloadSize, SbgBinaryLogData *pOutputData);
 
+/*!
+ * Parse an incoming log and fill the output union, raw data logs being referenced instead of copied.
+ *
+ * Identical to sbgEComBinaryLogParse except that SBG_ECOM_LOG_GPS#_RAW and SBG_ECOM_LOG_RTCM_RAW logs
+ * fill the gpsRawView and rtcmRawView members. These views point in the payload buffer and are only
+ * valid as long as the payload buffer is.
+ *
+ * \param[in]	msgClass					Received message class
+ * \param[in]	msg							Received message ID
+ * \param[in]	pPayload					Read only pointer on the payload buffer.
+ * \param[in]	payloadSize					Payload size in bytes.
+ * \param[out]	pOutputData					Pointer on the output union that stores parsed data.
+ */
+SbgErrorCode sbgEComBinaryLogParseWithRawViews(SbgEComClass msgClass, SbgEComMsgId msg, const void *pPayload, size_t payloadSize, SbgBinaryLogData *pOutputData);
+
+/*!
+ * Returns the size of the output union member filled when a log is parsed.
+ *
+ * This is used to store parsed logs compactly instead of using a whole SbgBinaryLogData union per log.
+ *
+ * \param[in]	msgClass					Message class.
+ * \param[in]	msg							Message ID.
+ * \param[in]	rawViews					True if the log is parsed with sbgEComBinaryLogParseWithRawViews.
+ * \return									Size of the parsed log in bytes, 0 if the log isn't supported.
+ */
+size_t sbgEComBinaryLogGetSize(SbgEComClass msgClass, SbgEComMsgId msg, bool rawViews);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,1272 @@
+﻿// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <fileMap/sbgFileMap.h>
+#include <streamBuffer/sbgStreamBuffer.h>
+
+// Project headers
+#include <binaryLogs/sbgEComBinaryLogUtc.h>
+
+// Local headers
+#include "sbgEComCapture.h"
+
+//----------------------------------------------------------------------//
+//- Private definitions                                                -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Capture file header and trailer magics.
+ */
+#define SBG_ECOM_CAPTURE_HEADER_MAGIC					"SBGECCAP"
+#define SBG_ECOM_CAPTURE_TRAILER_MAGIC					"SBGECIDX"
+#define SBG_ECOM_CAPTURE_MAGIC_SIZE						(8)
+
+/*!
+ * Initial number of allocated index entries.
+ */
+#define SBG_ECOM_CAPTURE_INDEX_INITIAL_CAPACITY			(256)
+
+/*!
+ * Capture record types.
+ */
+typedef enum _SbgEComCaptureRecordType
+{
+	SBG_ECOM_CAPTURE_RECORD_LOG		= 1,						/*!< Received log. */
+	SBG_ECOM_CAPTURE_RECORD_INDEX	= 2							/*!< Index block, the entries of the previous block. */
+} SbgEComCaptureRecordType;
+
+/*!
+ * Capture record header.
+ */
+typedef struct _SbgEComCaptureRecordHeader
+{
+	uint32_t					 size;						/*!< Payload size in bytes. */
+	uint8_t						 type;						/*!< Record type. */
+	uint8_t						 msgClass;					/*!< Log message class. */
+	uint8_t						 msgId;						/*!< Log message id. */
+	uint64_t					 hostTimeUs;				/*!< Host reception time in us. */
+} SbgEComCaptureRecordHeader;
+
+//----------------------------------------------------------------------//
+//- Private methods (time tracker)                                     -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Returns true if a log payload starts with a device time stamp.
+ *
+ * \param[in]	msgClass					Log message class.
+ * \param[in]	msgId						Log message id.
+ * \return									True if the log has a time stamp.
+ */
+static bool sbgEComCaptureLogHasTimeStamp(SbgEComClass msgClass, SbgEComMsgId msgId)
+{
+	bool	hasTimeStamp;
+
+	if (msgClass == SBG_ECOM_CLASS_LOG_ECOM_0)
+	{
+		hasTimeStamp = (msgId != SBG_ECOM_LOG_GPS1_RAW) && (msgId != SBG_ECOM_LOG_GPS2_RAW) && (msgId != SBG_ECOM_LOG_RTCM_RAW);
+	}
+	else if (msgClass == SBG_ECOM_CLASS_LOG_ECOM_1)
+	{
+		hasTimeStamp = true;
+	}
+	else
+	{
+		hasTimeStamp = false;
+	}
+
+	return hasTimeStamp;
+}
+
+/*!
+ * Initialize a time tracker from the state stored in an index entry.
+ *
+ * \param[out]	pTimeTracker				Time tracker.
+ * \param[in]	pEntry						Index entry.
+ */
+static void sbgEComCaptureTimeTrackerConstructFromEntry(SbgEComCaptureTimeTracker *pTimeTracker, const SbgEComCaptureIndexEntry *pEntry)
+{
+	assert(pTimeTracker);
+	assert(pEntry);
+
+	pTimeTracker->deviceTimeValid		= (pEntry->flags & SBG_ECOM_CAPTURE_ENTRY_DEVICE_TIME_VALID) != 0;
+	pTimeTracker->lastTimeStamp			= (uint32_t)pEntry->deviceTimeUs;
+	pTimeTracker->deviceTimeUs			= pEntry->deviceTimeUs;
+	pTimeTracker->utcTimeValid			= (pEntry->flags & SBG_ECOM_CAPTURE_ENTRY_UTC_TIME_VALID) != 0;
+	pTimeTracker->utcRefDeviceTimeUs	= pEntry->deviceTimeUs;
+	pTimeTracker->utcRefTimeUs			= pEntry->utcTimeUs;
+}
+
+//----------------------------------------------------------------------//
+//- Private methods (index)                                            -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Initialize a capture index.
+ *
+ * \param[out]	pIndex						Capture index.
+ * \param[in]	blockSize					Number of logs per block.
+ */
+static void sbgEComCaptureIndexConstruct(SbgEComCaptureIndex *pIndex, uint32_t blockSize)
+{
+	assert(pIndex);
+	assert(blockSize > 0);
+
+	memset(pIndex, 0, sizeof(*pIndex));
+
+	pIndex->blockSize = blockSize;
+
+	sbgEComCaptureTimeTrackerConstruct(&pIndex->timeTracker);
+}
+
+/*!
+ * Release a capture index.
+ *
+ * \param[in]	pIndex						Capture index.
+ */
+static void sbgEComCaptureIndexDestroy(SbgEComCaptureIndex *pIndex)
+{
+	assert(pIndex);
+
+	free(pIndex->pBlockEntries);
+	free(pIndex->pLogEntries);
+
+	memset(pIndex, 0, sizeof(*pIndex));
+}
+
+/*!
+ * Append an entry to an array of index entries.
+ *
+ * \param[in]	ppEntries					Entries, reallocated if needed.
+ * \param[in]	pNrEntries					Number of entries.
+ * \param[in]	pCapacity					Allocated number of entries.
+ * \param[in]	pEntry						Entry to append.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComCaptureIndexAppendEntry(SbgEComCaptureIndexEntry **ppEntries, size_t *pNrEntries, size_t *pCapacity, const SbgEComCaptureIndexEntry *pEntry)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+	SbgEComCaptureIndexEntry	*pNewEntries;
+	size_t						 newCapacity;
+
+	assert(ppEntries);
+	assert(pNrEntries);
+	assert(pCapacity);
+	assert(pEntry);
+
+	if (*pNrEntries == *pCapacity)
+	{
+		newCapacity = sbgMax(*pCapacity * 2, SBG_ECOM_CAPTURE_INDEX_INITIAL_CAPACITY);
+		pNewEntries = realloc(*ppEntries, newCapacity * sizeof(*pNewEntries));
+
+		if (pNewEntries)
+		{
+			*ppEntries	= pNewEntries;
+			*pCapacity	= newCapacity;
+		}
+		else
+		{
+			errorCode = SBG_MALLOC_FAILED;
+			SBG_LOG_ERROR(errorCode, "unable to allocate %zu index entries", newCapacity);
+		}
+	}
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		(*ppEntries)[*pNrEntries] = *pEntry;
+		(*pNrEntries)++;
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Add a log to a capture index.
+ *
+ * \param[in]	pIndex						Capture index.
+ * \param[in]	offset						Offset of the log record.
+ * \param[in]	hostTimeUs					Host reception time in us.
+ * \param[in]	msgClass					Log message class.
+ * \param[in]	msgId						Log message id.
+ * \param[in]	pPayload					Log payload.
+ * \param[in]	payloadSize					Log payload size in bytes.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComCaptureIndexAddLog(SbgEComCaptureIndex *pIndex, uint64_t offset, uint64_t hostTimeUs, SbgEComClass msgClass, SbgEComMsgId msgId, const void *pPayload, size_t payloadSize)
+{
+	SbgErrorCode				errorCode = SBG_NO_ERROR;
+	SbgEComCaptureIndexEntry	entry;
+	bool						found = false;
+	size_t						i;
+
+	assert(pIndex);
+
+	sbgEComCaptureTimeTrackerProcess(&pIndex->timeTracker, msgClass, msgId, pPayload, payloadSize);
+
+	entry.offset		= offset;
+	entry.hostTimeUs	= hostTimeUs;
+	entry.msgClass		= (uint8_t)msgClass;
+	entry.msgId			= (uint8_t)msgId;
+	entry.flags			= 0;
+	entry.deviceTimeUs	= pIndex->timeTracker.deviceTimeUs;
+
+	if (pIndex->timeTracker.deviceTimeValid)
+	{
+		entry.flags |= SBG_ECOM_CAPTURE_ENTRY_DEVICE_TIME_VALID;
+	}
+
+	if (sbgEComCaptureTimeTrackerGetTime(&pIndex->timeTracker, SBG_ECOM_CAPTURE_TIME_UTC, hostTimeUs, &entry.utcTimeUs))
+	{
+		entry.flags |= SBG_ECOM_CAPTURE_ENTRY_UTC_TIME_VALID;
+	}
+
+	if (pIndex->nrBlockLogs == 0)
+	{
+		errorCode = sbgEComCaptureIndexAppendEntry(&pIndex->pBlockEntries, &pIndex->nrBlockEntries, &pIndex->blockEntriesCapacity, &entry);
+	}
+
+	//
+	// Only the first log of each type is referenced in a block
+	//
+	for (i = pIndex->blockFirstLogEntry; i < pIndex->nrLogEntries; i++)
+	{
+		if ((pIndex->pLogEntries[i].msgClass == entry.msgClass) && (pIndex->pLogEntries[i].msgId == entry.msgId))
+		{
+			found = true;
+			break;
+		}
+	}
+
+	if ((errorCode == SBG_NO_ERROR) && !found)
+	{
+		errorCode = sbgEComCaptureIndexAppendEntry(&pIndex->pLogEntries, &pIndex->nrLogEntries, &pIndex->logEntriesCapacity, &entry);
+	}
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		pIndex->nrBlockLogs++;
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Returns true if the current block of a capture index is complete.
+ *
+ * \param[in]	pIndex						Capture index.
+ * \return									True if the block is complete.
+ */
+static bool sbgEComCaptureIndexIsBlockComplete(const SbgEComCaptureIndex *pIndex)
+{
+	assert(pIndex);
+
+	return pIndex->nrBlockLogs >= pIndex->blockSize;
+}
+
+/*!
+ * Start a new block in a capture index.
+ *
+ * \param[in]	pIndex						Capture index.
+ */
+static void sbgEComCaptureIndexStartBlock(SbgEComCaptureIndex *pIndex)
+{
+	assert(pIndex);
+
+	pIndex->blockFirstLogEntry	= pIndex->nrLogEntries;
+	pIndex->nrBlockLogs			= 0;
+}
+
+/*!
+ * Compare two log entries by message class, message id and offset.
+ *
+ * \param[in]	pA							First entry.
+ * \param[in]	pB							Second entry.
+ * \return									Comparison result for qsort.
+ */
+static int sbgEComCaptureIndexCompareLogEntries(const void *pA, const void *pB)
+{
+	const SbgEComCaptureIndexEntry	*pEntryA = pA;
+	const SbgEComCaptureIndexEntry	*pEntryB = pB;
+	int								 result;
+
+	if (pEntryA->msgClass != pEntryB->msgClass)
+	{
+		result = (pEntryA->msgClass < pEntryB->msgClass) ? -1 : 1;
+	}
+	else if (pEntryA->msgId != pEntryB->msgId)
+	{
+		result = (pEntryA->msgId < pEntryB->msgId) ? -1 : 1;
+	}
+	else if (pEntryA->offset != pEntryB->offset)
+	{
+		result = (pEntryA->offset < pEntryB->offset) ? -1 : 1;
+	}
+	else
+	{
+		result = 0;
+	}
+
+	return result;
+}
+
+/*!
+ * Sort the log entries of a capture index by message class, message id and offset.
+ *
+ * \param[in]	pIndex						Capture index.
+ */
+static void sbgEComCaptureIndexSort(SbgEComCaptureIndex *pIndex)
+{
+	assert(pIndex);
+
+	if (pIndex->nrLogEntries > 0)
+	{
+		qsort(pIndex->pLogEntries, pIndex->nrLogEntries, sizeof(*pIndex->pLogEntries), sbgEComCaptureIndexCompareLogEntries);
+	}
+}
+
+/*!
+ * Find the first log entry not ordered before a given key.
+ *
+ * \param[in]	pEntries					Log entries sorted by message class, message id and offset.
+ * \param[in]	nrEntries					Number of entries.
+ * \param[in]	pKey						Key.
+ * \return									Index of the found entry, nrEntries if all entries are ordered before the key.
+ */
+static size_t sbgEComCaptureIndexLowerBound(const SbgEComCaptureIndexEntry *pEntries, size_t nrEntries, const SbgEComCaptureIndexEntry *pKey)
+{
+	size_t	low = 0;
+	size_t	high = nrEntries;
+	size_t	middle;
+
+	assert(pEntries || (nrEntries == 0));
+	assert(pKey);
+
+	while (low < high)
+	{
+		middle = low + (high - low) / 2;
+
+		if (sbgEComCaptureIndexCompareLogEntries(&pEntries[middle], pKey) < 0)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	return low;
+}
+
+/*!
+ * Returns the time of an index entry in a given time base.
+ *
+ * Entries without a valid time are sorted before all the others.
+ *
+ * \param[in]	pEntry						Index entry.
+ * \param[in]	timeBase					Time base.
+ * \return									Time in us, INT64_MIN if not valid.
+ */
+static int64_t sbgEComCaptureIndexEntryGetTime(const SbgEComCaptureIndexEntry *pEntry, SbgEComCaptureTimeBase timeBase)
+{
+	int64_t		time;
+
+	assert(pEntry);
+
+	switch (timeBase)
+	{
+	case SBG_ECOM_CAPTURE_TIME_HOST:
+		time = (int64_t)pEntry->hostTimeUs;
+		break;
+	case SBG_ECOM_CAPTURE_TIME_DEVICE:
+		time = (pEntry->flags & SBG_ECOM_CAPTURE_ENTRY_DEVICE_TIME_VALID) ? pEntry->deviceTimeUs : INT64_MIN;
+		break;
+	case SBG_ECOM_CAPTURE_TIME_UTC:
+		time = (pEntry->flags & SBG_ECOM_CAPTURE_ENTRY_UTC_TIME_VALID) ? pEntry->utcTimeUs : INT64_MIN;
+		break;
+	default:
+		time = INT64_MIN;
+	}
+
+	return time;
+}
+
+/*!
+ * Find the last entry at or before a given time.
+ *
+ * \param[in]	pEntries					Entries sorted by time.
+ * \param[in]	nrEntries					Number of entries, must be greater than 0.
+ * \param[in]	timeBase					Time base.
+ * \param[in]	time						Time in us.
+ * \return									Index of the found entry, 0 if all entries are after the given time.
+ */
+static size_t sbgEComCaptureIndexFindEntry(const SbgEComCaptureIndexEntry *pEntries, size_t nrEntries, SbgEComCaptureTimeBase timeBase, int64_t time)
+{
+	size_t	low = 0;
+	size_t	high = nrEntries;
+	size_t	middle;
+
+	assert(pEntries);
+	assert(nrEntries > 0);
+
+	//
+	// Find the first entry after the given time
+	//
+	while (low < high)
+	{
+		middle = low + (high - low) / 2;
+
+		if (sbgEComCaptureIndexEntryGetTime(&pEntries[middle], timeBase) <= time)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	return (low > 0) ? (low - 1) : 0;
+}
+
+/*!
+ * Serialize index entries.
+ *
+ * \param[in]	pOutputStream				Output stream.
+ * \param[in]	pEntries					Entries.
+ * \param[in]	nrEntries					Number of entries.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComCaptureWriteEntries(SbgStreamBuffer *pOutputStream, const SbgEComCaptureIndexEntry *pEntries, size_t nrEntries)
+{
+	size_t	i;
+
+	assert(pOutputStream);
+	assert(pEntries || (nrEntries == 0));
+
+	for (i = 0; i < nrEntries; i++)
+	{
+		sbgStreamBufferWriteUint64LE(pOutputStream, pEntries[i].offset);
+		sbgStreamBufferWriteUint64LE(pOutputStream, pEntries[i].hostTimeUs);
+		sbgStreamBufferWriteInt64LE(pOutputStream, pEntries[i].deviceTimeUs);
+		sbgStreamBufferWriteInt64LE(pOutputStream, pEntries[i].utcTimeUs);
+		sbgStreamBufferWriteUint8LE(pOutputStream, pEntries[i].msgClass);
+		sbgStreamBufferWriteUint8LE(pOutputStream, pEntries[i].msgId);
+		sbgStreamBufferWriteUint16LE(pOutputStream, pEntries[i].flags);
+		sbgStreamBufferWriteUint32LE(pOutputStream, 0);
+	}
+
+	return sbgStreamBufferGetLastError(pOutputStream);
+}
+
+/*!
+ * Parse index entries.
+ *
+ * \param[in]	pInputStream				Input stream.
+ * \param[out]	pEntries					Entries.
+ * \param[in]	nrEntries					Number of entries.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComCaptureReadEntries(SbgStreamBuffer *pInputStream, SbgEComCaptureIndexEntry *pEntries, size_t nrEntries)
+{
+	size_t	i;
+
+	assert(pInputStream);
+	assert(pEntries || (nrEntries == 0));
+
+	for (i = 0; i < nrEntries; i++)
+	{
+		pEntries[i].offset			= sbgStreamBufferReadUint64LE(pInputStream);
+		pEntries[i].hostTimeUs		= sbgStreamBufferReadUint64LE(pInputStream);
+		pEntries[i].deviceTimeUs	= sbgStreamBufferReadInt64LE(pInputStream);
+		pEntries[i].utcTimeUs		= sbgStreamBufferReadInt64LE(pInputStream);
+		pEntries[i].msgClass		= sbgStreamBufferReadUint8LE(pInputStream);
+		pEntries[i].msgId			= sbgStreamBufferReadUint8LE(pInputStream);
+		pEntries[i].flags			= sbgStreamBufferReadUint16LE(pInputStream);
+		sbgStreamBufferSeek(pInputStream, sizeof(uint32_t), SB_SEEK_CUR_INC);
+	}
+
+	return sbgStreamBufferGetLastError(pInputStream);
+}
+
+//----------------------------------------------------------------------//
+//- Private methods (writer)                                           -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Write data to a capture file.
+ *
+ * \param[in]	pWriter						Capture writer.
+ * \param[in]	pBuffer						Data.
+ * \param[in]	size						Data size in bytes.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComCaptureWriterWrite(SbgEComCaptureWriter *pWriter, const void *pBuffer, size_t size)
+{
+	SbgErrorCode	errorCode = SBG_NO_ERROR;
+
+	assert(pWriter);
+	assert(pWriter->pFile);
+	assert(pBuffer || (size == 0));
+
+	if (size > 0)
+	{
+		if (fwrite(pBuffer, 1, size, pWriter->pFile) == size)
+		{
+			pWriter->offset += size;
+		}
+		else
+		{
+			errorCode = SBG_WRITE_ERROR;
+			SBG_LOG_ERROR(errorCode, "unable to write %zu bytes to capture", size);
+		}
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Write a record header to a capture file.
+ *
+ * \param[in]	pWriter						Capture writer.
+ * \param[in]	pHeader						Record header.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComCaptureWriterWriteRecordHeader(SbgEComCaptureWriter *pWriter, const SbgEComCaptureRecordHeader *pHeader)
+{
+	uint8_t				buffer[SBG_ECOM_CAPTURE_RECORD_HEADER_SIZE];
+	SbgStreamBuffer		outputStream;
+
+	assert(pWriter);
+	assert(pHeader);
+
+	sbgStreamBufferInitForWrite(&outputStream, buffer, sizeof(buffer));
+
+	sbgStreamBufferWriteUint32LE(&outputStream, pHeader->size);
+	sbgStreamBufferWriteUint8LE(&outputStream, pHeader->type);
+	sbgStreamBufferWriteUint8LE(&outputStream, pHeader->msgClass);
+	sbgStreamBufferWriteUint8LE(&outputStream, pHeader->msgId);
+	sbgStreamBufferWriteUint8LE(&outputStream, 0);
+	sbgStreamBufferWriteUint64LE(&outputStream, pHeader->hostTimeUs);
+
+	assert(sbgStreamBufferGetLastError(&outputStream) == SBG_NO_ERROR);
+
+	return sbgEComCaptureWriterWrite(pWriter, buffer, sizeof(buffer));
+}
+
+/*!
+ * Write index entries to a capture file.
+ *
+ * \param[in]	pWriter						Capture writer.
+ * \param[in]	pEntries					Entries.
+ * \param[in]	nrEntries					Number of entries.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComCaptureWriterWriteEntries(SbgEComCaptureWriter *pWriter, const SbgEComCaptureIndexEntry *pEntries, size_t nrEntries)
+{
+	SbgErrorCode		errorCode = SBG_NO_ERROR;
+	uint8_t				buffer[SBG_ECOM_CAPTURE_INDEX_ENTRY_SIZE * 64];
+	SbgStreamBuffer		outputStream;
+	size_t				nrWriteEntries;
+	size_t				i;
+
+	assert(pWriter);
+
+	for (i = 0; (i < nrEntries) && (errorCode == SBG_NO_ERROR); i += nrWriteEntries)
+	{
+		nrWriteEntries = sbgMin(nrEntries - i, sizeof(buffer) / SBG_ECOM_CAPTURE_INDEX_ENTRY_SIZE);
+
+		sbgStreamBufferInitForWrite(&outputStream, buffer, sizeof(buffer));
+		sbgEComCaptureWriteEntries(&outputStream, &pEntries[i], nrWriteEntries);
+
+		errorCode = sbgEComCaptureWriterWrite(pWriter, buffer, sbgStreamBufferGetLength(&outputStream));
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Write the index block of the current block.
+ *
+ * \param[in]	pWriter						Capture writer.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComCaptureWriterWriteIndexBlock(SbgEComCaptureWriter *pWriter)
+{
+	SbgErrorCode				errorCode;
+	SbgEComCaptureRecordHeader	header;
+	size_t						nrLogEntries;
+
+	assert(pWriter);
+	assert(pWriter->index.nrBlockEntries > 0);
+
+	nrLogEntries = pWriter->index.nrLogEntries - pWriter->index.blockFirstLogEntry;
+
+	header.size			= (uint32_t)((1 + nrLogEntries) * SBG_ECOM_CAPTURE_INDEX_ENTRY_SIZE);
+	header.type			= SBG_ECOM_CAPTURE_RECORD_INDEX;
+	header.msgClass		= 0;
+	header.msgId		= 0;
+	header.hostTimeUs	= 0;
+
+	errorCode = sbgEComCaptureWriterWriteRecordHeader(pWriter, &header);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		errorCode = sbgEComCaptureWriterWriteEntries(pWriter, &pWriter->index.pBlockEntries[pWriter->index.nrBlockEntries - 1], 1);
+	}
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		errorCode = sbgEComCaptureWriterWriteEntries(pWriter, &pWriter->index.pLogEntries[pWriter->index.blockFirstLogEntry], nrLogEntries);
+	}
+
+	sbgEComCaptureIndexStartBlock(&pWriter->index);
+
+	return errorCode;
+}
+
+//----------------------------------------------------------------------//
+//- Private methods (reader)                                           -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Parse a record header.
+ *
+ * \param[in]	pReader						Capture reader.
+ * \param[in]	offset						Record offset.
+ * \param[out]	pHeader						Record header.
+ * \return									SBG_NO_ERROR if the whole record is available.
+ */
+static SbgErrorCode sbgEComCaptureReaderReadRecordHeader(const SbgEComCaptureReader *pReader, size_t offset, SbgEComCaptureRecordHeader *pHeader)
+{
+	SbgErrorCode		errorCode = SBG_NO_ERROR;
+	SbgStreamBuffer		inputStream;
+
+	assert(pReader);
+	assert(pHeader);
+
+	if ((offset <= pReader->recordsEndOffset) && ((pReader->recordsEndOffset - offset) >= SBG_ECOM_CAPTURE_RECORD_HEADER_SIZE))
+	{
+		sbgStreamBufferInitForRead(&inputStream, sbgFileMapGetBuffer(&pReader->fileMap) + offset, SBG_ECOM_CAPTURE_RECORD_HEADER_SIZE);
+
+		pHeader->size		= sbgStreamBufferReadUint32LE(&inputStream);
+		pHeader->type		= sbgStreamBufferReadUint8LE(&inputStream);
+		pHeader->msgClass	= sbgStreamBufferReadUint8LE(&inputStream);
+		pHeader->msgId		= sbgStreamBufferReadUint8LE(&inputStream);
+		sbgStreamBufferSeek(&inputStream, sizeof(uint8_t), SB_SEEK_CUR_INC);
+		pHeader->hostTimeUs	= sbgStreamBufferReadUint64LE(&inputStream);
+
+		if ((pReader->recordsEndOffset - offset - SBG_ECOM_CAPTURE_RECORD_HEADER_SIZE) < pHeader->size)
+		{
+			errorCode = SBG_NOT_READY;
+		}
+	}
+	else
+	{
+		errorCode = SBG_NOT_READY;
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Load the consolidated index of a capture.
+ *
+ * \param[in]	pReader						Capture reader.
+ * \return									SBG_NO_ERROR if successful, SBG_NOT_READY if the capture has no trailer.
+ */
+static SbgErrorCode sbgEComCaptureReaderLoadIndex(SbgEComCaptureReader *pReader)
+{
+	SbgErrorCode		 errorCode = SBG_NO_ERROR;
+	const uint8_t		*pBuffer;
+	size_t				 size;
+	SbgStreamBuffer		 inputStream;
+	uint64_t			 indexOffset;
+	uint32_t			 nrBlockEntries;
+	uint32_t			 nrLogEntries;
+
+	assert(pReader);
+
+	pBuffer	= sbgFileMapGetBuffer(&pReader->fileMap);
+	size	= sbgFileMapGetSize(&pReader->fileMap);
+
+	if ((size >= (SBG_ECOM_CAPTURE_HEADER_SIZE + SBG_ECOM_CAPTURE_TRAILER_SIZE)) && (memcmp(pBuffer + size - SBG_ECOM_CAPTURE_MAGIC_SIZE, SBG_ECOM_CAPTURE_TRAILER_MAGIC, SBG_ECOM_CAPTURE_MAGIC_SIZE) == 0))
+	{
+		sbgStreamBufferInitForRead(&inputStream, pBuffer + size - SBG_ECOM_CAPTURE_TRAILER_SIZE, SBG_ECOM_CAPTURE_TRAILER_SIZE);
+
+		indexOffset		= sbgStreamBufferReadUint64LE(&inputStream);
+		nrBlockEntries	= sbgStreamBufferReadUint32LE(&inputStream);
+		nrLogEntries	= sbgStreamBufferReadUint32LE(&inputStream);
+
+		if ((indexOffset >= SBG_ECOM_CAPTURE_HEADER_SIZE) && (indexOffset + ((uint64_t)nrBlockEntries + nrLogEntries) * SBG_ECOM_CAPTURE_INDEX_ENTRY_SIZE + SBG_ECOM_CAPTURE_TRAILER_SIZE == size))
+		{
+			pReader->index.pBlockEntries	= malloc(sbgMax(nrBlockEntries, 1u) * sizeof(SbgEComCaptureIndexEntry));
+			pReader->index.pLogEntries		= malloc(sbgMax(nrLogEntries, 1u) * sizeof(SbgEComCaptureIndexEntry));
+
+			if (pReader->index.pBlockEntries && pReader->index.pLogEntries)
+			{
+				pReader->index.nrBlockEntries		= nrBlockEntries;
+				pReader->index.blockEntriesCapacity	= nrBlockEntries;
+				pReader->index.nrLogEntries			= nrLogEntries;
+				pReader->index.logEntriesCapacity	= nrLogEntries;
+				pReader->recordsEndOffset			= (size_t)indexOffset;
+
+				sbgStreamBufferInitForRead(&inputStream, pBuffer + indexOffset, size - (size_t)indexOffset - SBG_ECOM_CAPTURE_TRAILER_SIZE);
+
+				sbgEComCaptureReadEntries(&inputStream, pReader->index.pBlockEntries, nrBlockEntries);
+				errorCode = sbgEComCaptureReadEntries(&inputStream, pReader->index.pLogEntries, nrLogEntries);
+			}
+			else
+			{
+				errorCode = SBG_MALLOC_FAILED;
+				SBG_LOG_ERROR(errorCode, "unable to allocate the capture index");
+			}
+		}
+		else
+		{
+			errorCode = SBG_NOT_READY;
+			SBG_LOG_WARNING(errorCode, "invalid capture trailer");
+		}
+	}
+	else
+	{
+		errorCode = SBG_NOT_READY;
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Rebuild the index of a capture by walking through all records.
+ *
+ * The records walk stops at the first truncated record.
+ *
+ * \param[in]	pReader						Capture reader.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComCaptureReaderRebuildIndex(SbgEComCaptureReader *pReader)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+	const uint8_t				*pBuffer;
+	SbgEComCaptureRecordHeader	 header;
+	size_t						 offset;
+
+	assert(pReader);
+
+	pBuffer							= sbgFileMapGetBuffer(&pReader->fileMap);
+	pReader->recordsEndOffset		= sbgFileMapGetSize(&pReader->fileMap);
+	offset							= SBG_ECOM_CAPTURE_HEADER_SIZE;
+
+	while ((errorCode == SBG_NO_ERROR) && (sbgEComCaptureReaderReadRecordHeader(pReader, offset, &header) == SBG_NO_ERROR))
+	{
+		if (header.type == SBG_ECOM_CAPTURE_RECORD_LOG)
+		{
+			errorCode = sbgEComCaptureIndexAddLog(&pReader->index, offset, header.hostTimeUs, (SbgEComClass)header.msgClass, (SbgEComMsgId)header.msgId, pBuffer + offset + SBG_ECOM_CAPTURE_RECORD_HEADER_SIZE, header.size);
+
+			if (sbgEComCaptureIndexIsBlockComplete(&pReader->index))
+			{
+				sbgEComCaptureIndexStartBlock(&pReader->index);
+			}
+		}
+		else if (header.type != SBG_ECOM_CAPTURE_RECORD_INDEX)
+		{
+			SBG_LOG_WARNING(SBG_INVALID_FRAME, "invalid capture record type %" PRIu8 " at offset %zu", header.type, offset);
+			break;
+		}
+
+		offset += SBG_ECOM_CAPTURE_RECORD_HEADER_SIZE + header.size;
+	}
+
+	//
+	// Ignore any truncated or invalid record
+	//
+	pReader->recordsEndOffset	= offset;
+	pReader->indexRebuilt		= true;
+
+	sbgEComCaptureIndexSort(&pReader->index);
+
+	return errorCode;
+}
+
+/*!
+ * Find the first log at or after a given time, starting from an index entry.
+ *
+ * \param[in]	pReader						Capture reader.
+ * \param[in]	pEntry						Index entry to start from.
+ * \param[in]	timeBase					Time base.
+ * \param[in]	time						Time in us.
+ * \param[in]	anyLog						True to find any log, false to only find logs of the entry type.
+ * \param[out]	pOffset						Offset of the found log.
+ * \return									SBG_NO_ERROR if a log has been found, SBG_NOT_READY otherwise.
+ */
+static SbgErrorCode sbgEComCaptureReaderScan(const SbgEComCaptureReader *pReader, const SbgEComCaptureIndexEntry *pEntry, SbgEComCaptureTimeBase timeBase, int64_t time, bool anyLog, size_t *pOffset)
+{
+	SbgErrorCode				errorCode;
+	SbgEComCaptureTimeTracker	timeTracker;
+	SbgEComCaptureFrame			frame;
+	size_t						offset;
+	int64_t						frameTime;
+
+	assert(pReader);
+	assert(pEntry);
+	assert(pOffset);
+
+	sbgEComCaptureTimeTrackerConstructFromEntry(&timeTracker, pEntry);
+	offset = (size_t)pEntry->offset;
+
+	//
+	// The entry log is processed again by the time tracker, which doesn't change its state
+	//
+	while ((errorCode = sbgEComCaptureReaderReadFrame(pReader, &offset, &frame)) == SBG_NO_ERROR)
+	{
+		sbgEComCaptureTimeTrackerProcess(&timeTracker, frame.msgClass, frame.msgId, frame.pPayload, frame.payloadSize);
+
+		if (anyLog || ((frame.msgClass == pEntry->msgClass) && (frame.msgId == pEntry->msgId)))
+		{
+			if (sbgEComCaptureTimeTrackerGetTime(&timeTracker, timeBase, frame.hostTimeUs, &frameTime) && (frameTime >= time))
+			{
+				*pOffset = frame.offset;
+				break;
+			}
+		}
+	}
+
+	return errorCode;
+}
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+int64_t sbgEComCaptureMakeUtcTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second, uint32_t nanoSecond)
+{
+	int64_t		y;
+	int64_t		era;
+	int64_t		yearOfEra;
+	int64_t		dayOfYear;
+	int64_t		dayOfEra;
+	int64_t		days;
+
+	//
+	// Convert the civil date to a number of days since 1970-01-01
+	//
+	y			= (int64_t)year - ((month <= 2) ? 1 : 0);
+	era			= ((y >= 0) ? y : (y - 399)) / 400;
+	yearOfEra	= y - era * 400;
+	dayOfYear	= (153 * (month + ((month > 2) ? -3 : 9)) + 2) / 5 + day - 1;
+	dayOfEra	= yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+	days		= era * 146097 + dayOfEra - 719468;
+
+	return ((days * 86400 + hour * 3600 + minute * 60 + second) * 1000000) + (nanoSecond / 1000);
+}
+
+void sbgEComCaptureTimeTrackerConstruct(SbgEComCaptureTimeTracker *pTimeTracker)
+{
+	assert(pTimeTracker);
+
+	memset(pTimeTracker, 0, sizeof(*pTimeTracker));
+}
+
+void sbgEComCaptureTimeTrackerProcess(SbgEComCaptureTimeTracker *pTimeTracker, SbgEComClass msgClass, SbgEComMsgId msgId, const void *pPayload, size_t payloadSize)
+{
+	SbgStreamBuffer		inputStream;
+	SbgLogUtcData		utcData;
+	uint32_t			timeStamp;
+
+	assert(pTimeTracker);
+	assert(pPayload || (payloadSize == 0));
+
+	if (sbgEComCaptureLogHasTimeStamp(msgClass, msgId) && (payloadSize >= sizeof(uint32_t)))
+	{
+		sbgStreamBufferInitForRead(&inputStream, pPayload, payloadSize);
+		timeStamp = sbgStreamBufferReadUint32LE(&inputStream);
+
+		//
+		// Logs are not strictly ordered by time stamp, a signed difference handles both
+		// late logs and the 32 bits time stamp wrap around
+		//
+		if (pTimeTracker->deviceTimeValid)
+		{
+			pTimeTracker->deviceTimeUs += (int32_t)(timeStamp - pTimeTracker->lastTimeStamp);
+		}
+		else
+		{
+			pTimeTracker->deviceTimeUs		= timeStamp;
+			pTimeTracker->deviceTimeValid	= true;
+		}
+
+		pTimeTracker->lastTimeStamp = timeStamp;
+
+		if ((msgClass == SBG_ECOM_CLASS_LOG_ECOM_0) && (msgId == SBG_ECOM_LOG_UTC_TIME))
+		{
+			sbgStreamBufferInitForRead(&inputStream, pPayload, payloadSize);
+
+			if (sbgEComBinaryLogParseUtcData(&inputStream, &utcData) == SBG_NO_ERROR)
+			{
+				if (sbgEComLogUtcGetClockUtcStatus(utcData.status) == SBG_ECOM_UTC_VALID)
+				{
+					pTimeTracker->utcRefTimeUs			= sbgEComCaptureMakeUtcTime(utcData.year, (uint8_t)utcData.month, (uint8_t)utcData.day, (uint8_t)utcData.hour, (uint8_t)utcData.minute, (uint8_t)utcData.second, (uint32_t)utcData.nanoSecond);
+					pTimeTracker->utcRefDeviceTimeUs	= pTimeTracker->deviceTimeUs;
+					pTimeTracker->utcTimeValid			= true;
+				}
+			}
+		}
+	}
+}
+
+bool sbgEComCaptureTimeTrackerGetTime(const SbgEComCaptureTimeTracker *pTimeTracker, SbgEComCaptureTimeBase timeBase, uint64_t hostTimeUs, int64_t *pTime)
+{
+	bool	valid;
+
+	assert(pTimeTracker);
+	assert(pTime);
+
+	switch (timeBase)
+	{
+	case SBG_ECOM_CAPTURE_TIME_HOST:
+		*pTime	= (int64_t)hostTimeUs;
+		valid	= true;
+		break;
+	case SBG_ECOM_CAPTURE_TIME_DEVICE:
+		*pTime	= pTimeTracker->deviceTimeUs;
+		valid	= pTimeTracker->deviceTimeValid;
+		break;
+	case SBG_ECOM_CAPTURE_TIME_UTC:
+		*pTime	= pTimeTracker->utcRefTimeUs + (pTimeTracker->deviceTimeUs - pTimeTracker->utcRefDeviceTimeUs);
+		valid	= pTimeTracker->utcTimeValid;
+		break;
+	default:
+		*pTime	= 0;
+		valid	= false;
+	}
+
+	return valid;
+}
+
+SbgErrorCode sbgEComCaptureWriterOpen(SbgEComCaptureWriter *pWriter, const char *pPath, uint32_t blockSize)
+{
+	SbgErrorCode		errorCode = SBG_NO_ERROR;
+	uint8_t				buffer[SBG_ECOM_CAPTURE_HEADER_SIZE];
+	SbgStreamBuffer		outputStream;
+
+	assert(pWriter);
+	assert(pPath);
+
+	if (blockSize == 0)
+	{
+		blockSize = SBG_ECOM_CAPTURE_DEFAULT_BLOCK_SIZE;
+	}
+
+	pWriter->offset	= 0;
+	pWriter->pFile	= fopen(pPath, "wb");
+
+	if (pWriter->pFile)
+	{
+		sbgEComCaptureIndexConstruct(&pWriter->index, blockSize);
+
+		sbgStreamBufferInitForWrite(&outputStream, buffer, sizeof(buffer));
+
+		sbgStreamBufferWriteBuffer(&outputStream, SBG_ECOM_CAPTURE_HEADER_MAGIC, SBG_ECOM_CAPTURE_MAGIC_SIZE);
+		sbgStreamBufferWriteUint32LE(&outputStream, SBG_ECOM_CAPTURE_VERSION);
+		sbgStreamBufferWriteUint32LE(&outputStream, blockSize);
+		sbgStreamBufferWriteUint64LE(&outputStream, 0);
+		sbgStreamBufferWriteUint64LE(&outputStream, 0);
+
+		assert(sbgStreamBufferGetLastError(&outputStream) == SBG_NO_ERROR);
+
+		errorCode = sbgEComCaptureWriterWrite(pWriter, buffer, sizeof(buffer));
+
+		if (errorCode != SBG_NO_ERROR)
+		{
+			fclose(pWriter->pFile);
+			pWriter->pFile = NULL;
+			sbgEComCaptureIndexDestroy(&pWriter->index);
+		}
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+		SBG_LOG_ERROR(errorCode, "unable to open capture file %s", pPath);
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComCaptureWriterClose(SbgEComCaptureWriter *pWriter)
+{
+	SbgErrorCode		errorCode = SBG_NO_ERROR;
+	uint8_t				buffer[SBG_ECOM_CAPTURE_TRAILER_SIZE];
+	SbgStreamBuffer		outputStream;
+	uint64_t			indexOffset;
+
+	assert(pWriter);
+	assert(pWriter->pFile);
+
+	if (pWriter->index.nrBlockLogs > 0)
+	{
+		errorCode = sbgEComCaptureWriterWriteIndexBlock(pWriter);
+	}
+
+	//
+	// Write the consolidated index followed by the trailer
+	//
+	if (errorCode == SBG_NO_ERROR)
+	{
+		sbgEComCaptureIndexSort(&pWriter->index);
+
+		indexOffset = pWriter->offset;
+		errorCode = sbgEComCaptureWriterWriteEntries(pWriter, pWriter->index.pBlockEntries, pWriter->index.nrBlockEntries);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			errorCode = sbgEComCaptureWriterWriteEntries(pWriter, pWriter->index.pLogEntries, pWriter->index.nrLogEntries);
+		}
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			sbgStreamBufferInitForWrite(&outputStream, buffer, sizeof(buffer));
+
+			sbgStreamBufferWriteUint64LE(&outputStream, indexOffset);
+			sbgStreamBufferWriteUint32LE(&outputStream, (uint32_t)pWriter->index.nrBlockEntries);
+			sbgStreamBufferWriteUint32LE(&outputStream, (uint32_t)pWriter->index.nrLogEntries);
+			sbgStreamBufferWriteBuffer(&outputStream, SBG_ECOM_CAPTURE_TRAILER_MAGIC, SBG_ECOM_CAPTURE_MAGIC_SIZE);
+
+			assert(sbgStreamBufferGetLastError(&outputStream) == SBG_NO_ERROR);
+
+			errorCode = sbgEComCaptureWriterWrite(pWriter, buffer, sizeof(buffer));
+		}
+	}
+
+	if (fclose(pWriter->pFile) != 0)
+	{
+		errorCode = SBG_WRITE_ERROR;
+		SBG_LOG_ERROR(errorCode, "unable to close capture file");
+	}
+
+	pWriter->pFile = NULL;
+	sbgEComCaptureIndexDestroy(&pWriter->index);
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComCaptureWriterWriteFrame(SbgEComCaptureWriter *pWriter, uint64_t hostTimeUs, SbgEComClass msgClass, SbgEComMsgId msgId, const void *pPayload, size_t payloadSize)
+{
+	SbgErrorCode				errorCode;
+	SbgEComCaptureRecordHeader	header;
+	uint64_t					offset;
+
+	assert(pWriter);
+	assert(pWriter->pFile);
+	assert(pPayload || (payloadSize == 0));
+	assert(payloadSize <= UINT32_MAX);
+
+	offset = pWriter->offset;
+
+	header.size			= (uint32_t)payloadSize;
+	header.type			= SBG_ECOM_CAPTURE_RECORD_LOG;
+	header.msgClass		= (uint8_t)msgClass;
+	header.msgId		= (uint8_t)msgId;
+	header.hostTimeUs	= hostTimeUs;
+
+	errorCode = sbgEComCaptureWriterWriteRecordHeader(pWriter, &header);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		errorCode = sbgEComCaptureWriterWrite(pWriter, pPayload, payloadSize);
+	}
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		errorCode = sbgEComCaptureIndexAddLog(&pWriter->index, offset, hostTimeUs, msgClass, msgId, pPayload, payloadSize);
+	}
+
+	if ((errorCode == SBG_NO_ERROR) && sbgEComCaptureIndexIsBlockComplete(&pWriter->index))
+	{
+		errorCode = sbgEComCaptureWriterWriteIndexBlock(pWriter);
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComCaptureWriterOnLogPayload(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const void *pPayload, size_t payloadSize, void *pUserArg)
+{
+	assert(pUserArg);
+
+	SBG_UNUSED_PARAMETER(pHandle);
+
+	return sbgEComCaptureWriterWriteFrame((SbgEComCaptureWriter*)pUserArg, sbgGetTimeInUs(), msgClass, msg, pPayload, payloadSize);
+}
+
+SbgErrorCode sbgEComCaptureReaderOpen(SbgEComCaptureReader *pReader, const char *pPath)
+{
+	SbgErrorCode		 errorCode;
+	const uint8_t		*pBuffer;
+	SbgStreamBuffer		 inputStream;
+	uint32_t			 version;
+	uint32_t			 blockSize = 0;
+
+	assert(pReader);
+	assert(pPath);
+
+	memset(pReader, 0, sizeof(*pReader));
+
+	errorCode = sbgFileMapOpen(&pReader->fileMap, pPath);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		pBuffer = sbgFileMapGetBuffer(&pReader->fileMap);
+
+		if ((sbgFileMapGetSize(&pReader->fileMap) >= SBG_ECOM_CAPTURE_HEADER_SIZE) && (memcmp(pBuffer, SBG_ECOM_CAPTURE_HEADER_MAGIC, SBG_ECOM_CAPTURE_MAGIC_SIZE) == 0))
+		{
+			sbgStreamBufferInitForRead(&inputStream, pBuffer + SBG_ECOM_CAPTURE_MAGIC_SIZE, SBG_ECOM_CAPTURE_HEADER_SIZE - SBG_ECOM_CAPTURE_MAGIC_SIZE);
+
+			version		= sbgStreamBufferReadUint32LE(&inputStream);
+			blockSize	= sbgStreamBufferReadUint32LE(&inputStream);
+
+			if ((version != SBG_ECOM_CAPTURE_VERSION) || (blockSize == 0))
+			{
+				errorCode = SBG_INVALID_VERSION;
+				SBG_LOG_ERROR(errorCode, "unsupported capture version %" PRIu32, version);
+			}
+		}
+		else
+		{
+			errorCode = SBG_INVALID_FRAME;
+			SBG_LOG_ERROR(errorCode, "%s is not a capture file", pPath);
+		}
+	}
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		sbgEComCaptureIndexConstruct(&pReader->index, blockSize);
+
+		errorCode = sbgEComCaptureReaderLoadIndex(pReader);
+
+		if (errorCode == SBG_NOT_READY)
+		{
+			SBG_LOG_WARNING(errorCode, "capture %s has no index, rebuilding it", pPath);
+
+			sbgEComCaptureIndexDestroy(&pReader->index);
+			sbgEComCaptureIndexConstruct(&pReader->index, blockSize);
+
+			errorCode = sbgEComCaptureReaderRebuildIndex(pReader);
+		}
+
+		if (errorCode != SBG_NO_ERROR)
+		{
+			sbgEComCaptureIndexDestroy(&pReader->index);
+		}
+	}
+
+	if (errorCode != SBG_NO_ERROR)
+	{
+		sbgFileMapClose(&pReader->fileMap);
+	}
+
+	return errorCode;
+}
+
+void sbgEComCaptureReaderClose(SbgEComCaptureReader *pReader)
+{
+	assert(pReader);
+
+	sbgEComCaptureIndexDestroy(&pReader->index);
+	sbgFileMapClose(&pReader->fileMap);
+}
+
+SbgErrorCode sbgEComCaptureReaderReadFrame(const SbgEComCaptureReader *pReader, size_t *pOffset, SbgEComCaptureFrame *pFrame)
+{
+	SbgErrorCode				errorCode;
+	SbgEComCaptureRecordHeader	header;
+
+	assert(pReader);
+	assert(pOffset);
+	assert(pFrame);
+
+	//
+	// Skip index blocks
+	//
+	while ((errorCode = sbgEComCaptureReaderReadRecordHeader(pReader, *pOffset, &header)) == SBG_NO_ERROR)
+	{
+		if (header.type == SBG_ECOM_CAPTURE_RECORD_LOG)
+		{
+			pFrame->offset		= *pOffset;
+			pFrame->hostTimeUs	= header.hostTimeUs;
+			pFrame->msgClass	= (SbgEComClass)header.msgClass;
+			pFrame->msgId		= (SbgEComMsgId)header.msgId;
+			pFrame->pPayload	= sbgFileMapGetBuffer(&pReader->fileMap) + *pOffset + SBG_ECOM_CAPTURE_RECORD_HEADER_SIZE;
+			pFrame->payloadSize	= header.size;
+
+			*pOffset += SBG_ECOM_CAPTURE_RECORD_HEADER_SIZE + header.size;
+			break;
+		}
+		else if (header.type == SBG_ECOM_CAPTURE_RECORD_INDEX)
+		{
+			*pOffset += SBG_ECOM_CAPTURE_RECORD_HEADER_SIZE + header.size;
+		}
+		else
+		{
+			errorCode = SBG_INVALID_FRAME;
+			SBG_LOG_ERROR(errorCode, "invalid capture record type %" PRIu8 " at offset %zu", header.type, *pOffset);
+			break;
+		}
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComCaptureReaderSeek(const SbgEComCaptureReader *pReader, SbgEComCaptureTimeBase timeBase, int64_t time, size_t *pOffset)
+{
+	SbgErrorCode	errorCode;
+	size_t			entryIndex;
+
+	assert(pReader);
+	assert(pOffset);
+
+	if (pReader->index.nrBlockEntries > 0)
+	{
+		entryIndex	= sbgEComCaptureIndexFindEntry(pReader->index.pBlockEntries, pReader->index.nrBlockEntries, timeBase, time);
+		errorCode	= sbgEComCaptureReaderScan(pReader, &pReader->index.pBlockEntries[entryIndex], timeBase, time, true, pOffset);
+	}
+	else
+	{
+		errorCode = SBG_NOT_READY;
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComCaptureReaderSeekLog(const SbgEComCaptureReader *pReader, SbgEComCaptureTimeBase timeBase, int64_t time, SbgEComClass msgClass, SbgEComMsgId msgId, size_t *pOffset)
+{
+	SbgErrorCode				 errorCode;
+	SbgEComCaptureIndexEntry	 key;
+	size_t						 first;
+	size_t						 last;
+	size_t						 entryIndex;
+
+	assert(pReader);
+	assert(pOffset);
+
+	//
+	// Find the range of entries of the requested log type
+	//
+	key.msgClass	= (uint8_t)msgClass;
+	key.msgId		= (uint8_t)msgId;
+
+	key.offset		= 0;
+	first			= sbgEComCaptureIndexLowerBound(pReader->index.pLogEntries, pReader->index.nrLogEntries, &key);
+
+	key.offset		= UINT64_MAX;
+	last			= sbgEComCaptureIndexLowerBound(pReader->index.pLogEntries, pReader->index.nrLogEntries, &key);
+
+	if (last > first)
+	{
+		entryIndex	= first + sbgEComCaptureIndexFindEntry(&pReader->index.pLogEntries[first], last - first, timeBase, time);
+		errorCode	= sbgEComCaptureReaderScan(pReader, &pReader->index.pLogEntries[entryIndex], timeBase, time, false, pOffset);
+	}
+	else
+	{
+		errorCode = SBG_NOT_READY;
+	}
+
+	return errorCode;
+}
@@ -0,0 +1,365 @@
+﻿/*!
+ * \file			sbgEComCapture.h
+ * \author			SBG Systems
+ * \date			19 October 2026
+ *
+ * \brief			Indexed capture files of received sbgECom logs.
+ *
+ *				A capture file stores received logs along with their host reception time.
+ *				Index blocks are periodically inserted to map the host time, device time
+ *				stamp, UTC time and message type to the file offset of logs. A consolidated
+ *				index is written when the capture is closed so a reader can seek in
+ *				O(log n) and access frames without any copy from a memory mapped file.
+ *
+ *				All values are stored in little endian. The file layout is:
+ *				  - A 32 bytes file header: magic, version and index block size.
+ *				  - Records made of a 16 bytes header (payload size, record type, message
+ *				    class, message id, host time) followed by the payload. A record is
+ *				    either a received log or an index block.
+ *				  - The consolidated index: all block entries sorted by offset, followed
+ *				    by all log entries sorted by message class, message id and offset.
+ *				  - A 24 bytes trailer: index offset, number of block and log entries
+ *				    and trailer magic.
+ *
+ *				If the capture hasn't been closed properly, the trailer is missing and the
+ *				reader rebuilds the index by walking through all records.
+ *
+ * \copyright		Copyright (C) 2022, SBG Systems SAS. All rights reserved.
+ * \beginlicense	The MIT license
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * \endlicense
+ */
+
+#ifndef SBG_ECOM_CAPTURE_H
+#define SBG_ECOM_CAPTURE_H
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <fileMap/sbgFileMap.h>
+
+// Project headers
+#include <sbgECom.h>
+#include <sbgEComIds.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Capture file format version.
+ */
+#define SBG_ECOM_CAPTURE_VERSION						(1)
+
+/*!
+ * Default number of logs per index block.
+ */
+#define SBG_ECOM_CAPTURE_DEFAULT_BLOCK_SIZE				(1024)
+
+/*!
+ * Sizes in bytes of the capture file elements.
+ */
+#define SBG_ECOM_CAPTURE_HEADER_SIZE					(32)
+#define SBG_ECOM_CAPTURE_RECORD_HEADER_SIZE				(16)
+#define SBG_ECOM_CAPTURE_INDEX_ENTRY_SIZE				(40)
+#define SBG_ECOM_CAPTURE_TRAILER_SIZE					(24)
+
+/*!
+ * Index entry flags.
+ */
+#define SBG_ECOM_CAPTURE_ENTRY_DEVICE_TIME_VALID		(0x0001u << 0)		/*!< Set if the device time is valid. */
+#define SBG_ECOM_CAPTURE_ENTRY_UTC_TIME_VALID			(0x0001u << 1)		/*!< Set if the UTC time is valid. */
+
+//----------------------------------------------------------------------//
+//- Enum definitions                                                   -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Time bases used to seek in a capture.
+ */
+typedef enum _SbgEComCaptureTimeBase
+{
+	SBG_ECOM_CAPTURE_TIME_HOST		= 0,						/*!< Host reception time in us. */
+	SBG_ECOM_CAPTURE_TIME_DEVICE	= 1,						/*!< Device time stamp in us, extended to 64 bits to handle wrap arounds. */
+	SBG_ECOM_CAPTURE_TIME_UTC		= 2							/*!< UTC time in us since 1970-01-01, derived from the SBG_ECOM_LOG_UTC_TIME logs. */
+} SbgEComCaptureTimeBase;
+
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Tracks the device and UTC time of received logs.
+ *
+ * Device time stamps are extended to 64 bits and the UTC time of each log is
+ * derived from the latest valid SBG_ECOM_LOG_UTC_TIME log.
+ */
+typedef struct _SbgEComCaptureTimeTracker
+{
+	bool						 deviceTimeValid;			/*!< True if a device time stamp has been received. */
+	uint32_t					 lastTimeStamp;				/*!< Last received device time stamp in us. */
+	int64_t						 deviceTimeUs;				/*!< Extended device time in us. */
+	bool						 utcTimeValid;				/*!< True if a valid UTC time has been received. */
+	int64_t						 utcRefDeviceTimeUs;		/*!< Extended device time of the UTC reference in us. */
+	int64_t						 utcRefTimeUs;				/*!< UTC reference time in us since 1970-01-01. */
+} SbgEComCaptureTimeTracker;
+
+/*!
+ * Capture index entry.
+ */
+typedef struct _SbgEComCaptureIndexEntry
+{
+	uint64_t					 offset;					/*!< Offset of the log record in the capture file. */
+	uint64_t					 hostTimeUs;				/*!< Host reception time in us. */
+	int64_t						 deviceTimeUs;				/*!< Extended device time in us. */
+	int64_t						 utcTimeUs;					/*!< UTC time in us since 1970-01-01. */
+	uint8_t						 msgClass;					/*!< Log message class. */
+	uint8_t						 msgId;						/*!< Log message id. */
+	uint16_t					 flags;						/*!< Entry flags, see SBG_ECOM_CAPTURE_ENTRY_*. */
+} SbgEComCaptureIndexEntry;
+
+/*!
+ * Capture index.
+ *
+ * A block entry references the first log of each index block. Within each block,
+ * a log entry references the first log of each message type.
+ */
+typedef struct _SbgEComCaptureIndex
+{
+	SbgEComCaptureIndexEntry	*pBlockEntries;				/*!< Block entries. */
+	size_t						 nrBlockEntries;			/*!< Number of block entries. */
+	size_t						 blockEntriesCapacity;		/*!< Allocated number of block entries. */
+	SbgEComCaptureIndexEntry	*pLogEntries;				/*!< Log entries. */
+	size_t						 nrLogEntries;				/*!< Number of log entries. */
+	size_t						 logEntriesCapacity;		/*!< Allocated number of log entries. */
+	size_t						 blockFirstLogEntry;		/*!< Index of the first log entry of the current block. */
+	uint32_t					 blockSize;					/*!< Number of logs per block. */
+	uint32_t					 nrBlockLogs;				/*!< Number of logs in the current block. */
+	SbgEComCaptureTimeTracker	 timeTracker;				/*!< Time tracker. */
+} SbgEComCaptureIndex;
+
+/*!
+ * Capture writer.
+ */
+typedef struct _SbgEComCaptureWriter
+{
+	FILE						*pFile;						/*!< Capture file. */
+	uint64_t					 offset;					/*!< Current offset in the capture file. */
+	SbgEComCaptureIndex			 index;						/*!< Capture index. */
+} SbgEComCaptureWriter;
+
+/*!
+ * Capture reader.
+ */
+typedef struct _SbgEComCaptureReader
+{
+	SbgFileMap					 fileMap;					/*!< Capture file map. */
+	size_t						 recordsEndOffset;			/*!< Offset of the end of the records. */
+	bool						 indexRebuilt;				/*!< True if the index has been rebuilt because the trailer is missing. */
+	SbgEComCaptureIndex			 index;						/*!< Capture index. */
+} SbgEComCaptureReader;
+
+/*!
+ * Log read from a capture.
+ *
+ * The payload directly references the memory mapped capture file.
+ */
+typedef struct _SbgEComCaptureFrame
+{
+	size_t						 offset;					/*!< Offset of the log record in the capture file. */
+	uint64_t					 hostTimeUs;				/*!< Host reception time in us. */
+	SbgEComClass				 msgClass;					/*!< Log message class. */
+	SbgEComMsgId				 msgId;						/*!< Log message id. */
+	const void					*pPayload;					/*!< Log payload. */
+	size_t						 payloadSize;				/*!< Log payload size in bytes. */
+} SbgEComCaptureFrame;
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Convert a UTC date and time to a number of us since 1970-01-01.
+ *
+ * \param[in]	year						Year.
+ * \param[in]	month						Month in year [1 .. 12].
+ * \param[in]	day							Day in month [1 .. 31].
+ * \param[in]	hour						Hour in day [0 .. 23].
+ * \param[in]	minute						Minute in hour [0 .. 59].
+ * \param[in]	second						Second in minute [0 .. 60].
+ * \param[in]	nanoSecond					Nanosecond of the second.
+ * \return									UTC time in us since 1970-01-01.
+ */
+int64_t sbgEComCaptureMakeUtcTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second, uint32_t nanoSecond);
+
+/*!
+ * Initialize a time tracker.
+ *
+ * \param[out]	pTimeTracker				Time tracker.
+ */
+void sbgEComCaptureTimeTrackerConstruct(SbgEComCaptureTimeTracker *pTimeTracker);
+
+/*!
+ * Update a time tracker with a received log.
+ *
+ * \param[in]	pTimeTracker				Time tracker.
+ * \param[in]	msgClass					Log message class.
+ * \param[in]	msgId						Log message id.
+ * \param[in]	pPayload					Log payload.
+ * \param[in]	payloadSize					Log payload size in bytes.
+ */
+void sbgEComCaptureTimeTrackerProcess(SbgEComCaptureTimeTracker *pTimeTracker, SbgEComClass msgClass, SbgEComMsgId msgId, const void *pPayload, size_t payloadSize);
+
+/*!
+ * Returns the time of the last processed log in a given time base.
+ *
+ * \param[in]	pTimeTracker				Time tracker.
+ * \param[in]	timeBase					Time base.
+ * \param[in]	hostTimeUs					Host reception time of the last processed log in us.
+ * \param[out]	pTime						Time in us.
+ * \return									True if the time is valid.
+ */
+bool sbgEComCaptureTimeTrackerGetTime(const SbgEComCaptureTimeTracker *pTimeTracker, SbgEComCaptureTimeBase timeBase, uint64_t hostTimeUs, int64_t *pTime);
+
+/*!
+ * Open a capture file for writing.
+ *
+ * \param[out]	pWriter						Capture writer.
+ * \param[in]	pPath						Capture file path.
+ * \param[in]	blockSize					Number of logs per index block, 0 for SBG_ECOM_CAPTURE_DEFAULT_BLOCK_SIZE.
+ * \return									SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComCaptureWriterOpen(SbgEComCaptureWriter *pWriter, const char *pPath, uint32_t blockSize);
+
+/*!
+ * Write the index and close a capture file.
+ *
+ * \param[in]	pWriter						Capture writer.
+ * \return									SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComCaptureWriterClose(SbgEComCaptureWriter *pWriter);
+
+/*!
+ * Write a received log to a capture.
+ *
+ * \param[in]	pWriter						Capture writer.
+ * \param[in]	hostTimeUs					Host reception time in us.
+ * \param[in]	msgClass					Log message class.
+ * \param[in]	msgId						Log message id.
+ * \param[in]	pPayload					Log payload.
+ * \param[in]	payloadSize					Log payload size in bytes.
+ * \return									SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComCaptureWriterWriteFrame(SbgEComCaptureWriter *pWriter, uint64_t hostTimeUs, SbgEComClass msgClass, SbgEComMsgId msgId, const void *pPayload, size_t payloadSize);
+
+/*!
+ * Receive log payload callback writing each received log to a capture.
+ *
+ * Use it with sbgEComSetReceiveLogPayloadCallback() and a capture writer as user argument.
+ * The host reception time is given by sbgGetTimeInUs(). Logs received while a command is in
+ * progress are captured as well.
+ *
+ * \param[in]	pHandle						sbgECom handle.
+ * \param[in]	msgClass					Log message class.
+ * \param[in]	msg							Log message id.
+ * \param[in]	pPayload					Log payload.
+ * \param[in]	payloadSize					Log payload size in bytes.
+ * \param[in]	pUserArg					Capture writer.
+ * \return									SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComCaptureWriterOnLogPayload(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const void *pPayload, size_t payloadSize, void *pUserArg);
+
+/*!
+ * Open a capture file for reading.
+ *
+ * The file is memory mapped. If the index trailer is missing, the index is rebuilt.
+ *
+ * \param[out]	pReader						Capture reader.
+ * \param[in]	pPath						Capture file path.
+ * \return									SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComCaptureReaderOpen(SbgEComCaptureReader *pReader, const char *pPath);
+
+/*!
+ * Close a capture file.
+ *
+ * \param[in]	pReader						Capture reader.
+ */
+void sbgEComCaptureReaderClose(SbgEComCaptureReader *pReader);
+
+/*!
+ * Returns the offset of the first record of a capture.
+ *
+ * \param[in]	pReader						Capture reader.
+ * \return									Offset of the first record.
+ */
+SBG_INLINE size_t sbgEComCaptureReaderGetFirstOffset(const SbgEComCaptureReader *pReader)
+{
+	assert(pReader);
+
+	return SBG_ECOM_CAPTURE_HEADER_SIZE;
+}
+
+/*!
+ * Read a log from a capture.
+ *
+ * Index blocks are skipped. The returned payload references the capture file and
+ * remains valid until the reader is closed.
+ *
+ * \param[in]	pReader						Capture reader.
+ * \param[in,out]	pOffset					Offset of the record to read, updated with the offset of the next record.
+ * \param[out]	pFrame						Read log.
+ * \return									SBG_NO_ERROR if a log has been read, SBG_NOT_READY at the end of the capture.
+ */
+SbgErrorCode sbgEComCaptureReaderReadFrame(const SbgEComCaptureReader *pReader, size_t *pOffset, SbgEComCaptureFrame *pFrame);
+
+/*!
+ * Find the first log at or after a given time.
+ *
+ * \param[in]	pReader						Capture reader.
+ * \param[in]	timeBase					Time base.
+ * \param[in]	time						Time in us in the given time base.
+ * \param[out]	pOffset						Offset of the found log.
+ * \return									SBG_NO_ERROR if a log has been found, SBG_NOT_READY otherwise.
+ */
+SbgErrorCode sbgEComCaptureReaderSeek(const SbgEComCaptureReader *pReader, SbgEComCaptureTimeBase timeBase, int64_t time, size_t *pOffset);
+
+/*!
+ * Find the first log of a given type at or after a given time.
+ *
+ * \param[in]	pReader						Capture reader.
+ * \param[in]	timeBase					Time base.
+ * \param[in]	time						Time in us in the given time base.
+ * \param[in]	msgClass					Log message class.
+ * \param[in]	msgId						Log message id.
+ * \param[out]	pOffset						Offset of the found log.
+ * \return									SBG_NO_ERROR if a log has been found, SBG_NOT_READY otherwise.
+ */
+SbgErrorCode sbgEComCaptureReaderSeekLog(const SbgEComCaptureReader *pReader, SbgEComCaptureTimeBase timeBase, int64_t time, SbgEComClass msgClass, SbgEComMsgId msgId, size_t *pOffset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_ECOM_CAPTURE_H
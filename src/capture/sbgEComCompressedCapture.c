@@ -0,0 +1,1155 @@
+﻿// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <crc/sbgCrc.h>
+#include <fileMap/sbgFileMap.h>
+#include <lz/sbgLz.h>
+#include <streamBuffer/sbgStreamBuffer.h>
+
+// Local headers
+#include "sbgEComCompressedCapture.h"
+
+//----------------------------------------------------------------------//
+//- Private definitions                                                -//
+//----------------------------------------------------------------------//
+
+/*!
+ * File header and block magics.
+ */
+#define SBG_ECOM_COMPRESSED_CAPTURE_HEADER_MAGIC		"SBGECCMP"
+#define SBG_ECOM_COMPRESSED_CAPTURE_MAGIC_SIZE			(8)
+#define SBG_ECOM_COMPRESSED_CAPTURE_BLOCK_MAGIC			(0x4b4c4253u)		/*!< "SBLK" read as a little endian 32 bits value. */
+
+/*!
+ * Maximum number of fields and total size of a log layout.
+ */
+#define SBG_ECOM_COMPRESSED_CAPTURE_MAX_FIELDS			(16)
+#define SBG_ECOM_COMPRESSED_CAPTURE_MAX_LAYOUT_SIZE		(80)
+
+/*!
+ * Maximum size of a varint encoded 64 bits value in bytes.
+ */
+#define SBG_ECOM_COMPRESSED_CAPTURE_VARINT_MAX_SIZE		(10)
+
+/*!
+ * Maximum control stream size of a frame in bytes.
+ *
+ * Class, id, host time, payload size and fields.
+ */
+#define SBG_ECOM_COMPRESSED_CAPTURE_MAX_FRAME_CONTROL_SIZE	(2 + (SBG_ECOM_COMPRESSED_CAPTURE_VARINT_MAX_SIZE * (2 + SBG_ECOM_COMPRESSED_CAPTURE_MAX_FIELDS)))
+
+/*!
+ * Number of log classes with known layouts, class ids are below this value.
+ */
+#define SBG_ECOM_COMPRESSED_CAPTURE_NR_CLASSES			(SBG_ECOM_CLASS_LOG_ECOM_1 + 1)
+
+/*!
+ * Payload layout of a log, as the sizes of its little endian fields.
+ *
+ * The first field is always the device time stamp.
+ */
+typedef struct _SbgEComCompressedCaptureLayout
+{
+	SbgEComClass					 msgClass;				/*!< Log message class. */
+	SbgEComMsgId					 msgId;					/*!< Log message id. */
+	const uint8_t					*pFieldSizes;			/*!< Field sizes in bytes. */
+	size_t							 nrFields;				/*!< Number of fields. */
+} SbgEComCompressedCaptureLayout;
+
+/*!
+ * Delta coding state of a log type.
+ */
+typedef struct _SbgEComCompressedCaptureLogState
+{
+	uint32_t						 generation;									/*!< Generation the state is valid for. */
+	uint32_t						 lastTimeStampDelta;							/*!< Difference between the last two time stamps. */
+	uint8_t							 lastPayload[SBG_ECOM_COMPRESSED_CAPTURE_MAX_LAYOUT_SIZE];	/*!< Encoded fields of the last log. */
+} SbgEComCompressedCaptureLogState;
+
+/*!
+ * Delta coding state.
+ *
+ * The state is reset at each block so blocks can be decoded independently, a generation
+ * counter avoids clearing all log states.
+ */
+struct _SbgEComCompressedCaptureCodec
+{
+	uint32_t								 generation;			/*!< Current generation, incremented at each block. */
+	uint64_t								 lastHostTimeUs;		/*!< Host time of the last frame of the block. */
+	const SbgEComCompressedCaptureLayout	*pLayouts[SBG_ECOM_COMPRESSED_CAPTURE_NR_CLASSES][256];	/*!< Layouts by class and message id, NULL if unknown. */
+	SbgEComCompressedCaptureLogState		 logStates[SBG_ECOM_COMPRESSED_CAPTURE_NR_CLASSES][256];	/*!< Delta coding states by class and message id. */
+};
+
+/*!
+ * Log layouts.
+ *
+ * Layouts only drive the delta coding, a layout that doesn't match a payload only reduces the compression ratio.
+ */
+static const uint8_t gStatusLayout[]		= { 4, 2, 2, 4, 4, 4, 2, 4 };
+static const uint8_t gUtcLayout[]			= { 4, 2, 2, 1, 1, 1, 1, 1, 4, 4 };
+static const uint8_t gImuDataLayout[]		= { 4, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 };
+static const uint8_t gMagLayout[]			= { 4, 2, 4, 4, 4, 4, 4, 4 };
+static const uint8_t gEkfEulerLayout[]		= { 4, 4, 4, 4, 4, 4, 4, 4 };
+static const uint8_t gEkfQuatLayout[]		= { 4, 4, 4, 4, 4, 4, 4, 4, 4 };
+static const uint8_t gEkfNavLayout[]		= { 4, 4, 4, 4, 4, 4, 4, 8, 8, 8, 4, 4, 4, 4, 4 };
+static const uint8_t gShipMotionLayout[]	= { 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 2 };
+static const uint8_t gGpsVelLayout[]		= { 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 };
+static const uint8_t gGpsPosLayout[]		= { 4, 4, 4, 8, 8, 8, 4, 4, 4, 4, 1, 2, 2 };
+static const uint8_t gGpsHdtLayout[]		= { 4, 2, 4, 4, 4, 4, 4, 4 };
+static const uint8_t gOdometerLayout[]		= { 4, 2, 4 };
+static const uint8_t gEventLayout[]			= { 4, 2, 2, 2, 2, 2 };
+static const uint8_t gAirDataLayout[]		= { 4, 2, 4, 4, 4, 4, 4 };
+static const uint8_t gDepthLayout[]			= { 4, 2, 4, 4 };
+static const uint8_t gImuShortLayout[]		= { 4, 2, 4, 4, 4, 4, 4, 4, 2 };
+static const uint8_t gFastImuLayout[]		= { 4, 2, 2, 2, 2, 2, 2, 2 };
+
+/*!
+ * Build a log layout.
+ */
+#define SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(msgClass, msgId, fieldSizes)	{ msgClass, msgId, fieldSizes, SBG_ARRAY_SIZE(fieldSizes) }
+
+/*!
+ * Known log layouts.
+ */
+static const SbgEComCompressedCaptureLayout gLayouts[] =
+{
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_STATUS,			gStatusLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_UTC_TIME,			gUtcLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_IMU_DATA,			gImuDataLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_MAG,				gMagLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EKF_EULER,			gEkfEulerLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EKF_QUAT,			gEkfQuatLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EKF_NAV,			gEkfNavLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_SHIP_MOTION,		gShipMotionLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_SHIP_MOTION_HP,	gShipMotionLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_GPS1_VEL,			gGpsVelLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_GPS1_POS,			gGpsPosLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_GPS1_HDT,			gGpsHdtLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_GPS2_VEL,			gGpsVelLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_GPS2_POS,			gGpsPosLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_GPS2_HDT,			gGpsHdtLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_ODO_VEL,			gOdometerLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EVENT_A,			gEventLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EVENT_B,			gEventLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EVENT_C,			gEventLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EVENT_D,			gEventLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EVENT_E,			gEventLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EVENT_OUT_A,		gEventLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EVENT_OUT_B,		gEventLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_AIR_DATA,			gAirDataLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_DEPTH,				gDepthLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_IMU_SHORT,			gImuShortLayout),
+	SBG_ECOM_COMPRESSED_CAPTURE_LAYOUT(SBG_ECOM_CLASS_LOG_ECOM_1,	SBG_ECOM_LOG_FAST_IMU_DATA,		gFastImuLayout),
+};
+
+//----------------------------------------------------------------------//
+//- Private methods (codec)                                            -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Allocate a delta coding state.
+ *
+ * \return									Delta coding state, NULL if it can't be allocated.
+ */
+static SbgEComCompressedCaptureCodec *sbgEComCompressedCaptureCodecCreate(void)
+{
+	SbgEComCompressedCaptureCodec	*pCodec;
+
+	pCodec = calloc(1, sizeof(*pCodec));
+
+	if (pCodec)
+	{
+		for (size_t i = 0; i < SBG_ARRAY_SIZE(gLayouts); i++)
+		{
+			assert(gLayouts[i].msgClass < SBG_ECOM_COMPRESSED_CAPTURE_NR_CLASSES);
+			assert(gLayouts[i].nrFields <= SBG_ECOM_COMPRESSED_CAPTURE_MAX_FIELDS);
+			assert(gLayouts[i].pFieldSizes[0] == sizeof(uint32_t));
+
+			pCodec->pLayouts[gLayouts[i].msgClass][gLayouts[i].msgId] = &gLayouts[i];
+		}
+
+		//
+		// Log states are only valid from generation 1
+		//
+		pCodec->generation = 1;
+	}
+	else
+	{
+		SBG_LOG_ERROR(SBG_MALLOC_FAILED, "unable to allocate codec");
+	}
+
+	return pCodec;
+}
+
+/*!
+ * Reset the delta coding state at the beginning of a block.
+ *
+ * \param[in]	pCodec						Delta coding state.
+ */
+static void sbgEComCompressedCaptureCodecReset(SbgEComCompressedCaptureCodec *pCodec)
+{
+	assert(pCodec);
+
+	pCodec->generation++;
+	pCodec->lastHostTimeUs = 0;
+}
+
+/*!
+ * Returns the layout and delta coding state of a log.
+ *
+ * \param[in]	pCodec						Delta coding state.
+ * \param[in]	msgClass					Log message class.
+ * \param[in]	msgId						Log message id.
+ * \param[in]	payloadSize					Log payload size in bytes.
+ * \param[out]	ppLogState					Log delta coding state.
+ * \param[out]	pNrFields					Number of fields fully contained in the payload.
+ * \return									Log layout, NULL if the log has no known layout.
+ */
+static const SbgEComCompressedCaptureLayout *sbgEComCompressedCaptureCodecGetLayout(SbgEComCompressedCaptureCodec *pCodec, uint8_t msgClass, uint8_t msgId, size_t payloadSize, SbgEComCompressedCaptureLogState **ppLogState, size_t *pNrFields)
+{
+	const SbgEComCompressedCaptureLayout	*pLayout = NULL;
+
+	assert(pCodec);
+	assert(ppLogState);
+	assert(pNrFields);
+
+	if ((msgClass < SBG_ECOM_COMPRESSED_CAPTURE_NR_CLASSES) && (payloadSize <= SBG_ECOM_MAX_PAYLOAD_SIZE))
+	{
+		pLayout = pCodec->pLayouts[msgClass][msgId];
+
+		if (pLayout)
+		{
+			SbgEComCompressedCaptureLogState	*pLogState = &pCodec->logStates[msgClass][msgId];
+			size_t								 size = 0;
+			size_t								 nrFields;
+
+			//
+			// Older firmwares send shorter logs, only code the fields in the payload
+			//
+			for (nrFields = 0; nrFields < pLayout->nrFields; nrFields++)
+			{
+				if ((size + pLayout->pFieldSizes[nrFields]) > payloadSize)
+				{
+					break;
+				}
+
+				size += pLayout->pFieldSizes[nrFields];
+			}
+
+			if (pLogState->generation != pCodec->generation)
+			{
+				pLogState->generation			= pCodec->generation;
+				pLogState->lastTimeStampDelta	= 0;
+				memset(pLogState->lastPayload, 0, sizeof(pLogState->lastPayload));
+			}
+
+			*ppLogState	= pLogState;
+			*pNrFields	= nrFields;
+		}
+	}
+
+	return pLayout;
+}
+
+/*!
+ * Read a little endian field.
+ *
+ * \param[in]	pBuffer						Field.
+ * \param[in]	size						Field size in bytes.
+ * \return									Field value.
+ */
+static uint64_t sbgEComCompressedCaptureReadField(const uint8_t *pBuffer, size_t size)
+{
+	uint64_t	value = 0;
+
+	assert(pBuffer);
+
+	for (size_t i = 0; i < size; i++)
+	{
+		value |= (uint64_t)pBuffer[i] << (i * 8);
+	}
+
+	return value;
+}
+
+/*!
+ * Write a little endian field.
+ *
+ * \param[out]	pBuffer						Field.
+ * \param[in]	size						Field size in bytes.
+ * \param[in]	value						Field value.
+ */
+static void sbgEComCompressedCaptureWriteField(uint8_t *pBuffer, size_t size, uint64_t value)
+{
+	assert(pBuffer);
+
+	for (size_t i = 0; i < size; i++)
+	{
+		pBuffer[i] = (uint8_t)(value >> (i * 8));
+	}
+}
+
+/*!
+ * Returns the mask of a field value.
+ *
+ * \param[in]	size						Field size in bytes.
+ * \return									Mask of the field bits.
+ */
+static uint64_t sbgEComCompressedCaptureGetFieldMask(size_t size)
+{
+	return (size >= sizeof(uint64_t)) ? UINT64_MAX : ((UINT64_C(1) << (size * 8)) - 1);
+}
+
+/*!
+ * Zigzag encode the difference between two field values.
+ *
+ * The difference is computed modulo the field size and interpreted as a signed value,
+ * so small positive and negative differences give small codes.
+ *
+ * \param[in]	delta						Difference modulo the field size.
+ * \param[in]	size						Field size in bytes.
+ * \return									Zigzag code.
+ */
+static uint64_t sbgEComCompressedCaptureZigZagEncode(uint64_t delta, size_t size)
+{
+	uint64_t	signBit;
+
+	signBit = UINT64_C(1) << ((size * 8) - 1);
+
+	if (delta & signBit)
+	{
+		delta |= ~sbgEComCompressedCaptureGetFieldMask(size);
+	}
+
+	return (delta << 1) ^ (0 - (delta >> 63));
+}
+
+/*!
+ * Zigzag decode a difference.
+ *
+ * \param[in]	code						Zigzag code.
+ * \return									Difference, to be masked with the field size.
+ */
+static uint64_t sbgEComCompressedCaptureZigZagDecode(uint64_t code)
+{
+	return (code >> 1) ^ (0 - (code & 1));
+}
+
+/*!
+ * Append a varint to a buffer.
+ *
+ * \param[in]	pBuffer						Buffer, at least SBG_ECOM_COMPRESSED_CAPTURE_VARINT_MAX_SIZE bytes available.
+ * \param[in]	value						Value.
+ * \return									Number of written bytes.
+ */
+static size_t sbgEComCompressedCaptureWriteVarint(uint8_t *pBuffer, uint64_t value)
+{
+	size_t		size = 0;
+
+	assert(pBuffer);
+
+	while (value >= 0x80)
+	{
+		pBuffer[size++]	= (uint8_t)(value | 0x80);
+		value			>>= 7;
+	}
+
+	pBuffer[size++] = (uint8_t)value;
+
+	return size;
+}
+
+/*!
+ * Read a varint from a buffer.
+ *
+ * \param[in]		pBuffer					Buffer.
+ * \param[in]		size					Buffer size in bytes.
+ * \param[in,out]	pOffset					Offset of the varint, moved after it.
+ * \param[out]		pValue					Value.
+ * \return									SBG_NO_ERROR if successful, SBG_INVALID_FRAME if the varint is truncated or too long.
+ */
+static SbgErrorCode sbgEComCompressedCaptureReadVarint(const uint8_t *pBuffer, size_t size, size_t *pOffset, uint64_t *pValue)
+{
+	SbgErrorCode	errorCode = SBG_INVALID_FRAME;
+	uint64_t		value = 0;
+	size_t			offset;
+
+	assert(pBuffer);
+	assert(pOffset);
+	assert(pValue);
+
+	offset = *pOffset;
+
+	for (size_t i = 0; (i < SBG_ECOM_COMPRESSED_CAPTURE_VARINT_MAX_SIZE) && (offset < size); i++)
+	{
+		uint8_t		byte = pBuffer[offset++];
+
+		value |= (uint64_t)(byte & 0x7f) << (i * 7);
+
+		if ((byte & 0x80) == 0)
+		{
+			errorCode = SBG_NO_ERROR;
+			break;
+		}
+	}
+
+	*pOffset	= offset;
+	*pValue		= value;
+
+	return errorCode;
+}
+
+//----------------------------------------------------------------------//
+//- Private methods (writer)                                           -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Write some data to a compressed capture file.
+ *
+ * \param[in]	pWriter						Compressed capture writer.
+ * \param[in]	pBuffer						Data.
+ * \param[in]	size						Data size in bytes.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComCompressedCaptureWriterWrite(SbgEComCompressedCaptureWriter *pWriter, const void *pBuffer, size_t size)
+{
+	SbgErrorCode		errorCode = SBG_NO_ERROR;
+
+	assert(pWriter);
+	assert(pWriter->pFile);
+
+	if (fwrite(pBuffer, 1, size, pWriter->pFile) == size)
+	{
+		pWriter->nrFileBytes += size;
+	}
+	else
+	{
+		errorCode = SBG_WRITE_ERROR;
+		SBG_LOG_ERROR(errorCode, "unable to write compressed capture file");
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Write the current block and start a new one.
+ *
+ * \param[in]	pWriter						Compressed capture writer.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComCompressedCaptureWriterFlushBlock(SbgEComCompressedCaptureWriter *pWriter)
+{
+	SbgErrorCode		 errorCode = SBG_NO_ERROR;
+	uint8_t				 header[SBG_ECOM_COMPRESSED_CAPTURE_BLOCK_HEADER_SIZE];
+	SbgStreamBuffer		 outputStream;
+	const uint8_t		*pRaw;
+	size_t				 storedRawSize;
+	SbgCrc32			 crc;
+
+	assert(pWriter);
+
+	if (pWriter->nrBlockFrames != 0)
+	{
+		//
+		// Raw data is stored as is if it can't be compressed
+		//
+		storedRawSize = 0;
+
+		if (pWriter->rawSize != 0)
+		{
+			storedRawSize = sbgLzCompress(pWriter->pRaw, pWriter->rawSize, pWriter->pCompressed, pWriter->compressedCapacity);
+		}
+
+		if ((storedRawSize != 0) && (storedRawSize < pWriter->rawSize))
+		{
+			pRaw = pWriter->pCompressed;
+		}
+		else
+		{
+			pRaw			= pWriter->pRaw;
+			storedRawSize	= pWriter->rawSize;
+		}
+
+		sbgCrc32Initialize(&crc);
+		sbgCrc32Update(&crc, pWriter->pControl, pWriter->controlSize);
+		sbgCrc32Update(&crc, pRaw, storedRawSize);
+
+		sbgStreamBufferInitForWrite(&outputStream, header, sizeof(header));
+
+		sbgStreamBufferWriteUint32LE(&outputStream, SBG_ECOM_COMPRESSED_CAPTURE_BLOCK_MAGIC);
+		sbgStreamBufferWriteUint32LE(&outputStream, pWriter->nrBlockFrames);
+		sbgStreamBufferWriteUint32LE(&outputStream, (uint32_t)pWriter->controlSize);
+		sbgStreamBufferWriteUint32LE(&outputStream, (uint32_t)pWriter->rawSize);
+		sbgStreamBufferWriteUint32LE(&outputStream, (uint32_t)storedRawSize);
+		sbgStreamBufferWriteUint32LE(&outputStream, sbgCrc32Get(&crc));
+
+		assert(sbgStreamBufferGetLastError(&outputStream) == SBG_NO_ERROR);
+
+		errorCode = sbgEComCompressedCaptureWriterWrite(pWriter, header, sizeof(header));
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			errorCode = sbgEComCompressedCaptureWriterWrite(pWriter, pWriter->pControl, pWriter->controlSize);
+		}
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			errorCode = sbgEComCompressedCaptureWriterWrite(pWriter, pRaw, storedRawSize);
+		}
+
+		pWriter->controlSize	= 0;
+		pWriter->rawSize		= 0;
+		pWriter->nrBlockFrames	= 0;
+
+		sbgEComCompressedCaptureCodecReset(pWriter->pCodec);
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Make sure the raw stream can hold a payload.
+ *
+ * \param[in]	pWriter						Compressed capture writer.
+ * \param[in]	size						Payload size in bytes.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComCompressedCaptureWriterReserveRaw(SbgEComCompressedCaptureWriter *pWriter, size_t size)
+{
+	SbgErrorCode		 errorCode = SBG_NO_ERROR;
+
+	assert(pWriter);
+
+	if ((pWriter->rawSize + size) > pWriter->rawCapacity)
+	{
+		errorCode = sbgEComCompressedCaptureWriterFlushBlock(pWriter);
+
+		if ((errorCode == SBG_NO_ERROR) && (size > pWriter->rawCapacity))
+		{
+			uint8_t		*pRaw;
+			uint8_t		*pCompressed;
+
+			//
+			// Payloads larger than the block size get a block of their own
+			//
+			pRaw		= realloc(pWriter->pRaw, size);
+			pCompressed	= pRaw ? realloc(pWriter->pCompressed, sbgLzCompressBound(size)) : NULL;
+
+			if (pRaw)
+			{
+				pWriter->pRaw			= pRaw;
+			}
+
+			if (pCompressed)
+			{
+				pWriter->pCompressed		= pCompressed;
+				pWriter->rawCapacity		= size;
+				pWriter->compressedCapacity	= sbgLzCompressBound(size);
+			}
+			else
+			{
+				errorCode = SBG_MALLOC_FAILED;
+				SBG_LOG_ERROR(errorCode, "unable to allocate raw stream buffer");
+			}
+		}
+	}
+
+	return errorCode;
+}
+
+//----------------------------------------------------------------------//
+//- Private methods (reader)                                           -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Load the next block of a compressed capture.
+ *
+ * \param[in]	pReader						Compressed capture reader.
+ * \return									SBG_NO_ERROR if a block has been loaded, SBG_NOT_READY at the end of the capture,
+ *											SBG_INVALID_CRC or SBG_INVALID_FRAME if a corrupted block has been skipped.
+ */
+static SbgErrorCode sbgEComCompressedCaptureReaderLoadBlock(SbgEComCompressedCaptureReader *pReader)
+{
+	SbgErrorCode		 errorCode = SBG_NO_ERROR;
+	const uint8_t		*pBuffer;
+	size_t				 fileSize;
+	SbgStreamBuffer		 inputStream;
+	uint32_t			 magic;
+	uint32_t			 nrFrames;
+	size_t				 controlSize;
+	size_t				 rawSize;
+	size_t				 storedRawSize;
+	uint32_t			 crc;
+
+	assert(pReader);
+
+	pBuffer		= sbgFileMapGetBuffer(&pReader->fileMap);
+	fileSize	= sbgFileMapGetSize(&pReader->fileMap);
+
+	if ((fileSize - pReader->offset) >= SBG_ECOM_COMPRESSED_CAPTURE_BLOCK_HEADER_SIZE)
+	{
+		sbgStreamBufferInitForRead(&inputStream, &pBuffer[pReader->offset], SBG_ECOM_COMPRESSED_CAPTURE_BLOCK_HEADER_SIZE);
+
+		magic			= sbgStreamBufferReadUint32LE(&inputStream);
+		nrFrames		= sbgStreamBufferReadUint32LE(&inputStream);
+		controlSize		= sbgStreamBufferReadUint32LE(&inputStream);
+		rawSize			= sbgStreamBufferReadUint32LE(&inputStream);
+		storedRawSize	= sbgStreamBufferReadUint32LE(&inputStream);
+		crc				= sbgStreamBufferReadUint32LE(&inputStream);
+
+		if (magic != SBG_ECOM_COMPRESSED_CAPTURE_BLOCK_MAGIC)
+		{
+			//
+			// Block boundaries can't be recovered
+			//
+			errorCode = SBG_INVALID_FRAME;
+			SBG_LOG_ERROR(errorCode, "invalid block at offset %zu", pReader->offset);
+
+			pReader->offset = fileSize;
+		}
+		else if ((controlSize + storedRawSize) > (fileSize - pReader->offset - SBG_ECOM_COMPRESSED_CAPTURE_BLOCK_HEADER_SIZE))
+		{
+			errorCode = SBG_NOT_READY;
+			SBG_LOG_WARNING(errorCode, "truncated block at offset %zu ignored", pReader->offset);
+
+			pReader->offset = fileSize;
+		}
+		else
+		{
+			const uint8_t		*pControl;
+			const uint8_t		*pStoredRaw;
+			SbgCrc32			 computedCrc;
+
+			pReader->blockOffset	 = pReader->offset;
+			pControl				 = &pBuffer[pReader->offset + SBG_ECOM_COMPRESSED_CAPTURE_BLOCK_HEADER_SIZE];
+			pStoredRaw				 = pControl + controlSize;
+			pReader->offset			+= SBG_ECOM_COMPRESSED_CAPTURE_BLOCK_HEADER_SIZE + controlSize + storedRawSize;
+
+			sbgCrc32Initialize(&computedCrc);
+			sbgCrc32Update(&computedCrc, pControl, controlSize);
+			sbgCrc32Update(&computedCrc, pStoredRaw, storedRawSize);
+
+			if (sbgCrc32Get(&computedCrc) != crc)
+			{
+				errorCode = SBG_INVALID_CRC;
+				SBG_LOG_ERROR(errorCode, "invalid block CRC at offset %zu", pReader->blockOffset);
+			}
+			else if (storedRawSize > rawSize)
+			{
+				errorCode = SBG_INVALID_FRAME;
+				SBG_LOG_ERROR(errorCode, "invalid block sizes at offset %zu", pReader->blockOffset);
+			}
+			else if (storedRawSize == rawSize)
+			{
+				pReader->pRaw = pStoredRaw;
+			}
+			else
+			{
+				size_t		 decompressedSize;
+
+				if (rawSize > pReader->rawBufferCapacity)
+				{
+					uint8_t		*pRawBuffer;
+
+					pRawBuffer = realloc(pReader->pRawBuffer, rawSize);
+
+					if (pRawBuffer)
+					{
+						pReader->pRawBuffer			= pRawBuffer;
+						pReader->rawBufferCapacity	= rawSize;
+					}
+					else
+					{
+						errorCode = SBG_MALLOC_FAILED;
+						SBG_LOG_ERROR(errorCode, "unable to allocate raw stream buffer");
+					}
+				}
+
+				if (errorCode == SBG_NO_ERROR)
+				{
+					errorCode = sbgLzDecompress(pStoredRaw, storedRawSize, pReader->pRawBuffer, rawSize, &decompressedSize);
+
+					if ((errorCode != SBG_NO_ERROR) || (decompressedSize != rawSize))
+					{
+						errorCode = SBG_INVALID_FRAME;
+						SBG_LOG_ERROR(errorCode, "unable to decompress block at offset %zu", pReader->blockOffset);
+					}
+				}
+
+				pReader->pRaw = pReader->pRawBuffer;
+			}
+
+			if (errorCode == SBG_NO_ERROR)
+			{
+				pReader->pControl		= pControl;
+				pReader->controlSize	= controlSize;
+				pReader->controlOffset	= 0;
+				pReader->rawSize		= rawSize;
+				pReader->rawOffset		= 0;
+				pReader->nrBlockFrames	= nrFrames;
+
+				sbgEComCompressedCaptureCodecReset(pReader->pCodec);
+			}
+		}
+	}
+	else
+	{
+		if (pReader->offset != fileSize)
+		{
+			SBG_LOG_WARNING(SBG_NOT_READY, "truncated block at offset %zu ignored", pReader->offset);
+			pReader->offset = fileSize;
+		}
+
+		errorCode = SBG_NOT_READY;
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Decode a frame from the current block.
+ *
+ * \param[in]	pReader						Compressed capture reader.
+ * \param[out]	pFrame						Frame.
+ * \return									SBG_NO_ERROR if successful, SBG_INVALID_FRAME if the block is corrupted.
+ */
+static SbgErrorCode sbgEComCompressedCaptureReaderDecodeFrame(SbgEComCompressedCaptureReader *pReader, SbgEComCaptureFrame *pFrame)
+{
+	SbgErrorCode							 errorCode = SBG_NO_ERROR;
+	SbgEComCompressedCaptureCodec			*pCodec;
+	const SbgEComCompressedCaptureLayout	*pLayout = NULL;
+	SbgEComCompressedCaptureLogState		*pLogState = NULL;
+	uint64_t								 hostTimeDelta;
+	uint64_t								 sizeCode;
+	size_t									 nrFields = 0;
+	size_t									 fieldsSize = 0;
+
+	assert(pReader);
+	assert(pFrame);
+
+	pCodec = pReader->pCodec;
+
+	if ((pReader->controlSize - pReader->controlOffset) >= 2)
+	{
+		pFrame->msgClass	= pReader->pControl[pReader->controlOffset++];
+		pFrame->msgId		= pReader->pControl[pReader->controlOffset++];
+
+		errorCode = sbgEComCompressedCaptureReadVarint(pReader->pControl, pReader->controlSize, &pReader->controlOffset, &hostTimeDelta);
+	}
+	else
+	{
+		errorCode = SBG_INVALID_FRAME;
+	}
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		errorCode = sbgEComCompressedCaptureReadVarint(pReader->pControl, pReader->controlSize, &pReader->controlOffset, &sizeCode);
+	}
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		pCodec->lastHostTimeUs	+= sbgEComCompressedCaptureZigZagDecode(hostTimeDelta);
+		pFrame->hostTimeUs		 = pCodec->lastHostTimeUs;
+		pFrame->payloadSize		 = (size_t)(sizeCode >> 1);
+		pFrame->offset			 = pReader->blockOffset;
+
+		if (sizeCode & 1)
+		{
+			pLayout = sbgEComCompressedCaptureCodecGetLayout(pCodec, pFrame->msgClass, pFrame->msgId, pFrame->payloadSize, &pLogState, &nrFields);
+
+			if (!pLayout)
+			{
+				errorCode = SBG_INVALID_FRAME;
+			}
+		}
+	}
+
+	//
+	// Decode fields in the log state, the last payload of this type
+	//
+	for (size_t i = 0; (errorCode == SBG_NO_ERROR) && (i < nrFields); i++)
+	{
+		size_t		 fieldSize = pLayout->pFieldSizes[i];
+		uint64_t	 code;
+		uint64_t	 delta;
+		uint64_t	 value;
+
+		errorCode = sbgEComCompressedCaptureReadVarint(pReader->pControl, pReader->controlSize, &pReader->controlOffset, &code);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			delta = sbgEComCompressedCaptureZigZagDecode(code);
+
+			if (i == 0)
+			{
+				delta							= (delta + pLogState->lastTimeStampDelta) & UINT32_MAX;
+				pLogState->lastTimeStampDelta	= (uint32_t)delta;
+			}
+
+			value = sbgEComCompressedCaptureReadField(&pLogState->lastPayload[fieldsSize], fieldSize);
+			value = (value + delta) & sbgEComCompressedCaptureGetFieldMask(fieldSize);
+
+			sbgEComCompressedCaptureWriteField(&pLogState->lastPayload[fieldsSize], fieldSize, value);
+
+			fieldsSize += fieldSize;
+		}
+	}
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		size_t		 tailSize = pFrame->payloadSize - fieldsSize;
+
+		if (tailSize > (pReader->rawSize - pReader->rawOffset))
+		{
+			errorCode = SBG_INVALID_FRAME;
+		}
+		else if (fieldsSize == 0)
+		{
+			pFrame->pPayload = &pReader->pRaw[pReader->rawOffset];
+		}
+		else if (tailSize == 0)
+		{
+			pFrame->pPayload = pLogState->lastPayload;
+		}
+		else
+		{
+			memcpy(pReader->payload, pLogState->lastPayload, fieldsSize);
+			memcpy(&pReader->payload[fieldsSize], &pReader->pRaw[pReader->rawOffset], tailSize);
+
+			pFrame->pPayload = pReader->payload;
+		}
+
+		pReader->rawOffset += tailSize;
+	}
+
+	return errorCode;
+}
+
+//----------------------------------------------------------------------//
+//- Public methods (writer)                                            -//
+//----------------------------------------------------------------------//
+
+SbgErrorCode sbgEComCompressedCaptureWriterOpen(SbgEComCompressedCaptureWriter *pWriter, const char *pPath, size_t blockSize)
+{
+	SbgErrorCode		 errorCode = SBG_NO_ERROR;
+	uint8_t				 header[SBG_ECOM_COMPRESSED_CAPTURE_HEADER_SIZE];
+	SbgStreamBuffer		 outputStream;
+
+	assert(pWriter);
+	assert(pPath);
+
+	memset(pWriter, 0, sizeof(*pWriter));
+
+	if (blockSize == 0)
+	{
+		blockSize = SBG_ECOM_COMPRESSED_CAPTURE_DEFAULT_BLOCK_SIZE;
+	}
+
+	pWriter->blockSize			= blockSize;
+	pWriter->controlCapacity	= blockSize + SBG_ECOM_COMPRESSED_CAPTURE_MAX_FRAME_CONTROL_SIZE;
+	pWriter->rawCapacity		= blockSize + SBG_ECOM_MAX_PAYLOAD_SIZE;
+	pWriter->compressedCapacity	= sbgLzCompressBound(pWriter->rawCapacity);
+
+	pWriter->pCodec			= sbgEComCompressedCaptureCodecCreate();
+	pWriter->pControl		= malloc(pWriter->controlCapacity);
+	pWriter->pRaw			= malloc(pWriter->rawCapacity);
+	pWriter->pCompressed	= malloc(pWriter->compressedCapacity);
+
+	if (pWriter->pCodec && pWriter->pControl && pWriter->pRaw && pWriter->pCompressed)
+	{
+		pWriter->pFile = fopen(pPath, "wb");
+
+		if (pWriter->pFile)
+		{
+			sbgStreamBufferInitForWrite(&outputStream, header, sizeof(header));
+
+			sbgStreamBufferWriteBuffer(&outputStream, SBG_ECOM_COMPRESSED_CAPTURE_HEADER_MAGIC, SBG_ECOM_COMPRESSED_CAPTURE_MAGIC_SIZE);
+			sbgStreamBufferWriteUint32LE(&outputStream, SBG_ECOM_COMPRESSED_CAPTURE_VERSION);
+			sbgStreamBufferWriteUint32LE(&outputStream, (uint32_t)blockSize);
+
+			assert(sbgStreamBufferGetLastError(&outputStream) == SBG_NO_ERROR);
+
+			errorCode = sbgEComCompressedCaptureWriterWrite(pWriter, header, sizeof(header));
+
+			if (errorCode != SBG_NO_ERROR)
+			{
+				fclose(pWriter->pFile);
+				pWriter->pFile = NULL;
+			}
+		}
+		else
+		{
+			errorCode = SBG_INVALID_PARAMETER;
+			SBG_LOG_ERROR(errorCode, "unable to open compressed capture file %s", pPath);
+		}
+	}
+	else
+	{
+		errorCode = SBG_MALLOC_FAILED;
+		SBG_LOG_ERROR(errorCode, "unable to allocate compressed capture buffers");
+	}
+
+	if (errorCode != SBG_NO_ERROR)
+	{
+		free(pWriter->pCodec);
+		free(pWriter->pControl);
+		free(pWriter->pRaw);
+		free(pWriter->pCompressed);
+
+		memset(pWriter, 0, sizeof(*pWriter));
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComCompressedCaptureWriterClose(SbgEComCompressedCaptureWriter *pWriter)
+{
+	SbgErrorCode		 errorCode;
+
+	assert(pWriter);
+	assert(pWriter->pFile);
+
+	errorCode = sbgEComCompressedCaptureWriterFlushBlock(pWriter);
+
+	if ((fclose(pWriter->pFile) != 0) && (errorCode == SBG_NO_ERROR))
+	{
+		errorCode = SBG_WRITE_ERROR;
+		SBG_LOG_ERROR(errorCode, "unable to close compressed capture file");
+	}
+
+	pWriter->pFile = NULL;
+
+	free(pWriter->pCodec);
+	free(pWriter->pControl);
+	free(pWriter->pRaw);
+	free(pWriter->pCompressed);
+
+	pWriter->pCodec			= NULL;
+	pWriter->pControl		= NULL;
+	pWriter->pRaw			= NULL;
+	pWriter->pCompressed	= NULL;
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComCompressedCaptureWriterWriteFrame(SbgEComCompressedCaptureWriter *pWriter, uint64_t hostTimeUs, SbgEComClass msgClass, SbgEComMsgId msgId, const void *pPayload, size_t payloadSize)
+{
+	SbgErrorCode							 errorCode = SBG_NO_ERROR;
+	SbgEComCompressedCaptureCodec			*pCodec;
+	const SbgEComCompressedCaptureLayout	*pLayout;
+	SbgEComCompressedCaptureLogState		*pLogState = NULL;
+	const uint8_t							*pBuffer = pPayload;
+	uint8_t									*pControl;
+	size_t									 nrFields = 0;
+	size_t									 fieldsSize = 0;
+
+	assert(pWriter);
+	assert(pWriter->pFile);
+	assert(pPayload || (payloadSize == 0));
+
+	pCodec = pWriter->pCodec;
+
+	if ((pWriter->controlSize + SBG_ECOM_COMPRESSED_CAPTURE_MAX_FRAME_CONTROL_SIZE) > pWriter->controlCapacity)
+	{
+		errorCode = sbgEComCompressedCaptureWriterFlushBlock(pWriter);
+	}
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		pLayout = sbgEComCompressedCaptureCodecGetLayout(pCodec, (uint8_t)msgClass, (uint8_t)msgId, payloadSize, &pLogState, &nrFields);
+
+		for (size_t i = 0; i < nrFields; i++)
+		{
+			fieldsSize += pLayout->pFieldSizes[i];
+		}
+
+		//
+		// Bytes that aren't delta coded go to the raw stream
+		//
+		errorCode = sbgEComCompressedCaptureWriterReserveRaw(pWriter, payloadSize - fieldsSize);
+	}
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		//
+		// The log state may have been reset by a new block, get it again
+		//
+		pLayout		= sbgEComCompressedCaptureCodecGetLayout(pCodec, (uint8_t)msgClass, (uint8_t)msgId, payloadSize, &pLogState, &nrFields);
+		pControl	= &pWriter->pControl[pWriter->controlSize];
+
+		*pControl++	 = (uint8_t)msgClass;
+		*pControl++	 = (uint8_t)msgId;
+		pControl	+= sbgEComCompressedCaptureWriteVarint(pControl, sbgEComCompressedCaptureZigZagEncode(hostTimeUs - pCodec->lastHostTimeUs, sizeof(uint64_t)));
+		pControl	+= sbgEComCompressedCaptureWriteVarint(pControl, ((uint64_t)payloadSize << 1) | (pLayout ? 1 : 0));
+
+		pCodec->lastHostTimeUs = hostTimeUs;
+
+		fieldsSize = 0;
+
+		for (size_t i = 0; i < nrFields; i++)
+		{
+			size_t		 fieldSize = pLayout->pFieldSizes[i];
+			uint64_t	 value;
+			uint64_t	 delta;
+
+			value = sbgEComCompressedCaptureReadField(&pBuffer[fieldsSize], fieldSize);
+			delta = (value - sbgEComCompressedCaptureReadField(&pLogState->lastPayload[fieldsSize], fieldSize)) & sbgEComCompressedCaptureGetFieldMask(fieldSize);
+
+			if (i == 0)
+			{
+				uint32_t	 timeStampDelta = (uint32_t)delta;
+
+				delta							= (uint32_t)(timeStampDelta - pLogState->lastTimeStampDelta);
+				pLogState->lastTimeStampDelta	= timeStampDelta;
+			}
+
+			pControl	+= sbgEComCompressedCaptureWriteVarint(pControl, sbgEComCompressedCaptureZigZagEncode(delta, fieldSize));
+			fieldsSize	+= fieldSize;
+		}
+
+		if (fieldsSize != 0)
+		{
+			memcpy(pLogState->lastPayload, pBuffer, fieldsSize);
+		}
+
+		memcpy(&pWriter->pRaw[pWriter->rawSize], &pBuffer[fieldsSize], payloadSize - fieldsSize);
+
+		pWriter->rawSize		+= payloadSize - fieldsSize;
+		pWriter->controlSize	 = (size_t)(pControl - pWriter->pControl);
+		pWriter->nrBlockFrames++;
+		pWriter->nrFrames++;
+		pWriter->nrPayloadBytes	+= payloadSize;
+
+		if ((pWriter->controlSize >= pWriter->blockSize) || (pWriter->rawSize >= pWriter->blockSize))
+		{
+			errorCode = sbgEComCompressedCaptureWriterFlushBlock(pWriter);
+		}
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComCompressedCaptureWriterOnLogPayload(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const void *pPayload, size_t payloadSize, void *pUserArg)
+{
+	assert(pUserArg);
+
+	SBG_UNUSED_PARAMETER(pHandle);
+
+	return sbgEComCompressedCaptureWriterWriteFrame((SbgEComCompressedCaptureWriter*)pUserArg, sbgGetTimeInUs(), msgClass, msg, pPayload, payloadSize);
+}
+
+//----------------------------------------------------------------------//
+//- Public methods (reader)                                            -//
+//----------------------------------------------------------------------//
+
+SbgErrorCode sbgEComCompressedCaptureReaderOpen(SbgEComCompressedCaptureReader *pReader, const char *pPath)
+{
+	SbgErrorCode		 errorCode;
+	const uint8_t		*pBuffer;
+	SbgStreamBuffer		 inputStream;
+	uint32_t			 version;
+
+	assert(pReader);
+	assert(pPath);
+
+	memset(pReader, 0, sizeof(*pReader));
+
+	errorCode = sbgFileMapOpen(&pReader->fileMap, pPath);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		pBuffer = sbgFileMapGetBuffer(&pReader->fileMap);
+
+		if ((sbgFileMapGetSize(&pReader->fileMap) >= SBG_ECOM_COMPRESSED_CAPTURE_HEADER_SIZE) && (memcmp(pBuffer, SBG_ECOM_COMPRESSED_CAPTURE_HEADER_MAGIC, SBG_ECOM_COMPRESSED_CAPTURE_MAGIC_SIZE) == 0))
+		{
+			sbgStreamBufferInitForRead(&inputStream, pBuffer + SBG_ECOM_COMPRESSED_CAPTURE_MAGIC_SIZE, SBG_ECOM_COMPRESSED_CAPTURE_HEADER_SIZE - SBG_ECOM_COMPRESSED_CAPTURE_MAGIC_SIZE);
+
+			version = sbgStreamBufferReadUint32LE(&inputStream);
+
+			if (version == SBG_ECOM_COMPRESSED_CAPTURE_VERSION)
+			{
+				pReader->pCodec = sbgEComCompressedCaptureCodecCreate();
+
+				if (pReader->pCodec)
+				{
+					sbgFileMapSetAccess(&pReader->fileMap, SBG_FILE_MAP_ACCESS_SEQUENTIAL);
+					sbgEComCompressedCaptureReaderRewind(pReader);
+				}
+				else
+				{
+					errorCode = SBG_MALLOC_FAILED;
+				}
+			}
+			else
+			{
+				errorCode = SBG_INVALID_VERSION;
+				SBG_LOG_ERROR(errorCode, "unsupported compressed capture version %" PRIu32, version);
+			}
+		}
+		else
+		{
+			errorCode = SBG_INVALID_FRAME;
+			SBG_LOG_ERROR(errorCode, "%s isn't a compressed capture file", pPath);
+		}
+
+		if (errorCode != SBG_NO_ERROR)
+		{
+			sbgFileMapClose(&pReader->fileMap);
+		}
+	}
+
+	return errorCode;
+}
+
+void sbgEComCompressedCaptureReaderClose(SbgEComCompressedCaptureReader *pReader)
+{
+	assert(pReader);
+
+	free(pReader->pCodec);
+	free(pReader->pRawBuffer);
+	sbgFileMapClose(&pReader->fileMap);
+
+	memset(pReader, 0, sizeof(*pReader));
+}
+
+void sbgEComCompressedCaptureReaderRewind(SbgEComCompressedCaptureReader *pReader)
+{
+	assert(pReader);
+
+	pReader->offset			= SBG_ECOM_COMPRESSED_CAPTURE_HEADER_SIZE;
+	pReader->blockOffset	= SBG_ECOM_COMPRESSED_CAPTURE_HEADER_SIZE;
+	pReader->nrBlockFrames	= 0;
+}
+
+SbgErrorCode sbgEComCompressedCaptureReaderReadFrame(SbgEComCompressedCaptureReader *pReader, SbgEComCaptureFrame *pFrame)
+{
+	SbgErrorCode		 errorCode = SBG_NO_ERROR;
+
+	assert(pReader);
+	assert(pFrame);
+
+	while ((errorCode == SBG_NO_ERROR) && (pReader->nrBlockFrames == 0))
+	{
+		errorCode = sbgEComCompressedCaptureReaderLoadBlock(pReader);
+	}
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		errorCode = sbgEComCompressedCaptureReaderDecodeFrame(pReader, pFrame);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			pReader->nrBlockFrames--;
+		}
+		else
+		{
+			SBG_LOG_ERROR(errorCode, "invalid frame in block at offset %zu", pReader->blockOffset);
+
+			//
+			// Skip the rest of the block
+			//
+			pReader->nrBlockFrames = 0;
+		}
+	}
+
+	return errorCode;
+}
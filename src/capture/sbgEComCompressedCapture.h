@@ -0,0 +1,231 @@
+﻿/*!
+ * \file			sbgEComCompressedCapture.h
+ * \author			SBG Systems
+ * \date			19 October 2026
+ *
+ * \brief			Compressed capture files of received sbgECom logs.
+ *
+ *				A compressed capture stores the same frames as a capture, host reception time,
+ *				message class, id and payload, and decodes back to identical frames.
+ *				Frames are grouped in independently decodable blocks made of two streams:
+ *				- A control stream with the frame headers and, for logs with a known fixed
+ *				  layout, each payload field encoded as a zigzag varint of its difference
+ *				  with the same field of the previous log of that type. Time stamps use the
+ *				  difference between consecutive time stamp deltas.
+ *				- A raw stream with the payloads of other logs, such as GNSS raw data,
+ *				  compressed with the sbgLz codec.
+ *
+ * \copyright		Copyright (C) 2022, SBG Systems SAS. All rights reserved.
+ * \beginlicense	The MIT license
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * \endlicense
+ */
+
+#ifndef SBG_ECOM_COMPRESSED_CAPTURE_H
+#define SBG_ECOM_COMPRESSED_CAPTURE_H
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <fileMap/sbgFileMap.h>
+
+// Project headers
+#include <sbgECom.h>
+#include <sbgEComIds.h>
+
+// Local headers
+#include "sbgEComCapture.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Compressed capture file format version.
+ */
+#define SBG_ECOM_COMPRESSED_CAPTURE_VERSION				(1)
+
+/*!
+ * Default block size in bytes.
+ *
+ * A block is written once its control or raw stream reaches this size.
+ */
+#define SBG_ECOM_COMPRESSED_CAPTURE_DEFAULT_BLOCK_SIZE	(256 * 1024)
+
+/*!
+ * File header and block header sizes in bytes.
+ */
+#define SBG_ECOM_COMPRESSED_CAPTURE_HEADER_SIZE			(16)
+#define SBG_ECOM_COMPRESSED_CAPTURE_BLOCK_HEADER_SIZE	(24)
+
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Delta coding state shared by the writer and the reader, private.
+ */
+typedef struct _SbgEComCompressedCaptureCodec SbgEComCompressedCaptureCodec;
+
+/*!
+ * Compressed capture writer.
+ */
+typedef struct _SbgEComCompressedCaptureWriter
+{
+	FILE							*pFile;					/*!< Compressed capture file. */
+	size_t							 blockSize;				/*!< Block size in bytes. */
+	SbgEComCompressedCaptureCodec	*pCodec;				/*!< Delta coding state. */
+
+	uint8_t							*pControl;				/*!< Control stream of the current block. */
+	size_t							 controlSize;			/*!< Control stream size in bytes. */
+	size_t							 controlCapacity;		/*!< Control stream buffer size in bytes. */
+	uint8_t							*pRaw;					/*!< Raw stream of the current block. */
+	size_t							 rawSize;				/*!< Raw stream size in bytes. */
+	size_t							 rawCapacity;			/*!< Raw stream buffer size in bytes. */
+	uint8_t							*pCompressed;			/*!< Compressed raw stream buffer. */
+	size_t							 compressedCapacity;	/*!< Compressed raw stream buffer size in bytes. */
+	uint32_t						 nrBlockFrames;			/*!< Number of frames in the current block. */
+
+	uint64_t						 nrFrames;				/*!< Total number of written frames. */
+	uint64_t						 nrPayloadBytes;		/*!< Total size of written payloads in bytes. */
+	uint64_t						 nrFileBytes;			/*!< Compressed capture file size in bytes. */
+} SbgEComCompressedCaptureWriter;
+
+/*!
+ * Compressed capture reader.
+ */
+typedef struct _SbgEComCompressedCaptureReader
+{
+	SbgFileMap						 fileMap;				/*!< Compressed capture file map. */
+	size_t							 offset;				/*!< Offset of the next block. */
+	size_t							 blockOffset;			/*!< Offset of the current block. */
+	SbgEComCompressedCaptureCodec	*pCodec;				/*!< Delta coding state. */
+
+	const uint8_t					*pControl;				/*!< Control stream of the current block. */
+	size_t							 controlSize;			/*!< Control stream size in bytes. */
+	size_t							 controlOffset;			/*!< Offset of the next frame in the control stream. */
+	const uint8_t					*pRaw;					/*!< Raw stream of the current block. */
+	size_t							 rawSize;				/*!< Raw stream size in bytes. */
+	size_t							 rawOffset;				/*!< Offset of the next payload in the raw stream. */
+	uint8_t							*pRawBuffer;			/*!< Decompressed raw stream buffer. */
+	size_t							 rawBufferCapacity;		/*!< Decompressed raw stream buffer size in bytes. */
+	uint32_t						 nrBlockFrames;			/*!< Number of frames left in the current block. */
+	uint8_t							 payload[SBG_ECOM_MAX_PAYLOAD_SIZE];	/*!< Payload of the last read frame, if it isn't referenced in place. */
+} SbgEComCompressedCaptureReader;
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Create a compressed capture file.
+ *
+ * \param[out]	pWriter						Compressed capture writer.
+ * \param[in]	pPath						Compressed capture file path.
+ * \param[in]	blockSize					Block size in bytes, 0 to use SBG_ECOM_COMPRESSED_CAPTURE_DEFAULT_BLOCK_SIZE.
+ * \return									SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComCompressedCaptureWriterOpen(SbgEComCompressedCaptureWriter *pWriter, const char *pPath, size_t blockSize);
+
+/*!
+ * Write the last block and close a compressed capture file.
+ *
+ * \param[in]	pWriter						Compressed capture writer.
+ * \return									SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComCompressedCaptureWriterClose(SbgEComCompressedCaptureWriter *pWriter);
+
+/*!
+ * Write a frame to a compressed capture.
+ *
+ * \param[in]	pWriter						Compressed capture writer.
+ * \param[in]	hostTimeUs					Host reception time in us.
+ * \param[in]	msgClass					Log message class.
+ * \param[in]	msgId						Log message id.
+ * \param[in]	pPayload					Log payload.
+ * \param[in]	payloadSize					Log payload size in bytes.
+ * \return									SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComCompressedCaptureWriterWriteFrame(SbgEComCompressedCaptureWriter *pWriter, uint64_t hostTimeUs, SbgEComClass msgClass, SbgEComMsgId msgId, const void *pPayload, size_t payloadSize);
+
+/*!
+ * Receive log payload callback writing each received log to a compressed capture.
+ *
+ * Use it with sbgEComSetReceiveLogPayloadCallback() and a compressed capture writer as user argument.
+ * The host reception time is given by sbgGetTimeInUs().
+ *
+ * \param[in]	pHandle						sbgECom handle.
+ * \param[in]	msgClass					Log message class.
+ * \param[in]	msg							Log message id.
+ * \param[in]	pPayload					Log payload.
+ * \param[in]	payloadSize					Log payload size in bytes.
+ * \param[in]	pUserArg					Compressed capture writer.
+ * \return									SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComCompressedCaptureWriterOnLogPayload(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const void *pPayload, size_t payloadSize, void *pUserArg);
+
+/*!
+ * Open a compressed capture file for reading.
+ *
+ * The file is memory mapped.
+ *
+ * \param[out]	pReader						Compressed capture reader.
+ * \param[in]	pPath						Compressed capture file path.
+ * \return									SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComCompressedCaptureReaderOpen(SbgEComCompressedCaptureReader *pReader, const char *pPath);
+
+/*!
+ * Close a compressed capture file.
+ *
+ * \param[in]	pReader						Compressed capture reader.
+ */
+void sbgEComCompressedCaptureReaderClose(SbgEComCompressedCaptureReader *pReader);
+
+/*!
+ * Go back to the first frame of a compressed capture.
+ *
+ * \param[in]	pReader						Compressed capture reader.
+ */
+void sbgEComCompressedCaptureReaderRewind(SbgEComCompressedCaptureReader *pReader);
+
+/*!
+ * Read the next frame of a compressed capture.
+ *
+ * The frame payload is only valid until the next read. The frame offset is the offset of its block.
+ * A corrupted block is skipped, the error is returned and the next read continues with the next block.
+ * A truncated last block, left by an interrupted writer, is ignored.
+ *
+ * \param[in]	pReader						Compressed capture reader.
+ * \param[out]	pFrame						Frame.
+ * \return									SBG_NO_ERROR if a frame has been read, SBG_NOT_READY at the end of the capture,
+ *											SBG_INVALID_CRC or SBG_INVALID_FRAME if a corrupted block has been skipped.
+ */
+SbgErrorCode sbgEComCompressedCaptureReaderReadFrame(SbgEComCompressedCaptureReader *pReader, SbgEComCaptureFrame *pFrame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_ECOM_COMPRESSED_CAPTURE_H
@@ -89,17 +89,10 @@ SbgErrorCode sbgEComReceiveAnyCmd2(SbgEComHandle *pHandle, uint8_t *pMsgClass, u
 		{
 			if (sbgEComMsgClassIsALog((SbgEComClass)receivedMsgClass))
 			{
-				if (pHandle->pReceiveLogCallback)
-				{
-					SbgBinaryLogData		 logData;
-
-					errorCode = sbgEComBinaryLogParse((SbgEComClass)receivedMsgClass, receivedMsgId, sbgEComProtocolPayloadGetBuffer(pPayload), sbgEComProtocolPayloadGetSize(pPayload), &logData);
-
-					if (errorCode == SBG_NO_ERROR)
-					{
-						pHandle->pReceiveLogCallback(pHandle, (SbgEComClass)receivedMsgClass, receivedMsgId, &logData, pHandle->pUserArg);						
-					}
-				}
+				//
+				// Logs received while waiting for an answer are dispatched as any other received log
+				//
+				errorCode = sbgEComHandleLogPayload(pHandle, (SbgEComClass)receivedMsgClass, receivedMsgId, sbgEComProtocolPayloadGetBuffer(pPayload), sbgEComProtocolPayloadGetSize(pPayload));
 			}
 			else
 			{
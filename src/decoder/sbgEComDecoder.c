@@ -0,0 +1,993 @@
+﻿// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <arena/sbgArena.h>
+#include <crc/sbgCrc.h>
+#include <fileMap/sbgFileMap.h>
+#include <streamBuffer/sbgStreamBuffer.h>
+
+// Project headers
+#include <binaryLogs/sbgEComBinaryLogs.h>
+#include <protocol/sbgEComProtocol.h>
+
+// Local headers
+#include "sbgEComDecoder.h"
+
+//----------------------------------------------------------------------//
+//- Include specific header for UNIX platforms                         -//
+//----------------------------------------------------------------------//
+#if defined(__unix__) || defined(__APPLE__)
+	#include <pthread.h>
+	#include <unistd.h>
+	#define SBG_ECOM_DECODER_USE_THREADS
+#endif
+
+//----------------------------------------------------------------------//
+//- Private definitions                                                -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Size of the frame header and footer around the payload, in bytes.
+ */
+#define SBG_ECOM_DECODER_FRAME_OVERHEAD					(9)
+
+/*!
+ * Size of the extended frame headers, in bytes.
+ */
+#define SBG_ECOM_DECODER_EXTENDED_HEADER_SIZE			(5)
+
+/*!
+ * Number of chunks per worker that can be decoded ahead of the merge.
+ */
+#define SBG_ECOM_DECODER_SLOTS_PER_WORKER				(2)
+
+/*!
+ * Initial number of frames allocated per chunk.
+ */
+#define SBG_ECOM_DECODER_INITIAL_FRAMES_CAPACITY		(4096)
+
+/*!
+ * Frame decoded by a worker.
+ */
+typedef struct _SbgEComDecoderFrame
+{
+	size_t						 offset;					/*!< Frame offset in the stream. */
+	size_t						 endOffset;					/*!< Frame end offset in the stream. */
+	const uint8_t				*pPayload;					/*!< Payload, referencing the stream. */
+	size_t						 payloadSize;				/*!< Payload size in bytes. */
+	const SbgBinaryLogData		*pLogData;					/*!< Parsed log, only the member of the log type is allocated. */
+	size_t						 logDataSize;				/*!< Parsed log size in bytes. */
+	SbgErrorCode				 parseErrorCode;			/*!< Log parsing error code. */
+	uint8_t						 msgClass;					/*!< Message class. */
+	uint8_t						 msgId;						/*!< Message ID. */
+	uint8_t						 transferId;				/*!< Transfer ID of an extended frame. */
+	uint16_t					 pageIndex;					/*!< Page index of an extended frame. */
+	uint16_t					 nrPages;					/*!< Number of pages of an extended frame, 0 for standard frames. */
+} SbgEComDecoderFrame;
+
+/*!
+ * Decoded chunk.
+ */
+typedef struct _SbgEComDecoderChunk
+{
+	SbgEComDecoderFrame			*pFrames;					/*!< Decoded frames, in stream order. */
+	size_t						 nrFrames;					/*!< Number of decoded frames. */
+	size_t						 framesCapacity;			/*!< Allocated number of frames. */
+	SbgArena					 arena;						/*!< Arena parsed logs are allocated from. */
+	SbgErrorCode				 errorCode;					/*!< Chunk decoding error code. */
+	bool						 decoded;					/*!< True if the chunk has been decoded and is ready to be merged. */
+} SbgEComDecoderChunk;
+
+/*!
+ * Extended frames reassembly.
+ */
+typedef struct _SbgEComDecoderLargeTransfer
+{
+	uint8_t						*pBuffer;					/*!< Reassembled payload. */
+	size_t						 size;						/*!< Reassembled payload size in bytes. */
+	size_t						 capacity;					/*!< Allocated payload size in bytes. */
+	bool						 inProgress;				/*!< True if a transfer is in progress. */
+	uint8_t						 msgClass;					/*!< Message class. */
+	uint8_t						 msgId;						/*!< Message ID. */
+	uint8_t						 transferId;				/*!< Transfer ID. */
+	uint16_t					 nextPageIndex;				/*!< Index of the next expected page. */
+	uint16_t					 nrPages;					/*!< Number of pages. */
+} SbgEComDecoderLargeTransfer;
+
+/*!
+ * Decoder shared by the workers and the merge.
+ */
+typedef struct _SbgEComDecoder
+{
+	SbgEComHandle				*pHandle;					/*!< sbgECom handle the logs are dispatched to. */
+	const uint8_t				*pBuffer;					/*!< Recorded stream. */
+	size_t						 size;						/*!< Recorded stream size in bytes. */
+	size_t						 chunkSize;					/*!< Nominal chunk size in bytes. */
+	size_t						 nrChunks;					/*!< Number of chunks. */
+	bool						 parseLogs;					/*!< True if logs have to be parsed. */
+	bool						 rawViews;					/*!< True if raw data logs are parsed as views. */
+
+	SbgEComDecoderChunk			*pSlots;					/*!< Chunks decoded ahead of the merge. */
+	size_t						 nrSlots;					/*!< Number of slots. */
+	size_t						 nextChunk;					/*!< Index of the next chunk to decode. */
+	size_t						 nextMerge;					/*!< Index of the next chunk to merge. */
+	bool						 aborted;					/*!< True if the decoding has been aborted. */
+
+	size_t						 mergeOffset;				/*!< End offset of the last merged frame. */
+	uint64_t					 nrFrameBytes;				/*!< Number of bytes in merged frames. */
+	SbgEComDecoderLargeTransfer	 largeTransfer;				/*!< Extended frames reassembly. */
+	SbgEComDecoderStats			 stats;						/*!< Decoding statistics. */
+
+#ifdef SBG_ECOM_DECODER_USE_THREADS
+	pthread_mutex_t				 mutex;						/*!< Mutex protecting the scheduling members. */
+	pthread_cond_t				 cond;						/*!< Condition signaled when a chunk is decoded or merged. */
+#endif
+} SbgEComDecoder;
+
+//----------------------------------------------------------------------//
+//- Private methods (frames)                                           -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Find the SYNC bytes of a frame.
+ *
+ * \param[in]	pBuffer						Stream.
+ * \param[in]	size						Stream size in bytes.
+ * \param[in]	startOffset					Start offset in bytes.
+ * \param[in]	endOffset					Offset the frame must start before, in bytes.
+ * \param[out]	pOffset						Frame offset in bytes.
+ * \return									True if SYNC bytes have been found.
+ */
+static bool sbgEComDecoderFindSyncBytes(const uint8_t *pBuffer, size_t size, size_t startOffset, size_t endOffset, size_t *pOffset)
+{
+	const uint8_t	*pSync;
+	bool			 found = false;
+
+	assert(pBuffer);
+	assert(endOffset <= size);
+	assert(pOffset);
+
+	while ((!found) && (startOffset < endOffset))
+	{
+		pSync = memchr(&pBuffer[startOffset], SBG_ECOM_SYNC_1, endOffset - startOffset);
+
+		if (pSync)
+		{
+			startOffset = (size_t)(pSync - pBuffer);
+
+			if (((startOffset + 1) < size) && (pBuffer[startOffset + 1] == SBG_ECOM_SYNC_2))
+			{
+				*pOffset	= startOffset;
+				found		= true;
+			}
+			else
+			{
+				startOffset++;
+			}
+		}
+		else
+		{
+			startOffset = endOffset;
+		}
+	}
+
+	return found;
+}
+
+/*!
+ * Parse and check a frame.
+ *
+ * Unlike the protocol parser, invalid frames are silently rejected as the stream is
+ * probed at arbitrary offsets.
+ *
+ * \param[in]	pBuffer						Stream.
+ * \param[in]	size						Stream size in bytes.
+ * \param[in]	offset						Frame offset in bytes, SYNC bytes included.
+ * \param[out]	pFrame						Frame.
+ * \return									SBG_NO_ERROR if successful,
+ *											SBG_NOT_READY if the frame is truncated by the end of the stream,
+ *											SBG_INVALID_FRAME or SBG_INVALID_CRC if the frame is invalid.
+ */
+static SbgErrorCode sbgEComDecoderParseFrame(const uint8_t *pBuffer, size_t size, size_t offset, SbgEComDecoderFrame *pFrame)
+{
+	SbgErrorCode		errorCode = SBG_NO_ERROR;
+	SbgStreamBuffer		inputStream;
+	size_t				standardPayloadSize;
+	uint16_t			frameCrc;
+
+	assert(pBuffer);
+	assert(offset < size);
+	assert(pFrame);
+
+	sbgStreamBufferInitForRead(&inputStream, &pBuffer[offset], size - offset);
+
+	//
+	// Skip SYNC bytes
+	//
+	sbgStreamBufferSeek(&inputStream, 2, SB_SEEK_CUR_INC);
+
+	pFrame->msgId		= sbgStreamBufferReadUint8(&inputStream);
+	pFrame->msgClass	= sbgStreamBufferReadUint8(&inputStream);
+	standardPayloadSize	= sbgStreamBufferReadUint16LE(&inputStream);
+
+	if (sbgStreamBufferGetLastError(&inputStream) != SBG_NO_ERROR)
+	{
+		errorCode = SBG_NOT_READY;
+	}
+	else if (standardPayloadSize > SBG_ECOM_MAX_PAYLOAD_SIZE)
+	{
+		errorCode = SBG_INVALID_FRAME;
+	}
+	else if ((size - offset) < (standardPayloadSize + SBG_ECOM_DECODER_FRAME_OVERHEAD))
+	{
+		errorCode = SBG_NOT_READY;
+	}
+	else if (pBuffer[offset + standardPayloadSize + SBG_ECOM_DECODER_FRAME_OVERHEAD - 1] != SBG_ECOM_ETX)
+	{
+		errorCode = SBG_INVALID_FRAME;
+	}
+	else
+	{
+		if ((pFrame->msgClass & 0x80) == 0)
+		{
+			pFrame->payloadSize	= standardPayloadSize;
+			pFrame->transferId	= 0;
+			pFrame->pageIndex	= 0;
+			pFrame->nrPages		= 0;
+		}
+		else if (standardPayloadSize >= SBG_ECOM_DECODER_EXTENDED_HEADER_SIZE)
+		{
+			//
+			// In extended frames, the payload size includes the extended headers
+			//
+			pFrame->msgClass	&= 0x7f;
+			pFrame->payloadSize	 = standardPayloadSize - SBG_ECOM_DECODER_EXTENDED_HEADER_SIZE;
+			pFrame->transferId	 = sbgStreamBufferReadUint8(&inputStream);
+			pFrame->pageIndex	 = sbgStreamBufferReadUint16LE(&inputStream);
+			pFrame->nrPages		 = sbgStreamBufferReadUint16LE(&inputStream);
+
+			//
+			// Reserved transfer ID bits must be cleared
+			//
+			if (((pFrame->transferId & 0xf0) != 0) || (pFrame->pageIndex >= pFrame->nrPages))
+			{
+				errorCode = SBG_INVALID_FRAME;
+			}
+		}
+		else
+		{
+			errorCode = SBG_INVALID_FRAME;
+		}
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			pFrame->pPayload = sbgStreamBufferGetCursor(&inputStream);
+
+			sbgStreamBufferSeek(&inputStream, pFrame->payloadSize, SB_SEEK_CUR_INC);
+			frameCrc = sbgStreamBufferReadUint16LE(&inputStream);
+
+			//
+			// The CRC spans from the header (excluding the SYNC bytes) up to the CRC bytes
+			//
+			if (frameCrc == sbgCrc16Compute(&pBuffer[offset + 2], standardPayloadSize + 4))
+			{
+				pFrame->offset		= offset;
+				pFrame->endOffset	= offset + standardPayloadSize + SBG_ECOM_DECODER_FRAME_OVERHEAD;
+			}
+			else
+			{
+				errorCode = SBG_INVALID_CRC;
+			}
+		}
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Find the first frame boundary at or after a given offset.
+ *
+ * A frame boundary is the start of a valid frame followed by SBG_ECOM_DECODER_SYNC_CHAIN_LENGTH - 1
+ * other valid frames, or by the end of the stream. It makes a match on SYNC bytes and CRC found
+ * in the middle of a payload very unlikely.
+ *
+ * \param[in]	pBuffer						Stream.
+ * \param[in]	size						Stream size in bytes.
+ * \param[in]	startOffset					Start offset in bytes.
+ * \return									Frame boundary offset, the stream size if none has been found.
+ */
+static size_t sbgEComDecoderFindBoundary(const uint8_t *pBuffer, size_t size, size_t startOffset)
+{
+	SbgEComDecoderFrame		frame;
+	size_t					boundary = size;
+	size_t					offset;
+	size_t					frameOffset;
+	bool					valid;
+
+	assert(pBuffer);
+
+	while (sbgEComDecoderFindSyncBytes(pBuffer, size, startOffset, size, &offset))
+	{
+		valid		= true;
+		frameOffset	= offset;
+
+		for (size_t i = 0; (i < SBG_ECOM_DECODER_SYNC_CHAIN_LENGTH) && (frameOffset < size); i++)
+		{
+			SbgErrorCode	errorCode;
+
+			errorCode = sbgEComDecoderParseFrame(pBuffer, size, frameOffset, &frame);
+
+			if (errorCode == SBG_NO_ERROR)
+			{
+				frameOffset = frame.endOffset;
+			}
+			else
+			{
+				//
+				// A frame truncated by the end of the stream only invalidates the first frame
+				//
+				valid = ((errorCode == SBG_NOT_READY) && (i != 0));
+				break;
+			}
+		}
+
+		if (valid)
+		{
+			boundary = offset;
+			break;
+		}
+
+		startOffset = offset + 2;
+	}
+
+	return boundary;
+}
+
+//----------------------------------------------------------------------//
+//- Private methods (chunks)                                           -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Chunk constructor.
+ *
+ * \param[out]	pChunk						Chunk.
+ */
+static void sbgEComDecoderChunkConstruct(SbgEComDecoderChunk *pChunk)
+{
+	assert(pChunk);
+
+	memset(pChunk, 0, sizeof(*pChunk));
+
+	sbgArenaConstruct(&pChunk->arena, 0);
+}
+
+/*!
+ * Chunk destructor.
+ *
+ * \param[in]	pChunk						Chunk.
+ */
+static void sbgEComDecoderChunkDestroy(SbgEComDecoderChunk *pChunk)
+{
+	assert(pChunk);
+
+	free(pChunk->pFrames);
+	sbgArenaDestroy(&pChunk->arena);
+}
+
+/*!
+ * Reset a chunk so it can be reused, allocated memory is kept.
+ *
+ * \param[in]	pChunk						Chunk.
+ */
+static void sbgEComDecoderChunkReset(SbgEComDecoderChunk *pChunk)
+{
+	assert(pChunk);
+
+	pChunk->nrFrames	= 0;
+	pChunk->errorCode	= SBG_NO_ERROR;
+	pChunk->decoded		= false;
+
+	sbgArenaReset(&pChunk->arena);
+}
+
+/*!
+ * Parse the log of a decoded frame.
+ *
+ * \param[in]	pDecoder					Decoder.
+ * \param[in]	pChunk						Chunk the parsed log is allocated from.
+ * \param[in,out]	pFrame					Frame.
+ * \return									SBG_NO_ERROR if successful, SBG_MALLOC_FAILED if the log can't be allocated.
+ */
+static SbgErrorCode sbgEComDecoderChunkParseLog(const SbgEComDecoder *pDecoder, SbgEComDecoderChunk *pChunk, SbgEComDecoderFrame *pFrame)
+{
+	SbgErrorCode		 errorCode = SBG_NO_ERROR;
+	SbgBinaryLogData	*pLogData;
+
+	assert(pDecoder);
+	assert(pChunk);
+	assert(pFrame);
+
+	pFrame->pLogData		= NULL;
+	pFrame->logDataSize		= 0;
+	pFrame->parseErrorCode	= SBG_ERROR;
+
+	if (pDecoder->parseLogs && sbgEComMsgClassIsALog((SbgEComClass)pFrame->msgClass) && (pFrame->nrPages == 0) && (pFrame->payloadSize > 0))
+	{
+		pFrame->logDataSize = sbgEComBinaryLogGetSize((SbgEComClass)pFrame->msgClass, (SbgEComMsgId)pFrame->msgId, pDecoder->rawViews);
+
+		if (pFrame->logDataSize != 0)
+		{
+			pLogData = sbgArenaAlloc(&pChunk->arena, pFrame->logDataSize, sizeof(uint64_t));
+
+			if (pLogData)
+			{
+				if (pDecoder->rawViews)
+				{
+					pFrame->parseErrorCode = sbgEComBinaryLogParseWithRawViews((SbgEComClass)pFrame->msgClass, (SbgEComMsgId)pFrame->msgId, pFrame->pPayload, pFrame->payloadSize, pLogData);
+				}
+				else
+				{
+					pFrame->parseErrorCode = sbgEComBinaryLogParse((SbgEComClass)pFrame->msgClass, (SbgEComMsgId)pFrame->msgId, pFrame->pPayload, pFrame->payloadSize, pLogData);
+				}
+
+				pFrame->pLogData = pLogData;
+			}
+			else
+			{
+				errorCode = SBG_MALLOC_FAILED;
+			}
+		}
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Decode a chunk.
+ *
+ * All frames starting within the chunk are decoded, including the last one that may
+ * end after the chunk.
+ *
+ * \param[in]	pDecoder					Decoder.
+ * \param[in]	chunkIndex					Chunk index.
+ * \param[out]	pChunk						Decoded chunk.
+ */
+static void sbgEComDecoderChunkDecode(const SbgEComDecoder *pDecoder, size_t chunkIndex, SbgEComDecoderChunk *pChunk)
+{
+	SbgEComDecoderFrame		*pFrame;
+	size_t					 startOffset;
+	size_t					 endOffset;
+	size_t					 offset;
+
+	assert(pDecoder);
+	assert(pChunk);
+
+	if (chunkIndex == 0)
+	{
+		startOffset = 0;
+	}
+	else
+	{
+		startOffset = sbgEComDecoderFindBoundary(pDecoder->pBuffer, pDecoder->size, chunkIndex * pDecoder->chunkSize);
+	}
+
+	if ((chunkIndex + 1) == pDecoder->nrChunks)
+	{
+		endOffset = pDecoder->size;
+	}
+	else
+	{
+		endOffset = sbgEComDecoderFindBoundary(pDecoder->pBuffer, pDecoder->size, (chunkIndex + 1) * pDecoder->chunkSize);
+	}
+
+	while ((pChunk->errorCode == SBG_NO_ERROR) && sbgEComDecoderFindSyncBytes(pDecoder->pBuffer, pDecoder->size, startOffset, endOffset, &offset))
+	{
+		if (pChunk->nrFrames == pChunk->framesCapacity)
+		{
+			SbgEComDecoderFrame		*pNewFrames;
+			size_t					 newCapacity;
+
+			newCapacity	= (pChunk->framesCapacity == 0) ? SBG_ECOM_DECODER_INITIAL_FRAMES_CAPACITY : (pChunk->framesCapacity * 2);
+			pNewFrames	= realloc(pChunk->pFrames, newCapacity * sizeof(*pNewFrames));
+
+			if (pNewFrames)
+			{
+				pChunk->pFrames			= pNewFrames;
+				pChunk->framesCapacity	= newCapacity;
+			}
+			else
+			{
+				pChunk->errorCode = SBG_MALLOC_FAILED;
+				break;
+			}
+		}
+
+		pFrame = &pChunk->pFrames[pChunk->nrFrames];
+
+		if (sbgEComDecoderParseFrame(pDecoder->pBuffer, pDecoder->size, offset, pFrame) == SBG_NO_ERROR)
+		{
+			pChunk->errorCode = sbgEComDecoderChunkParseLog(pDecoder, pChunk, pFrame);
+			pChunk->nrFrames++;
+
+			startOffset = pFrame->endOffset;
+		}
+		else
+		{
+			//
+			// Not a valid frame, skip SYNC bytes and try again
+			//
+			startOffset = offset + 2;
+		}
+	}
+}
+
+//----------------------------------------------------------------------//
+//- Private methods (merge)                                            -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Process an extended frame, the log is dispatched once all pages have been received.
+ *
+ * \param[in]	pDecoder					Decoder.
+ * \param[in]	pFrame						Extended frame.
+ */
+static void sbgEComDecoderMergeExtendedFrame(SbgEComDecoder *pDecoder, const SbgEComDecoderFrame *pFrame)
+{
+	SbgEComDecoderLargeTransfer	*pLargeTransfer;
+	SbgErrorCode				 errorCode;
+
+	assert(pDecoder);
+	assert(pFrame);
+
+	pLargeTransfer = &pDecoder->largeTransfer;
+
+	if (pLargeTransfer->inProgress)
+	{
+		if ((pFrame->msgClass != pLargeTransfer->msgClass) || (pFrame->msgId != pLargeTransfer->msgId) || (pFrame->transferId != pLargeTransfer->transferId) ||
+			(pFrame->nrPages != pLargeTransfer->nrPages) || (pFrame->pageIndex != pLargeTransfer->nextPageIndex))
+		{
+			SBG_LOG_WARNING(SBG_INVALID_FRAME, "large transfer interrupted at offset %zu", pFrame->offset);
+			pLargeTransfer->inProgress = false;
+		}
+	}
+
+	if ((!pLargeTransfer->inProgress) && (pFrame->pageIndex == 0))
+	{
+		pLargeTransfer->inProgress		= true;
+		pLargeTransfer->msgClass		= pFrame->msgClass;
+		pLargeTransfer->msgId			= pFrame->msgId;
+		pLargeTransfer->transferId		= pFrame->transferId;
+		pLargeTransfer->nrPages			= pFrame->nrPages;
+		pLargeTransfer->nextPageIndex	= 0;
+		pLargeTransfer->size			= 0;
+	}
+
+	if (pLargeTransfer->inProgress)
+	{
+		if ((pLargeTransfer->size + pFrame->payloadSize) > pLargeTransfer->capacity)
+		{
+			uint8_t		*pNewBuffer;
+			size_t		 newCapacity;
+
+			newCapacity	= sbgMax(pLargeTransfer->capacity * 2, pLargeTransfer->size + pFrame->payloadSize);
+			pNewBuffer	= realloc(pLargeTransfer->pBuffer, newCapacity);
+
+			if (pNewBuffer)
+			{
+				pLargeTransfer->pBuffer		= pNewBuffer;
+				pLargeTransfer->capacity	= newCapacity;
+			}
+			else
+			{
+				SBG_LOG_ERROR(SBG_MALLOC_FAILED, "unable to allocate large transfer buffer");
+				pLargeTransfer->inProgress = false;
+			}
+		}
+	}
+
+	if (pLargeTransfer->inProgress)
+	{
+		memcpy(&pLargeTransfer->pBuffer[pLargeTransfer->size], pFrame->pPayload, pFrame->payloadSize);
+
+		pLargeTransfer->size += pFrame->payloadSize;
+		pLargeTransfer->nextPageIndex++;
+
+		if (pLargeTransfer->nextPageIndex == pLargeTransfer->nrPages)
+		{
+			pLargeTransfer->inProgress = false;
+
+			//
+			// Logs larger than a standard frame payload are rejected as sbgEComHandle() does
+			//
+			if (pLargeTransfer->size > SBG_ECOM_MAX_PAYLOAD_SIZE)
+			{
+				SBG_LOG_WARNING(SBG_BUFFER_OVERFLOW, "large transfer of %zu bytes ignored", pLargeTransfer->size);
+			}
+			else if (pLargeTransfer->size > 0)
+			{
+				errorCode = sbgEComHandleLogPayload(pDecoder->pHandle, (SbgEComClass)pLargeTransfer->msgClass, (SbgEComMsgId)pLargeTransfer->msgId, pLargeTransfer->pBuffer, pLargeTransfer->size);
+
+				pDecoder->stats.nrLogs++;
+
+				if (errorCode != SBG_NO_ERROR)
+				{
+					pDecoder->stats.nrCallbackErrors++;
+				}
+			}
+		}
+	}
+}
+
+/*!
+ * Dispatch the log of a standard frame to the handle callbacks.
+ *
+ * The log is dispatched by sbgEComHandleLogPayload2() with the log parsed by a worker, if any,
+ * so callbacks and the snapshot store are handled exactly as for sbgEComHandleLogPayload().
+ *
+ * \param[in]	pDecoder					Decoder.
+ * \param[in]	pFrame						Frame.
+ */
+static void sbgEComDecoderMergeLog(SbgEComDecoder *pDecoder, const SbgEComDecoderFrame *pFrame)
+{
+	SbgErrorCode		 errorCode;
+	SbgBinaryLogData	 logData;
+	SbgBinaryLogData	*pLogData = NULL;
+
+	assert(pDecoder);
+	assert(pFrame);
+
+	//
+	// Logs that failed to be parsed by a worker are parsed again by the handle to report the error
+	//
+	if (pFrame->parseErrorCode == SBG_NO_ERROR)
+	{
+		memcpy(&logData, pFrame->pLogData, pFrame->logDataSize);
+		pLogData = &logData;
+	}
+
+	errorCode = sbgEComHandleLogPayload2(pDecoder->pHandle, (SbgEComClass)pFrame->msgClass, (SbgEComMsgId)pFrame->msgId, pFrame->pPayload, pFrame->payloadSize, pLogData);
+
+	pDecoder->stats.nrLogs++;
+
+	if (pDecoder->parseLogs && (pFrame->parseErrorCode != SBG_NO_ERROR))
+	{
+		pDecoder->stats.nrParseErrors++;
+	}
+	else if (errorCode != SBG_NO_ERROR)
+	{
+		pDecoder->stats.nrCallbackErrors++;
+	}
+}
+
+/*!
+ * Merge a decoded chunk.
+ *
+ * Frames ending after the chunk have already been merged with the previous chunk and
+ * are skipped.
+ *
+ * \param[in]	pDecoder					Decoder.
+ * \param[in]	pChunk						Decoded chunk.
+ */
+static void sbgEComDecoderMergeChunk(SbgEComDecoder *pDecoder, const SbgEComDecoderChunk *pChunk)
+{
+	const SbgEComDecoderFrame	*pFrame;
+
+	assert(pDecoder);
+	assert(pChunk);
+
+	for (size_t i = 0; i < pChunk->nrFrames; i++)
+	{
+		pFrame = &pChunk->pFrames[i];
+
+		if (pFrame->offset >= pDecoder->mergeOffset)
+		{
+			pDecoder->mergeOffset	 = pFrame->endOffset;
+			pDecoder->nrFrameBytes	+= pFrame->endOffset - pFrame->offset;
+			pDecoder->stats.nrFrames++;
+
+			if (sbgEComMsgClassIsALog((SbgEComClass)pFrame->msgClass))
+			{
+				if (pFrame->nrPages == 0)
+				{
+					sbgEComDecoderMergeLog(pDecoder, pFrame);
+				}
+				else
+				{
+					sbgEComDecoderMergeExtendedFrame(pDecoder, pFrame);
+				}
+			}
+		}
+	}
+
+	pDecoder->stats.nrChunks++;
+}
+
+//----------------------------------------------------------------------//
+//- Private methods (scheduling)                                       -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Decode and merge all chunks from the calling thread.
+ *
+ * \param[in]	pDecoder					Decoder.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComDecoderRunSequential(SbgEComDecoder *pDecoder)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+	SbgEComDecoderChunk		*pChunk;
+
+	assert(pDecoder);
+	assert(pDecoder->nrSlots > 0);
+
+	pChunk = &pDecoder->pSlots[0];
+
+	for (size_t i = 0; (errorCode == SBG_NO_ERROR) && (i < pDecoder->nrChunks); i++)
+	{
+		sbgEComDecoderChunkDecode(pDecoder, i, pChunk);
+
+		errorCode = pChunk->errorCode;
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			sbgEComDecoderMergeChunk(pDecoder, pChunk);
+		}
+
+		sbgEComDecoderChunkReset(pChunk);
+	}
+
+	return errorCode;
+}
+
+#ifdef SBG_ECOM_DECODER_USE_THREADS
+/*!
+ * Worker thread decoding chunks.
+ *
+ * Chunks are taken in order, a worker waits if too many chunks are decoded ahead of the merge.
+ *
+ * \param[in]	pArg						Decoder.
+ * \return									NULL.
+ */
+static void *sbgEComDecoderWorker(void *pArg)
+{
+	SbgEComDecoder			*pDecoder = pArg;
+	SbgEComDecoderChunk		*pChunk;
+	size_t					 chunkIndex;
+
+	assert(pDecoder);
+
+	pthread_mutex_lock(&pDecoder->mutex);
+
+	for (;;)
+	{
+		while ((!pDecoder->aborted) && (pDecoder->nextChunk < pDecoder->nrChunks) && (pDecoder->nextChunk >= (pDecoder->nextMerge + pDecoder->nrSlots)))
+		{
+			pthread_cond_wait(&pDecoder->cond, &pDecoder->mutex);
+		}
+
+		if ((pDecoder->aborted) || (pDecoder->nextChunk >= pDecoder->nrChunks))
+		{
+			break;
+		}
+
+		chunkIndex	= pDecoder->nextChunk++;
+		pChunk		= &pDecoder->pSlots[chunkIndex % pDecoder->nrSlots];
+
+		pthread_mutex_unlock(&pDecoder->mutex);
+
+		sbgEComDecoderChunkDecode(pDecoder, chunkIndex, pChunk);
+
+		pthread_mutex_lock(&pDecoder->mutex);
+
+		pChunk->decoded = true;
+		pthread_cond_broadcast(&pDecoder->cond);
+	}
+
+	pthread_mutex_unlock(&pDecoder->mutex);
+
+	return NULL;
+}
+
+/*!
+ * Decode chunks on worker threads and merge them from the calling thread.
+ *
+ * \param[in]	pDecoder					Decoder.
+ * \param[in]	nrWorkers					Number of worker threads.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComDecoderRunParallel(SbgEComDecoder *pDecoder, uint32_t nrWorkers)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+	pthread_t				 threads[SBG_ECOM_DECODER_MAX_WORKERS];
+	uint32_t				 nrThreads;
+	SbgEComDecoderChunk		*pChunk;
+
+	assert(pDecoder);
+	assert(nrWorkers <= SBG_ECOM_DECODER_MAX_WORKERS);
+
+	pthread_mutex_init(&pDecoder->mutex, NULL);
+	pthread_cond_init(&pDecoder->cond, NULL);
+
+	for (nrThreads = 0; nrThreads < nrWorkers; nrThreads++)
+	{
+		if (pthread_create(&threads[nrThreads], NULL, sbgEComDecoderWorker, pDecoder) != 0)
+		{
+			SBG_LOG_WARNING(SBG_ERROR, "unable to create worker thread %" PRIu32, nrThreads);
+			break;
+		}
+	}
+
+	if (nrThreads > 0)
+	{
+		pDecoder->stats.nrWorkers = nrThreads;
+
+		for (size_t i = 0; (errorCode == SBG_NO_ERROR) && (i < pDecoder->nrChunks); i++)
+		{
+			pChunk = &pDecoder->pSlots[i % pDecoder->nrSlots];
+
+			pthread_mutex_lock(&pDecoder->mutex);
+
+			while (!pChunk->decoded)
+			{
+				pthread_cond_wait(&pDecoder->cond, &pDecoder->mutex);
+			}
+
+			pthread_mutex_unlock(&pDecoder->mutex);
+
+			errorCode = pChunk->errorCode;
+
+			if (errorCode == SBG_NO_ERROR)
+			{
+				sbgEComDecoderMergeChunk(pDecoder, pChunk);
+			}
+
+			sbgEComDecoderChunkReset(pChunk);
+
+			pthread_mutex_lock(&pDecoder->mutex);
+
+			pDecoder->nextMerge++;
+			pDecoder->aborted = (errorCode != SBG_NO_ERROR);
+			pthread_cond_broadcast(&pDecoder->cond);
+
+			pthread_mutex_unlock(&pDecoder->mutex);
+		}
+
+		for (uint32_t i = 0; i < nrThreads; i++)
+		{
+			pthread_join(threads[i], NULL);
+		}
+	}
+	else
+	{
+		errorCode = sbgEComDecoderRunSequential(pDecoder);
+	}
+
+	pthread_cond_destroy(&pDecoder->cond);
+	pthread_mutex_destroy(&pDecoder->mutex);
+
+	return errorCode;
+}
+#endif // SBG_ECOM_DECODER_USE_THREADS
+
+/*!
+ * Returns the number of available CPUs.
+ *
+ * \return									Number of available CPUs.
+ */
+static uint32_t sbgEComDecoderGetNrCpus(void)
+{
+	uint32_t	nrCpus = 1;
+
+#ifdef SBG_ECOM_DECODER_USE_THREADS
+	long		result;
+
+	result = sysconf(_SC_NPROCESSORS_ONLN);
+
+	if (result > 0)
+	{
+		nrCpus = (uint32_t)result;
+	}
+#endif
+
+	return nrCpus;
+}
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+SbgErrorCode sbgEComDecoderDecodeBuffer(SbgEComHandle *pHandle, const void *pBuffer, size_t size, uint32_t nrWorkers, size_t chunkSize, SbgEComDecoderStats *pStats)
+{
+	SbgErrorCode		errorCode = SBG_NO_ERROR;
+	SbgEComDecoder		decoder;
+
+	assert(pHandle);
+	assert(pBuffer || (size == 0));
+
+	memset(&decoder, 0, sizeof(decoder));
+
+	if (nrWorkers == 0)
+	{
+		nrWorkers = sbgEComDecoderGetNrCpus();
+	}
+
+	if (chunkSize == 0)
+	{
+		chunkSize = SBG_ECOM_DECODER_DEFAULT_CHUNK_SIZE;
+	}
+
+	decoder.pHandle		= pHandle;
+	decoder.pBuffer		= pBuffer;
+	decoder.size		= size;
+	decoder.chunkSize	= chunkSize;
+	decoder.nrChunks	= (size / chunkSize) + (((size % chunkSize) != 0) ? 1 : 0);
+	decoder.parseLogs	= (pHandle->pReceiveLogCallback != NULL) || (pHandle->pSnapshotStore != NULL);
+	decoder.rawViews	= pHandle->rawDataViews;
+
+	nrWorkers			= (uint32_t)sbgMin(sbgMin(nrWorkers, SBG_ECOM_DECODER_MAX_WORKERS), sbgMax(decoder.nrChunks, 1));
+	decoder.nrSlots		= (nrWorkers > 1) ? (nrWorkers * SBG_ECOM_DECODER_SLOTS_PER_WORKER) : 1;
+	decoder.pSlots		= malloc(decoder.nrSlots * sizeof(*decoder.pSlots));
+
+	decoder.stats.nrWorkers	= 1;
+	decoder.stats.nrBytes	= size;
+
+	if (decoder.pSlots)
+	{
+		for (size_t i = 0; i < decoder.nrSlots; i++)
+		{
+			sbgEComDecoderChunkConstruct(&decoder.pSlots[i]);
+		}
+
+#ifdef SBG_ECOM_DECODER_USE_THREADS
+		if (nrWorkers > 1)
+		{
+			errorCode = sbgEComDecoderRunParallel(&decoder, nrWorkers);
+		}
+		else
+#endif
+		{
+			errorCode = sbgEComDecoderRunSequential(&decoder);
+		}
+
+		for (size_t i = 0; i < decoder.nrSlots; i++)
+		{
+			sbgEComDecoderChunkDestroy(&decoder.pSlots[i]);
+		}
+
+		free(decoder.pSlots);
+		free(decoder.largeTransfer.pBuffer);
+
+		decoder.stats.nrSkippedBytes = decoder.size - decoder.nrFrameBytes;
+	}
+	else
+	{
+		errorCode = SBG_MALLOC_FAILED;
+		SBG_LOG_ERROR(errorCode, "unable to allocate decoder chunks");
+	}
+
+	if (pStats)
+	{
+		*pStats = decoder.stats;
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComDecoderDecodeFile(SbgEComHandle *pHandle, const char *pPath, uint32_t nrWorkers, size_t chunkSize, SbgEComDecoderStats *pStats)
+{
+	SbgErrorCode		errorCode;
+	SbgFileMap			fileMap;
+
+	assert(pHandle);
+	assert(pPath);
+
+	errorCode = sbgFileMapOpen(&fileMap, pPath);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		errorCode = sbgEComDecoderDecodeBuffer(pHandle, sbgFileMapGetBuffer(&fileMap), sbgFileMapGetSize(&fileMap), nrWorkers, chunkSize, pStats);
+
+		sbgFileMapClose(&fileMap);
+	}
+
+	return errorCode;
+}
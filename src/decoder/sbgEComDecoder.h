@@ -0,0 +1,135 @@
+﻿/*!
+ * \file			sbgEComDecoder.h
+ * \author			SBG Systems
+ * \date			19 October 2026
+ *
+ * \brief			Parallel offline decoder of recorded sbgECom streams.
+ *
+ *				A recorded stream, as written by a device on a serial or Ethernet link, is split
+ *				into chunks that start on verified frame boundaries: a SYNC sequence followed by
+ *				a valid frame and a chain of valid frames. Chunks are decoded by a pool of worker
+ *				threads, frames are CRC checked and logs parsed, then results are merged back in
+ *				stream order and dispatched to the callbacks of an sbgECom handle.
+ *
+ *				A frame is owned by the chunk it starts in, so frames spanning a chunk boundary
+ *				are decoded once by the preceding chunk.
+ *
+ *				Only a bounded number of chunks are decoded ahead of the merge, keeping the memory
+ *				usage independent of the stream size. Platforms without POSIX threads decode the
+ *				chunks sequentially.
+ *
+ * \copyright		Copyright (C) 2022, SBG Systems SAS. All rights reserved.
+ * \beginlicense	The MIT license
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * \endlicense
+ */
+
+#ifndef SBG_ECOM_DECODER_H
+#define SBG_ECOM_DECODER_H
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+// Project headers
+#include <sbgECom.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Default chunk size in bytes.
+ */
+#define SBG_ECOM_DECODER_DEFAULT_CHUNK_SIZE				(4u * 1024u * 1024u)
+
+/*!
+ * Maximum number of worker threads.
+ */
+#define SBG_ECOM_DECODER_MAX_WORKERS					(64)
+
+/*!
+ * Number of valid frames that must follow a chunk start to consider it as a frame boundary.
+ */
+#define SBG_ECOM_DECODER_SYNC_CHAIN_LENGTH				(3)
+
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Decoding statistics.
+ */
+typedef struct _SbgEComDecoderStats
+{
+	size_t						 nrChunks;					/*!< Number of decoded chunks. */
+	uint32_t					 nrWorkers;					/*!< Number of worker threads used. */
+	uint64_t					 nrBytes;					/*!< Stream size in bytes. */
+	uint64_t					 nrFrames;					/*!< Number of valid frames. */
+	uint64_t					 nrLogs;					/*!< Number of logs dispatched to the handle. */
+	uint64_t					 nrParseErrors;				/*!< Number of logs that couldn't be parsed. */
+	uint64_t					 nrCallbackErrors;			/*!< Number of logs the handle callbacks have failed to process. */
+	uint64_t					 nrSkippedBytes;			/*!< Number of bytes outside of valid frames. */
+} SbgEComDecoderStats;
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Decode a recorded stream held in memory.
+ *
+ * Logs are dispatched to the handle callbacks from the calling thread, in stream order,
+ * exactly as sbgEComHandleLogPayload() would. Only log frames are dispatched and the buffer
+ * must remain valid during the whole call.
+ *
+ * \param[in]	pHandle						sbgECom handle the logs are dispatched to.
+ * \param[in]	pBuffer						Recorded stream.
+ * \param[in]	size						Recorded stream size in bytes.
+ * \param[in]	nrWorkers					Number of worker threads, 0 to use one per available CPU.
+ * \param[in]	chunkSize					Chunk size in bytes, 0 for SBG_ECOM_DECODER_DEFAULT_CHUNK_SIZE.
+ * \param[out]	pStats						Decoding statistics, may be NULL.
+ * \return									SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComDecoderDecodeBuffer(SbgEComHandle *pHandle, const void *pBuffer, size_t size, uint32_t nrWorkers, size_t chunkSize, SbgEComDecoderStats *pStats);
+
+/*!
+ * Decode a recorded stream file.
+ *
+ * The file is memory mapped and decoded with sbgEComDecoderDecodeBuffer().
+ *
+ * \param[in]	pHandle						sbgECom handle the logs are dispatched to.
+ * \param[in]	pPath						Recorded stream file path.
+ * \param[in]	nrWorkers					Number of worker threads, 0 to use one per available CPU.
+ * \param[in]	chunkSize					Chunk size in bytes, 0 for SBG_ECOM_DECODER_DEFAULT_CHUNK_SIZE.
+ * \param[out]	pStats						Decoding statistics, may be NULL.
+ * \return									SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComDecoderDecodeFile(SbgEComHandle *pHandle, const char *pPath, uint32_t nrWorkers, size_t chunkSize, SbgEComDecoderStats *pStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_ECOM_DECODER_H
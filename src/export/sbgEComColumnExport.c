@@ -0,0 +1,801 @@
+﻿// sbgCommonLib headers
+#include <sbgCommon.h>
+
+// Local headers
+#include "sbgEComColumnExport.h"
+
+//----------------------------------------------------------------------//
+//- Private definitions                                                -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Maximum size of a column file path, including the null terminating character.
+ */
+#define SBG_ECOM_COLUMN_EXPORT_FILE_PATH_MAX_SIZE		(SBG_ECOM_COLUMN_EXPORT_PATH_MAX_SIZE + 64)
+
+/*!
+ * Describes how a log structure field is stored in a column file.
+ */
+typedef struct _SbgEComColumnExportFieldDesc
+{
+	const char		*pName;									/*!< Column name. */
+	size_t			 offset;								/*!< Offset of the field in the log structure. */
+	size_t			 size;									/*!< Field size in bytes. */
+	char			 kind;									/*!< numpy dtype kind, 'u' for unsigned, 'i' for signed integers and 'f' for floats. */
+} SbgEComColumnExportFieldDesc;
+
+/*!
+ * Describes an exported log type.
+ */
+typedef struct _SbgEComColumnExportLogDesc
+{
+	const char							*pName;				/*!< Log name. */
+	SbgEComClass						 msgClass;			/*!< Log class. */
+	SbgEComMsgId						 msgId;				/*!< Log message ID. */
+	const SbgEComColumnExportFieldDesc	*pFields;			/*!< Field descriptors. */
+	size_t								 nrFields;			/*!< Number of field descriptors. */
+} SbgEComColumnExportLogDesc;
+
+/*!
+ * Column file.
+ */
+typedef struct _SbgEComColumnExportColumn
+{
+	FILE			*pFile;									/*!< Column file. */
+	uint8_t			*pBuffer;								/*!< Write buffer. */
+	size_t			 length;								/*!< Number of bytes in the write buffer. */
+} SbgEComColumnExportColumn;
+
+/*!
+ * Export state of a log type.
+ */
+struct _SbgEComColumnExportLog
+{
+	SbgEComColumnExportColumn		*pColumns;				/*!< Columns, NULL until the first log of this type is exported. */
+	uint64_t						 nrRows;				/*!< Number of exported logs. */
+};
+
+/*!
+ * Build a field descriptor.
+ */
+#define SBG_ECOM_COLUMN_EXPORT_FIELD(logType, field, name, kind)	{ name, offsetof(logType, field), sizeof(((logType*)0)->field), kind }
+
+/*!
+ * SBG_ECOM_LOG_STATUS fields.
+ */
+static const SbgEComColumnExportFieldDesc gStatusFields[] =
+{
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogStatusData, timeStamp,			"time_stamp",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogStatusData, generalStatus,		"general_status",		'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogStatusData, comStatus,			"com_status",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogStatusData, aidingStatus,		"aiding_status",		'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogStatusData, uptime,				"uptime",				'u'),
+};
+
+/*!
+ * SBG_ECOM_LOG_UTC_TIME fields.
+ */
+static const SbgEComColumnExportFieldDesc gUtcFields[] =
+{
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogUtcData, timeStamp,				"time_stamp",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogUtcData, status,					"status",				'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogUtcData, year,					"year",					'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogUtcData, month,					"month",				'i'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogUtcData, day,					"day",					'i'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogUtcData, hour,					"hour",					'i'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogUtcData, minute,					"minute",				'i'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogUtcData, second,					"second",				'i'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogUtcData, nanoSecond,				"nano_second",			'i'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogUtcData, gpsTimeOfWeek,			"gps_time_of_week",		'u'),
+};
+
+/*!
+ * SBG_ECOM_LOG_IMU_DATA fields.
+ */
+static const SbgEComColumnExportFieldDesc gImuDataFields[] =
+{
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogImuData, timeStamp,				"time_stamp",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogImuData, status,					"status",				'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogImuData, accelerometers[0],		"accelerometer_x",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogImuData, accelerometers[1],		"accelerometer_y",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogImuData, accelerometers[2],		"accelerometer_z",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogImuData, gyroscopes[0],			"gyroscope_x",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogImuData, gyroscopes[1],			"gyroscope_y",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogImuData, gyroscopes[2],			"gyroscope_z",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogImuData, temperature,			"temperature",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogImuData, deltaVelocity[0],		"delta_velocity_x",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogImuData, deltaVelocity[1],		"delta_velocity_y",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogImuData, deltaVelocity[2],		"delta_velocity_z",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogImuData, deltaAngle[0],			"delta_angle_x",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogImuData, deltaAngle[1],			"delta_angle_y",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogImuData, deltaAngle[2],			"delta_angle_z",		'f'),
+};
+
+/*!
+ * SBG_ECOM_LOG_FAST_IMU_DATA fields.
+ */
+static const SbgEComColumnExportFieldDesc gFastImuFields[] =
+{
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogFastImuData, timeStamp,			"time_stamp",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogFastImuData, status,				"status",				'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogFastImuData, accelerometers[0],	"accelerometer_x",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogFastImuData, accelerometers[1],	"accelerometer_y",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogFastImuData, accelerometers[2],	"accelerometer_z",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogFastImuData, gyroscopes[0],		"gyroscope_x",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogFastImuData, gyroscopes[1],		"gyroscope_y",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogFastImuData, gyroscopes[2],		"gyroscope_z",			'f'),
+};
+
+/*!
+ * SBG_ECOM_LOG_MAG fields.
+ */
+static const SbgEComColumnExportFieldDesc gMagFields[] =
+{
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogMag, timeStamp,					"time_stamp",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogMag, status,						"status",				'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogMag, magnetometers[0],			"magnetometer_x",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogMag, magnetometers[1],			"magnetometer_y",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogMag, magnetometers[2],			"magnetometer_z",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogMag, accelerometers[0],			"accelerometer_x",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogMag, accelerometers[1],			"accelerometer_y",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogMag, accelerometers[2],			"accelerometer_z",		'f'),
+};
+
+/*!
+ * SBG_ECOM_LOG_EKF_EULER fields.
+ */
+static const SbgEComColumnExportFieldDesc gEkfEulerFields[] =
+{
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfEulerData, timeStamp,			"time_stamp",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfEulerData, euler[0],			"roll",					'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfEulerData, euler[1],			"pitch",				'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfEulerData, euler[2],			"yaw",					'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfEulerData, eulerStdDev[0],	"roll_std_dev",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfEulerData, eulerStdDev[1],	"pitch_std_dev",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfEulerData, eulerStdDev[2],	"yaw_std_dev",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfEulerData, status,			"status",				'u'),
+};
+
+/*!
+ * SBG_ECOM_LOG_EKF_QUAT fields.
+ */
+static const SbgEComColumnExportFieldDesc gEkfQuatFields[] =
+{
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfQuatData, timeStamp,			"time_stamp",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfQuatData, quaternion[0],		"quaternion_w",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfQuatData, quaternion[1],		"quaternion_x",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfQuatData, quaternion[2],		"quaternion_y",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfQuatData, quaternion[3],		"quaternion_z",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfQuatData, eulerStdDev[0],		"roll_std_dev",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfQuatData, eulerStdDev[1],		"pitch_std_dev",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfQuatData, eulerStdDev[2],		"yaw_std_dev",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfQuatData, status,				"status",				'u'),
+};
+
+/*!
+ * SBG_ECOM_LOG_EKF_NAV fields.
+ */
+static const SbgEComColumnExportFieldDesc gEkfNavFields[] =
+{
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfNavData, timeStamp,			"time_stamp",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfNavData, velocity[0],			"velocity_north",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfNavData, velocity[1],			"velocity_east",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfNavData, velocity[2],			"velocity_down",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfNavData, velocityStdDev[0],	"velocity_north_std_dev",	'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfNavData, velocityStdDev[1],	"velocity_east_std_dev",	'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfNavData, velocityStdDev[2],	"velocity_down_std_dev",	'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfNavData, position[0],			"latitude",				'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfNavData, position[1],			"longitude",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfNavData, position[2],			"altitude",				'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfNavData, undulation,			"undulation",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfNavData, positionStdDev[0],	"latitude_std_dev",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfNavData, positionStdDev[1],	"longitude_std_dev",	'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfNavData, positionStdDev[2],	"altitude_std_dev",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEkfNavData, status,				"status",				'u'),
+};
+
+/*!
+ * SBG_ECOM_LOG_SHIP_MOTION and SBG_ECOM_LOG_SHIP_MOTION_HP fields.
+ */
+static const SbgEComColumnExportFieldDesc gShipMotionFields[] =
+{
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogShipMotionData, timeStamp,		"time_stamp",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogShipMotionData, status,			"status",				'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogShipMotionData, mainHeavePeriod,	"main_heave_period",	'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogShipMotionData, shipMotion[0],	"surge",				'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogShipMotionData, shipMotion[1],	"sway",					'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogShipMotionData, shipMotion[2],	"heave",				'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogShipMotionData, shipAccel[0],	"surge_accel",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogShipMotionData, shipAccel[1],	"sway_accel",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogShipMotionData, shipAccel[2],	"heave_accel",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogShipMotionData, shipVel[0],		"surge_velocity",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogShipMotionData, shipVel[1],		"sway_velocity",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogShipMotionData, shipVel[2],		"heave_velocity",		'f'),
+};
+
+/*!
+ * SBG_ECOM_LOG_GPS#_VEL fields.
+ */
+static const SbgEComColumnExportFieldDesc gGpsVelFields[] =
+{
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsVel, timeStamp,				"time_stamp",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsVel, status,					"status",				'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsVel, timeOfWeek,				"time_of_week",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsVel, velocity[0],				"velocity_north",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsVel, velocity[1],				"velocity_east",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsVel, velocity[2],				"velocity_down",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsVel, velocityAcc[0],			"velocity_north_accuracy",	'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsVel, velocityAcc[1],			"velocity_east_accuracy",	'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsVel, velocityAcc[2],			"velocity_down_accuracy",	'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsVel, course,					"course",				'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsVel, courseAcc,				"course_accuracy",		'f'),
+};
+
+/*!
+ * SBG_ECOM_LOG_GPS#_POS fields.
+ */
+static const SbgEComColumnExportFieldDesc gGpsPosFields[] =
+{
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsPos, timeStamp,				"time_stamp",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsPos, status,					"status",				'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsPos, timeOfWeek,				"time_of_week",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsPos, latitude,				"latitude",				'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsPos, longitude,				"longitude",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsPos, altitude,				"altitude",				'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsPos, undulation,				"undulation",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsPos, latitudeAccuracy,		"latitude_accuracy",	'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsPos, longitudeAccuracy,		"longitude_accuracy",	'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsPos, altitudeAccuracy,		"altitude_accuracy",	'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsPos, numSvUsed,				"num_sv_used",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsPos, baseStationId,			"base_station_id",		'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsPos, differentialAge,			"differential_age",		'u'),
+};
+
+/*!
+ * SBG_ECOM_LOG_GPS#_HDT fields.
+ */
+static const SbgEComColumnExportFieldDesc gGpsHdtFields[] =
+{
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsHdt, timeStamp,				"time_stamp",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsHdt, status,					"status",				'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsHdt, timeOfWeek,				"time_of_week",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsHdt, heading,					"heading",				'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsHdt, headingAccuracy,			"heading_accuracy",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsHdt, pitch,					"pitch",				'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsHdt, pitchAccuracy,			"pitch_accuracy",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogGpsHdt, baseline,				"baseline",				'f'),
+};
+
+/*!
+ * SBG_ECOM_LOG_ODO_VEL fields.
+ */
+static const SbgEComColumnExportFieldDesc gOdometerFields[] =
+{
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogOdometerData, timeStamp,			"time_stamp",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogOdometerData, status,			"status",				'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogOdometerData, velocity,			"velocity",				'f'),
+};
+
+/*!
+ * SBG_ECOM_LOG_EVENT_# fields.
+ */
+static const SbgEComColumnExportFieldDesc gEventFields[] =
+{
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEvent, timeStamp,				"time_stamp",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEvent, status,					"status",				'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEvent, timeOffset0,				"time_offset_0",		'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEvent, timeOffset1,				"time_offset_1",		'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEvent, timeOffset2,				"time_offset_2",		'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogEvent, timeOffset3,				"time_offset_3",		'u'),
+};
+
+/*!
+ * SBG_ECOM_LOG_AIR_DATA fields.
+ */
+static const SbgEComColumnExportFieldDesc gAirDataFields[] =
+{
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogAirData, timeStamp,				"time_stamp",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogAirData, status,					"status",				'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogAirData, pressureAbs,			"pressure_abs",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogAirData, altitude,				"altitude",				'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogAirData, pressureDiff,			"pressure_diff",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogAirData, trueAirspeed,			"true_airspeed",		'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogAirData, airTemperature,			"air_temperature",		'f'),
+};
+
+/*!
+ * SBG_ECOM_LOG_DEPTH fields.
+ */
+static const SbgEComColumnExportFieldDesc gDepthFields[] =
+{
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogDepth, timeStamp,				"time_stamp",			'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogDepth, status,					"status",				'u'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogDepth, pressureAbs,				"pressure_abs",			'f'),
+	SBG_ECOM_COLUMN_EXPORT_FIELD(SbgLogDepth, altitude,					"altitude",				'f'),
+};
+
+/*!
+ * Build a log descriptor.
+ */
+#define SBG_ECOM_COLUMN_EXPORT_LOG(name, msgClass, msgId, fields)	{ name, msgClass, msgId, fields, SBG_ARRAY_SIZE(fields) }
+
+/*!
+ * Exported logs.
+ */
+static const SbgEComColumnExportLogDesc gLogDescs[] =
+{
+	SBG_ECOM_COLUMN_EXPORT_LOG("status",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_STATUS,			gStatusFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("utc_time",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_UTC_TIME,			gUtcFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("imu_data",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_IMU_DATA,			gImuDataFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("mag",				SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_MAG,				gMagFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("ekf_euler",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EKF_EULER,			gEkfEulerFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("ekf_quat",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EKF_QUAT,			gEkfQuatFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("ekf_nav",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EKF_NAV,			gEkfNavFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("ship_motion",		SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_SHIP_MOTION,		gShipMotionFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("ship_motion_hp",	SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_SHIP_MOTION_HP,	gShipMotionFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("gps1_vel",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_GPS1_VEL,			gGpsVelFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("gps1_pos",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_GPS1_POS,			gGpsPosFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("gps1_hdt",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_GPS1_HDT,			gGpsHdtFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("gps2_vel",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_GPS2_VEL,			gGpsVelFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("gps2_pos",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_GPS2_POS,			gGpsPosFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("gps2_hdt",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_GPS2_HDT,			gGpsHdtFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("odo_vel",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_ODO_VEL,			gOdometerFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("event_a",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EVENT_A,			gEventFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("event_b",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EVENT_B,			gEventFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("event_c",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EVENT_C,			gEventFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("event_d",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EVENT_D,			gEventFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("event_e",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EVENT_E,			gEventFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("event_out_a",		SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EVENT_OUT_A,		gEventFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("event_out_b",		SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_EVENT_OUT_B,		gEventFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("air_data",			SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_AIR_DATA,			gAirDataFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("depth",				SBG_ECOM_CLASS_LOG_ECOM_0,	SBG_ECOM_LOG_DEPTH,				gDepthFields),
+	SBG_ECOM_COLUMN_EXPORT_LOG("fast_imu_data",		SBG_ECOM_CLASS_LOG_ECOM_1,	SBG_ECOM_LOG_FAST_IMU_DATA,		gFastImuFields),
+};
+
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Returns the descriptor of a log type.
+ *
+ * \param[in]	msgClass					Log class.
+ * \param[in]	msg							Log message ID.
+ * \return									Index of the log descriptor, SBG_ARRAY_SIZE(gLogDescs) if the log isn't exported.
+ */
+static size_t sbgEComColumnExportFindLog(SbgEComClass msgClass, SbgEComMsgId msg)
+{
+	size_t		i;
+
+	for (i = 0; i < SBG_ARRAY_SIZE(gLogDescs); i++)
+	{
+		if ((gLogDescs[i].msgClass == msgClass) && (gLogDescs[i].msgId == msg))
+		{
+			break;
+		}
+	}
+
+	return i;
+}
+
+/*!
+ * Returns the size of the largest exported field.
+ *
+ * \return									Largest field size in bytes.
+ */
+static size_t sbgEComColumnExportGetMaxFieldSize(void)
+{
+	size_t		maxSize = 0;
+
+	for (size_t i = 0; i < SBG_ARRAY_SIZE(gLogDescs); i++)
+	{
+		for (size_t j = 0; j < gLogDescs[i].nrFields; j++)
+		{
+			maxSize = sbgMax(maxSize, gLogDescs[i].pFields[j].size);
+		}
+	}
+
+	return maxSize;
+}
+
+/*!
+ * Build the path of a file in the output directory.
+ *
+ * \param[in]	pExport						Columnar export.
+ * \param[out]	pPath						Path, SBG_ECOM_COLUMN_EXPORT_FILE_PATH_MAX_SIZE bytes.
+ * \param[in]	pLogName					Log name, NULL for the manifest.
+ * \param[in]	pFieldName					Field name, NULL for the manifest.
+ */
+static void sbgEComColumnExportBuildPath(const SbgEComColumnExport *pExport, char *pPath, const char *pLogName, const char *pFieldName)
+{
+	assert(pExport);
+	assert(pPath);
+
+	if (pLogName)
+	{
+		assert(pFieldName);
+
+		snprintf(pPath, SBG_ECOM_COLUMN_EXPORT_FILE_PATH_MAX_SIZE, "%s/%s.%s.bin", pExport->directory, pLogName, pFieldName);
+	}
+	else
+	{
+		snprintf(pPath, SBG_ECOM_COLUMN_EXPORT_FILE_PATH_MAX_SIZE, "%s/%s", pExport->directory, SBG_ECOM_COLUMN_EXPORT_MANIFEST_NAME);
+	}
+}
+
+/*!
+ * Write the content of a column buffer to its file.
+ *
+ * \param[in]	pExport						Columnar export.
+ * \param[in]	pColumn						Column.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComColumnExportFlushColumn(SbgEComColumnExport *pExport, SbgEComColumnExportColumn *pColumn)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+
+	assert(pExport);
+	assert(pColumn);
+
+	if (pColumn->length != 0)
+	{
+		if (fwrite(pColumn->pBuffer, 1, pColumn->length, pColumn->pFile) == pColumn->length)
+		{
+			pExport->nrBytes += pColumn->length;
+		}
+		else
+		{
+			errorCode = SBG_WRITE_ERROR;
+			SBG_LOG_ERROR(errorCode, "unable to write column file");
+		}
+
+		pColumn->length = 0;
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Close the columns of a log type.
+ *
+ * Buffered data is written before each file is closed.
+ *
+ * \param[in]	pExport						Columnar export.
+ * \param[in]	pLogDesc					Log descriptor.
+ * \param[in]	pLog						Log export state.
+ * \return									SBG_NO_ERROR if all the data has been written.
+ */
+static SbgErrorCode sbgEComColumnExportCloseLog(SbgEComColumnExport *pExport, const SbgEComColumnExportLogDesc *pLogDesc, SbgEComColumnExportLog *pLog)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+
+	assert(pLogDesc);
+	assert(pLog);
+
+	if (pLog->pColumns)
+	{
+		for (size_t i = 0; i < pLogDesc->nrFields; i++)
+		{
+			SbgEComColumnExportColumn	*pColumn = &pLog->pColumns[i];
+
+			if (pColumn->pFile)
+			{
+				SbgErrorCode		 closeErrorCode;
+
+				closeErrorCode = sbgEComColumnExportFlushColumn(pExport, pColumn);
+
+				if ((fclose(pColumn->pFile) != 0) && (closeErrorCode == SBG_NO_ERROR))
+				{
+					closeErrorCode = SBG_WRITE_ERROR;
+					SBG_LOG_ERROR(closeErrorCode, "unable to close column file");
+				}
+
+				if (errorCode == SBG_NO_ERROR)
+				{
+					errorCode = closeErrorCode;
+				}
+			}
+
+			free(pColumn->pBuffer);
+		}
+
+		free(pLog->pColumns);
+		pLog->pColumns = NULL;
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Create the column files of a log type.
+ *
+ * \param[in]	pExport						Columnar export.
+ * \param[in]	pLogDesc					Log descriptor.
+ * \param[in]	pLog						Log export state.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComColumnExportOpenLog(SbgEComColumnExport *pExport, const SbgEComColumnExportLogDesc *pLogDesc, SbgEComColumnExportLog *pLog)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+
+	assert(pExport);
+	assert(pLogDesc);
+	assert(pLog);
+	assert(!pLog->pColumns);
+
+	pLog->pColumns = calloc(pLogDesc->nrFields, sizeof(*pLog->pColumns));
+
+	if (pLog->pColumns)
+	{
+		for (size_t i = 0; i < pLogDesc->nrFields; i++)
+		{
+			SbgEComColumnExportColumn	*pColumn = &pLog->pColumns[i];
+			char						 path[SBG_ECOM_COLUMN_EXPORT_FILE_PATH_MAX_SIZE];
+
+			sbgEComColumnExportBuildPath(pExport, path, pLogDesc->pName, pLogDesc->pFields[i].pName);
+
+			pColumn->pBuffer	= malloc(pExport->bufferSize);
+			pColumn->pFile		= fopen(path, "wb");
+
+			if (!pColumn->pBuffer)
+			{
+				errorCode = SBG_MALLOC_FAILED;
+				SBG_LOG_ERROR(errorCode, "unable to allocate column buffer");
+				break;
+			}
+			else if (!pColumn->pFile)
+			{
+				errorCode = SBG_INVALID_PARAMETER;
+				SBG_LOG_ERROR(errorCode, "unable to create %s", path);
+				break;
+			}
+			else
+			{
+				//
+				// Writes are already buffered, the stdio buffer would only add a copy
+				//
+				setvbuf(pColumn->pFile, NULL, _IONBF, 0);
+			}
+		}
+
+		if (errorCode != SBG_NO_ERROR)
+		{
+			sbgEComColumnExportCloseLog(pExport, pLogDesc, pLog);
+		}
+	}
+	else
+	{
+		errorCode = SBG_MALLOC_FAILED;
+		SBG_LOG_ERROR(errorCode, "unable to allocate columns");
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Write the manifest describing all exported columns.
+ *
+ * \param[in]	pExport						Columnar export.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComColumnExportWriteManifest(const SbgEComColumnExport *pExport)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+	char					 path[SBG_ECOM_COLUMN_EXPORT_FILE_PATH_MAX_SIZE];
+	FILE					*pFile;
+	char					 byteOrder;
+	bool					 firstLog = true;
+
+	assert(pExport);
+
+	sbgEComColumnExportBuildPath(pExport, path, NULL, NULL);
+
+#if SBG_CONFIG_BIG_ENDIAN == 1
+	byteOrder = '>';
+#else
+	byteOrder = '<';
+#endif
+
+	pFile = fopen(path, "w");
+
+	if (pFile)
+	{
+		fprintf(pFile, "{\n");
+		fprintf(pFile, "\t\"version\": %u,\n", SBG_ECOM_COLUMN_EXPORT_VERSION);
+		fprintf(pFile, "\t\"logs\": [");
+
+		for (size_t i = 0; i < SBG_ARRAY_SIZE(gLogDescs); i++)
+		{
+			const SbgEComColumnExportLogDesc	*pLogDesc = &gLogDescs[i];
+
+			if (pExport->pLogs[i].nrRows != 0)
+			{
+				fprintf(pFile, "%s\n\t\t{\n", firstLog ? "" : ",");
+				fprintf(pFile, "\t\t\t\"name\": \"%s\",\n", pLogDesc->pName);
+				fprintf(pFile, "\t\t\t\"class\": %u,\n", pLogDesc->msgClass);
+				fprintf(pFile, "\t\t\t\"id\": %u,\n", pLogDesc->msgId);
+				fprintf(pFile, "\t\t\t\"rows\": %" PRIu64 ",\n", pExport->pLogs[i].nrRows);
+				fprintf(pFile, "\t\t\t\"columns\": [\n");
+
+				for (size_t j = 0; j < pLogDesc->nrFields; j++)
+				{
+					const SbgEComColumnExportFieldDesc	*pField = &pLogDesc->pFields[j];
+
+					fprintf(pFile, "\t\t\t\t{ \"name\": \"%s\", \"file\": \"%s.%s.bin\", \"dtype\": \"%c%c%zu\" }%s\n",
+						pField->pName, pLogDesc->pName, pField->pName, (pField->size == 1) ? '|' : byteOrder, pField->kind, pField->size,
+						(j + 1 < pLogDesc->nrFields) ? "," : "");
+				}
+
+				fprintf(pFile, "\t\t\t]\n");
+				fprintf(pFile, "\t\t}");
+
+				firstLog = false;
+			}
+		}
+
+		fprintf(pFile, "\n\t]\n");
+		fprintf(pFile, "}\n");
+
+		if (ferror(pFile) != 0)
+		{
+			errorCode = SBG_WRITE_ERROR;
+		}
+
+		if ((fclose(pFile) != 0) || (errorCode != SBG_NO_ERROR))
+		{
+			errorCode = SBG_WRITE_ERROR;
+			SBG_LOG_ERROR(errorCode, "unable to write %s", path);
+		}
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+		SBG_LOG_ERROR(errorCode, "unable to create %s", path);
+	}
+
+	return errorCode;
+}
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+SbgErrorCode sbgEComColumnExportOpen(SbgEComColumnExport *pExport, const char *pDirectory, size_t bufferSize)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+
+	assert(pExport);
+	assert(pDirectory);
+
+	memset(pExport, 0, sizeof(*pExport));
+
+	if (strlen(pDirectory) < sizeof(pExport->directory))
+	{
+		strcpy(pExport->directory, pDirectory);
+
+		if (bufferSize == 0)
+		{
+			bufferSize = SBG_ECOM_COLUMN_EXPORT_DEFAULT_BUFFER_SIZE;
+		}
+
+		//
+		// A column buffer must at least hold one element of any column
+		//
+		bufferSize = sbgMax(bufferSize, sbgEComColumnExportGetMaxFieldSize());
+
+		pExport->bufferSize	= bufferSize;
+		pExport->errorCode	= SBG_NO_ERROR;
+		pExport->pLogs		= calloc(SBG_ARRAY_SIZE(gLogDescs), sizeof(*pExport->pLogs));
+
+		if (!pExport->pLogs)
+		{
+			errorCode = SBG_MALLOC_FAILED;
+			SBG_LOG_ERROR(errorCode, "unable to allocate export");
+		}
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+		SBG_LOG_ERROR(errorCode, "output directory path too long");
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComColumnExportClose(SbgEComColumnExport *pExport)
+{
+	SbgErrorCode			 errorCode;
+
+	assert(pExport);
+	assert(pExport->pLogs);
+
+	errorCode = pExport->errorCode;
+
+	for (size_t i = 0; i < SBG_ARRAY_SIZE(gLogDescs); i++)
+	{
+		SbgErrorCode		 closeErrorCode;
+
+		closeErrorCode = sbgEComColumnExportCloseLog(pExport, &gLogDescs[i], &pExport->pLogs[i]);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			errorCode = closeErrorCode;
+		}
+	}
+
+	//
+	// The manifest is written even if a column is incomplete so the exported data can still be inspected
+	//
+	if (errorCode == SBG_NO_ERROR)
+	{
+		errorCode = sbgEComColumnExportWriteManifest(pExport);
+	}
+	else
+	{
+		sbgEComColumnExportWriteManifest(pExport);
+	}
+
+	free(pExport->pLogs);
+	pExport->pLogs = NULL;
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComColumnExportAppend(SbgEComColumnExport *pExport, SbgEComClass msgClass, SbgEComMsgId msg, const SbgBinaryLogData *pLogData)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+	size_t					 logIndex;
+
+	assert(pExport);
+	assert(pExport->pLogs);
+	assert(pLogData);
+
+	logIndex = sbgEComColumnExportFindLog(msgClass, msg);
+
+	if ((logIndex < SBG_ARRAY_SIZE(gLogDescs)) && (pExport->errorCode == SBG_NO_ERROR))
+	{
+		const SbgEComColumnExportLogDesc	*pLogDesc	= &gLogDescs[logIndex];
+		SbgEComColumnExportLog				*pLog		= &pExport->pLogs[logIndex];
+
+		if (!pLog->pColumns)
+		{
+			errorCode = sbgEComColumnExportOpenLog(pExport, pLogDesc, pLog);
+		}
+
+		for (size_t i = 0; (errorCode == SBG_NO_ERROR) && (i < pLogDesc->nrFields); i++)
+		{
+			const SbgEComColumnExportFieldDesc	*pField		= &pLogDesc->pFields[i];
+			SbgEComColumnExportColumn			*pColumn	= &pLog->pColumns[i];
+
+			if ((pColumn->length + pField->size) > pExport->bufferSize)
+			{
+				errorCode = sbgEComColumnExportFlushColumn(pExport, pColumn);
+			}
+
+			if (errorCode == SBG_NO_ERROR)
+			{
+				memcpy(&pColumn->pBuffer[pColumn->length], (const uint8_t*)pLogData + pField->offset, pField->size);
+				pColumn->length += pField->size;
+			}
+		}
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			pLog->nrRows++;
+			pExport->nrRows++;
+		}
+		else
+		{
+			//
+			// Columns would no longer have the same number of rows, stop exporting
+			//
+			pExport->errorCode = errorCode;
+		}
+	}
+	else if (logIndex < SBG_ARRAY_SIZE(gLogDescs))
+	{
+		errorCode = pExport->errorCode;
+	}
+
+	return errorCode;
+}
@@ -0,0 +1,143 @@
+﻿/*!
+ * \file			sbgEComColumnExport.h
+ * \author			SBG Systems
+ * \date			19 October 2026
+ *
+ * \brief			Streams decoded logs to columnar binary files.
+ *
+ *				Each field of a supported log is written to its own raw column file named
+ *				<log>.<field>.bin in the output directory. Values are stored back to back in
+ *				the host byte order, without any header, so a column can be loaded with
+ *				numpy.fromfile. A manifest.json file lists the exported logs, their number of
+ *				rows and, for each column, the file name and the numpy dtype.
+ *
+ * \copyright		Copyright (C) 2022, SBG Systems SAS. All rights reserved.
+ * \beginlicense	The MIT license
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * \endlicense
+ */
+
+#ifndef SBG_ECOM_COLUMN_EXPORT_H
+#define SBG_ECOM_COLUMN_EXPORT_H
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+// Project headers
+#include <sbgEComIds.h>
+#include <binaryLogs/sbgEComBinaryLogs.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Default write buffer size per column in bytes.
+ */
+#define SBG_ECOM_COLUMN_EXPORT_DEFAULT_BUFFER_SIZE		(256u * 1024u)
+
+/*!
+ * Maximum size of the output directory path, including the null terminating character.
+ */
+#define SBG_ECOM_COLUMN_EXPORT_PATH_MAX_SIZE			(1024)
+
+/*!
+ * Manifest file name.
+ */
+#define SBG_ECOM_COLUMN_EXPORT_MANIFEST_NAME			"manifest.json"
+
+/*!
+ * Manifest format version.
+ */
+#define SBG_ECOM_COLUMN_EXPORT_VERSION					(1)
+
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Export state of a log type, private.
+ */
+typedef struct _SbgEComColumnExportLog SbgEComColumnExportLog;
+
+/*!
+ * Columnar export.
+ */
+typedef struct _SbgEComColumnExport
+{
+	char							 directory[SBG_ECOM_COLUMN_EXPORT_PATH_MAX_SIZE];	/*!< Output directory. */
+	size_t							 bufferSize;			/*!< Write buffer size per column in bytes. */
+	SbgEComColumnExportLog			*pLogs;					/*!< Export state of each supported log type. */
+	SbgErrorCode					 errorCode;				/*!< First write error, SBG_NO_ERROR if none. */
+	uint64_t						 nrRows;				/*!< Total number of exported logs. */
+	uint64_t						 nrBytes;				/*!< Total number of bytes written to column files. */
+} SbgEComColumnExport;
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Open a columnar export.
+ *
+ * Column files are created when the first log of their type is exported, so only received
+ * logs produce files. Existing files with the same names are overwritten.
+ *
+ * \param[out]	pExport						Columnar export.
+ * \param[in]	pDirectory					Output directory, it must exist.
+ * \param[in]	bufferSize					Write buffer size per column in bytes, 0 to use SBG_ECOM_COLUMN_EXPORT_DEFAULT_BUFFER_SIZE,
+ *											it is rounded up to the largest column element size.
+ * \return									SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComColumnExportOpen(SbgEComColumnExport *pExport, const char *pDirectory, size_t bufferSize);
+
+/*!
+ * Flush all columns, write the manifest and close the export.
+ *
+ * The export is closed and its memory released even if an error occurs.
+ *
+ * \param[in]	pExport						Columnar export.
+ * \return									SBG_NO_ERROR if all the data and the manifest have been written.
+ */
+SbgErrorCode sbgEComColumnExportClose(SbgEComColumnExport *pExport);
+
+/*!
+ * Append a decoded log to its columns.
+ *
+ * This method can be directly called from the log callback, unsupported logs are ignored.
+ *
+ * \param[in]	pExport						Columnar export.
+ * \param[in]	msgClass					Log class.
+ * \param[in]	msg							Log message ID.
+ * \param[in]	pLogData					Decoded log.
+ * \return									SBG_NO_ERROR if successful or if the log isn't supported.
+ */
+SbgErrorCode sbgEComColumnExportAppend(SbgEComColumnExport *pExport, SbgEComClass msgClass, SbgEComMsgId msg, const SbgBinaryLogData *pLogData);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_ECOM_COLUMN_EXPORT_H
@@ -0,0 +1,336 @@
+﻿// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <arena/sbgArena.h>
+
+// Project headers
+#include <protocol/sbgEComProtocol.h>
+
+// Local headers
+#include "sbgEComFrameBuilder.h"
+
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Allocate an output buffer from the arena and move the pending frames to it.
+ *
+ * \param[in]	pBuilder						Frame builder.
+ * \param[in]	capacity						Output buffer capacity in bytes.
+ * \return										SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComFrameBuilderAllocBuffer(SbgEComFrameBuilder *pBuilder, size_t capacity)
+{
+	SbgErrorCode						 errorCode = SBG_NO_ERROR;
+	uint8_t								*pBuffer;
+	size_t								 pendingSize;
+
+	assert(pBuilder);
+
+	pendingSize = sbgEComFrameBuilderGetPendingSize(pBuilder);
+
+	assert(capacity >= pendingSize);
+
+	pBuffer = sbgArenaAlloc(&pBuilder->arena, capacity, sizeof(void*));
+
+	if (pBuffer)
+	{
+		if (pendingSize != 0)
+		{
+			memcpy(pBuffer, pBuilder->pBuffer, pendingSize);
+		}
+
+		pBuilder->pBuffer	= pBuffer;
+		pBuilder->capacity	= capacity;
+		pBuilder->nrBuffers++;
+
+		sbgStreamBufferInitForWrite(&pBuilder->outputStream, pBuffer, capacity);
+		sbgStreamBufferSeek(&pBuilder->outputStream, pendingSize, SB_SEEK_SET);
+	}
+	else
+	{
+		errorCode = SBG_MALLOC_FAILED;
+		SBG_LOG_ERROR(errorCode, "unable to allocate frame builder buffer of %zu bytes", capacity);
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Make sure a maximum size frame can be appended after the pending frames.
+ *
+ * The output buffer capacity is doubled until it is large enough.
+ *
+ * \param[in]	pBuilder						Frame builder.
+ * \return										SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComFrameBuilderReserve(SbgEComFrameBuilder *pBuilder)
+{
+	SbgErrorCode						 errorCode = SBG_NO_ERROR;
+	size_t								 pendingSize;
+
+	assert(pBuilder);
+
+	pendingSize = sbgEComFrameBuilderGetPendingSize(pBuilder);
+
+	if (!pBuilder->pBuffer || ((pBuilder->capacity - pendingSize) < SBG_ECOM_MAX_BUFFER_SIZE))
+	{
+		size_t							 capacity;
+
+		capacity = pBuilder->capacity;
+
+		if (pBuilder->pBuffer)
+		{
+			capacity *= 2;
+		}
+
+		while ((capacity - pendingSize) < SBG_ECOM_MAX_BUFFER_SIZE)
+		{
+			capacity *= 2;
+		}
+
+		errorCode = sbgEComFrameBuilderAllocBuffer(pBuilder, capacity);
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Discard all pending frames.
+ *
+ * If the output buffer has grown, the arena is reset so that previous buffers are released.
+ *
+ * \param[in]	pBuilder						Frame builder.
+ */
+static void sbgEComFrameBuilderClear(SbgEComFrameBuilder *pBuilder)
+{
+	assert(pBuilder);
+	assert(!pBuilder->frameStarted);
+
+	pBuilder->nrPendingFrames = 0;
+
+	if (pBuilder->pBuffer)
+	{
+		sbgStreamBufferSeek(&pBuilder->outputStream, 0, SB_SEEK_SET);
+
+		if (pBuilder->nrBuffers > 1)
+		{
+			sbgArenaReset(&pBuilder->arena);
+
+			pBuilder->pBuffer	= NULL;
+			pBuilder->nrBuffers	= 0;
+
+			//
+			// If this fails, the buffer is allocated again on the next frame
+			//
+			sbgEComFrameBuilderAllocBuffer(pBuilder, pBuilder->capacity);
+		}
+	}
+}
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+void sbgEComFrameBuilderConstruct(SbgEComFrameBuilder *pBuilder, SbgInterface *pInterface, size_t capacity, size_t flushSize, uint32_t flushAge)
+{
+	assert(pBuilder);
+	assert(pInterface);
+
+	if (capacity == 0)
+	{
+		capacity = SBG_ECOM_FRAME_BUILDER_DEFAULT_CAPACITY;
+	}
+
+	sbgArenaConstruct(&pBuilder->arena, capacity);
+
+	pBuilder->pInterface		= pInterface;
+	pBuilder->pBuffer			= NULL;
+	pBuilder->capacity			= capacity;
+	pBuilder->nrBuffers			= 0;
+	pBuilder->flushSize			= flushSize;
+	pBuilder->flushAge			= flushAge;
+	pBuilder->frameCursor		= 0;
+	pBuilder->frameStarted		= false;
+	pBuilder->nrPendingFrames	= 0;
+	pBuilder->firstPendingTime	= 0;
+	pBuilder->nrFrames			= 0;
+	pBuilder->nrWrites			= 0;
+}
+
+void sbgEComFrameBuilderDestroy(SbgEComFrameBuilder *pBuilder)
+{
+	assert(pBuilder);
+
+	sbgArenaDestroy(&pBuilder->arena);
+
+	pBuilder->pBuffer			= NULL;
+	pBuilder->nrBuffers			= 0;
+	pBuilder->frameStarted		= false;
+	pBuilder->nrPendingFrames	= 0;
+}
+
+SbgErrorCode sbgEComFrameBuilderStartFrame(SbgEComFrameBuilder *pBuilder, uint8_t msgClass, uint8_t msg, SbgStreamBuffer **ppOutputStream)
+{
+	SbgErrorCode						 errorCode;
+
+	assert(pBuilder);
+	assert(!pBuilder->frameStarted);
+	assert(ppOutputStream);
+
+	errorCode = sbgEComFrameBuilderReserve(pBuilder);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		errorCode = sbgEComStartFrameGeneration(&pBuilder->outputStream, msgClass, msg, &pBuilder->frameCursor);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			pBuilder->frameStarted	= true;
+			*ppOutputStream			= &pBuilder->outputStream;
+		}
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComFrameBuilderFinalizeFrame(SbgEComFrameBuilder *pBuilder)
+{
+	SbgErrorCode						 errorCode;
+
+	assert(pBuilder);
+	assert(pBuilder->frameStarted);
+
+	pBuilder->frameStarted = false;
+
+	errorCode = sbgEComFinalizeFrameGeneration(&pBuilder->outputStream, pBuilder->frameCursor);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		if (pBuilder->nrPendingFrames == 0)
+		{
+			pBuilder->firstPendingTime = sbgGetTime();
+		}
+
+		pBuilder->nrPendingFrames++;
+
+		if ((pBuilder->flushSize != 0) && (sbgEComFrameBuilderGetPendingSize(pBuilder) >= pBuilder->flushSize))
+		{
+			errorCode = sbgEComFrameBuilderFlush(pBuilder);
+		}
+		else
+		{
+			errorCode = sbgEComFrameBuilderPoll(pBuilder);
+		}
+	}
+	else
+	{
+		//
+		// Discard the invalid frame, the stream buffer must be initialized again to clear its error
+		//
+		sbgStreamBufferInitForWrite(&pBuilder->outputStream, pBuilder->pBuffer, pBuilder->capacity);
+		sbgStreamBufferSeek(&pBuilder->outputStream, pBuilder->frameCursor, SB_SEEK_SET);
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComFrameBuilderAppendFrame(SbgEComFrameBuilder *pBuilder, uint8_t msgClass, uint8_t msg, const void *pData, size_t size)
+{
+	SbgErrorCode						 errorCode;
+	SbgStreamBuffer						*pOutputStream;
+
+	assert(pBuilder);
+	assert(pData || (size == 0));
+
+	if (size <= SBG_ECOM_MAX_PAYLOAD_SIZE)
+	{
+		errorCode = sbgEComFrameBuilderStartFrame(pBuilder, msgClass, msg, &pOutputStream);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			if (size != 0)
+			{
+				sbgStreamBufferWriteBuffer(pOutputStream, pData, size);
+			}
+
+			errorCode = sbgEComFrameBuilderFinalizeFrame(pBuilder);
+		}
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+		SBG_LOG_ERROR(errorCode, "payload of %zu bytes is too large for a standard frame", size);
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComFrameBuilderFlush(SbgEComFrameBuilder *pBuilder)
+{
+	SbgErrorCode						 errorCode = SBG_NO_ERROR;
+	size_t								 pendingSize;
+
+	assert(pBuilder);
+	assert(!pBuilder->frameStarted);
+
+	pendingSize = sbgEComFrameBuilderGetPendingSize(pBuilder);
+
+	if (pendingSize != 0)
+	{
+		errorCode = sbgInterfaceWrite(pBuilder->pInterface, pBuilder->pBuffer, pendingSize);
+
+		pBuilder->nrWrites++;
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			pBuilder->nrFrames += pBuilder->nrPendingFrames;
+		}
+		else
+		{
+			SBG_LOG_ERROR(errorCode, "unable to write %zu frames", pBuilder->nrPendingFrames);
+		}
+
+		sbgEComFrameBuilderClear(pBuilder);
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComFrameBuilderPoll(SbgEComFrameBuilder *pBuilder)
+{
+	SbgErrorCode						 errorCode = SBG_NO_ERROR;
+
+	assert(pBuilder);
+
+	if ((pBuilder->flushAge != 0) && (pBuilder->nrPendingFrames != 0) && !pBuilder->frameStarted)
+	{
+		if ((sbgGetTime() - pBuilder->firstPendingTime) >= pBuilder->flushAge)
+		{
+			errorCode = sbgEComFrameBuilderFlush(pBuilder);
+		}
+	}
+
+	return errorCode;
+}
+
+size_t sbgEComFrameBuilderGetPendingSize(const SbgEComFrameBuilder *pBuilder)
+{
+	size_t								 pendingSize = 0;
+
+	assert(pBuilder);
+
+	if (pBuilder->pBuffer)
+	{
+		if (pBuilder->frameStarted)
+		{
+			pendingSize = pBuilder->frameCursor;
+		}
+		else
+		{
+			pendingSize = sbgStreamBufferGetLength(&pBuilder->outputStream);
+		}
+	}
+
+	return pendingSize;
+}
@@ -0,0 +1,187 @@
+﻿/*!
+ * \file			sbgEComFrameBuilder.h
+ * \author			SBG Systems
+ * \date			19 October 2026
+ *
+ * \brief			Batch outgoing sbgECom frames and send them with a single write.
+ *
+ * \copyright		Copyright (C) 2022, SBG Systems SAS. All rights reserved.
+ * \beginlicense	The MIT license
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * \endlicense
+ */
+
+#ifndef SBG_ECOM_FRAME_BUILDER_H
+#define SBG_ECOM_FRAME_BUILDER_H
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <arena/sbgArena.h>
+#include <interfaces/sbgInterface.h>
+#include <streamBuffer/sbgStreamBuffer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Default initial output buffer capacity in bytes.
+ */
+#define SBG_ECOM_FRAME_BUILDER_DEFAULT_CAPACITY			(16384)
+
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Frame builder.
+ *
+ * Complete frames are appended to an output buffer allocated from an arena and sent to the
+ * interface with a single write when the builder is flushed. The buffer grows as needed so
+ * frames are never dropped because of a full buffer.
+ *
+ * The builder is flushed automatically once the pending frames reach the flush size or
+ * once the oldest pending frame reaches the flush age.
+ */
+typedef struct _SbgEComFrameBuilder
+{
+	SbgInterface					*pInterface;					/*!< Interface frames are written to. */
+	SbgArena						 arena;							/*!< Arena the output buffer is allocated from. */
+	SbgStreamBuffer					 outputStream;					/*!< Output stream on the output buffer. */
+	uint8_t							*pBuffer;						/*!< Output buffer, NULL until the first frame. */
+	size_t							 capacity;						/*!< Output buffer capacity in bytes. */
+	size_t							 nrBuffers;						/*!< Number of output buffers allocated since the arena was last reset. */
+
+	size_t							 flushSize;						/*!< Pending size in bytes that triggers a flush, 0 to disable. */
+	uint32_t						 flushAge;						/*!< Age in ms of the oldest pending frame that triggers a flush, 0 to disable. */
+
+	size_t							 frameCursor;					/*!< Offset of the frame being generated. */
+	bool							 frameStarted;					/*!< True if a frame is being generated. */
+	size_t							 nrPendingFrames;				/*!< Number of complete frames waiting to be written. */
+	uint32_t						 firstPendingTime;				/*!< Time in ms the oldest pending frame was appended. */
+
+	size_t							 nrFrames;						/*!< Total number of frames written. */
+	size_t							 nrWrites;						/*!< Total number of interface writes. */
+} SbgEComFrameBuilder;
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Frame builder constructor.
+ *
+ * No memory is allocated until the first frame.
+ *
+ * \param[in]	pBuilder						Frame builder.
+ * \param[in]	pInterface						Interface frames are written to.
+ * \param[in]	capacity						Initial output buffer capacity in bytes, 0 to use SBG_ECOM_FRAME_BUILDER_DEFAULT_CAPACITY.
+ * \param[in]	flushSize						Pending size in bytes that triggers a flush, 0 to disable.
+ * \param[in]	flushAge						Age in ms of the oldest pending frame that triggers a flush, 0 to disable.
+ */
+void sbgEComFrameBuilderConstruct(SbgEComFrameBuilder *pBuilder, SbgInterface *pInterface, size_t capacity, size_t flushSize, uint32_t flushAge);
+
+/*!
+ * Frame builder destructor.
+ *
+ * Pending frames are discarded, call sbgEComFrameBuilderFlush() first to send them.
+ *
+ * \param[in]	pBuilder						Frame builder.
+ */
+void sbgEComFrameBuilderDestroy(SbgEComFrameBuilder *pBuilder);
+
+/*!
+ * Start a new frame.
+ *
+ * The returned output stream has room for a maximum size payload. The payload is written to it
+ * and the frame is then completed with sbgEComFrameBuilderFinalizeFrame().
+ *
+ * \param[in]	pBuilder						Frame builder.
+ * \param[in]	msgClass						Message class.
+ * \param[in]	msg								Message ID.
+ * \param[out]	ppOutputStream					Output stream to write the payload to.
+ * \return										SBG_NO_ERROR if successful,
+ *												SBG_MALLOC_FAILED if the output buffer can't grow.
+ */
+SbgErrorCode sbgEComFrameBuilderStartFrame(SbgEComFrameBuilder *pBuilder, uint8_t msgClass, uint8_t msg, SbgStreamBuffer **ppOutputStream);
+
+/*!
+ * Complete the frame started with sbgEComFrameBuilderStartFrame().
+ *
+ * The builder is flushed if a flush threshold is reached. If the payload is invalid,
+ * the frame is discarded and pending frames are kept.
+ *
+ * \param[in]	pBuilder						Frame builder.
+ * \return										SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComFrameBuilderFinalizeFrame(SbgEComFrameBuilder *pBuilder);
+
+/*!
+ * Append a complete frame.
+ *
+ * \param[in]	pBuilder						Frame builder.
+ * \param[in]	msgClass						Message class.
+ * \param[in]	msg								Message ID.
+ * \param[in]	pData							Payload.
+ * \param[in]	size							Payload size in bytes, up to SBG_ECOM_MAX_PAYLOAD_SIZE.
+ * \return										SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComFrameBuilderAppendFrame(SbgEComFrameBuilder *pBuilder, uint8_t msgClass, uint8_t msg, const void *pData, size_t size);
+
+/*!
+ * Write all pending frames to the interface with a single write.
+ *
+ * Pending frames are discarded even if the write fails, aiding data is time sensitive
+ * and resending stale frames would only delay the next ones.
+ *
+ * \param[in]	pBuilder						Frame builder.
+ * \return										SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComFrameBuilderFlush(SbgEComFrameBuilder *pBuilder);
+
+/*!
+ * Flush the builder if the oldest pending frame has reached the flush age.
+ *
+ * This should be called periodically if frames may stop being appended, otherwise
+ * the last pending frames would wait for the next frame to be sent.
+ *
+ * \param[in]	pBuilder						Frame builder.
+ * \return										SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComFrameBuilderPoll(SbgEComFrameBuilder *pBuilder);
+
+/*!
+ * Returns the number of bytes waiting to be written.
+ *
+ * \param[in]	pBuilder						Frame builder.
+ * \return										Pending size in bytes.
+ */
+size_t sbgEComFrameBuilderGetPendingSize(const SbgEComFrameBuilder *pBuilder);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_ECOM_FRAME_BUILDER_H
@@ -0,0 +1,348 @@
+﻿// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <arena/sbgArena.h>
+
+// Local headers
+#include "sbgEComLogColumns.h"
+
+//----------------------------------------------------------------------//
+//- Private definitions                                                -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Describes how a log structure field is stored in a column.
+ */
+typedef struct _SbgEComLogColumnDesc
+{
+	size_t		logOffset;									/*!< Offset of the field in the log structure. */
+	size_t		columnOffset;								/*!< Offset of the column in the log columns structure. */
+	size_t		size;										/*!< Field size in bytes. */
+} SbgEComLogColumnDesc;
+
+/*!
+ * Build a column descriptor.
+ */
+#define SBG_ECOM_LOG_COLUMN_DESC(logType, columnsType, field, column)	{ offsetof(logType, field), offsetof(columnsType, column), sizeof(((logType*)0)->field) }
+
+/*!
+ * SBG_ECOM_LOG_EKF_NAV columns descriptors.
+ */
+static const SbgEComLogColumnDesc gEkfNavColumnDescs[] =
+{
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogEkfNavData, SbgEComLogColumnsEkfNav, timeStamp,			timeStamp),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogEkfNavData, SbgEComLogColumnsEkfNav, velocity[0],		velocity[0]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogEkfNavData, SbgEComLogColumnsEkfNav, velocity[1],		velocity[1]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogEkfNavData, SbgEComLogColumnsEkfNav, velocity[2],		velocity[2]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogEkfNavData, SbgEComLogColumnsEkfNav, velocityStdDev[0],	velocityStdDev[0]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogEkfNavData, SbgEComLogColumnsEkfNav, velocityStdDev[1],	velocityStdDev[1]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogEkfNavData, SbgEComLogColumnsEkfNav, velocityStdDev[2],	velocityStdDev[2]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogEkfNavData, SbgEComLogColumnsEkfNav, position[0],		latitude),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogEkfNavData, SbgEComLogColumnsEkfNav, position[1],		longitude),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogEkfNavData, SbgEComLogColumnsEkfNav, position[2],		altitude),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogEkfNavData, SbgEComLogColumnsEkfNav, undulation,			undulation),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogEkfNavData, SbgEComLogColumnsEkfNav, positionStdDev[0],	positionStdDev[0]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogEkfNavData, SbgEComLogColumnsEkfNav, positionStdDev[1],	positionStdDev[1]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogEkfNavData, SbgEComLogColumnsEkfNav, positionStdDev[2],	positionStdDev[2]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogEkfNavData, SbgEComLogColumnsEkfNav, status,				status),
+};
+
+/*!
+ * SBG_ECOM_LOG_IMU_DATA columns descriptors.
+ */
+static const SbgEComLogColumnDesc gImuDataColumnDescs[] =
+{
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogImuData, SbgEComLogColumnsImuData, timeStamp,			timeStamp),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogImuData, SbgEComLogColumnsImuData, status,				status),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogImuData, SbgEComLogColumnsImuData, accelerometers[0],	accelerometers[0]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogImuData, SbgEComLogColumnsImuData, accelerometers[1],	accelerometers[1]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogImuData, SbgEComLogColumnsImuData, accelerometers[2],	accelerometers[2]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogImuData, SbgEComLogColumnsImuData, gyroscopes[0],		gyroscopes[0]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogImuData, SbgEComLogColumnsImuData, gyroscopes[1],		gyroscopes[1]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogImuData, SbgEComLogColumnsImuData, gyroscopes[2],		gyroscopes[2]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogImuData, SbgEComLogColumnsImuData, temperature,			temperature),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogImuData, SbgEComLogColumnsImuData, deltaVelocity[0],		deltaVelocity[0]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogImuData, SbgEComLogColumnsImuData, deltaVelocity[1],		deltaVelocity[1]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogImuData, SbgEComLogColumnsImuData, deltaVelocity[2],		deltaVelocity[2]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogImuData, SbgEComLogColumnsImuData, deltaAngle[0],		deltaAngle[0]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogImuData, SbgEComLogColumnsImuData, deltaAngle[1],		deltaAngle[1]),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogImuData, SbgEComLogColumnsImuData, deltaAngle[2],		deltaAngle[2]),
+};
+
+/*!
+ * SBG_ECOM_LOG_GPS#_POS columns descriptors.
+ */
+static const SbgEComLogColumnDesc gGpsPosColumnDescs[] =
+{
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogGpsPos, SbgEComLogColumnsGpsPos, timeStamp,				timeStamp),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogGpsPos, SbgEComLogColumnsGpsPos, status,					status),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogGpsPos, SbgEComLogColumnsGpsPos, timeOfWeek,				timeOfWeek),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogGpsPos, SbgEComLogColumnsGpsPos, latitude,				latitude),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogGpsPos, SbgEComLogColumnsGpsPos, longitude,				longitude),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogGpsPos, SbgEComLogColumnsGpsPos, altitude,				altitude),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogGpsPos, SbgEComLogColumnsGpsPos, undulation,				undulation),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogGpsPos, SbgEComLogColumnsGpsPos, latitudeAccuracy,		latitudeAccuracy),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogGpsPos, SbgEComLogColumnsGpsPos, longitudeAccuracy,		longitudeAccuracy),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogGpsPos, SbgEComLogColumnsGpsPos, altitudeAccuracy,		altitudeAccuracy),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogGpsPos, SbgEComLogColumnsGpsPos, numSvUsed,				numSvUsed),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogGpsPos, SbgEComLogColumnsGpsPos, baseStationId,			baseStationId),
+	SBG_ECOM_LOG_COLUMN_DESC(SbgLogGpsPos, SbgEComLogColumnsGpsPos, differentialAge,		differentialAge),
+};
+
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Returns a column from a log columns structure and a column descriptor.
+ *
+ * \param[in]	pTypeColumns				Log columns structure.
+ * \param[in]	pDesc						Column descriptor.
+ * \return									Column.
+ */
+static SbgEComLogColumn *sbgEComLogColumnsGetColumn(void *pTypeColumns, const SbgEComLogColumnDesc *pDesc)
+{
+	assert(pTypeColumns);
+	assert(pDesc);
+
+	return (SbgEComLogColumn*)((uint8_t*)pTypeColumns + pDesc->columnOffset);
+}
+
+/*!
+ * Initialize the columns of a log type.
+ *
+ * \param[out]	pTypeColumns				Log columns structure.
+ * \param[in]	pDescs						Column descriptors.
+ * \param[in]	numDescs					Number of column descriptors.
+ */
+static void sbgEComLogColumnsInitType(void *pTypeColumns, const SbgEComLogColumnDesc *pDescs, size_t numDescs)
+{
+	size_t		i;
+
+	assert(pTypeColumns);
+	assert(pDescs);
+
+	for (i = 0; i < numDescs; i++)
+	{
+		SbgEComLogColumn	*pColumn;
+
+		pColumn = sbgEComLogColumnsGetColumn(pTypeColumns, &pDescs[i]);
+
+		pColumn->pFirstChunk	= NULL;
+		pColumn->pLastChunk		= NULL;
+		pColumn->elementSize	= pDescs[i].size;
+		pColumn->count			= 0;
+	}
+}
+
+/*!
+ * Make sure a value can be appended to a column.
+ *
+ * \param[in]	pColumns					Columnar log accumulator.
+ * \param[in]	pColumn						Column.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComLogColumnReserve(SbgEComLogColumns *pColumns, SbgEComLogColumn *pColumn)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+
+	assert(pColumns);
+	assert(pColumn);
+
+	if (!pColumn->pLastChunk || (pColumn->pLastChunk->count == pColumns->chunkCapacity))
+	{
+		SbgEComLogColumnChunk	*pChunk;
+
+		pChunk = sbgArenaAlloc(&pColumns->arena, sizeof(*pChunk), sizeof(void*));
+
+		if (pChunk)
+		{
+			pChunk->pData = sbgArenaAlloc(&pColumns->arena, pColumns->chunkCapacity * pColumn->elementSize, SBG_ECOM_LOG_COLUMNS_CHUNK_ALIGNMENT);
+
+			if (pChunk->pData)
+			{
+				pChunk->pNext	= NULL;
+				pChunk->count	= 0;
+
+				if (pColumn->pLastChunk)
+				{
+					pColumn->pLastChunk->pNext = pChunk;
+				}
+				else
+				{
+					pColumn->pFirstChunk = pChunk;
+				}
+
+				pColumn->pLastChunk = pChunk;
+			}
+			else
+			{
+				errorCode = SBG_MALLOC_FAILED;
+			}
+		}
+		else
+		{
+			errorCode = SBG_MALLOC_FAILED;
+		}
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Append a log to all the columns of its type.
+ *
+ * \param[in]	pColumns					Columnar log accumulator.
+ * \param[in]	pTypeColumns				Log columns structure.
+ * \param[in]	pDescs						Column descriptors.
+ * \param[in]	numDescs					Number of column descriptors.
+ * \param[in]	pLog						Decoded log structure.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComLogColumnsAppendType(SbgEComLogColumns *pColumns, void *pTypeColumns, const SbgEComLogColumnDesc *pDescs, size_t numDescs, const void *pLog)
+{
+	SbgErrorCode		errorCode = SBG_NO_ERROR;
+	size_t				i;
+
+	assert(pColumns);
+	assert(pTypeColumns);
+	assert(pDescs);
+	assert(pLog);
+
+	//
+	// Reserve space in all columns first so a log is never partially appended
+	//
+	for (i = 0; i < numDescs; i++)
+	{
+		errorCode = sbgEComLogColumnReserve(pColumns, sbgEComLogColumnsGetColumn(pTypeColumns, &pDescs[i]));
+
+		if (errorCode != SBG_NO_ERROR)
+		{
+			break;
+		}
+	}
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		for (i = 0; i < numDescs; i++)
+		{
+			SbgEComLogColumn		*pColumn;
+			SbgEComLogColumnChunk	*pChunk;
+
+			pColumn	= sbgEComLogColumnsGetColumn(pTypeColumns, &pDescs[i]);
+			pChunk	= pColumn->pLastChunk;
+
+			memcpy((uint8_t*)pChunk->pData + pChunk->count * pColumn->elementSize, (const uint8_t*)pLog + pDescs[i].logOffset, pDescs[i].size);
+
+			pChunk->count++;
+			pColumn->count++;
+		}
+	}
+	else
+	{
+		SBG_LOG_ERROR(errorCode, "unable to allocate column chunk");
+	}
+
+	return errorCode;
+}
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+void sbgEComLogColumnsConstruct(SbgEComLogColumns *pColumns, size_t chunkCapacity)
+{
+	assert(pColumns);
+
+	if (chunkCapacity == 0)
+	{
+		chunkCapacity = SBG_ECOM_LOG_COLUMNS_DEFAULT_CHUNK_CAPACITY;
+	}
+
+	sbgArenaConstruct(&pColumns->arena, 0);
+
+	pColumns->chunkCapacity = chunkCapacity;
+
+	sbgEComLogColumnsInitType(&pColumns->ekfNav,	gEkfNavColumnDescs,		SBG_ARRAY_SIZE(gEkfNavColumnDescs));
+	sbgEComLogColumnsInitType(&pColumns->imuData,	gImuDataColumnDescs,	SBG_ARRAY_SIZE(gImuDataColumnDescs));
+	sbgEComLogColumnsInitType(&pColumns->gps1Pos,	gGpsPosColumnDescs,		SBG_ARRAY_SIZE(gGpsPosColumnDescs));
+	sbgEComLogColumnsInitType(&pColumns->gps2Pos,	gGpsPosColumnDescs,		SBG_ARRAY_SIZE(gGpsPosColumnDescs));
+}
+
+void sbgEComLogColumnsDestroy(SbgEComLogColumns *pColumns)
+{
+	assert(pColumns);
+
+	sbgArenaDestroy(&pColumns->arena);
+}
+
+void sbgEComLogColumnsClear(SbgEComLogColumns *pColumns)
+{
+	assert(pColumns);
+
+	sbgArenaReset(&pColumns->arena);
+
+	sbgEComLogColumnsInitType(&pColumns->ekfNav,	gEkfNavColumnDescs,		SBG_ARRAY_SIZE(gEkfNavColumnDescs));
+	sbgEComLogColumnsInitType(&pColumns->imuData,	gImuDataColumnDescs,	SBG_ARRAY_SIZE(gImuDataColumnDescs));
+	sbgEComLogColumnsInitType(&pColumns->gps1Pos,	gGpsPosColumnDescs,		SBG_ARRAY_SIZE(gGpsPosColumnDescs));
+	sbgEComLogColumnsInitType(&pColumns->gps2Pos,	gGpsPosColumnDescs,		SBG_ARRAY_SIZE(gGpsPosColumnDescs));
+}
+
+SbgErrorCode sbgEComLogColumnsAppend(SbgEComLogColumns *pColumns, SbgEComClass msgClass, SbgEComMsgId msg, const SbgBinaryLogData *pLogData)
+{
+	SbgErrorCode		errorCode = SBG_NO_ERROR;
+
+	assert(pColumns);
+	assert(pLogData);
+
+	if (msgClass == SBG_ECOM_CLASS_LOG_ECOM_0)
+	{
+		switch (msg)
+		{
+		case SBG_ECOM_LOG_EKF_NAV:
+			errorCode = sbgEComLogColumnsAppendType(pColumns, &pColumns->ekfNav, gEkfNavColumnDescs, SBG_ARRAY_SIZE(gEkfNavColumnDescs), &pLogData->ekfNavData);
+			break;
+		case SBG_ECOM_LOG_IMU_DATA:
+			errorCode = sbgEComLogColumnsAppendType(pColumns, &pColumns->imuData, gImuDataColumnDescs, SBG_ARRAY_SIZE(gImuDataColumnDescs), &pLogData->imuData);
+			break;
+		case SBG_ECOM_LOG_GPS1_POS:
+			errorCode = sbgEComLogColumnsAppendType(pColumns, &pColumns->gps1Pos, gGpsPosColumnDescs, SBG_ARRAY_SIZE(gGpsPosColumnDescs), &pLogData->gpsPosData);
+			break;
+		case SBG_ECOM_LOG_GPS2_POS:
+			errorCode = sbgEComLogColumnsAppendType(pColumns, &pColumns->gps2Pos, gGpsPosColumnDescs, SBG_ARRAY_SIZE(gGpsPosColumnDescs), &pLogData->gpsPosData);
+			break;
+		default:
+			break;
+		}
+	}
+
+	return errorCode;
+}
+
+size_t sbgEComLogColumnGetCount(const SbgEComLogColumn *pColumn)
+{
+	assert(pColumn);
+
+	return pColumn->count;
+}
+
+const SbgEComLogColumnChunk *sbgEComLogColumnGetFirstChunk(const SbgEComLogColumn *pColumn)
+{
+	assert(pColumn);
+
+	return pColumn->pFirstChunk;
+}
+
+void sbgEComLogColumnCopy(const SbgEComLogColumn *pColumn, void *pDst)
+{
+	const SbgEComLogColumnChunk	*pChunk;
+	uint8_t						*pDstBytes = pDst;
+
+	assert(pColumn);
+	assert(pDst || (pColumn->count == 0));
+
+	for (pChunk = pColumn->pFirstChunk; pChunk; pChunk = pChunk->pNext)
+	{
+		memcpy(pDstBytes, pChunk->pData, pChunk->count * pColumn->elementSize);
+		pDstBytes += pChunk->count * pColumn->elementSize;
+	}
+}
@@ -0,0 +1,229 @@
+﻿/*!
+ * \file			sbgEComLogColumns.h
+ * \author			SBG Systems
+ * \date			19 October 2026
+ *
+ * \brief			Columnar (structure of arrays) accumulator for decoded logs.
+ *
+ * Each field of a supported log is appended to its own column. A column is a list of
+ * fixed capacity chunks allocated from an arena, so appending never moves existing values
+ * and each chunk is a contiguous and aligned array ready for vectorized processing.
+ *
+ * \copyright		Copyright (C) 2022, SBG Systems SAS. All rights reserved.
+ * \beginlicense	The MIT license
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * \endlicense
+ */
+
+#ifndef SBG_ECOM_LOG_COLUMNS_H
+#define SBG_ECOM_LOG_COLUMNS_H
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <arena/sbgArena.h>
+
+// Project headers
+#include <sbgEComIds.h>
+#include <binaryLogs/sbgEComBinaryLogs.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Default number of values per column chunk.
+ */
+#define SBG_ECOM_LOG_COLUMNS_DEFAULT_CHUNK_CAPACITY		(4096)
+
+/*!
+ * Column chunks alignment in bytes.
+ */
+#define SBG_ECOM_LOG_COLUMNS_CHUNK_ALIGNMENT			(64)
+
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Column chunk, a contiguous array of values.
+ */
+typedef struct _SbgEComLogColumnChunk
+{
+	struct _SbgEComLogColumnChunk	*pNext;							/*!< Next chunk or NULL if this is the last one. */
+	void							*pData;							/*!< Values, aligned on SBG_ECOM_LOG_COLUMNS_CHUNK_ALIGNMENT bytes. */
+	size_t							 count;							/*!< Number of values in this chunk. */
+} SbgEComLogColumnChunk;
+
+/*!
+ * Column storing all the values of a single log field.
+ *
+ * The type of the values is the one of the corresponding log structure field.
+ */
+typedef struct _SbgEComLogColumn
+{
+	SbgEComLogColumnChunk			*pFirstChunk;					/*!< First chunk or NULL if the column is empty. */
+	SbgEComLogColumnChunk			*pLastChunk;					/*!< Last chunk, values are appended to this one. */
+	size_t							 elementSize;					/*!< Size of a value, in bytes. */
+	size_t							 count;							/*!< Total number of values. */
+} SbgEComLogColumn;
+
+/*!
+ * Columns for SBG_ECOM_LOG_EKF_NAV logs.
+ */
+typedef struct _SbgEComLogColumnsEkfNav
+{
+	SbgEComLogColumn				timeStamp;						/*!< uint32_t time in us since the sensor power up. */
+	SbgEComLogColumn				velocity[3];					/*!< float North, East, Down velocity in m.s^-1. */
+	SbgEComLogColumn				velocityStdDev[3];				/*!< float North, East, Down velocity 1 sigma standard deviation in m.s^-1. */
+	SbgEComLogColumn				latitude;						/*!< double latitude in degrees, positive north. */
+	SbgEComLogColumn				longitude;						/*!< double longitude in degrees, positive east. */
+	SbgEComLogColumn				altitude;						/*!< double altitude above Mean Sea Level in meters. */
+	SbgEComLogColumn				undulation;						/*!< float altitude difference between the geoid and the ellipsoid in meters. */
+	SbgEComLogColumn				positionStdDev[3];				/*!< float latitude, longitude, altitude 1 sigma standard deviation in meters. */
+	SbgEComLogColumn				status;							/*!< uint32_t EKF solution status bitmask and enum. */
+} SbgEComLogColumnsEkfNav;
+
+/*!
+ * Columns for SBG_ECOM_LOG_IMU_DATA logs.
+ */
+typedef struct _SbgEComLogColumnsImuData
+{
+	SbgEComLogColumn				timeStamp;						/*!< uint32_t time in us since the sensor power up. */
+	SbgEComLogColumn				status;							/*!< uint16_t IMU status bitmask. */
+	SbgEComLogColumn				accelerometers[3];				/*!< float X, Y, Z accelerometers in m.s^-2. */
+	SbgEComLogColumn				gyroscopes[3];					/*!< float X, Y, Z gyroscopes in rad.s^-1. */
+	SbgEComLogColumn				temperature;					/*!< float internal temperature in °C. */
+	SbgEComLogColumn				deltaVelocity[3];				/*!< float X, Y, Z delta velocity in m.s^-2. */
+	SbgEComLogColumn				deltaAngle[3];					/*!< float X, Y, Z delta angle in rad.s^-1. */
+} SbgEComLogColumnsImuData;
+
+/*!
+ * Columns for SBG_ECOM_LOG_GPS#_POS logs.
+ */
+typedef struct _SbgEComLogColumnsGpsPos
+{
+	SbgEComLogColumn				timeStamp;						/*!< uint32_t time in us since the sensor power up. */
+	SbgEComLogColumn				status;							/*!< uint32_t GPS position status, type and bitmask. */
+	SbgEComLogColumn				timeOfWeek;						/*!< uint32_t GPS time of week in ms. */
+	SbgEComLogColumn				latitude;						/*!< double latitude in degrees, positive north. */
+	SbgEComLogColumn				longitude;						/*!< double longitude in degrees, positive east. */
+	SbgEComLogColumn				altitude;						/*!< double altitude above Mean Sea Level in meters. */
+	SbgEComLogColumn				undulation;						/*!< float altitude difference between the geoid and the ellipsoid in meters. */
+	SbgEComLogColumn				latitudeAccuracy;				/*!< float 1 sigma latitude accuracy in meters. */
+	SbgEComLogColumn				longitudeAccuracy;				/*!< float 1 sigma longitude accuracy in meters. */
+	SbgEComLogColumn				altitudeAccuracy;				/*!< float 1 sigma altitude accuracy in meters. */
+	SbgEComLogColumn				numSvUsed;						/*!< uint8_t number of space vehicles used to compute the solution. */
+	SbgEComLogColumn				baseStationId;					/*!< uint16_t base station id for differential corrections. */
+	SbgEComLogColumn				differentialAge;				/*!< uint16_t differential correction age in 0.01 seconds. */
+} SbgEComLogColumnsGpsPos;
+
+/*!
+ * Columnar log accumulator.
+ */
+typedef struct _SbgEComLogColumns
+{
+	SbgArena						arena;							/*!< Arena all chunks are allocated from. */
+	size_t							chunkCapacity;					/*!< Number of values per chunk. */
+
+	SbgEComLogColumnsEkfNav			ekfNav;							/*!< SBG_ECOM_LOG_EKF_NAV columns. */
+	SbgEComLogColumnsImuData		imuData;						/*!< SBG_ECOM_LOG_IMU_DATA columns. */
+	SbgEComLogColumnsGpsPos			gps1Pos;						/*!< SBG_ECOM_LOG_GPS1_POS columns. */
+	SbgEComLogColumnsGpsPos			gps2Pos;						/*!< SBG_ECOM_LOG_GPS2_POS columns. */
+} SbgEComLogColumns;
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Columnar log accumulator constructor.
+ *
+ * \param[in]	pColumns					Columnar log accumulator.
+ * \param[in]	chunkCapacity				Number of values per chunk, 0 to use SBG_ECOM_LOG_COLUMNS_DEFAULT_CHUNK_CAPACITY.
+ */
+void sbgEComLogColumnsConstruct(SbgEComLogColumns *pColumns, size_t chunkCapacity);
+
+/*!
+ * Columnar log accumulator destructor.
+ *
+ * \param[in]	pColumns					Columnar log accumulator.
+ */
+void sbgEComLogColumnsDestroy(SbgEComLogColumns *pColumns);
+
+/*!
+ * Remove all values from all columns.
+ *
+ * Memory is kept to be reused by next appends.
+ *
+ * \param[in]	pColumns					Columnar log accumulator.
+ */
+void sbgEComLogColumnsClear(SbgEComLogColumns *pColumns);
+
+/*!
+ * Append a decoded log to the corresponding columns.
+ *
+ * This method can be directly called from the log callback, unsupported logs are ignored.
+ * A log is either appended to all its columns or to none of them.
+ *
+ * \param[in]	pColumns					Columnar log accumulator.
+ * \param[in]	msgClass					Log class.
+ * \param[in]	msg							Log message ID.
+ * \param[in]	pLogData					Decoded log.
+ * \return									SBG_NO_ERROR if successful or if the log isn't supported,
+ *											SBG_MALLOC_FAILED if a chunk can't be allocated.
+ */
+SbgErrorCode sbgEComLogColumnsAppend(SbgEComLogColumns *pColumns, SbgEComClass msgClass, SbgEComMsgId msg, const SbgBinaryLogData *pLogData);
+
+/*!
+ * Returns the number of values in a column.
+ *
+ * \param[in]	pColumn						Column.
+ * \return									Number of values.
+ */
+size_t sbgEComLogColumnGetCount(const SbgEComLogColumn *pColumn);
+
+/*!
+ * Returns the first chunk of a column.
+ *
+ * Chunks are iterated through their pNext member.
+ *
+ * \param[in]	pColumn						Column.
+ * \return									First chunk, NULL if the column is empty.
+ */
+const SbgEComLogColumnChunk *sbgEComLogColumnGetFirstChunk(const SbgEComLogColumn *pColumn);
+
+/*!
+ * Copy all the values of a column to a contiguous array.
+ *
+ * \param[in]	pColumn						Column.
+ * \param[out]	pDst						Destination array, at least count * elementSize bytes.
+ */
+void sbgEComLogColumnCopy(const SbgEComLogColumn *pColumn, void *pDst);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_ECOM_LOG_COLUMNS_H
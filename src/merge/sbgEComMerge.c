@@ -0,0 +1,541 @@
+﻿// sbgCommonLib headers
+#include <sbgCommon.h>
+
+// Local headers
+#include "sbgEComMerge.h"
+
+//----------------------------------------------------------------------//
+//- Private definitions                                                -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Header of a log stored in a lookahead buffer, followed by the log payload.
+ */
+typedef struct _SbgEComMergeLookaheadEntry
+{
+	size_t						 offset;					/*!< Offset of the log in the frame source. */
+	uint64_t					 hostTimeUs;				/*!< Host reception time in us. */
+	int64_t						 deviceTimeUs;				/*!< Extended device time in us. */
+	bool						 deviceTimeValid;			/*!< True if the device time is valid. */
+	SbgEComClass				 msgClass;					/*!< Log message class. */
+	SbgEComMsgId				 msgId;						/*!< Log message id. */
+	size_t						 payloadSize;				/*!< Log payload size in bytes. */
+} SbgEComMergeLookaheadEntry;
+
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Set the UTC time of a log.
+ *
+ * \param[in]	pInput						Frame source.
+ * \param[out]	pFrame						Log.
+ * \param[in]	utcTimeValid				True if the UTC time is valid.
+ * \param[in]	utcTimeUs					UTC time in us since 1970-01-01.
+ */
+static void sbgEComMergeInputSetTime(SbgEComMergeInput *pInput, SbgEComMergeFrame *pFrame, bool utcTimeValid, int64_t utcTimeUs)
+{
+	assert(pInput);
+	assert(pFrame);
+
+	pFrame->utcTimeValid	= utcTimeValid;
+	pFrame->utcTimeUs		= utcTimeValid ? utcTimeUs : 0;
+
+	if (utcTimeValid)
+	{
+		pInput->lastTimeValid	= true;
+		pInput->lastTimeUs		= utcTimeUs;
+	}
+}
+
+/*!
+ * Store a log in the lookahead buffer of a frame source.
+ *
+ * \param[in]	pInput						Frame source.
+ * \param[in]	lookaheadSize				Lookahead buffer size in bytes.
+ * \param[in]	pFrame						Log, already processed by the time tracker.
+ * \return									True if the log has been stored, false if the lookahead buffer is full.
+ */
+static bool sbgEComMergeInputPushLookahead(SbgEComMergeInput *pInput, size_t lookaheadSize, const SbgEComCaptureFrame *pFrame)
+{
+	SbgEComMergeLookaheadEntry	 entry;
+	bool						 stored = false;
+
+	assert(pInput);
+	assert(pFrame);
+
+	if ((lookaheadSize - pInput->lookaheadWriteOffset) >= (sizeof(entry) + pFrame->payloadSize))
+	{
+		memset(&entry, 0, sizeof(entry));
+
+		entry.offset			= pFrame->offset;
+		entry.hostTimeUs		= pFrame->hostTimeUs;
+		entry.deviceTimeUs		= pInput->timeTracker.deviceTimeUs;
+		entry.deviceTimeValid	= pInput->timeTracker.deviceTimeValid;
+		entry.msgClass			= pFrame->msgClass;
+		entry.msgId				= pFrame->msgId;
+		entry.payloadSize		= pFrame->payloadSize;
+
+		//
+		// Entries are not aligned, they are always copied
+		//
+		memcpy(&pInput->pLookahead[pInput->lookaheadWriteOffset], &entry, sizeof(entry));
+		memcpy(&pInput->pLookahead[pInput->lookaheadWriteOffset + sizeof(entry)], pFrame->pPayload, pFrame->payloadSize);
+
+		pInput->lookaheadWriteOffset += sizeof(entry) + pFrame->payloadSize;
+
+		stored = true;
+	}
+
+	return stored;
+}
+
+/*!
+ * Take the oldest log of the lookahead buffer of a frame source.
+ *
+ * Logs are dated with the first valid UTC time of the source, if any.
+ *
+ * \param[in]	pInput						Frame source.
+ * \param[out]	pFrame						Log, its payload references the lookahead buffer.
+ */
+static void sbgEComMergeInputPopLookahead(SbgEComMergeInput *pInput, SbgEComMergeFrame *pFrame)
+{
+	const SbgEComCaptureTimeTracker	*pTimeTracker;
+	SbgEComMergeLookaheadEntry		 entry;
+
+	assert(pInput);
+	assert(pFrame);
+	assert(pInput->lookaheadReadOffset < pInput->lookaheadWriteOffset);
+
+	pTimeTracker = &pInput->timeTracker;
+
+	memcpy(&entry, &pInput->pLookahead[pInput->lookaheadReadOffset], sizeof(entry));
+
+	pFrame->frame.offset		= entry.offset;
+	pFrame->frame.hostTimeUs	= entry.hostTimeUs;
+	pFrame->frame.msgClass		= entry.msgClass;
+	pFrame->frame.msgId			= entry.msgId;
+	pFrame->frame.pPayload		= &pInput->pLookahead[pInput->lookaheadReadOffset + sizeof(entry)];
+	pFrame->frame.payloadSize	= entry.payloadSize;
+
+	//
+	// The device time is continuous, logs before the UTC reference are dated backward from it
+	//
+	if (pTimeTracker->utcTimeValid && entry.deviceTimeValid)
+	{
+		sbgEComMergeInputSetTime(pInput, pFrame, true, pTimeTracker->utcRefTimeUs + (entry.deviceTimeUs - pTimeTracker->utcRefDeviceTimeUs));
+	}
+	else
+	{
+		sbgEComMergeInputSetTime(pInput, pFrame, pTimeTracker->utcTimeValid && pInput->lastTimeValid, pInput->lastTimeUs);
+	}
+
+	pInput->lookaheadReadOffset += sizeof(entry) + entry.payloadSize;
+
+	//
+	// The payload remains valid as logs are only stored again once the frame is delivered
+	//
+	if (pInput->lookaheadReadOffset == pInput->lookaheadWriteOffset)
+	{
+		pInput->lookaheadReadOffset		= 0;
+		pInput->lookaheadWriteOffset	= 0;
+		pInput->draining				= false;
+	}
+}
+
+/*!
+ * Read the next log of a frame source to deliver.
+ *
+ * \param[in]	pMerge						Merge.
+ * \param[in]	pInput						Frame source.
+ * \return									True if a log is available in the frame source head, false if the source has ended.
+ */
+static bool sbgEComMergeInputFetch(SbgEComMerge *pMerge, SbgEComMergeInput *pInput)
+{
+	SbgErrorCode			 errorCode;
+	SbgEComCaptureFrame		 frame;
+	int64_t					 utcTimeUs;
+	bool					 found = false;
+
+	assert(pMerge);
+	assert(pInput);
+
+	while (!found)
+	{
+		if (pInput->draining && (pInput->lookaheadReadOffset < pInput->lookaheadWriteOffset))
+		{
+			sbgEComMergeInputPopLookahead(pInput, &pInput->head);
+			found = true;
+		}
+		else if (pInput->hasNext)
+		{
+			pInput->head	= pInput->next;
+			pInput->hasNext	= false;
+			found			= true;
+		}
+		else if (pInput->ended)
+		{
+			break;
+		}
+		else
+		{
+			errorCode = pInput->pReadFunc(pInput->pSource, &frame);
+
+			if (errorCode == SBG_NO_ERROR)
+			{
+				pInput->nrConsecutiveErrors = 0;
+
+				sbgEComCaptureTimeTrackerProcess(&pInput->timeTracker, frame.msgClass, frame.msgId, frame.pPayload, frame.payloadSize);
+
+				if (sbgEComCaptureTimeTrackerGetTime(&pInput->timeTracker, SBG_ECOM_CAPTURE_TIME_UTC, frame.hostTimeUs, &utcTimeUs))
+				{
+					//
+					// Stored logs can now be dated, they are delivered first
+					//
+					pInput->next.frame	= frame;
+					pInput->hasNext		= true;
+					pInput->draining	= true;
+
+					sbgEComMergeInputSetTime(pInput, &pInput->next, true, utcTimeUs);
+				}
+				else if (!sbgEComMergeInputPushLookahead(pInput, pMerge->lookaheadSize, &frame))
+				{
+					//
+					// No UTC time in the lookahead window, stored logs can't be dated
+					//
+					pInput->next.frame	= frame;
+					pInput->hasNext		= true;
+					pInput->draining	= true;
+
+					sbgEComMergeInputSetTime(pInput, &pInput->next, false, 0);
+				}
+			}
+			else if (errorCode == SBG_NOT_READY)
+			{
+				pInput->ended		= true;
+				pInput->draining	= true;
+			}
+			else
+			{
+				pMerge->stats.nrReadErrors++;
+				pInput->nrConsecutiveErrors++;
+
+				if (pInput->nrConsecutiveErrors >= SBG_ECOM_MERGE_MAX_READ_ERRORS)
+				{
+					SBG_LOG_ERROR(errorCode, "too many read errors, frame source %zu ignored from now", (size_t)(pInput - pMerge->inputs));
+
+					pInput->ended		= true;
+					pInput->draining	= true;
+				}
+			}
+		}
+	}
+
+	return found;
+}
+
+/*!
+ * Returns true if the head log of a frame source must be delivered before another one.
+ *
+ * Logs without a valid UTC time are delivered first, ties are broken by frame source index.
+ *
+ * \param[in]	pMerge						Merge.
+ * \param[in]	inputIndex1					First frame source index.
+ * \param[in]	inputIndex2					Second frame source index.
+ * \return									True if the first frame source head must be delivered first.
+ */
+static bool sbgEComMergeIsBefore(const SbgEComMerge *pMerge, size_t inputIndex1, size_t inputIndex2)
+{
+	const SbgEComMergeFrame		*pFrame1;
+	const SbgEComMergeFrame		*pFrame2;
+	int64_t						 time1;
+	int64_t						 time2;
+
+	assert(pMerge);
+
+	pFrame1	= &pMerge->inputs[inputIndex1].head;
+	pFrame2	= &pMerge->inputs[inputIndex2].head;
+	time1	= pFrame1->utcTimeValid ? pFrame1->utcTimeUs : INT64_MIN;
+	time2	= pFrame2->utcTimeValid ? pFrame2->utcTimeUs : INT64_MIN;
+
+	return (time1 < time2) || ((time1 == time2) && (inputIndex1 < inputIndex2));
+}
+
+/*!
+ * Insert a frame source in the heap.
+ *
+ * \param[in]	pMerge						Merge.
+ * \param[in]	inputIndex					Frame source index, with a log in its head.
+ */
+static void sbgEComMergeHeapPush(SbgEComMerge *pMerge, size_t inputIndex)
+{
+	size_t		 index;
+
+	assert(pMerge);
+	assert(pMerge->heapSize < SBG_ARRAY_SIZE(pMerge->heap));
+
+	index = pMerge->heapSize++;
+
+	while (index > 0)
+	{
+		size_t		 parentIndex = (index - 1) / 2;
+
+		if (!sbgEComMergeIsBefore(pMerge, inputIndex, pMerge->heap[parentIndex]))
+		{
+			break;
+		}
+
+		pMerge->heap[index]	= pMerge->heap[parentIndex];
+		index				= parentIndex;
+	}
+
+	pMerge->heap[index] = inputIndex;
+}
+
+/*!
+ * Remove the frame source with the oldest head log from the heap.
+ *
+ * \param[in]	pMerge						Merge.
+ * \return									Frame source index.
+ */
+static size_t sbgEComMergeHeapPop(SbgEComMerge *pMerge)
+{
+	size_t		 inputIndex;
+	size_t		 lastInputIndex;
+	size_t		 index = 0;
+
+	assert(pMerge);
+	assert(pMerge->heapSize > 0);
+
+	inputIndex		= pMerge->heap[0];
+	lastInputIndex	= pMerge->heap[--pMerge->heapSize];
+
+	for (;;)
+	{
+		size_t		 childIndex = (index * 2) + 1;
+
+		if (childIndex >= pMerge->heapSize)
+		{
+			break;
+		}
+
+		if (((childIndex + 1) < pMerge->heapSize) && sbgEComMergeIsBefore(pMerge, pMerge->heap[childIndex + 1], pMerge->heap[childIndex]))
+		{
+			childIndex++;
+		}
+
+		if (!sbgEComMergeIsBefore(pMerge, pMerge->heap[childIndex], lastInputIndex))
+		{
+			break;
+		}
+
+		pMerge->heap[index]	= pMerge->heap[childIndex];
+		index				= childIndex;
+	}
+
+	if (pMerge->heapSize > 0)
+	{
+		pMerge->heap[index] = lastInputIndex;
+	}
+
+	return inputIndex;
+}
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+void sbgEComMergeInit(SbgEComMerge *pMerge, size_t lookaheadSize)
+{
+	assert(pMerge);
+
+	memset(pMerge, 0, sizeof(*pMerge));
+
+	if (lookaheadSize == 0)
+	{
+		lookaheadSize = SBG_ECOM_MERGE_DEFAULT_LOOKAHEAD_SIZE;
+	}
+
+	pMerge->lookaheadSize = lookaheadSize;
+}
+
+void sbgEComMergeClose(SbgEComMerge *pMerge)
+{
+	assert(pMerge);
+
+	for (size_t i = 0; i < pMerge->nrInputs; i++)
+	{
+		free(pMerge->inputs[i].pLookahead);
+	}
+
+	memset(pMerge, 0, sizeof(*pMerge));
+}
+
+SbgErrorCode sbgEComMergeAddSource(SbgEComMerge *pMerge, SbgEComReplayReadFunc pReadFunc, void *pSource)
+{
+	SbgErrorCode			 errorCode = SBG_NO_ERROR;
+	SbgEComMergeInput		*pInput;
+
+	assert(pMerge);
+	assert(pReadFunc);
+	assert(!pMerge->started);
+
+	if (pMerge->nrInputs < SBG_ARRAY_SIZE(pMerge->inputs))
+	{
+		pInput = &pMerge->inputs[pMerge->nrInputs];
+
+		memset(pInput, 0, sizeof(*pInput));
+
+		pInput->pLookahead = malloc(pMerge->lookaheadSize);
+
+		if (pInput->pLookahead)
+		{
+			pInput->pReadFunc	= pReadFunc;
+			pInput->pSource		= pSource;
+
+			sbgEComCaptureTimeTrackerConstruct(&pInput->timeTracker);
+
+			pMerge->nrInputs++;
+		}
+		else
+		{
+			errorCode = SBG_MALLOC_FAILED;
+			SBG_LOG_ERROR(errorCode, "unable to allocate lookahead buffer");
+		}
+	}
+	else
+	{
+		errorCode = SBG_BUFFER_OVERFLOW;
+		SBG_LOG_ERROR(errorCode, "too many frame sources");
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComMergeAddCapture(SbgEComMerge *pMerge, const SbgEComCaptureReader *pReader)
+{
+	SbgErrorCode			 errorCode;
+	SbgEComMergeInput		*pInput;
+
+	assert(pMerge);
+	assert(pReader);
+
+	if (pMerge->nrInputs < SBG_ARRAY_SIZE(pMerge->inputs))
+	{
+		pInput		= &pMerge->inputs[pMerge->nrInputs];
+		errorCode	= sbgEComMergeAddSource(pMerge, sbgEComReplayCaptureSourceRead, &pInput->captureSource);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			sbgEComReplayCaptureSourceInit(&pInput->captureSource, pReader, sbgEComCaptureReaderGetFirstOffset(pReader));
+		}
+	}
+	else
+	{
+		errorCode = SBG_BUFFER_OVERFLOW;
+		SBG_LOG_ERROR(errorCode, "too many frame sources");
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComMergeReadFrame(SbgEComMerge *pMerge, SbgEComMergeFrame *pFrame)
+{
+	SbgErrorCode		 errorCode = SBG_NO_ERROR;
+	size_t				 inputIndex;
+
+	assert(pMerge);
+	assert(pFrame);
+
+	if (!pMerge->started)
+	{
+		for (size_t i = 0; i < pMerge->nrInputs; i++)
+		{
+			if (sbgEComMergeInputFetch(pMerge, &pMerge->inputs[i]))
+			{
+				sbgEComMergeHeapPush(pMerge, i);
+			}
+		}
+
+		pMerge->started = true;
+	}
+	else if (pMerge->refill)
+	{
+		//
+		// The previous log payload may reference the source, it is only read now
+		//
+		if (sbgEComMergeInputFetch(pMerge, &pMerge->inputs[pMerge->lastInputIndex]))
+		{
+			sbgEComMergeHeapPush(pMerge, pMerge->lastInputIndex);
+		}
+
+		pMerge->refill = false;
+	}
+
+	if (pMerge->heapSize > 0)
+	{
+		inputIndex = sbgEComMergeHeapPop(pMerge);
+
+		*pFrame				= pMerge->inputs[inputIndex].head;
+		pFrame->inputIndex	= inputIndex;
+
+		pMerge->lastInputIndex	= inputIndex;
+		pMerge->refill			= true;
+
+		pMerge->stats.nrFrames++;
+
+		if (!pFrame->utcTimeValid)
+		{
+			pMerge->stats.nrUntimedFrames++;
+		}
+	}
+	else
+	{
+		errorCode = SBG_NOT_READY;
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComMergeReplayRead(void *pMerge, SbgEComCaptureFrame *pFrame)
+{
+	SbgErrorCode		 errorCode;
+	SbgEComMergeFrame	 mergeFrame;
+
+	assert(pFrame);
+
+	errorCode = sbgEComMergeReadFrame((SbgEComMerge*)pMerge, &mergeFrame);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		*pFrame = mergeFrame.frame;
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComMergeRun(SbgEComMerge *pMerge, SbgEComMergeFrameFunc pFrameFunc, void *pUserArg)
+{
+	SbgEComMergeFrame	 frame;
+
+	assert(pMerge);
+	assert(pFrameFunc);
+
+	while (sbgEComMergeReadFrame(pMerge, &frame) == SBG_NO_ERROR)
+	{
+		if (pFrameFunc(&frame, pUserArg) != SBG_NO_ERROR)
+		{
+			pMerge->stats.nrErrors++;
+		}
+	}
+
+	return SBG_NO_ERROR;
+}
+
+const SbgEComMergeStats *sbgEComMergeGetStats(const SbgEComMerge *pMerge)
+{
+	assert(pMerge);
+
+	return &pMerge->stats;
+}
@@ -0,0 +1,247 @@
+﻿/*!
+ * \file			sbgEComMerge.h
+ * \author			SBG Systems
+ * \date			19 October 2026
+ *
+ * \brief			Time ordered merge of logs recorded by several devices.
+ *
+ *				A merge reads the logs of several frame sources, one per device, and maps
+ *				each device time stamps onto a common UTC timeline using its SBG_ECOM_LOG_UTC_TIME
+ *				logs. Logs are then delivered in UTC time order through a k-way merge.
+ *
+ *				Memory is bounded: only the next log of each source is kept, plus a lookahead
+ *				buffer used to date the logs received before the first valid UTC time.
+ *
+ * \copyright		Copyright (C) 2022, SBG Systems SAS. All rights reserved.
+ * \beginlicense	The MIT license
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * \endlicense
+ */
+
+#ifndef SBG_ECOM_MERGE_H
+#define SBG_ECOM_MERGE_H
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+// Project headers
+#include <sbgECom.h>
+#include <capture/sbgEComCapture.h>
+#include <replay/sbgEComReplay.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Maximum number of merged frame sources.
+ */
+#define SBG_ECOM_MERGE_MAX_INPUTS						(32)
+
+/*!
+ * Default lookahead buffer size per frame source, in bytes.
+ */
+#define SBG_ECOM_MERGE_DEFAULT_LOOKAHEAD_SIZE			(1024 * 1024)
+
+/*!
+ * Number of consecutive read errors after which a frame source is considered as ended.
+ */
+#define SBG_ECOM_MERGE_MAX_READ_ERRORS					(16)
+
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Log delivered by a merge.
+ */
+typedef struct _SbgEComMergeFrame
+{
+	SbgEComCaptureFrame			 frame;						/*!< Log. */
+	size_t						 inputIndex;				/*!< Index of the frame source the log comes from. */
+	bool						 utcTimeValid;				/*!< True if the UTC time is valid. */
+	int64_t						 utcTimeUs;					/*!< UTC time in us since 1970-01-01. */
+} SbgEComMergeFrame;
+
+/*!
+ * Callback definition called for each log delivered by a merge.
+ *
+ * \param[in]	pFrame						Delivered log, only valid until the callback returns.
+ * \param[in]	pUserArg					Optional user supplied argument.
+ * \return									SBG_NO_ERROR if the log has been used successfully.
+ */
+typedef SbgErrorCode (*SbgEComMergeFrameFunc)(const SbgEComMergeFrame *pFrame, void *pUserArg);
+
+/*!
+ * Merge statistics.
+ */
+typedef struct _SbgEComMergeStats
+{
+	uint64_t					 nrFrames;					/*!< Number of delivered logs. */
+	uint64_t					 nrUntimedFrames;			/*!< Number of logs delivered without a valid UTC time. */
+	uint64_t					 nrReadErrors;				/*!< Number of frame source read errors. */
+	uint64_t					 nrErrors;					/*!< Number of logs the callback has failed to process. */
+} SbgEComMergeStats;
+
+/*!
+ * Merged frame source.
+ *
+ * Logs read before the first valid UTC time are stored in the lookahead buffer until
+ * they can be dated. If the buffer is full or the source ends first, they are delivered
+ * without a valid UTC time, ahead of the dated logs.
+ */
+typedef struct _SbgEComMergeInput
+{
+	SbgEComReplayReadFunc		 pReadFunc;					/*!< Frame source read function. */
+	void						*pSource;					/*!< Frame source. */
+	SbgEComReplayCaptureSource	 captureSource;				/*!< Capture frame source, used by sbgEComMergeAddCapture(). */
+
+	SbgEComCaptureTimeTracker	 timeTracker;				/*!< Time tracker of the frame source. */
+	bool						 lastTimeValid;				/*!< True if a log has been delivered with a valid UTC time. */
+	int64_t						 lastTimeUs;				/*!< UTC time of the last log delivered with a valid UTC time in us. */
+
+	uint8_t						*pLookahead;				/*!< Lookahead buffer. */
+	size_t						 lookaheadReadOffset;		/*!< Offset of the next log to deliver from the lookahead buffer. */
+	size_t						 lookaheadWriteOffset;		/*!< Offset of the end of the logs in the lookahead buffer. */
+	bool						 draining;					/*!< True if the logs of the lookahead buffer are being delivered. */
+
+	bool						 hasNext;					/*!< True if a log read from the source waits for the lookahead buffer to be drained. */
+	SbgEComMergeFrame			 next;						/*!< Log read from the source. */
+	SbgEComMergeFrame			 head;						/*!< Next log of the source to deliver. */
+
+	uint32_t					 nrConsecutiveErrors;		/*!< Number of consecutive read errors. */
+	bool						 ended;						/*!< True if the frame source has no more log. */
+} SbgEComMergeInput;
+
+/*!
+ * Merge.
+ *
+ * The next log of each frame source is kept in a min-heap ordered by UTC time.
+ */
+typedef struct _SbgEComMerge
+{
+	SbgEComMergeInput			 inputs[SBG_ECOM_MERGE_MAX_INPUTS];	/*!< Frame sources. */
+	size_t						 nrInputs;					/*!< Number of frame sources. */
+	size_t						 lookaheadSize;				/*!< Lookahead buffer size per frame source in bytes. */
+
+	size_t						 heap[SBG_ECOM_MERGE_MAX_INPUTS];	/*!< Indexes of the frame sources with a log to deliver, ordered by UTC time. */
+	size_t						 heapSize;					/*!< Number of frame sources in the heap. */
+	bool						 started;					/*!< True once the first log of each frame source has been read. */
+	bool						 refill;					/*!< True if the next log of the last delivered frame source must be read. */
+	size_t						 lastInputIndex;			/*!< Index of the last delivered frame source. */
+
+	SbgEComMergeStats			 stats;						/*!< Merge statistics. */
+} SbgEComMerge;
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Initialize a merge.
+ *
+ * \param[out]	pMerge						Merge.
+ * \param[in]	lookaheadSize				Lookahead buffer size per frame source in bytes, 0 for SBG_ECOM_MERGE_DEFAULT_LOOKAHEAD_SIZE.
+ */
+void sbgEComMergeInit(SbgEComMerge *pMerge, size_t lookaheadSize);
+
+/*!
+ * Close a merge and release its buffers.
+ *
+ * Frame sources are not closed.
+ *
+ * \param[in]	pMerge						Merge.
+ */
+void sbgEComMergeClose(SbgEComMerge *pMerge);
+
+/*!
+ * Add a frame source to a merge.
+ *
+ * Frame sources must be added before the first log is read.
+ *
+ * \param[in]	pMerge						Merge.
+ * \param[in]	pReadFunc					Frame source read function.
+ * \param[in]	pSource						Frame source.
+ * \return									SBG_NO_ERROR if successful, SBG_BUFFER_OVERFLOW if there are already SBG_ECOM_MERGE_MAX_INPUTS frame sources.
+ */
+SbgErrorCode sbgEComMergeAddSource(SbgEComMerge *pMerge, SbgEComReplayReadFunc pReadFunc, void *pSource);
+
+/*!
+ * Add all the logs of a capture to a merge.
+ *
+ * \param[in]	pMerge						Merge.
+ * \param[in]	pReader						Capture reader, must remain open until the merge is closed.
+ * \return									SBG_NO_ERROR if successful, SBG_BUFFER_OVERFLOW if there are already SBG_ECOM_MERGE_MAX_INPUTS frame sources.
+ */
+SbgErrorCode sbgEComMergeAddCapture(SbgEComMerge *pMerge, const SbgEComCaptureReader *pReader);
+
+/*!
+ * Read the next log in UTC time order.
+ *
+ * The returned payload is only valid until the next call.
+ *
+ * \param[in]	pMerge						Merge.
+ * \param[out]	pFrame						Next log.
+ * \return									SBG_NO_ERROR if a log has been read, SBG_NOT_READY if there is no more log.
+ */
+SbgErrorCode sbgEComMergeReadFrame(SbgEComMerge *pMerge, SbgEComMergeFrame *pFrame);
+
+/*!
+ * Read the next log of a merge, as a replay frame source.
+ *
+ * The replay time tracker follows a single device, merged logs should thus be paced
+ * on SBG_ECOM_CAPTURE_TIME_HOST or replayed unthrottled.
+ *
+ * \param[in]	pMerge						Merge.
+ * \param[out]	pFrame						Next log.
+ * \return									SBG_NO_ERROR if a log has been read, SBG_NOT_READY if there is no more log.
+ */
+SbgErrorCode sbgEComMergeReplayRead(void *pMerge, SbgEComCaptureFrame *pFrame);
+
+/*!
+ * Deliver all logs to a callback, in UTC time order.
+ *
+ * Errors returned by the callback are counted but don't stop the merge.
+ *
+ * \param[in]	pMerge						Merge.
+ * \param[in]	pFrameFunc					Callback called for each log.
+ * \param[in]	pUserArg					Optional user argument passed to the callback.
+ * \return									SBG_NO_ERROR once all logs have been delivered.
+ */
+SbgErrorCode sbgEComMergeRun(SbgEComMerge *pMerge, SbgEComMergeFrameFunc pFrameFunc, void *pUserArg);
+
+/*!
+ * Returns the merge statistics.
+ *
+ * \param[in]	pMerge						Merge.
+ * \return									Merge statistics.
+ */
+const SbgEComMergeStats *sbgEComMergeGetStats(const SbgEComMerge *pMerge);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_ECOM_MERGE_H
@@ -0,0 +1,250 @@
+﻿// sbgCommonLib headers
+#include <sbgCommon.h>
+
+// Local headers
+#include "sbgEComReplay.h"
+
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Wait until a given host time.
+ *
+ * The thread sleeps while the remaining time is above one millisecond, then spins
+ * to get a sub millisecond accuracy.
+ *
+ * \param[in]	targetTimeUs				Host time to wait for in us.
+ * \return									Host time when the wait ends in us.
+ */
+static uint64_t sbgEComReplayWaitUntil(uint64_t targetTimeUs)
+{
+	uint64_t	currentTimeUs;
+
+	currentTimeUs = sbgGetTimeInUs();
+
+	while (currentTimeUs < targetTimeUs)
+	{
+		if ((targetTimeUs - currentTimeUs) > 2000)
+		{
+			sbgSleep((uint32_t)sbgMin((targetTimeUs - currentTimeUs) / 1000 - 1, UINT32_MAX));
+		}
+
+		currentTimeUs = sbgGetTimeInUs();
+	}
+
+	return currentTimeUs;
+}
+
+/*!
+ * Pace the delivery of the last read log.
+ *
+ * \param[in]	pReplay						Replay.
+ * \param[in]	pFrame						Last read log, already processed by the time tracker.
+ */
+static void sbgEComReplayPace(SbgEComReplay *pReplay, const SbgEComCaptureFrame *pFrame)
+{
+	int64_t		frameTime;
+	int64_t		targetTimeUs;
+	uint64_t	currentTimeUs;
+	uint64_t	lagUs;
+
+	assert(pReplay);
+	assert(pFrame);
+
+	currentTimeUs = sbgGetTimeInUs();
+
+	if ((pReplay->speed > 0.0f) && sbgEComCaptureTimeTrackerGetTime(&pReplay->timeTracker, pReplay->timeBase, pFrame->hostTimeUs, &frameTime))
+	{
+		if (pReplay->started)
+		{
+			targetTimeUs = (int64_t)pReplay->startHostTimeUs + (int64_t)((double)(frameTime - pReplay->startFrameTime) / pReplay->speed);
+
+			if ((int64_t)currentTimeUs < targetTimeUs)
+			{
+				currentTimeUs = sbgEComReplayWaitUntil((uint64_t)targetTimeUs);
+			}
+
+			//
+			// Logs slightly out of order are due before the current time but aren't late
+			//
+			if (((int64_t)currentTimeUs > targetTimeUs) && (frameTime >= pReplay->lastFrameTime))
+			{
+				lagUs = (uint64_t)((int64_t)currentTimeUs - targetTimeUs);
+
+				pReplay->stats.sumLagUs	+= lagUs;
+				pReplay->stats.maxLagUs	 = sbgMax(pReplay->stats.maxLagUs, lagUs);
+
+				if (lagUs > SBG_ECOM_REPLAY_LATE_THRESHOLD_US)
+				{
+					pReplay->stats.nrLateFrames++;
+				}
+			}
+		}
+		else
+		{
+			pReplay->startFrameTime		= frameTime;
+			pReplay->startHostTimeUs	= currentTimeUs;
+			pReplay->lastFrameTime		= frameTime;
+			pReplay->started			= true;
+		}
+
+		pReplay->lastFrameTime = sbgMax(pReplay->lastFrameTime, frameTime);
+	}
+
+	if (pReplay->stats.nrFrames == 0)
+	{
+		pReplay->firstHostTimeUs = currentTimeUs;
+	}
+
+	pReplay->stats.elapsedUs = currentTimeUs - pReplay->firstHostTimeUs;
+}
+
+/*!
+ * Pace a log read from the frame source and dispatch it to the handle callbacks.
+ *
+ * \param[in]	pReplay						Replay.
+ * \param[in]	pFrame						Log to deliver.
+ * \return									SBG_NO_ERROR if the log has been processed by the handle callbacks.
+ */
+static SbgErrorCode sbgEComReplayDeliver(SbgEComReplay *pReplay, const SbgEComCaptureFrame *pFrame)
+{
+	SbgErrorCode			errorCode;
+
+	assert(pReplay);
+	assert(pFrame);
+
+	sbgEComCaptureTimeTrackerProcess(&pReplay->timeTracker, pFrame->msgClass, pFrame->msgId, pFrame->pPayload, pFrame->payloadSize);
+
+	sbgEComReplayPace(pReplay, pFrame);
+
+	errorCode = sbgEComHandleLogPayload(pReplay->pHandle, pFrame->msgClass, pFrame->msgId, pFrame->pPayload, pFrame->payloadSize);
+
+	pReplay->stats.nrFrames++;
+
+	if (errorCode != SBG_NO_ERROR)
+	{
+		pReplay->stats.nrErrors++;
+	}
+
+	return errorCode;
+}
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+void sbgEComReplayCaptureSourceInit(SbgEComReplayCaptureSource *pSource, const SbgEComCaptureReader *pReader, size_t offset)
+{
+	assert(pSource);
+	assert(pReader);
+
+	pSource->pReader	= pReader;
+	pSource->offset		= offset;
+}
+
+SbgErrorCode sbgEComReplayCaptureSourceRead(void *pSource, SbgEComCaptureFrame *pFrame)
+{
+	SbgEComReplayCaptureSource	*pCaptureSource = pSource;
+
+	assert(pCaptureSource);
+
+	return sbgEComCaptureReaderReadFrame(pCaptureSource->pReader, &pCaptureSource->offset, pFrame);
+}
+
+void sbgEComReplayInit(SbgEComReplay *pReplay, SbgEComHandle *pHandle, SbgEComReplayReadFunc pReadFunc, void *pSource)
+{
+	assert(pReplay);
+	assert(pHandle);
+	assert(pReadFunc);
+
+	memset(pReplay, 0, sizeof(*pReplay));
+
+	pReplay->pHandle	= pHandle;
+	pReplay->pReadFunc	= pReadFunc;
+	pReplay->pSource	= pSource;
+	pReplay->timeBase	= SBG_ECOM_CAPTURE_TIME_DEVICE;
+	pReplay->speed		= SBG_ECOM_REPLAY_SPEED_UNTHROTTLED;
+
+	sbgEComCaptureTimeTrackerConstruct(&pReplay->timeTracker);
+}
+
+void sbgEComReplaySetPacing(SbgEComReplay *pReplay, SbgEComCaptureTimeBase timeBase, float speed)
+{
+	assert(pReplay);
+	assert(speed >= 0.0f);
+
+	pReplay->timeBase	= timeBase;
+	pReplay->speed		= speed;
+	pReplay->started	= false;
+}
+
+SbgErrorCode sbgEComReplayStep(SbgEComReplay *pReplay)
+{
+	SbgErrorCode			errorCode;
+	SbgEComCaptureFrame		frame;
+
+	assert(pReplay);
+
+	errorCode = pReplay->pReadFunc(pReplay->pSource, &frame);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		errorCode = sbgEComReplayDeliver(pReplay, &frame);
+	}
+	else if (errorCode != SBG_NOT_READY)
+	{
+		pReplay->stats.nrReadErrors++;
+		SBG_LOG_ERROR(errorCode, "unable to read the next log from the frame source");
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComReplayRun(SbgEComReplay *pReplay)
+{
+	SbgErrorCode			errorCode;
+	SbgEComCaptureFrame		frame;
+
+	assert(pReplay);
+
+	//
+	// Replay all logs until the frame source reports an error, SBG_NOT_READY at the end of the source
+	// Callback errors are only counted as they don't prevent reading the next logs
+	//
+	do
+	{
+		errorCode = pReplay->pReadFunc(pReplay->pSource, &frame);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			sbgEComReplayDeliver(pReplay, &frame);
+		}
+	} while (errorCode == SBG_NO_ERROR);
+
+	if (errorCode == SBG_NOT_READY)
+	{
+		errorCode = SBG_NO_ERROR;
+	}
+	else
+	{
+		pReplay->stats.nrReadErrors++;
+		SBG_LOG_ERROR(errorCode, "unable to read the next log from the frame source");
+	}
+
+	return errorCode;
+}
+
+const SbgEComReplayStats *sbgEComReplayGetStats(const SbgEComReplay *pReplay)
+{
+	assert(pReplay);
+
+	return &pReplay->stats;
+}
+
+void sbgEComReplayResetStats(SbgEComReplay *pReplay)
+{
+	assert(pReplay);
+
+	memset(&pReplay->stats, 0, sizeof(pReplay->stats));
+}
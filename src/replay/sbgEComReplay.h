@@ -0,0 +1,216 @@
+﻿/*!
+ * \file			sbgEComReplay.h
+ * \author			SBG Systems
+ * \date			19 October 2026
+ *
+ * \brief			Replay of captured sbgECom logs.
+ *
+ *				A replay reads logs from a frame source, usually a capture, and dispatches them
+ *				to the callbacks of an sbgECom handle as if they were received from a device.
+ *
+ *				The delivery can be paced on the device time stamp or on the recorded host
+ *				reception time, at real time, at a scaled speed or as fast as possible. The
+ *				lag between the scheduled and the actual delivery time of each log is
+ *				measured to report how well the pacing has been followed.
+ *
+ * \copyright		Copyright (C) 2022, SBG Systems SAS. All rights reserved.
+ * \beginlicense	The MIT license
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * \endlicense
+ */
+
+#ifndef SBG_ECOM_REPLAY_H
+#define SBG_ECOM_REPLAY_H
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+// Project headers
+#include <sbgECom.h>
+#include <capture/sbgEComCapture.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Speed to replay logs as fast as possible.
+ */
+#define SBG_ECOM_REPLAY_SPEED_UNTHROTTLED				(0.0f)
+
+/*!
+ * Lag, in us, above which a log is considered as delivered late.
+ */
+#define SBG_ECOM_REPLAY_LATE_THRESHOLD_US				(1000)
+
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Function reading the next log of a frame source.
+ *
+ * \param[in]	pSource						Frame source.
+ * \param[out]	pFrame						Read log.
+ * \return									SBG_NO_ERROR if a log has been read, SBG_NOT_READY if there is no more log.
+ */
+typedef SbgErrorCode (*SbgEComReplayReadFunc)(void *pSource, SbgEComCaptureFrame *pFrame);
+
+/*!
+ * Frame source reading the logs of a capture.
+ */
+typedef struct _SbgEComReplayCaptureSource
+{
+	const SbgEComCaptureReader	*pReader;					/*!< Capture reader. */
+	size_t						 offset;					/*!< Offset of the next record to read. */
+} SbgEComReplayCaptureSource;
+
+/*!
+ * Replay statistics.
+ *
+ * The lag is the difference between the actual and the scheduled delivery time of a log.
+ * It is always zero for unthrottled replays.
+ */
+typedef struct _SbgEComReplayStats
+{
+	uint32_t					 nrFrames;					/*!< Number of delivered logs. */
+	uint32_t					 nrErrors;					/*!< Number of logs the handle callbacks have failed to process. */
+	uint32_t					 nrReadErrors;				/*!< Number of errors returned by the frame source, other than SBG_NOT_READY. */
+	uint32_t					 nrLateFrames;				/*!< Number of logs delivered with a lag above SBG_ECOM_REPLAY_LATE_THRESHOLD_US. */
+	uint64_t					 maxLagUs;					/*!< Maximum lag in us. */
+	uint64_t					 sumLagUs;					/*!< Sum of the lags in us. */
+	uint64_t					 elapsedUs;					/*!< Time elapsed since the first log has been delivered in us. */
+} SbgEComReplayStats;
+
+/*!
+ * Replay engine.
+ */
+typedef struct _SbgEComReplay
+{
+	SbgEComHandle				*pHandle;					/*!< sbgECom handle the logs are dispatched to. */
+	SbgEComReplayReadFunc		 pReadFunc;					/*!< Frame source read function. */
+	void						*pSource;					/*!< Frame source. */
+
+	SbgEComCaptureTimeBase		 timeBase;					/*!< Time base used to pace the logs delivery. */
+	float						 speed;						/*!< Replay speed, SBG_ECOM_REPLAY_SPEED_UNTHROTTLED to replay as fast as possible. */
+
+	SbgEComCaptureTimeTracker	 timeTracker;				/*!< Time tracker of the replayed logs. */
+	bool						 started;					/*!< True if the pacing reference has been set. */
+	int64_t						 startFrameTime;			/*!< Time of the pacing reference log in us. */
+	uint64_t					 startHostTimeUs;			/*!< Host time at which the pacing reference log has been delivered in us. */
+	int64_t						 lastFrameTime;				/*!< Latest time of the paced logs in us. */
+	uint64_t					 firstHostTimeUs;			/*!< Host time at which the first log has been delivered in us. */
+
+	SbgEComReplayStats			 stats;						/*!< Replay statistics. */
+} SbgEComReplay;
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Initialize a capture frame source.
+ *
+ * \param[out]	pSource						Capture frame source.
+ * \param[in]	pReader						Capture reader.
+ * \param[in]	offset						Offset of the first record to read, see sbgEComCaptureReaderGetFirstOffset() and sbgEComCaptureReaderSeek().
+ */
+void sbgEComReplayCaptureSourceInit(SbgEComReplayCaptureSource *pSource, const SbgEComCaptureReader *pReader, size_t offset);
+
+/*!
+ * Read the next log of a capture frame source.
+ *
+ * \param[in]	pSource						Capture frame source.
+ * \param[out]	pFrame						Read log.
+ * \return									SBG_NO_ERROR if a log has been read, SBG_NOT_READY at the end of the capture.
+ */
+SbgErrorCode sbgEComReplayCaptureSourceRead(void *pSource, SbgEComCaptureFrame *pFrame);
+
+/*!
+ * Initialize a replay.
+ *
+ * The replay is unthrottled by default.
+ *
+ * \param[out]	pReplay						Replay.
+ * \param[in]	pHandle						sbgECom handle the logs are dispatched to.
+ * \param[in]	pReadFunc					Frame source read function.
+ * \param[in]	pSource						Frame source.
+ */
+void sbgEComReplayInit(SbgEComReplay *pReplay, SbgEComHandle *pHandle, SbgEComReplayReadFunc pReadFunc, void *pSource);
+
+/*!
+ * Set the replay pacing.
+ *
+ * The pacing reference is reset and set again on the next delivered log.
+ *
+ * \param[in]	pReplay						Replay.
+ * \param[in]	timeBase					Time base used to pace the logs delivery.
+ * \param[in]	speed						Replay speed, 1.0 for real time, SBG_ECOM_REPLAY_SPEED_UNTHROTTLED to replay as fast as possible.
+ */
+void sbgEComReplaySetPacing(SbgEComReplay *pReplay, SbgEComCaptureTimeBase timeBase, float speed);
+
+/*!
+ * Wait until the next log is due, then dispatch it to the handle callbacks.
+ *
+ * Logs without a valid time in the pacing time base are delivered immediately.
+ *
+ * \param[in]	pReplay						Replay.
+ * \return									SBG_NO_ERROR if a log has been delivered, SBG_NOT_READY if there is no more log,
+ *											the error returned by the frame source or the error returned by the handle callbacks.
+ */
+SbgErrorCode sbgEComReplayStep(SbgEComReplay *pReplay);
+
+/*!
+ * Replay all logs until the end of the frame source.
+ *
+ * Errors returned by the handle callbacks are counted but don't stop the replay.
+ * The replay stops on the first frame source error, for example a corrupted capture record.
+ *
+ * \param[in]	pReplay						Replay.
+ * \return									SBG_NO_ERROR once all logs have been delivered,
+ *											the error returned by the frame source otherwise.
+ */
+SbgErrorCode sbgEComReplayRun(SbgEComReplay *pReplay);
+
+/*!
+ * Returns the replay statistics.
+ *
+ * \param[in]	pReplay						Replay.
+ * \return									Replay statistics.
+ */
+const SbgEComReplayStats *sbgEComReplayGetStats(const SbgEComReplay *pReplay);
+
+/*!
+ * Reset the replay statistics.
+ *
+ * \param[in]	pReplay						Replay.
+ */
+void sbgEComReplayResetStats(SbgEComReplay *pReplay);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_ECOM_REPLAY_H
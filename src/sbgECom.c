@@ -3,65 +3,130 @@
 #include "commands/sbgEComCmdCommon.h"
 
 //----------------------------------------------------------------------//
-//- Public methods                                                     -//
+//- Private methods                                                    -//
 //----------------------------------------------------------------------//
 
-SbgErrorCode sbgEComInit(SbgEComHandle *pHandle, SbgInterface *pInterface)
+/*!
+ * Dispatch a received log payload to the handle callbacks and snapshot store, without committing the store.
+ *
+ * \param[in]	pHandle							A valid sbgECom handle.
+ * \param[in]	msgClass						Log message class.
+ * \param[in]	msg								Log message id.
+ * \param[in]	pPayload						Log payload.
+ * \param[in]	payloadSize						Log payload size in bytes.
+ * \param[in]	pLogData						Log already parsed according to the handle raw data views setting, NULL to parse it if needed.
+ * \return										SBG_NO_ERROR if the log has been handled successfully.
+ */
+static SbgErrorCode sbgEComDispatchLogPayload(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const void *pPayload, size_t payloadSize, const SbgBinaryLogData *pLogData)
 {
-	SbgErrorCode errorCode = SBG_NO_ERROR;
-	
+	SbgErrorCode			errorCode = SBG_NO_ERROR;
+	SbgErrorCode			payloadErrorCode = SBG_NO_ERROR;
+	SbgBinaryLogData		logData;
+
 	assert(pHandle);
-	assert(pInterface);
-	
-	//
-	// Initialize the sbgECom handle
-	//
-	pHandle->pReceiveLogCallback	= NULL;
-	pHandle->pUserArg				= NULL;
+	assert(pPayload || (payloadSize == 0));
 
 	//
-	// Initialize the default number of trials and time out
+	// First give the raw payload to the payload callback, its result doesn't prevent the log from being parsed
 	//
-	pHandle->numTrials			= 3;
-	pHandle->cmdDefaultTimeOut	= SBG_ECOM_DEFAULT_CMD_TIME_OUT;
+	if (pHandle->pReceiveLogPayloadCallback)
+	{
+		payloadErrorCode = pHandle->pReceiveLogPayloadCallback(pHandle, msgClass, msg, pPayload, payloadSize, pHandle->pPayloadUserArg);
+	}
 
 	//
-	// Initialize the protocol 
+	// Only parse the whole log if a receive log callback or a snapshot store is defined
 	//
-	errorCode = sbgEComProtocolInit(&pHandle->protocolHandle, pInterface);
-	
-	return errorCode;
-}
+	if (pHandle->pReceiveLogCallback || pHandle->pSnapshotStore)
+	{
+		if (!pLogData)
+		{
+			if (pHandle->rawDataViews)
+			{
+				errorCode = sbgEComBinaryLogParseWithRawViews(msgClass, msg, pPayload, payloadSize, &logData);
+			}
+			else
+			{
+				errorCode = sbgEComBinaryLogParse(msgClass, msg, pPayload, payloadSize, &logData);
+			}
 
-SbgErrorCode sbgEComClose(SbgEComHandle *pHandle)
-{
-	SbgErrorCode errorCode = SBG_NO_ERROR;
+			pLogData = &logData;
+		}
 
-	assert(pHandle);
+		//
+		// Test if the incoming log has been parsed successfully
+		//
+		if (errorCode == SBG_NO_ERROR)
+		{
+			//
+			// Log types the store doesn't hold are ignored
+			//
+			if (pHandle->pSnapshotStore)
+			{
+				sbgEComSnapshotStoreUpdate(pHandle->pSnapshotStore, msgClass, msg, pLogData, pHandle->rawDataViews);
+			}
+
+			//
+			// Call the binary log callback using the new method
+			//
+			if (pHandle->pReceiveLogCallback)
+			{
+				errorCode = pHandle->pReceiveLogCallback(pHandle, msgClass, msg, pLogData, pHandle->pUserArg);
+			}
+		}
+		else
+		{
+			//
+			// Call the on error callback
+			//
+		}
+	}
 
 	//
-	// Close the protocol
+	// Parse and receive log callback errors take precedence over the payload callback one
 	//
-	errorCode = sbgEComProtocolClose(&pHandle->protocolHandle);
-	
+	if (errorCode == SBG_NO_ERROR)
+	{
+		errorCode = payloadErrorCode;
+	}
+
 	return errorCode;
 }
 
-SbgErrorCode sbgEComHandleOneLog(SbgEComHandle *pHandle)
+/*!
+ * Try to parse one log from the input interface, without committing the snapshot store.
+ *
+ * \param[in]	pHandle							A valid sbgECom handle.
+ * \return										SBG_NO_ERROR if no error occurs during incoming log parsing.
+ */
+static SbgErrorCode sbgEComReceiveOneLog(SbgEComHandle *pHandle)
 {
-	SbgErrorCode		errorCode = SBG_NO_ERROR;
-	SbgBinaryLogData	logData;
-	uint8_t				receivedMsg;
-	uint8_t				receivedMsgClass;
-	size_t				payloadSize;
-	uint8_t				payloadData[SBG_ECOM_MAX_PAYLOAD_SIZE];
+	SbgErrorCode			errorCode = SBG_NO_ERROR;
+	uint8_t					receivedMsg;
+	uint8_t					receivedMsgClass;
+	SbgEComProtocolPayload	payload;
+	size_t					payloadSize;
+	const void				*pPayloadData;
 
 	assert(pHandle);
 
+	sbgEComProtocolPayloadConstruct(&payload);
+
 	//
-	// Try to read a received frame
+	// Try to read a received frame, the payload directly references the protocol work buffer
 	//
-	errorCode = sbgEComProtocolReceive(&pHandle->protocolHandle, &receivedMsgClass, &receivedMsg, payloadData, &payloadSize, sizeof(payloadData));
+	errorCode = sbgEComProtocolReceive2(&pHandle->protocolHandle, &receivedMsgClass, &receivedMsg, &payload);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		pPayloadData	= sbgEComProtocolPayloadGetBuffer(&payload);
+		payloadSize		= sbgEComProtocolPayloadGetSize(&payload);
+
+		if (payloadSize > SBG_ECOM_MAX_PAYLOAD_SIZE)
+		{
+			errorCode = SBG_BUFFER_OVERFLOW;
+		}
+	}
 
 	//
 	// Test if we have received a valid frame
@@ -76,30 +141,7 @@ SbgErrorCode sbgEComHandleOneLog(SbgEComHandle *pHandle)
 			//
 			// The received frame is a binary log one
 			//
-			errorCode = sbgEComBinaryLogParse((SbgEComClass)receivedMsgClass, (SbgEComMsgId)receivedMsg, payloadData, payloadSize, &logData);
-
-			//
-			// Test if the incoming log has been parsed successfully
-			//
-			if (errorCode == SBG_NO_ERROR)
-			{
-				//
-				// Test if we have a valid callback to handle received logs
-				//
-				if (pHandle->pReceiveLogCallback)
-				{
-					//
-					// Call the binary log callback using the new method
-					//
-					errorCode = pHandle->pReceiveLogCallback(pHandle, (SbgEComClass)receivedMsgClass, receivedMsg, &logData, pHandle->pUserArg);
-				}
-			}
-			else
-			{
-				//
-				// Call the on error callback
-				//
-			}
+			errorCode = sbgEComDispatchLogPayload(pHandle, (SbgEComClass)receivedMsgClass, (SbgEComMsgId)receivedMsg, pPayloadData, payloadSize, NULL);
 		}
 		else
 		{
@@ -115,10 +157,98 @@ SbgErrorCode sbgEComHandleOneLog(SbgEComHandle *pHandle)
 		//
 		SBG_LOG_WARNING(errorCode, "Invalid frame received");
 	}
+
+	sbgEComProtocolPayloadDestroy(&payload);
 	
 	return errorCode;
 }
 
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+SbgErrorCode sbgEComInit(SbgEComHandle *pHandle, SbgInterface *pInterface)
+{
+	SbgErrorCode errorCode = SBG_NO_ERROR;
+	
+	assert(pHandle);
+	assert(pInterface);
+	
+	//
+	// Initialize the sbgECom handle
+	//
+	pHandle->pReceiveLogCallback		= NULL;
+	pHandle->pUserArg					= NULL;
+	pHandle->pReceiveLogPayloadCallback	= NULL;
+	pHandle->pPayloadUserArg			= NULL;
+	pHandle->rawDataViews				= false;
+	pHandle->pSnapshotStore				= NULL;
+
+	//
+	// Initialize the default number of trials and time out
+	//
+	pHandle->numTrials			= 3;
+	pHandle->cmdDefaultTimeOut	= SBG_ECOM_DEFAULT_CMD_TIME_OUT;
+
+	//
+	// Initialize the protocol 
+	//
+	errorCode = sbgEComProtocolInit(&pHandle->protocolHandle, pInterface);
+	
+	return errorCode;
+}
+
+SbgErrorCode sbgEComClose(SbgEComHandle *pHandle)
+{
+	SbgErrorCode errorCode = SBG_NO_ERROR;
+
+	assert(pHandle);
+
+	//
+	// Close the protocol
+	//
+	errorCode = sbgEComProtocolClose(&pHandle->protocolHandle);
+	
+	return errorCode;
+}
+
+SbgErrorCode sbgEComHandleLogPayload(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const void *pPayload, size_t payloadSize)
+{
+	return sbgEComHandleLogPayload2(pHandle, msgClass, msg, pPayload, payloadSize, NULL);
+}
+
+SbgErrorCode sbgEComHandleLogPayload2(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const void *pPayload, size_t payloadSize, const SbgBinaryLogData *pLogData)
+{
+	SbgErrorCode			errorCode;
+
+	assert(pHandle);
+
+	errorCode = sbgEComDispatchLogPayload(pHandle, msgClass, msg, pPayload, payloadSize, pLogData);
+
+	if (pHandle->pSnapshotStore)
+	{
+		sbgEComSnapshotStoreCommit(pHandle->pSnapshotStore);
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComHandleOneLog(SbgEComHandle *pHandle)
+{
+	SbgErrorCode			errorCode;
+
+	assert(pHandle);
+
+	errorCode = sbgEComReceiveOneLog(pHandle);
+
+	if (pHandle->pSnapshotStore)
+	{
+		sbgEComSnapshotStoreCommit(pHandle->pSnapshotStore);
+	}
+
+	return errorCode;
+}
+
 SbgErrorCode sbgEComHandle(SbgEComHandle *pHandle)
 {
 	SbgErrorCode		errorCode = SBG_NO_ERROR;
@@ -133,8 +263,16 @@ SbgErrorCode sbgEComHandle(SbgEComHandle *pHandle)
 		//
 		// Try to read and parse one frame
 		//
-		errorCode = sbgEComHandleOneLog(pHandle);
+		errorCode = sbgEComReceiveOneLog(pHandle);
 	} while (errorCode != SBG_NOT_READY);
+
+	//
+	// Logs received during this pass are committed together
+	//
+	if (pHandle->pSnapshotStore)
+	{
+		sbgEComSnapshotStoreCommit(pHandle->pSnapshotStore);
+	}
 	
 	return errorCode;
 }
@@ -161,6 +299,17 @@ void sbgEComSetReceiveLogCallback(SbgEComHandle *pHandle, SbgEComReceiveLogFunc
 	pHandle->pUserArg				= pUserArg;
 }
 
+void sbgEComSetReceiveLogPayloadCallback(SbgEComHandle *pHandle, SbgEComReceiveLogPayloadFunc pReceiveLogPayloadCallback, void *pUserArg)
+{
+	assert(pHandle);
+
+	//
+	// Define the callback and the user argument
+	//
+	pHandle->pReceiveLogPayloadCallback	= pReceiveLogPayloadCallback;
+	pHandle->pPayloadUserArg			= pUserArg;
+}
+
 void sbgEComSetCmdTrialsAndTimeOut(SbgEComHandle *pHandle, uint32_t numTrials, uint32_t cmdDefaultTimeOut)
 {
 	assert(pHandle);
@@ -174,6 +323,20 @@ void sbgEComSetCmdTrialsAndTimeOut(SbgEComHandle *pHandle, uint32_t numTrials, u
 	pHandle->cmdDefaultTimeOut	= cmdDefaultTimeOut;
 }
 
+void sbgEComSetRawDataViews(SbgEComHandle *pHandle, bool enable)
+{
+	assert(pHandle);
+
+	pHandle->rawDataViews = enable;
+}
+
+void sbgEComSetSnapshotStore(SbgEComHandle *pHandle, SbgEComSnapshotStore *pSnapshotStore)
+{
+	assert(pHandle);
+
+	pHandle->pSnapshotStore = pSnapshotStore;
+}
+
 void sbgEComErrorToString(SbgErrorCode errorCode, char errorMsg[256])
 {
 	if (errorMsg)
@@ -44,6 +44,7 @@ extern "C" {
 #include "sbgEComIds.h"
 #include "protocol/sbgEComProtocol.h"
 #include "binaryLogs/sbgEComBinaryLogs.h"
+#include "snapshot/sbgEComSnapshot.h"
 
 //----------------------------------------------------------------------//
 //- Predefinitions                                                     -//
@@ -70,6 +71,24 @@ typedef struct _SbgEComHandle SbgEComHandle;
  */
 typedef SbgErrorCode (*SbgEComReceiveLogFunc)(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const SbgBinaryLogData *pLogData, void *pUserArg);
 
+/*!
+ * Callback definition called each time a new log is received, before it is parsed.
+ *
+ * An error returned by this callback doesn't prevent the log from being parsed and given to the receive log callback.
+ *
+ * The payload directly references the protocol work buffer and is only valid until the callback returns.
+ * It can be used with log views such as SbgLogEkfNavView to only decode the fields actually needed.
+ *
+ * \param[in]	pHandle									Valid handle on the sbgECom instance that has called this callback.
+ * \param[in]	msgClass								Class of the message we have received
+ * \param[in]	msg										Message ID of the log received.
+ * \param[in]	pPayload								Received log payload.
+ * \param[in]	payloadSize								Payload size in bytes.
+ * \param[in]	pUserArg								Optional user supplied argument.
+ * \return												SBG_NO_ERROR if the received log has been used successfully.
+ */
+typedef SbgErrorCode (*SbgEComReceiveLogPayloadFunc)(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const void *pPayload, size_t payloadSize, void *pUserArg);
+
 //----------------------------------------------------------------------//
 //- Structures definitions                                             -//
 //----------------------------------------------------------------------//
@@ -83,6 +102,10 @@ struct _SbgEComHandle
 
 	SbgEComReceiveLogFunc		 pReceiveLogCallback;		/*!< Pointer on the method called each time a new binary log is received. */
 	void						*pUserArg;					/*!< Optional user supplied argument for callbacks. */
+	SbgEComReceiveLogPayloadFunc pReceiveLogPayloadCallback;	/*!< Pointer on the method called each time a new binary log payload is received. */
+	void						*pPayloadUserArg;			/*!< Optional user supplied argument for the payload callback. */
+	bool						 rawDataViews;				/*!< True if raw data logs are referenced instead of copied (default is false). */
+	SbgEComSnapshotStore		*pSnapshotStore;			/*!< Optional store updated with each received log (default is NULL). */
 
 	uint32_t					 numTrials;					/*!< Number of trials when a command is sent (default is 3). */
 	uint32_t					 cmdDefaultTimeOut;			/*!< Default time out in ms to get an answer from the device (default 500 ms). */
@@ -109,6 +132,40 @@ SbgErrorCode sbgEComInit(SbgEComHandle *pHandle, SbgInterface *pInterface);
  */
 SbgErrorCode sbgEComClose(SbgEComHandle *pHandle);
 
+/*!
+ * Dispatch a received log payload to the handle callbacks.
+ *
+ * The receive log payload callback is called first, then the log is parsed and given to the
+ * receive log callback and snapshot store if any is defined. This is used to feed logs that
+ * don't come from the handle interface, for example when replaying a capture.
+ *
+ * Parse and receive log callback errors are returned in priority over the payload callback one.
+ *
+ * \param[in]	pHandle							A valid sbgECom handle.
+ * \param[in]	msgClass						Log message class.
+ * \param[in]	msg								Log message id.
+ * \param[in]	pPayload						Log payload.
+ * \param[in]	payloadSize						Log payload size in bytes.
+ * \return										SBG_NO_ERROR if the log has been parsed and both callbacks have succeeded.
+ */
+SbgErrorCode sbgEComHandleLogPayload(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const void *pPayload, size_t payloadSize);
+
+/*!
+ * Dispatch a received log payload, and optionally its parsed log, to the handle callbacks.
+ *
+ * Same as sbgEComHandleLogPayload() but the log can have been parsed beforehand, for example by a
+ * decoder worker thread. The snapshot store is updated and committed exactly as for other logs.
+ *
+ * \param[in]	pHandle							A valid sbgECom handle.
+ * \param[in]	msgClass						Log message class.
+ * \param[in]	msg								Log message id.
+ * \param[in]	pPayload						Log payload.
+ * \param[in]	payloadSize						Log payload size in bytes.
+ * \param[in]	pLogData						Log parsed according to the handle raw data views setting, NULL to parse it if needed.
+ * \return										SBG_NO_ERROR if the log has been parsed and both callbacks have succeeded.
+ */
+SbgErrorCode sbgEComHandleLogPayload2(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const void *pPayload, size_t payloadSize, const SbgBinaryLogData *pLogData);
+
 /*!
  * Try to parse one log from the input interface and then return.
  * 
@@ -146,6 +203,20 @@ SbgErrorCode sbgEComPurgeIncoming(SbgEComHandle *pHandle);
  */
 void sbgEComSetReceiveLogCallback(SbgEComHandle *pHandle, SbgEComReceiveLogFunc pReceiveLogCallback, void *pUserArg);
 
+/*!
+ * Define the callback that should be called each time a new binary log payload is received.
+ *
+ * This callback is called before the log is parsed. If neither a receive log callback nor a snapshot
+ * store is defined, the log is not parsed at all so consumers only pay for the fields they read using log views.
+ *
+ * It is called for every received log, including logs received while waiting for a command answer.
+ * 
+ * \param[in]	pHandle							A valid sbgECom handle.
+ * \param[in]	pReceiveLogPayloadCallback		Pointer on the callback to call when a new log payload is received.
+ * \param[in]	pUserArg						Optional user argument that will be passed to the callback method.
+ */
+void sbgEComSetReceiveLogPayloadCallback(SbgEComHandle *pHandle, SbgEComReceiveLogPayloadFunc pReceiveLogPayloadCallback, void *pUserArg);
+
 /*!
  * Define the default number of trials that should be done when a command is send to the device as well as the time out.
  * 
@@ -155,6 +226,31 @@ void sbgEComSetReceiveLogCallback(SbgEComHandle *pHandle, SbgEComReceiveLogFunc
  */
 void sbgEComSetCmdTrialsAndTimeOut(SbgEComHandle *pHandle, uint32_t numTrials, uint32_t cmdDefaultTimeOut);
 
+/*!
+ * Define if raw data logs are copied or referenced when passed to the receive log callback.
+ *
+ * When enabled, SBG_ECOM_LOG_GPS#_RAW and SBG_ECOM_LOG_RTCM_RAW logs are returned through the gpsRawView
+ * and rtcmRawView members of the log union instead of gpsRawData and rtcmRawData. Views directly
+ * reference the protocol work buffer and are only valid until the callback returns.
+ *
+ * \param[in]	pHandle							A valid sbgECom handle.
+ * \param[in]	enable							True to reference raw data logs, false to copy them (default).
+ */
+void sbgEComSetRawDataViews(SbgEComHandle *pHandle, bool enable);
+
+/*!
+ * Define the snapshot store updated with each received log.
+ *
+ * Logs received during an sbgEComHandle() pass are committed together at the end of the pass.
+ * Logs received by any other path, such as sbgEComHandleOneLog(), sbgEComHandleLogPayload() or
+ * while waiting for a command answer, are committed one at a time.
+ * Other threads can then read the latest logs using sbgEComSnapshotStoreRead() and sbgEComSnapshotStoreReadSet().
+ *
+ * \param[in]	pHandle							A valid sbgECom handle.
+ * \param[in]	pSnapshotStore					Snapshot store, NULL to disable it.
+ */
+void sbgEComSetSnapshotStore(SbgEComHandle *pHandle, SbgEComSnapshotStore *pSnapshotStore);
+
 /*!
  *	Convert an error code into a human readable string.
  * 
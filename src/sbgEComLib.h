@@ -1,4 +1,4 @@
-/*!
+﻿/*!
  * \file			sbgEComLib.h
  * \author			SBG Systems
  * \date			05 February 2013
@@ -46,11 +46,18 @@ extern "C" {
 
 // sbgCommonLib headers
 #include <sbgCommon.h>
+#include <arena/sbgArena.h>
 #include <crc/sbgCrc.h>
+#include <fileMap/sbgFileMap.h>
+#include <lz/sbgLz.h>
 #include <interfaces/sbgInterface.h>
 #include <interfaces/sbgInterfaceUdp.h>
+#include <interfaces/sbgInterfaceTcp.h>
 #include <interfaces/sbgInterfaceSerial.h>
 #include <interfaces/sbgInterfaceFile.h>
+#include <interfaces/sbgInterfacePipe.h>
+#include <interfaces/sbgInterfaceTee.h>
+#include <interfaces/sbgInterfaceUring.h>
 #include <splitBuffer/sbgSplitBuffer.h>
 #include <streamBuffer/sbgStreamBuffer.h>
 #include <network/sbgNetwork.h>
@@ -61,7 +68,17 @@ extern "C" {
 #include "sbgEComIds.h"
 #include "commands/sbgEComCmd.h"
 #include "protocol/sbgEComProtocol.h"
+#include "frameBuilder/sbgEComFrameBuilder.h"
 #include "binaryLogs/sbgEComBinaryLogs.h"
+#include "logColumns/sbgEComLogColumns.h"
+#include "capture/sbgEComCapture.h"
+#include "capture/sbgEComCompressedCapture.h"
+#include "replay/sbgEComReplay.h"
+#include "shm/sbgEComShm.h"
+#include "snapshot/sbgEComSnapshot.h"
+#include "decoder/sbgEComDecoder.h"
+#include "merge/sbgEComMerge.h"
+#include "export/sbgEComColumnExport.h"
 #include "sbgEComVersion.h"
 #include "sbgEComGetVersion.h"
 
@@ -0,0 +1,974 @@
+﻿// sbgCommonLib headers
+#include <sbgCommon.h>
+
+// Project headers
+#include <binaryLogs/sbgEComBinaryLogs.h>
+
+// Local headers
+#include "sbgEComShm.h"
+
+//----------------------------------------------------------------------//
+//- Include specific header for WIN32 and UNIX platforms               -//
+//----------------------------------------------------------------------//
+#ifdef WIN32
+	#include <windows.h>
+	#define SBG_ECOM_SHM_SUPPORTED
+#elif defined(__unix__) || defined(__APPLE__)
+	#include <errno.h>
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+	#define SBG_ECOM_SHM_SUPPORTED
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+	#define SBG_ECOM_SHM_LOAD(pValue)						__atomic_load_n(pValue, __ATOMIC_ACQUIRE)
+	#define SBG_ECOM_SHM_LOAD_RELAXED(pValue)				__atomic_load_n(pValue, __ATOMIC_RELAXED)
+	#define SBG_ECOM_SHM_STORE(pValue, value)				__atomic_store_n(pValue, value, __ATOMIC_RELEASE)
+	#define SBG_ECOM_SHM_STORE_RELAXED(pValue, value)		__atomic_store_n(pValue, value, __ATOMIC_RELAXED)
+	#define SBG_ECOM_SHM_FENCE_ACQUIRE()					__atomic_thread_fence(__ATOMIC_ACQUIRE)
+	#define SBG_ECOM_SHM_FENCE_RELEASE()					__atomic_thread_fence(__ATOMIC_RELEASE)
+#elif defined(_MSC_VER)
+	#include <intrin.h>
+
+	//
+	// Volatile accesses have acquire and release semantics on x86 and x64 targets
+	//
+	#define SBG_ECOM_SHM_LOAD(pValue)						(*(volatile uint64_t *)(pValue))
+	#define SBG_ECOM_SHM_LOAD_RELAXED(pValue)				(*(volatile uint64_t *)(pValue))
+	#define SBG_ECOM_SHM_STORE(pValue, value)				(*(volatile uint64_t *)(pValue) = (value))
+	#define SBG_ECOM_SHM_STORE_RELAXED(pValue, value)		(*(volatile uint64_t *)(pValue) = (value))
+	#define SBG_ECOM_SHM_FENCE_ACQUIRE()					_ReadWriteBarrier()
+	#define SBG_ECOM_SHM_FENCE_RELEASE()					_ReadWriteBarrier()
+#else
+	#error "atomic operations are not supported by this compiler"
+#endif
+
+//----------------------------------------------------------------------//
+//- Private definitions                                                -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Shared memory magic number, "SBGM" in little endian.
+ */
+#define SBG_ECOM_SHM_MAGIC								(0x4d474253u)
+
+/*!
+ * Shared memory layout version.
+ */
+#define SBG_ECOM_SHM_VERSION							(1)
+
+/*!
+ * Cache line size, rings and slots are aligned on cache lines.
+ */
+#define SBG_ECOM_SHM_CACHE_LINE_SIZE					(64)
+
+/*!
+ * Maximum number of slots of each log type ring.
+ */
+#define SBG_ECOM_SHM_MAX_NR_SLOTS						(65536)
+
+/*!
+ * Number of attempts to read the latest log before giving up.
+ */
+#define SBG_ECOM_SHM_LATEST_NR_ATTEMPTS					(4)
+
+/*!
+ * Shared memory header.
+ *
+ * The magic number is written last so that consumers never see a partially initialized shared memory.
+ */
+typedef struct _SbgEComShmHeader
+{
+	uint32_t					 magic;						/*!< SBG_ECOM_SHM_MAGIC once initialized. */
+	uint32_t					 version;					/*!< Layout version. */
+	uint64_t					 size;						/*!< Shared memory size in bytes. */
+	uint32_t					 logDataSize;				/*!< Publisher SbgBinaryLogData size, used to detect incompatible builds. */
+	uint32_t					 nrSlots;					/*!< Number of slots of each ring. */
+	uint32_t					 nrTypes;					/*!< Number of log types. */
+	uint32_t					 reserved;					/*!< Reserved, zero. */
+} SbgEComShmHeader;
+
+/*!
+ * Log type descriptor, following the header.
+ */
+typedef struct _SbgEComShmTypeDesc
+{
+	uint8_t						 msgClass;					/*!< Message class. */
+	uint8_t						 msgId;						/*!< Message id. */
+	uint16_t					 reserved;					/*!< Reserved, zero. */
+	uint32_t					 dataSize;					/*!< Parsed log size in bytes. */
+	uint32_t					 ringOffset;				/*!< Ring offset in the shared memory. */
+	uint32_t					 slotSize;					/*!< Slot size in bytes. */
+} SbgEComShmTypeDesc;
+
+/*!
+ * Ring header, followed by the ring slots.
+ */
+typedef struct _SbgEComShmRing
+{
+	uint64_t					 writeIndex;				/*!< Number of logs published in the ring. */
+	uint32_t					 dataSize;					/*!< Parsed log size in bytes. */
+	uint32_t					 slotSize;					/*!< Slot size in bytes. */
+} SbgEComShmRing;
+
+/*!
+ * Slot header, followed by the parsed log.
+ *
+ * The sequence is odd while the log of a given index is written and even once it's complete,
+ * so that a consumer detects both torn reads and overwritten slots.
+ */
+typedef struct _SbgEComShmSlot
+{
+	uint64_t					 sequence;					/*!< (2 * index) + 1 while writing, (2 * index) + 2 once written. */
+	uint64_t					 hostTimeUs;				/*!< Host time at which the log has been published in us. */
+} SbgEComShmSlot;
+
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Round a size up to a multiple of the cache line size.
+ *
+ * \param[in]	size						Size in bytes.
+ * \return									Rounded size in bytes.
+ */
+static size_t sbgEComShmAlign(size_t size)
+{
+	return (size + SBG_ECOM_SHM_CACHE_LINE_SIZE - 1) & ~((size_t)SBG_ECOM_SHM_CACHE_LINE_SIZE - 1);
+}
+
+/*!
+ * Returns the ring layout of a log type.
+ *
+ * \param[in]	pMap						Shared memory mapping.
+ * \param[in]	msgClass					Message class.
+ * \param[in]	msg							Message id.
+ * \return									Ring layout, NULL if the log type isn't published.
+ */
+static const SbgEComShmRingLayout *sbgEComShmGetLayout(const SbgEComShmMap *pMap, SbgEComClass msgClass, SbgEComMsgId msg)
+{
+	const SbgEComShmRingLayout	*pLayout = NULL;
+
+	assert(pMap);
+
+	if (((size_t)msgClass < SBG_ECOM_SHM_NR_CLASSES) && (pMap->rings[msgClass][msg].offset != 0))
+	{
+		pLayout = &pMap->rings[msgClass][msg];
+	}
+
+	return pLayout;
+}
+
+/*!
+ * Returns the ring header of a log type.
+ *
+ * \param[in]	pMap						Shared memory mapping.
+ * \param[in]	pLayout						Ring layout.
+ * \return									Ring header.
+ */
+static SbgEComShmRing *sbgEComShmGetRing(const SbgEComShmMap *pMap, const SbgEComShmRingLayout *pLayout)
+{
+	assert(pMap);
+	assert(pLayout);
+
+	return (SbgEComShmRing *)(pMap->pBuffer + pLayout->offset);
+}
+
+/*!
+ * Returns a ring slot.
+ *
+ * \param[in]	pMap						Shared memory mapping.
+ * \param[in]	pLayout						Ring layout.
+ * \param[in]	index						Log index.
+ * \return									Slot holding the log index.
+ */
+static SbgEComShmSlot *sbgEComShmGetSlot(const SbgEComShmMap *pMap, const SbgEComShmRingLayout *pLayout, uint64_t index)
+{
+	assert(pMap);
+	assert(pLayout);
+
+	return (SbgEComShmSlot *)(pMap->pBuffer + pLayout->offset + SBG_ECOM_SHM_CACHE_LINE_SIZE + (size_t)(index & (pMap->nrSlots - 1)) * pLayout->slotSize);
+}
+
+/*!
+ * Copy a log out of a slot.
+ *
+ * \param[in]	pLayout						Ring layout.
+ * \param[in]	pSlot						Slot.
+ * \param[in]	index						Expected log index.
+ * \param[out]	pLogData					Parsed log.
+ * \param[out]	pHostTimeUs					Publication host time in us, may be NULL.
+ * \return									true if the log has been read, false if the slot has been overwritten.
+ */
+static bool sbgEComShmReadSlot(const SbgEComShmRingLayout *pLayout, const SbgEComShmSlot *pSlot, uint64_t index, SbgBinaryLogData *pLogData, uint64_t *pHostTimeUs)
+{
+	bool						 read = false;
+	uint64_t					 sequence;
+	uint64_t					 hostTimeUs;
+
+	assert(pLayout);
+	assert(pSlot);
+	assert(pLogData);
+
+	sequence = SBG_ECOM_SHM_LOAD(&pSlot->sequence);
+
+	if (sequence == ((2 * index) + 2))
+	{
+		hostTimeUs = pSlot->hostTimeUs;
+		memcpy(pLogData, (const uint8_t *)pSlot + sizeof(*pSlot), pLayout->dataSize);
+
+		//
+		// The log is only valid if the slot hasn't been written during the copy
+		//
+		SBG_ECOM_SHM_FENCE_ACQUIRE();
+
+		if (SBG_ECOM_SHM_LOAD_RELAXED(&pSlot->sequence) == sequence)
+		{
+			if (pHostTimeUs)
+			{
+				*pHostTimeUs = hostTimeUs;
+			}
+
+			read = true;
+		}
+	}
+
+	return read;
+}
+
+/*!
+ * Move a cursor to the oldest log not yet overwritten.
+ *
+ * \param[in]	pMap						Shared memory mapping.
+ * \param[in]	pRing						Ring.
+ * \param[in]	pCursor						Cursor.
+ */
+static void sbgEComShmResyncCursor(const SbgEComShmMap *pMap, const SbgEComShmRing *pRing, SbgEComShmCursor *pCursor)
+{
+	uint64_t					 writeIndex;
+	uint64_t					 oldestIndex;
+
+	assert(pMap);
+	assert(pRing);
+	assert(pCursor);
+
+	writeIndex = SBG_ECOM_SHM_LOAD(&pRing->writeIndex);
+
+	//
+	// The oldest slot is the next one to be written, skip it as well
+	//
+	oldestIndex = (writeIndex >= pMap->nrSlots) ? (writeIndex - pMap->nrSlots + 1) : 0;
+	oldestIndex = sbgMax(oldestIndex, pCursor->nextIndex + 1);
+
+	pCursor->nrLost		+= oldestIndex - pCursor->nextIndex;
+	pCursor->nextIndex	 = oldestIndex;
+}
+
+/*!
+ * Validate the layout of a mapped shared memory and build the ring layouts table.
+ *
+ * \param[in]	pMap						Shared memory mapping.
+ * \return									SBG_NO_ERROR if the layout is valid.
+ */
+static SbgErrorCode sbgEComShmLoadLayout(SbgEComShmMap *pMap)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+	const SbgEComShmHeader		*pHeader;
+	const SbgEComShmTypeDesc	*pTypes;
+
+	assert(pMap);
+
+	pHeader = (const SbgEComShmHeader *)pMap->pBuffer;
+
+	if ((pMap->size < sizeof(*pHeader)) || (pHeader->magic != SBG_ECOM_SHM_MAGIC))
+	{
+		errorCode = SBG_NOT_READY;
+		SBG_LOG_ERROR(errorCode, "shared memory not initialized");
+	}
+	else if ((pHeader->version != SBG_ECOM_SHM_VERSION) || (pHeader->logDataSize != sizeof(SbgBinaryLogData)))
+	{
+		errorCode = SBG_INVALID_VERSION;
+		SBG_LOG_ERROR(errorCode, "incompatible shared memory layout");
+	}
+	else if ((pHeader->size > pMap->size) || (pHeader->nrSlots == 0) || (pHeader->nrSlots > SBG_ECOM_SHM_MAX_NR_SLOTS) || ((pHeader->nrSlots & (pHeader->nrSlots - 1)) != 0) ||
+			 (pHeader->nrTypes > (SBG_ECOM_SHM_NR_CLASSES * SBG_ECOM_SHM_NR_MSG_IDS)) || ((sizeof(*pHeader) + pHeader->nrTypes * sizeof(*pTypes)) > pHeader->size))
+	{
+		errorCode = SBG_INVALID_FRAME;
+		SBG_LOG_ERROR(errorCode, "invalid shared memory header");
+	}
+	else
+	{
+		SBG_ECOM_SHM_FENCE_ACQUIRE();
+
+		pMap->nrSlots = pHeader->nrSlots;
+		pTypes = (const SbgEComShmTypeDesc *)(pMap->pBuffer + sizeof(*pHeader));
+
+		memset(pMap->rings, 0, sizeof(pMap->rings));
+
+		for (uint32_t i = 0; i < pHeader->nrTypes; i++)
+		{
+			const SbgEComShmTypeDesc	*pType = &pTypes[i];
+			size_t						 ringSize;
+
+			ringSize = SBG_ECOM_SHM_CACHE_LINE_SIZE + (size_t)pType->slotSize * pHeader->nrSlots;
+
+			if ((pType->msgClass >= SBG_ECOM_SHM_NR_CLASSES) || (pType->dataSize > sizeof(SbgBinaryLogData)) || (pType->slotSize < (sizeof(SbgEComShmSlot) + pType->dataSize)) ||
+				(pType->ringOffset == 0) || ((pType->ringOffset % SBG_ECOM_SHM_CACHE_LINE_SIZE) != 0) || (pType->ringOffset > pHeader->size) || (ringSize > (pHeader->size - pType->ringOffset)))
+			{
+				errorCode = SBG_INVALID_FRAME;
+				SBG_LOG_ERROR(errorCode, "invalid shared memory type descriptor");
+				break;
+			}
+
+			pMap->rings[pType->msgClass][pType->msgId].offset	= pType->ringOffset;
+			pMap->rings[pType->msgClass][pType->msgId].dataSize	= pType->dataSize;
+			pMap->rings[pType->msgClass][pType->msgId].slotSize	= pType->slotSize;
+		}
+	}
+
+	return errorCode;
+}
+
+#ifdef SBG_ECOM_SHM_SUPPORTED
+/*!
+ * Build the platform specific shared memory name.
+ *
+ * \param[out]	pPlatformName				Platform specific name.
+ * \param[in]	pName						Shared memory name.
+ * \return									SBG_NO_ERROR if the name is valid.
+ */
+static SbgErrorCode sbgEComShmBuildName(char pPlatformName[SBG_ECOM_SHM_NAME_MAX_SIZE + 8], const char *pName)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+
+	assert(pPlatformName);
+	assert(pName);
+
+	if ((pName[0] != '\0') && (strlen(pName) < SBG_ECOM_SHM_NAME_MAX_SIZE) && !strchr(pName, '/') && !strchr(pName, '\\'))
+	{
+#ifdef WIN32
+		snprintf(pPlatformName, SBG_ECOM_SHM_NAME_MAX_SIZE + 8, "Local\\%s", pName);
+#else
+		snprintf(pPlatformName, SBG_ECOM_SHM_NAME_MAX_SIZE + 8, "/%s", pName);
+#endif
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+		SBG_LOG_ERROR(errorCode, "invalid shared memory name");
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Create and map a shared memory for read and write access.
+ *
+ * \param[out]	pMap						Shared memory mapping.
+ * \param[in]	pName						Shared memory name.
+ * \param[in]	size						Shared memory size in bytes.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComShmMapCreate(SbgEComShmMap *pMap, const char *pName, size_t size)
+{
+	SbgErrorCode				 errorCode;
+	char						 platformName[SBG_ECOM_SHM_NAME_MAX_SIZE + 8];
+
+	assert(pMap);
+	assert(pName);
+
+	errorCode = sbgEComShmBuildName(platformName, pName);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+#ifdef WIN32
+		HANDLE					 mappingHandle;
+
+		mappingHandle = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, (DWORD)((uint64_t)size >> 32), (DWORD)size, platformName);
+
+		if (mappingHandle && (GetLastError() == ERROR_ALREADY_EXISTS))
+		{
+			CloseHandle(mappingHandle);
+			mappingHandle = NULL;
+		}
+
+		if (mappingHandle)
+		{
+			pMap->pBuffer = MapViewOfFile(mappingHandle, FILE_MAP_ALL_ACCESS, 0, 0, size);
+
+			if (pMap->pBuffer)
+			{
+				pMap->size		= size;
+				pMap->handle	= (intptr_t)mappingHandle;
+			}
+			else
+			{
+				errorCode = SBG_ERROR;
+				CloseHandle(mappingHandle);
+			}
+		}
+		else
+		{
+			errorCode = SBG_ERROR;
+		}
+#else
+		int						 fd;
+
+		//
+		// Consumers mapping a previous shared memory keep it, it's never resized under them
+		//
+		shm_unlink(platformName);
+
+		fd = shm_open(platformName, O_RDWR | O_CREAT | O_EXCL, 0644);
+
+		if (fd >= 0)
+		{
+			if (ftruncate(fd, (off_t)size) == 0)
+			{
+				void			*pBuffer;
+
+				pBuffer = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+				if (pBuffer != MAP_FAILED)
+				{
+					pMap->pBuffer	= pBuffer;
+					pMap->size		= size;
+					pMap->handle	= fd;
+				}
+				else
+				{
+					errorCode = SBG_ERROR;
+				}
+			}
+			else
+			{
+				errorCode = SBG_ERROR;
+			}
+
+			if (errorCode != SBG_NO_ERROR)
+			{
+				close(fd);
+				shm_unlink(platformName);
+			}
+		}
+		else
+		{
+			errorCode = SBG_ERROR;
+		}
+#endif
+
+		if (errorCode != SBG_NO_ERROR)
+		{
+			SBG_LOG_ERROR(errorCode, "unable to create shared memory %s", pName);
+		}
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Open and map an existing shared memory for read only access.
+ *
+ * \param[out]	pMap						Shared memory mapping.
+ * \param[in]	pName						Shared memory name.
+ * \return									SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComShmMapOpen(SbgEComShmMap *pMap, const char *pName)
+{
+	SbgErrorCode				 errorCode;
+	char						 platformName[SBG_ECOM_SHM_NAME_MAX_SIZE + 8];
+
+	assert(pMap);
+	assert(pName);
+
+	errorCode = sbgEComShmBuildName(platformName, pName);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+#ifdef WIN32
+		HANDLE					 mappingHandle;
+
+		mappingHandle = OpenFileMappingA(FILE_MAP_READ, FALSE, platformName);
+
+		if (mappingHandle)
+		{
+			pMap->pBuffer = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+
+			if (pMap->pBuffer)
+			{
+				MEMORY_BASIC_INFORMATION	 memoryInfo;
+
+				VirtualQuery(pMap->pBuffer, &memoryInfo, sizeof(memoryInfo));
+
+				pMap->size		= memoryInfo.RegionSize;
+				pMap->handle	= (intptr_t)mappingHandle;
+			}
+			else
+			{
+				errorCode = SBG_ERROR;
+				CloseHandle(mappingHandle);
+			}
+		}
+		else
+		{
+			errorCode = SBG_ERROR;
+		}
+#else
+		int						 fd;
+		struct stat				 fileStat;
+
+		fd = shm_open(platformName, O_RDONLY, 0);
+
+		if (fd >= 0)
+		{
+			if ((fstat(fd, &fileStat) == 0) && (fileStat.st_size > 0))
+			{
+				void			*pBuffer;
+
+				pBuffer = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+
+				if (pBuffer != MAP_FAILED)
+				{
+					pMap->pBuffer	= pBuffer;
+					pMap->size		= (size_t)fileStat.st_size;
+					pMap->handle	= -1;
+				}
+				else
+				{
+					errorCode = SBG_ERROR;
+				}
+			}
+			else
+			{
+				errorCode = SBG_NOT_READY;
+			}
+
+			//
+			// The mapping remains valid once the descriptor is closed
+			//
+			close(fd);
+		}
+		else
+		{
+			errorCode = SBG_ERROR;
+		}
+#endif
+
+		if (errorCode != SBG_NO_ERROR)
+		{
+			SBG_LOG_ERROR(errorCode, "unable to open shared memory %s", pName);
+		}
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Unmap a shared memory.
+ *
+ * \param[in]	pMap						Shared memory mapping.
+ */
+static void sbgEComShmMapClose(SbgEComShmMap *pMap)
+{
+	assert(pMap);
+
+	if (pMap->pBuffer)
+	{
+#ifdef WIN32
+		UnmapViewOfFile(pMap->pBuffer);
+		CloseHandle((HANDLE)pMap->handle);
+#else
+		munmap(pMap->pBuffer, pMap->size);
+
+		if (pMap->handle >= 0)
+		{
+			close((int)pMap->handle);
+		}
+#endif
+
+		pMap->pBuffer = NULL;
+	}
+}
+#else
+static SbgErrorCode sbgEComShmMapCreate(SbgEComShmMap *pMap, const char *pName, size_t size)
+{
+	SBG_UNUSED_PARAMETER(pMap);
+	SBG_UNUSED_PARAMETER(pName);
+	SBG_UNUSED_PARAMETER(size);
+
+	SBG_LOG_ERROR(SBG_ERROR, "shared memory not supported on this platform");
+
+	return SBG_ERROR;
+}
+
+static SbgErrorCode sbgEComShmMapOpen(SbgEComShmMap *pMap, const char *pName)
+{
+	SBG_UNUSED_PARAMETER(pMap);
+	SBG_UNUSED_PARAMETER(pName);
+
+	SBG_LOG_ERROR(SBG_ERROR, "shared memory not supported on this platform");
+
+	return SBG_ERROR;
+}
+
+static void sbgEComShmMapClose(SbgEComShmMap *pMap)
+{
+	SBG_UNUSED_PARAMETER(pMap);
+}
+#endif // SBG_ECOM_SHM_SUPPORTED
+
+/*!
+ * Write a log to the next slot of its ring.
+ *
+ * \param[in]	pPublisher					Publisher.
+ * \param[in]	msgClass					Message class.
+ * \param[in]	msg							Message id.
+ * \param[in]	pLogData					Parsed log.
+ * \param[in]	rawView						True if raw data logs are views that must be copied.
+ * \return									SBG_NO_ERROR if the log has been published.
+ */
+static SbgErrorCode sbgEComShmPublisherWrite(SbgEComShmPublisher *pPublisher, SbgEComClass msgClass, SbgEComMsgId msg, const SbgBinaryLogData *pLogData, bool rawView)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+	const SbgEComShmRingLayout	*pLayout;
+
+	assert(pPublisher);
+	assert(pLogData);
+
+	pLayout = sbgEComShmGetLayout(&pPublisher->map, msgClass, msg);
+
+	if (pLayout)
+	{
+		SbgEComShmRing			*pRing;
+		SbgEComShmSlot			*pSlot;
+		uint64_t				 index;
+		uint8_t					*pData;
+
+		pRing	= sbgEComShmGetRing(&pPublisher->map, pLayout);
+		index	= pRing->writeIndex;
+		pSlot	= sbgEComShmGetSlot(&pPublisher->map, pLayout, index);
+		pData	= (uint8_t *)pSlot + sizeof(*pSlot);
+
+		SBG_ECOM_SHM_STORE_RELAXED(&pSlot->sequence, (2 * index) + 1);
+		SBG_ECOM_SHM_FENCE_RELEASE();
+
+		pSlot->hostTimeUs = sbgGetTimeInUs();
+
+		if (rawView && (sbgEComBinaryLogGetSize(msgClass, msg, true) != sbgEComBinaryLogGetSize(msgClass, msg, false)))
+		{
+			SbgLogRawData		*pRawData = (SbgLogRawData *)pData;
+
+			assert(pLogData->gpsRawView.bufferSize <= sizeof(pRawData->rawBuffer));
+
+			memcpy(pRawData->rawBuffer, pLogData->gpsRawView.pRawBuffer, pLogData->gpsRawView.bufferSize);
+			pRawData->bufferSize = pLogData->gpsRawView.bufferSize;
+		}
+		else
+		{
+			memcpy(pData, pLogData, pLayout->dataSize);
+		}
+
+		SBG_ECOM_SHM_STORE(&pSlot->sequence, (2 * index) + 2);
+		SBG_ECOM_SHM_STORE(&pRing->writeIndex, index + 1);
+
+		pPublisher->nrPublished++;
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+	}
+
+	return errorCode;
+}
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+SbgErrorCode sbgEComShmPublisherCreate(SbgEComShmPublisher *pPublisher, const char *pName, uint32_t nrSlots)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+	uint32_t					 roundedNrSlots = 1;
+	uint32_t					 nrTypes = 0;
+	size_t						 size;
+
+	assert(pPublisher);
+	assert(pName);
+
+	memset(pPublisher, 0, sizeof(*pPublisher));
+
+	if ((nrSlots != 0) && (nrSlots <= SBG_ECOM_SHM_MAX_NR_SLOTS))
+	{
+		while (roundedNrSlots < nrSlots)
+		{
+			roundedNrSlots <<= 1;
+		}
+
+		//
+		// Compute the layout: header, type descriptors, then one ring per log type
+		//
+		for (uint32_t msgClass = 0; msgClass < SBG_ECOM_SHM_NR_CLASSES; msgClass++)
+		{
+			for (uint32_t msg = 0; msg < SBG_ECOM_SHM_NR_MSG_IDS; msg++)
+			{
+				if (sbgEComBinaryLogGetSize((SbgEComClass)msgClass, (SbgEComMsgId)msg, false) != 0)
+				{
+					nrTypes++;
+				}
+			}
+		}
+
+		size = sbgEComShmAlign(sizeof(SbgEComShmHeader) + nrTypes * sizeof(SbgEComShmTypeDesc));
+
+		for (uint32_t msgClass = 0; msgClass < SBG_ECOM_SHM_NR_CLASSES; msgClass++)
+		{
+			for (uint32_t msg = 0; msg < SBG_ECOM_SHM_NR_MSG_IDS; msg++)
+			{
+				size_t			 dataSize;
+
+				dataSize = sbgEComBinaryLogGetSize((SbgEComClass)msgClass, (SbgEComMsgId)msg, false);
+
+				if (dataSize != 0)
+				{
+					pPublisher->map.rings[msgClass][msg].offset		= (uint32_t)size;
+					pPublisher->map.rings[msgClass][msg].dataSize	= (uint32_t)dataSize;
+					pPublisher->map.rings[msgClass][msg].slotSize	= (uint32_t)sbgEComShmAlign(sizeof(SbgEComShmSlot) + dataSize);
+
+					size += SBG_ECOM_SHM_CACHE_LINE_SIZE + (size_t)pPublisher->map.rings[msgClass][msg].slotSize * roundedNrSlots;
+				}
+			}
+		}
+
+		errorCode = sbgEComShmMapCreate(&pPublisher->map, pName, size);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			SbgEComShmHeader	*pHeader;
+			SbgEComShmTypeDesc	*pTypes;
+			uint32_t			 typeIndex = 0;
+
+			strcpy(pPublisher->name, pName);
+			pPublisher->map.nrSlots = roundedNrSlots;
+
+			pHeader	= (SbgEComShmHeader *)pPublisher->map.pBuffer;
+			pTypes	= (SbgEComShmTypeDesc *)(pPublisher->map.pBuffer + sizeof(*pHeader));
+
+			pHeader->version		= SBG_ECOM_SHM_VERSION;
+			pHeader->size			= size;
+			pHeader->logDataSize	= sizeof(SbgBinaryLogData);
+			pHeader->nrSlots		= roundedNrSlots;
+			pHeader->nrTypes		= nrTypes;
+
+			for (uint32_t msgClass = 0; msgClass < SBG_ECOM_SHM_NR_CLASSES; msgClass++)
+			{
+				for (uint32_t msg = 0; msg < SBG_ECOM_SHM_NR_MSG_IDS; msg++)
+				{
+					const SbgEComShmRingLayout	*pLayout;
+
+					pLayout = sbgEComShmGetLayout(&pPublisher->map, (SbgEComClass)msgClass, (SbgEComMsgId)msg);
+
+					if (pLayout)
+					{
+						SbgEComShmRing			*pRing;
+
+						pRing = sbgEComShmGetRing(&pPublisher->map, pLayout);
+
+						pRing->dataSize		= pLayout->dataSize;
+						pRing->slotSize		= pLayout->slotSize;
+
+						pTypes[typeIndex].msgClass		= (uint8_t)msgClass;
+						pTypes[typeIndex].msgId			= (uint8_t)msg;
+						pTypes[typeIndex].dataSize		= pLayout->dataSize;
+						pTypes[typeIndex].ringOffset	= pLayout->offset;
+						pTypes[typeIndex].slotSize		= pLayout->slotSize;
+
+						typeIndex++;
+					}
+				}
+			}
+
+			SBG_ECOM_SHM_FENCE_RELEASE();
+			pHeader->magic = SBG_ECOM_SHM_MAGIC;
+		}
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+		SBG_LOG_ERROR(errorCode, "invalid number of slots: %" PRIu32, nrSlots);
+	}
+
+	return errorCode;
+}
+
+void sbgEComShmPublisherDestroy(SbgEComShmPublisher *pPublisher)
+{
+	assert(pPublisher);
+
+	sbgEComShmMapClose(&pPublisher->map);
+
+#if defined(SBG_ECOM_SHM_SUPPORTED) && !defined(WIN32)
+	{
+		char					 platformName[SBG_ECOM_SHM_NAME_MAX_SIZE + 8];
+
+		if (sbgEComShmBuildName(platformName, pPublisher->name) == SBG_NO_ERROR)
+		{
+			shm_unlink(platformName);
+		}
+	}
+#endif
+}
+
+SbgErrorCode sbgEComShmPublisherPublish(SbgEComShmPublisher *pPublisher, SbgEComClass msgClass, SbgEComMsgId msg, const SbgBinaryLogData *pLogData)
+{
+	return sbgEComShmPublisherWrite(pPublisher, msgClass, msg, pLogData, false);
+}
+
+SbgErrorCode sbgEComShmPublisherReceiveLog(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const SbgBinaryLogData *pLogData, void *pUserArg)
+{
+	assert(pHandle);
+	assert(pUserArg);
+
+	//
+	// Unsupported log types are silently ignored
+	//
+	sbgEComShmPublisherWrite((SbgEComShmPublisher *)pUserArg, msgClass, msg, pLogData, pHandle->rawDataViews);
+
+	return SBG_NO_ERROR;
+}
+
+SbgErrorCode sbgEComShmConsumerOpen(SbgEComShmConsumer *pConsumer, const char *pName)
+{
+	SbgErrorCode				 errorCode;
+
+	assert(pConsumer);
+	assert(pName);
+
+	memset(pConsumer, 0, sizeof(*pConsumer));
+
+	errorCode = sbgEComShmMapOpen(&pConsumer->map, pName);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		errorCode = sbgEComShmLoadLayout(&pConsumer->map);
+
+		if (errorCode != SBG_NO_ERROR)
+		{
+			sbgEComShmMapClose(&pConsumer->map);
+		}
+	}
+
+	return errorCode;
+}
+
+void sbgEComShmConsumerClose(SbgEComShmConsumer *pConsumer)
+{
+	assert(pConsumer);
+
+	sbgEComShmMapClose(&pConsumer->map);
+}
+
+SbgErrorCode sbgEComShmConsumerInitCursor(const SbgEComShmConsumer *pConsumer, SbgEComShmCursor *pCursor, SbgEComClass msgClass, SbgEComMsgId msg)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+	const SbgEComShmRingLayout	*pLayout;
+
+	assert(pConsumer);
+	assert(pCursor);
+
+	pLayout = sbgEComShmGetLayout(&pConsumer->map, msgClass, msg);
+
+	if (pLayout)
+	{
+		pCursor->msgClass	= (uint8_t)msgClass;
+		pCursor->msgId		= (uint8_t)msg;
+		pCursor->nextIndex	= SBG_ECOM_SHM_LOAD(&sbgEComShmGetRing(&pConsumer->map, pLayout)->writeIndex);
+		pCursor->nrLost		= 0;
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComShmConsumerRead(const SbgEComShmConsumer *pConsumer, SbgEComShmCursor *pCursor, SbgBinaryLogData *pLogData, uint64_t *pHostTimeUs)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+	const SbgEComShmRingLayout	*pLayout;
+	const SbgEComShmRing		*pRing;
+	uint64_t					 writeIndex;
+
+	assert(pConsumer);
+	assert(pCursor);
+	assert(pLogData);
+
+	pLayout = sbgEComShmGetLayout(&pConsumer->map, (SbgEComClass)pCursor->msgClass, (SbgEComMsgId)pCursor->msgId);
+	assert(pLayout);
+
+	pRing		= sbgEComShmGetRing(&pConsumer->map, pLayout);
+	writeIndex	= SBG_ECOM_SHM_LOAD(&pRing->writeIndex);
+
+	if (pCursor->nextIndex >= writeIndex)
+	{
+		errorCode = SBG_NOT_READY;
+	}
+	else if (((writeIndex - pCursor->nextIndex) > pConsumer->map.nrSlots) ||
+			 !sbgEComShmReadSlot(pLayout, sbgEComShmGetSlot(&pConsumer->map, pLayout, pCursor->nextIndex), pCursor->nextIndex, pLogData, pHostTimeUs))
+	{
+		errorCode = SBG_BUFFER_OVERFLOW;
+		sbgEComShmResyncCursor(&pConsumer->map, pRing, pCursor);
+	}
+	else
+	{
+		pCursor->nextIndex++;
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComShmConsumerReadLatest(const SbgEComShmConsumer *pConsumer, SbgEComClass msgClass, SbgEComMsgId msg, SbgBinaryLogData *pLogData, uint64_t *pHostTimeUs)
+{
+	SbgErrorCode				 errorCode = SBG_INVALID_PARAMETER;
+	const SbgEComShmRingLayout	*pLayout;
+
+	assert(pConsumer);
+	assert(pLogData);
+
+	pLayout = sbgEComShmGetLayout(&pConsumer->map, msgClass, msg);
+
+	if (pLayout)
+	{
+		const SbgEComShmRing	*pRing;
+
+		pRing = sbgEComShmGetRing(&pConsumer->map, pLayout);
+
+		//
+		// The attempts are bounded so that a consumer never waits for the publisher
+		//
+		errorCode = SBG_BUFFER_OVERFLOW;
+
+		for (uint32_t i = 0; i < SBG_ECOM_SHM_LATEST_NR_ATTEMPTS; i++)
+		{
+			uint64_t			 writeIndex;
+
+			writeIndex = SBG_ECOM_SHM_LOAD(&pRing->writeIndex);
+
+			if (writeIndex == 0)
+			{
+				errorCode = SBG_NOT_READY;
+				break;
+			}
+			else if (sbgEComShmReadSlot(pLayout, sbgEComShmGetSlot(&pConsumer->map, pLayout, writeIndex - 1), writeIndex - 1, pLogData, pHostTimeUs))
+			{
+				errorCode = SBG_NO_ERROR;
+				break;
+			}
+		}
+	}
+
+	return errorCode;
+}
@@ -0,0 +1,249 @@
+﻿/*!
+ * \file			sbgEComShm.h
+ * \author			SBG Systems
+ * \date			19 October 2026
+ *
+ * \brief			Publish decoded logs to other processes through shared memory.
+ *
+ * \copyright		Copyright (C) 2022, SBG Systems SAS. All rights reserved.
+ * \beginlicense	The MIT license
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * \endlicense
+ */
+
+
+#ifndef SBG_ECOM_SHM_H
+#define SBG_ECOM_SHM_H
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+// Project headers
+#include <sbgECom.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Default number of slots of each log type ring.
+ */
+#define SBG_ECOM_SHM_DEFAULT_NR_SLOTS					(64)
+
+/*!
+ * Maximum shared memory name size, including the null terminator.
+ */
+#define SBG_ECOM_SHM_NAME_MAX_SIZE						(64)
+
+/*!
+ * Number of log classes that can be published.
+ */
+#define SBG_ECOM_SHM_NR_CLASSES							(2)
+
+/*!
+ * Maximum number of message ids per log class, covering every SbgEComMsgId value.
+ */
+#define SBG_ECOM_SHM_NR_MSG_IDS							(256)
+
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Layout of a log type ring.
+ *
+ * Consumers take it from the validated type descriptors, never from the ring headers in
+ * the shared memory that the publisher may modify at any time.
+ */
+typedef struct _SbgEComShmRingLayout
+{
+	uint32_t					 offset;					/*!< Ring offset in the shared memory, 0 if the log type isn't published. */
+	uint32_t					 dataSize;					/*!< Parsed log size in bytes. */
+	uint32_t					 slotSize;					/*!< Slot size in bytes. */
+} SbgEComShmRingLayout;
+
+/*!
+ * Shared memory mapping, common to publishers and consumers.
+ */
+typedef struct _SbgEComShmMap
+{
+	uint8_t						*pBuffer;					/*!< Mapped shared memory. */
+	size_t						 size;						/*!< Mapped shared memory size in bytes. */
+	intptr_t					 handle;					/*!< Platform specific shared memory handle. */
+	uint32_t					 nrSlots;					/*!< Number of slots of each log type ring. */
+	SbgEComShmRingLayout		 rings[SBG_ECOM_SHM_NR_CLASSES][SBG_ECOM_SHM_NR_MSG_IDS];	/*!< Ring layout of each log type. */
+} SbgEComShmMap;
+
+/*!
+ * Shared memory publisher.
+ *
+ * Each published log type has its own ring of slots, each slot holding a parsed log
+ * protected by a sequence number so that consumers never block the publisher.
+ */
+typedef struct _SbgEComShmPublisher
+{
+	SbgEComShmMap				 map;						/*!< Shared memory mapping. */
+	char						 name[SBG_ECOM_SHM_NAME_MAX_SIZE];	/*!< Shared memory name. */
+	uint64_t					 nrPublished;				/*!< Number of published logs. */
+} SbgEComShmPublisher;
+
+/*!
+ * Shared memory consumer.
+ */
+typedef struct _SbgEComShmConsumer
+{
+	SbgEComShmMap				 map;						/*!< Shared memory mapping. */
+} SbgEComShmConsumer;
+
+/*!
+ * Position of a consumer in the ring of a log type.
+ */
+typedef struct _SbgEComShmCursor
+{
+	uint8_t						 msgClass;					/*!< Message class. */
+	uint8_t						 msgId;						/*!< Message id. */
+	uint64_t					 nextIndex;					/*!< Index of the next log to read. */
+	uint64_t					 nrLost;					/*!< Number of logs overwritten before they could be read. */
+} SbgEComShmCursor;
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Create a shared memory publisher.
+ *
+ * A ring is created for each log type sbgEComBinaryLogParse() supports. An existing shared memory
+ * with the same name is replaced, consumers still mapping it must open the new one.
+ *
+ * Shared memory is only supported on POSIX and Windows platforms.
+ *
+ * \param[out]	pPublisher					Publisher.
+ * \param[in]	pName						Shared memory name, without any leading slash.
+ * \param[in]	nrSlots						Number of slots of each log type ring, rounded up to a power of two.
+ * \return									SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComShmPublisherCreate(SbgEComShmPublisher *pPublisher, const char *pName, uint32_t nrSlots);
+
+/*!
+ * Destroy a shared memory publisher.
+ *
+ * The shared memory name is removed, consumers keep their mapping until they close it.
+ *
+ * \param[in]	pPublisher					Publisher.
+ */
+void sbgEComShmPublisherDestroy(SbgEComShmPublisher *pPublisher);
+
+/*!
+ * Publish a parsed log.
+ *
+ * The log must have been parsed with sbgEComBinaryLogParse(), raw data views can't be published.
+ *
+ * \param[in]	pPublisher					Publisher.
+ * \param[in]	msgClass					Message class.
+ * \param[in]	msg							Message id.
+ * \param[in]	pLogData					Parsed log.
+ * \return									SBG_NO_ERROR if the log has been published, SBG_INVALID_PARAMETER if the log type isn't supported.
+ */
+SbgErrorCode sbgEComShmPublisherPublish(SbgEComShmPublisher *pPublisher, SbgEComClass msgClass, SbgEComMsgId msg, const SbgBinaryLogData *pLogData);
+
+/*!
+ * Receive log callback publishing all logs received by a handle.
+ *
+ * It's meant to be given to sbgEComSetReceiveLogCallback() with the publisher as user argument.
+ * Raw data views are copied if enabled on the handle.
+ *
+ * \param[in]	pHandle						sbgECom handle.
+ * \param[in]	msgClass					Message class.
+ * \param[in]	msg							Message id.
+ * \param[in]	pLogData					Parsed log.
+ * \param[in]	pUserArg					Publisher.
+ * \return									SBG_NO_ERROR.
+ */
+SbgErrorCode sbgEComShmPublisherReceiveLog(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const SbgBinaryLogData *pLogData, void *pUserArg);
+
+/*!
+ * Open the shared memory of a publisher.
+ *
+ * The shared memory is mapped read only, consumers can't disturb the publisher or each other.
+ *
+ * \param[out]	pConsumer					Consumer.
+ * \param[in]	pName						Shared memory name, as given to sbgEComShmPublisherCreate().
+ * \return									SBG_NO_ERROR if successful, SBG_INVALID_VERSION if the publisher layout isn't compatible.
+ */
+SbgErrorCode sbgEComShmConsumerOpen(SbgEComShmConsumer *pConsumer, const char *pName);
+
+/*!
+ * Close a consumer.
+ *
+ * \param[in]	pConsumer					Consumer.
+ */
+void sbgEComShmConsumerClose(SbgEComShmConsumer *pConsumer);
+
+/*!
+ * Initialize a cursor to read the logs of a type published from now on.
+ *
+ * \param[in]	pConsumer					Consumer.
+ * \param[out]	pCursor						Cursor.
+ * \param[in]	msgClass					Message class.
+ * \param[in]	msg							Message id.
+ * \return									SBG_NO_ERROR if successful, SBG_INVALID_PARAMETER if the log type isn't published.
+ */
+SbgErrorCode sbgEComShmConsumerInitCursor(const SbgEComShmConsumer *pConsumer, SbgEComShmCursor *pCursor, SbgEComClass msgClass, SbgEComMsgId msg);
+
+/*!
+ * Read the next log of a cursor.
+ *
+ * The read never waits for the publisher. If the publisher has overwritten the next log, the cursor
+ * moves to the oldest available log and the number of skipped logs is added to its nrLost member.
+ *
+ * \param[in]	pConsumer					Consumer.
+ * \param[in]	pCursor						Cursor.
+ * \param[out]	pLogData					Parsed log, only the member of the log type is written.
+ * \param[out]	pHostTimeUs					Host time at which the log has been published in us, may be NULL.
+ * \return									SBG_NO_ERROR if a log has been read, SBG_NOT_READY if no new log is available,
+ *											SBG_BUFFER_OVERFLOW if logs have been lost.
+ */
+SbgErrorCode sbgEComShmConsumerRead(const SbgEComShmConsumer *pConsumer, SbgEComShmCursor *pCursor, SbgBinaryLogData *pLogData, uint64_t *pHostTimeUs);
+
+/*!
+ * Read the latest published log of a type.
+ *
+ * \param[in]	pConsumer					Consumer.
+ * \param[in]	msgClass					Message class.
+ * \param[in]	msg							Message id.
+ * \param[out]	pLogData					Parsed log, only the member of the log type is written.
+ * \param[out]	pHostTimeUs					Host time at which the log has been published in us, may be NULL.
+ * \return									SBG_NO_ERROR if a log has been read, SBG_NOT_READY if no log has been published yet,
+ *											SBG_BUFFER_OVERFLOW if the publisher kept overwriting the log while it was read,
+ *											SBG_INVALID_PARAMETER if the log type isn't published.
+ */
+SbgErrorCode sbgEComShmConsumerReadLatest(const SbgEComShmConsumer *pConsumer, SbgEComClass msgClass, SbgEComMsgId msg, SbgBinaryLogData *pLogData, uint64_t *pHostTimeUs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_ECOM_SHM_H
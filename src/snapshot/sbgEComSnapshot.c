@@ -0,0 +1,359 @@
+﻿// sbgCommonLib headers
+#include <sbgCommon.h>
+
+// Local headers
+#include "sbgEComSnapshot.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+	#define SBG_ECOM_SNAPSHOT_LOAD(pValue)					__atomic_load_n(pValue, __ATOMIC_ACQUIRE)
+	#define SBG_ECOM_SNAPSHOT_LOAD_RELAXED(pValue)			__atomic_load_n(pValue, __ATOMIC_RELAXED)
+	#define SBG_ECOM_SNAPSHOT_STORE(pValue, value)			__atomic_store_n(pValue, value, __ATOMIC_RELEASE)
+	#define SBG_ECOM_SNAPSHOT_STORE_RELAXED(pValue, value)	__atomic_store_n(pValue, value, __ATOMIC_RELAXED)
+	#define SBG_ECOM_SNAPSHOT_FENCE_ACQUIRE()				__atomic_thread_fence(__ATOMIC_ACQUIRE)
+	#define SBG_ECOM_SNAPSHOT_FENCE_RELEASE()				__atomic_thread_fence(__ATOMIC_RELEASE)
+#elif defined(_MSC_VER)
+	#include <intrin.h>
+
+	//
+	// Volatile accesses have acquire and release semantics on x86 and x64 targets
+	//
+	#define SBG_ECOM_SNAPSHOT_LOAD(pValue)					(*(volatile uint64_t *)(pValue))
+	#define SBG_ECOM_SNAPSHOT_LOAD_RELAXED(pValue)			(*(volatile uint64_t *)(pValue))
+	#define SBG_ECOM_SNAPSHOT_STORE(pValue, value)			(*(volatile uint64_t *)(pValue) = (value))
+	#define SBG_ECOM_SNAPSHOT_STORE_RELAXED(pValue, value)	(*(volatile uint64_t *)(pValue) = (value))
+	#define SBG_ECOM_SNAPSHOT_FENCE_ACQUIRE()				_ReadWriteBarrier()
+	#define SBG_ECOM_SNAPSHOT_FENCE_RELEASE()				_ReadWriteBarrier()
+#else
+	#error "atomic operations are not supported by this compiler"
+#endif
+
+//----------------------------------------------------------------------//
+//- Private definitions                                                -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Cache line size, logs are aligned on cache lines.
+ */
+#define SBG_ECOM_SNAPSHOT_CACHE_LINE_SIZE				(64)
+
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Round a size up to a multiple of the cache line size.
+ *
+ * \param[in]	size						Size in bytes.
+ * \return									Rounded size in bytes.
+ */
+static size_t sbgEComSnapshotAlign(size_t size)
+{
+	return (size + SBG_ECOM_SNAPSHOT_CACHE_LINE_SIZE - 1) & ~((size_t)SBG_ECOM_SNAPSHOT_CACHE_LINE_SIZE - 1);
+}
+
+/*!
+ * Returns the entry of a log type.
+ *
+ * \param[in]	pStore						Snapshot store.
+ * \param[in]	msgClass					Message class.
+ * \param[in]	msg							Message id.
+ * \return									Entry, NULL if the log type isn't stored.
+ */
+static SbgEComSnapshotEntry *sbgEComSnapshotStoreGetEntry(const SbgEComSnapshotStore *pStore, SbgEComClass msgClass, SbgEComMsgId msg)
+{
+	SbgEComSnapshotEntry		*pEntry = NULL;
+
+	assert(pStore);
+
+	if (((size_t)msgClass < SBG_ECOM_SNAPSHOT_NR_CLASSES) && (pStore->entryIndexes[msgClass][msg] != 0))
+	{
+		pEntry = &pStore->pEntries[pStore->entryIndexes[msgClass][msg] - 1];
+	}
+
+	return pEntry;
+}
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+SbgErrorCode sbgEComSnapshotStoreInit(SbgEComSnapshotStore *pStore)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+	size_t						 bufferSize = 0;
+
+	assert(pStore);
+
+	memset(pStore, 0, sizeof(*pStore));
+
+	for (uint32_t msgClass = 0; msgClass < SBG_ECOM_SNAPSHOT_NR_CLASSES; msgClass++)
+	{
+		for (uint32_t msg = 0; msg < SBG_ECOM_SNAPSHOT_NR_MSG_IDS; msg++)
+		{
+			size_t				 dataSize;
+
+			dataSize = sbgEComBinaryLogGetSize((SbgEComClass)msgClass, (SbgEComMsgId)msg, false);
+
+			if (dataSize != 0)
+			{
+				pStore->nrEntries++;
+				bufferSize += 2 * sbgEComSnapshotAlign(dataSize);
+			}
+		}
+	}
+
+	assert(pStore->nrEntries < UINT8_MAX);
+
+	pStore->pEntries	= calloc(pStore->nrEntries, sizeof(*pStore->pEntries));
+	pStore->pBuffer		= malloc(bufferSize + SBG_ECOM_SNAPSHOT_CACHE_LINE_SIZE);
+
+	if (pStore->pEntries && pStore->pBuffer)
+	{
+		uint8_t					*pData;
+		size_t					 entryIndex = 0;
+
+		pData = (uint8_t *)sbgEComSnapshotAlign((size_t)pStore->pBuffer);
+
+		for (uint32_t msgClass = 0; msgClass < SBG_ECOM_SNAPSHOT_NR_CLASSES; msgClass++)
+		{
+			for (uint32_t msg = 0; msg < SBG_ECOM_SNAPSHOT_NR_MSG_IDS; msg++)
+			{
+				size_t			 dataSize;
+
+				dataSize = sbgEComBinaryLogGetSize((SbgEComClass)msgClass, (SbgEComMsgId)msg, false);
+
+				if (dataSize != 0)
+				{
+					SbgEComSnapshotEntry	*pEntry = &pStore->pEntries[entryIndex];
+
+					pEntry->dataSize	= dataSize;
+					pEntry->pLatest		= pData;
+					pEntry->pCommitted	= pData + sbgEComSnapshotAlign(dataSize);
+
+					pData += 2 * sbgEComSnapshotAlign(dataSize);
+
+					pStore->entryIndexes[msgClass][msg] = (uint8_t)(entryIndex + 1);
+					entryIndex++;
+				}
+			}
+		}
+	}
+	else
+	{
+		errorCode = SBG_MALLOC_FAILED;
+		SBG_LOG_ERROR(errorCode, "unable to allocate the snapshot store");
+
+		sbgEComSnapshotStoreDestroy(pStore);
+	}
+
+	return errorCode;
+}
+
+void sbgEComSnapshotStoreDestroy(SbgEComSnapshotStore *pStore)
+{
+	assert(pStore);
+
+	free(pStore->pEntries);
+	free(pStore->pBuffer);
+
+	pStore->pEntries	= NULL;
+	pStore->pBuffer		= NULL;
+	pStore->nrEntries	= 0;
+
+	memset(pStore->entryIndexes, 0, sizeof(pStore->entryIndexes));
+}
+
+SbgErrorCode sbgEComSnapshotStoreUpdate(SbgEComSnapshotStore *pStore, SbgEComClass msgClass, SbgEComMsgId msg, const SbgBinaryLogData *pLogData, bool rawView)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+	SbgEComSnapshotEntry		*pEntry;
+
+	assert(pStore);
+	assert(pLogData);
+
+	pEntry = sbgEComSnapshotStoreGetEntry(pStore, msgClass, msg);
+
+	if (pEntry)
+	{
+		uint64_t				 sequence;
+
+		sequence = pEntry->sequence;
+
+		SBG_ECOM_SNAPSHOT_STORE_RELAXED(&pEntry->sequence, sequence + 1);
+		SBG_ECOM_SNAPSHOT_FENCE_RELEASE();
+
+		if (rawView && (sbgEComBinaryLogGetSize(msgClass, msg, true) != pEntry->dataSize))
+		{
+			SbgLogRawData		*pRawData = (SbgLogRawData *)pEntry->pLatest;
+
+			assert(pLogData->gpsRawView.bufferSize <= sizeof(pRawData->rawBuffer));
+
+			memcpy(pRawData->rawBuffer, pLogData->gpsRawView.pRawBuffer, pLogData->gpsRawView.bufferSize);
+			pRawData->bufferSize = pLogData->gpsRawView.bufferSize;
+		}
+		else
+		{
+			memcpy(pEntry->pLatest, pLogData, pEntry->dataSize);
+		}
+
+		SBG_ECOM_SNAPSHOT_STORE(&pEntry->sequence, sequence + 2);
+
+		pEntry->dirty	= true;
+		pStore->dirty	= true;
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+	}
+
+	return errorCode;
+}
+
+void sbgEComSnapshotStoreCommit(SbgEComSnapshotStore *pStore)
+{
+	assert(pStore);
+
+	if (pStore->dirty)
+	{
+		uint64_t				 commitSequence;
+
+		commitSequence = pStore->commitSequence;
+
+		SBG_ECOM_SNAPSHOT_STORE_RELAXED(&pStore->commitSequence, commitSequence + 1);
+		SBG_ECOM_SNAPSHOT_FENCE_RELEASE();
+
+		for (size_t i = 0; i < pStore->nrEntries; i++)
+		{
+			SbgEComSnapshotEntry	*pEntry = &pStore->pEntries[i];
+
+			if (pEntry->dirty)
+			{
+				memcpy(pEntry->pCommitted, pEntry->pLatest, pEntry->dataSize);
+
+				SBG_ECOM_SNAPSHOT_STORE_RELAXED(&pEntry->committedCount, pEntry->sequence / 2);
+				pEntry->dirty = false;
+			}
+		}
+
+		SBG_ECOM_SNAPSHOT_STORE(&pStore->commitSequence, commitSequence + 2);
+
+		pStore->dirty = false;
+	}
+}
+
+SbgErrorCode sbgEComSnapshotStoreRead(const SbgEComSnapshotStore *pStore, SbgEComClass msgClass, SbgEComMsgId msg, SbgBinaryLogData *pLogData, uint64_t *pUpdateCount)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+	const SbgEComSnapshotEntry	*pEntry;
+
+	assert(pStore);
+	assert(pLogData);
+
+	pEntry = sbgEComSnapshotStoreGetEntry(pStore, msgClass, msg);
+
+	if (pEntry)
+	{
+		uint64_t				 sequence;
+
+		//
+		// Retry until the log hasn't been updated during the copy
+		//
+		for (;;)
+		{
+			sequence = SBG_ECOM_SNAPSHOT_LOAD(&pEntry->sequence);
+
+			if ((sequence & 1) == 0)
+			{
+				if (sequence != 0)
+				{
+					memcpy(pLogData, pEntry->pLatest, pEntry->dataSize);
+				}
+
+				SBG_ECOM_SNAPSHOT_FENCE_ACQUIRE();
+
+				if (SBG_ECOM_SNAPSHOT_LOAD_RELAXED(&pEntry->sequence) == sequence)
+				{
+					break;
+				}
+			}
+		}
+
+		if (sequence == 0)
+		{
+			errorCode = SBG_NOT_READY;
+		}
+
+		if (pUpdateCount)
+		{
+			*pUpdateCount = sequence / 2;
+		}
+	}
+	else
+	{
+		errorCode = SBG_INVALID_PARAMETER;
+	}
+
+	return errorCode;
+}
+
+SbgErrorCode sbgEComSnapshotStoreReadSet(const SbgEComSnapshotStore *pStore, SbgEComSnapshotItem *pItems, size_t nrItems, uint64_t *pCommitCount)
+{
+	SbgErrorCode				 errorCode = SBG_NO_ERROR;
+	uint64_t					 commitSequence;
+
+	assert(pStore);
+	assert(pItems || (nrItems == 0));
+
+	for (size_t i = 0; i < nrItems; i++)
+	{
+		assert(pItems[i].pLogData);
+
+		if (!sbgEComSnapshotStoreGetEntry(pStore, pItems[i].msgClass, pItems[i].msgId))
+		{
+			errorCode = SBG_INVALID_PARAMETER;
+			break;
+		}
+	}
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		//
+		// Retry until no commit has happened during the copy
+		//
+		for (;;)
+		{
+			commitSequence = SBG_ECOM_SNAPSHOT_LOAD(&pStore->commitSequence);
+
+			if ((commitSequence & 1) == 0)
+			{
+				for (size_t i = 0; i < nrItems; i++)
+				{
+					const SbgEComSnapshotEntry	*pEntry;
+
+					pEntry = sbgEComSnapshotStoreGetEntry(pStore, pItems[i].msgClass, pItems[i].msgId);
+
+					pItems[i].updateCount = SBG_ECOM_SNAPSHOT_LOAD_RELAXED(&pEntry->committedCount);
+
+					if (pItems[i].updateCount != 0)
+					{
+						memcpy(pItems[i].pLogData, pEntry->pCommitted, pEntry->dataSize);
+					}
+				}
+
+				SBG_ECOM_SNAPSHOT_FENCE_ACQUIRE();
+
+				if (SBG_ECOM_SNAPSHOT_LOAD_RELAXED(&pStore->commitSequence) == commitSequence)
+				{
+					break;
+				}
+			}
+		}
+
+		if (pCommitCount)
+		{
+			*pCommitCount = commitSequence / 2;
+		}
+	}
+
+	return errorCode;
+}
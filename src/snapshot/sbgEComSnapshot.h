@@ -0,0 +1,186 @@
+﻿/*!
+ * \file			sbgEComSnapshot.h
+ * \author			SBG Systems
+ * \date			19 October 2026
+ *
+ * \brief			Latest parsed log of each type, readable from other threads.
+ *
+ * \copyright		Copyright (C) 2022, SBG Systems SAS. All rights reserved.
+ * \beginlicense	The MIT license
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * \endlicense
+ */
+
+
+#ifndef SBG_ECOM_SNAPSHOT_H
+#define SBG_ECOM_SNAPSHOT_H
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+// Project headers
+#include <sbgEComIds.h>
+#include <binaryLogs/sbgEComBinaryLogs.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Number of log classes that can be stored.
+ */
+#define SBG_ECOM_SNAPSHOT_NR_CLASSES					(2)
+
+/*!
+ * Maximum number of message ids per log class, covering every SbgEComMsgId value.
+ */
+#define SBG_ECOM_SNAPSHOT_NR_MSG_IDS					(256)
+
+//----------------------------------------------------------------------//
+//- Structure definitions                                              -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Stored log type.
+ *
+ * The latest log is protected by a sequence number, odd while it's written. The committed
+ * copy is protected by the store commit sequence.
+ */
+typedef struct _SbgEComSnapshotEntry
+{
+	uint64_t					 sequence;					/*!< Twice the number of updates, plus one while the latest log is written. */
+	uint64_t					 committedCount;			/*!< Number of updates included in the committed copy, 0 if never committed. */
+	size_t						 dataSize;					/*!< Parsed log size in bytes. */
+	uint8_t						*pLatest;					/*!< Latest parsed log. */
+	uint8_t						*pCommitted;				/*!< Parsed log at the end of the last commit. */
+	bool						 dirty;						/*!< True if the latest log has been updated since the last commit. */
+} SbgEComSnapshotEntry;
+
+/*!
+ * Snapshot store holding the latest parsed log of each type.
+ *
+ * The store is updated by a single thread, usually through the sbgECom handle receive path,
+ * and read by any number of threads without locks.
+ */
+typedef struct _SbgEComSnapshotStore
+{
+	SbgEComSnapshotEntry		*pEntries;					/*!< Stored log types. */
+	size_t						 nrEntries;					/*!< Number of stored log types. */
+	uint8_t						*pBuffer;					/*!< Latest and committed logs buffer. */
+	uint8_t						 entryIndexes[SBG_ECOM_SNAPSHOT_NR_CLASSES][SBG_ECOM_SNAPSHOT_NR_MSG_IDS];	/*!< Entry index plus one of each log type, 0 if not stored. */
+	uint64_t					 commitSequence;			/*!< Twice the number of commits, plus one while committing. */
+	bool						 dirty;						/*!< True if a log has been updated since the last commit. */
+} SbgEComSnapshotStore;
+
+/*!
+ * Log to read with sbgEComSnapshotStoreReadSet().
+ */
+typedef struct _SbgEComSnapshotItem
+{
+	SbgEComClass				 msgClass;					/*!< Message class. */
+	SbgEComMsgId				 msgId;						/*!< Message id. */
+	SbgBinaryLogData			*pLogData;					/*!< Parsed log, only the member of the log type is written. */
+	uint64_t					 updateCount;				/*!< Returned number of updates of the log type, 0 if it hasn't been received yet. */
+} SbgEComSnapshotItem;
+
+//----------------------------------------------------------------------//
+//- Public methods                                                     -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Initialize a snapshot store.
+ *
+ * A slot is allocated for each log type sbgEComBinaryLogParse() supports.
+ *
+ * \param[out]	pStore						Snapshot store.
+ * \return									SBG_NO_ERROR if successful.
+ */
+SbgErrorCode sbgEComSnapshotStoreInit(SbgEComSnapshotStore *pStore);
+
+/*!
+ * Release a snapshot store.
+ *
+ * \param[in]	pStore						Snapshot store.
+ */
+void sbgEComSnapshotStoreDestroy(SbgEComSnapshotStore *pStore);
+
+/*!
+ * Update the latest log of a type.
+ *
+ * Only a single thread may update and commit a store.
+ *
+ * \param[in]	pStore						Snapshot store.
+ * \param[in]	msgClass					Message class.
+ * \param[in]	msg							Message id.
+ * \param[in]	pLogData					Parsed log.
+ * \param[in]	rawView						True if raw data logs are views that must be copied.
+ * \return									SBG_NO_ERROR if successful, SBG_INVALID_PARAMETER if the log type isn't stored.
+ */
+SbgErrorCode sbgEComSnapshotStoreUpdate(SbgEComSnapshotStore *pStore, SbgEComClass msgClass, SbgEComMsgId msg, const SbgBinaryLogData *pLogData, bool rawView);
+
+/*!
+ * Commit the logs updated since the last commit so that they can be read together.
+ *
+ * The sbgECom handle commits its store at the end of each sbgEComHandle() pass and after each log
+ * received by any other path.
+ *
+ * \param[in]	pStore						Snapshot store.
+ */
+void sbgEComSnapshotStoreCommit(SbgEComSnapshotStore *pStore);
+
+/*!
+ * Read the latest log of a type.
+ *
+ * The log is returned as soon as it's updated, without waiting for the next commit.
+ *
+ * \param[in]	pStore						Snapshot store.
+ * \param[in]	msgClass					Message class.
+ * \param[in]	msg							Message id.
+ * \param[out]	pLogData					Parsed log, only the member of the log type is written.
+ * \param[out]	pUpdateCount				Number of updates of the log type, may be NULL.
+ * \return									SBG_NO_ERROR if successful, SBG_NOT_READY if the log hasn't been received yet,
+ *											SBG_INVALID_PARAMETER if the log type isn't stored.
+ */
+SbgErrorCode sbgEComSnapshotStoreRead(const SbgEComSnapshotStore *pStore, SbgEComClass msgClass, SbgEComMsgId msg, SbgBinaryLogData *pLogData, uint64_t *pUpdateCount);
+
+/*!
+ * Read a coherent set of logs.
+ *
+ * All logs are read from the same commit, for example the EKF nav and quaternion logs
+ * received during the same sbgEComHandle() pass.
+ *
+ * \param[in]	pStore						Snapshot store.
+ * \param[in,out]	pItems					Logs to read.
+ * \param[in]	nrItems						Number of logs to read.
+ * \param[out]	pCommitCount				Number of commits the set has been read from, may be NULL.
+ * \return									SBG_NO_ERROR if successful, SBG_INVALID_PARAMETER if a log type isn't stored.
+ */
+SbgErrorCode sbgEComSnapshotStoreReadSet(const SbgEComSnapshotStore *pStore, SbgEComSnapshotItem *pItems, size_t nrItems, uint64_t *pCommitCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SBG_ECOM_SNAPSHOT_H
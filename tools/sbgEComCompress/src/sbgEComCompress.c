@@ -0,0 +1,246 @@
+﻿/*!
+ * \file			sbgEComCompress.c
+ * \author			SBG Systems
+ * \date			19 October 2026
+ *
+ * \brief			Offline tool converting sbgECom captures to and from the compressed capture format.
+ *
+ *				Compresses an indexed capture file into a compressed capture file, or restores
+ *				an indexed capture file from a compressed one with the -d option.
+ *
+ * \copyright		Copyright (C) 2022, SBG Systems SAS. All rights reserved.
+ * \beginlicense	The MIT license
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * \endlicense
+ */
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+// sbgECom headers
+#include <sbgEComLib.h>
+
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Print conversion statistics.
+ *
+ * \param[in]	nrFrames							Number of converted logs.
+ * \param[in]	nrPayloadBytes						Total payload size in bytes.
+ * \param[in]	pInputPath							Input file path.
+ * \param[in]	pOutputPath							Output file path.
+ * \param[in]	elapsedTime							Elapsed time in us.
+ */
+static void sbgEComCompressPrintStats(uint64_t nrFrames, uint64_t nrPayloadBytes, const char *pInputPath, const char *pOutputPath, uint64_t elapsedTime)
+{
+	SbgFileMap			inputMap;
+	SbgFileMap			outputMap;
+
+	assert(pInputPath);
+	assert(pOutputPath);
+
+	if ((sbgFileMapOpen(&inputMap, pInputPath) == SBG_NO_ERROR) && (sbgFileMapOpen(&outputMap, pOutputPath) == SBG_NO_ERROR))
+	{
+		printf("             Logs: %" PRIu64 "\n",		nrFrames);
+		printf("    Payload bytes: %" PRIu64 "\n",		nrPayloadBytes);
+		printf("       Input size: %zu\n",				sbgFileMapGetSize(&inputMap));
+		printf("      Output size: %zu\n",				sbgFileMapGetSize(&outputMap));
+		printf("            Ratio: %.2f\n",				sbgFileMapGetSize(&inputMap) / (double)sbgMax(sbgFileMapGetSize(&outputMap), 1));
+		printf("     Elapsed time: %.3f s\n",			elapsedTime / 1e6);
+		printf("       Throughput: %.1f MB/s\n",		sbgFileMapGetSize(&inputMap) / (double)elapsedTime);
+
+		sbgFileMapClose(&inputMap);
+		sbgFileMapClose(&outputMap);
+	}
+}
+
+/*!
+ * Compress a capture file.
+ *
+ * \param[in]	pInputPath							Capture file path.
+ * \param[in]	pOutputPath							Compressed capture file path.
+ * \return											SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComCompressCapture(const char *pInputPath, const char *pOutputPath)
+{
+	SbgErrorCode						errorCode;
+	SbgEComCaptureReader				reader;
+	SbgEComCompressedCaptureWriter		writer;
+	SbgEComCaptureFrame					frame;
+	size_t								offset;
+	uint64_t							startTime;
+
+	assert(pInputPath);
+	assert(pOutputPath);
+
+	startTime	= sbgGetTimeInUs();
+	errorCode	= sbgEComCaptureReaderOpen(&reader, pInputPath);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		errorCode = sbgEComCompressedCaptureWriterOpen(&writer, pOutputPath, 0);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			offset = sbgEComCaptureReaderGetFirstOffset(&reader);
+
+			while (errorCode == SBG_NO_ERROR)
+			{
+				errorCode = sbgEComCaptureReaderReadFrame(&reader, &offset, &frame);
+
+				if (errorCode == SBG_NO_ERROR)
+				{
+					errorCode = sbgEComCompressedCaptureWriterWriteFrame(&writer, frame.hostTimeUs, frame.msgClass, frame.msgId, frame.pPayload, frame.payloadSize);
+				}
+			}
+
+			if (errorCode == SBG_NOT_READY)
+			{
+				errorCode = sbgEComCompressedCaptureWriterClose(&writer);
+			}
+			else
+			{
+				sbgEComCompressedCaptureWriterClose(&writer);
+			}
+
+			if (errorCode == SBG_NO_ERROR)
+			{
+				sbgEComCompressPrintStats(writer.nrFrames, writer.nrPayloadBytes, pInputPath, pOutputPath, sbgMax(sbgGetTimeInUs() - startTime, 1));
+			}
+		}
+
+		sbgEComCaptureReaderClose(&reader);
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Decompress a compressed capture file.
+ *
+ * Corrupted blocks are skipped.
+ *
+ * \param[in]	pInputPath							Compressed capture file path.
+ * \param[in]	pOutputPath							Capture file path.
+ * \return											SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComCompressDecompressCapture(const char *pInputPath, const char *pOutputPath)
+{
+	SbgErrorCode						errorCode;
+	SbgEComCompressedCaptureReader		reader;
+	SbgEComCaptureWriter				writer;
+	SbgEComCaptureFrame					frame;
+	uint64_t							nrFrames = 0;
+	uint64_t							nrPayloadBytes = 0;
+	uint64_t							startTime;
+
+	assert(pInputPath);
+	assert(pOutputPath);
+
+	startTime	= sbgGetTimeInUs();
+	errorCode	= sbgEComCompressedCaptureReaderOpen(&reader, pInputPath);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		errorCode = sbgEComCaptureWriterOpen(&writer, pOutputPath, 0);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			while ((errorCode == SBG_NO_ERROR) || (errorCode == SBG_INVALID_CRC) || (errorCode == SBG_INVALID_FRAME))
+			{
+				errorCode = sbgEComCompressedCaptureReaderReadFrame(&reader, &frame);
+
+				if (errorCode == SBG_NO_ERROR)
+				{
+					errorCode = sbgEComCaptureWriterWriteFrame(&writer, frame.hostTimeUs, frame.msgClass, frame.msgId, frame.pPayload, frame.payloadSize);
+
+					nrFrames++;
+					nrPayloadBytes += frame.payloadSize;
+				}
+			}
+
+			if (errorCode == SBG_NOT_READY)
+			{
+				errorCode = sbgEComCaptureWriterClose(&writer);
+			}
+			else
+			{
+				sbgEComCaptureWriterClose(&writer);
+			}
+
+			if (errorCode == SBG_NO_ERROR)
+			{
+				sbgEComCompressPrintStats(nrFrames, nrPayloadBytes, pInputPath, pOutputPath, sbgMax(sbgGetTimeInUs() - startTime, 1));
+			}
+		}
+
+		sbgEComCompressedCaptureReaderClose(&reader);
+	}
+
+	return errorCode;
+}
+
+//----------------------------------------------------------------------//
+//  Main program                                                        //
+//----------------------------------------------------------------------//
+
+/*!
+ * Program entry point usage: sbgEComCompress [-d] INPUT OUTPUT
+ * 
+ * \param[in]	argc					Number of input arguments.
+ * \param[in]	argv					Input arguments as an array of strings.
+ * \return								EXIT_SUCCESS if successful.
+ */
+int main(int argc, char** argv)
+{
+	SbgErrorCode		errorCode;
+	int					exitCode;
+
+	if ((argc == 3) || ((argc == 4) && (strcmp(argv[1], "-d") == 0)))
+	{
+		if (argc == 4)
+		{
+			errorCode = sbgEComCompressDecompressCapture(argv[2], argv[3]);
+		}
+		else
+		{
+			errorCode = sbgEComCompressCapture(argv[1], argv[2]);
+		}
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			exitCode = EXIT_SUCCESS;
+		}
+		else
+		{
+			exitCode = EXIT_FAILURE;
+		}
+	}
+	else
+	{
+		printf("Invalid input arguments, usage: sbgEComCompress [-d] INPUT OUTPUT\n");
+		exitCode = EXIT_FAILURE;
+	}
+
+	return exitCode;
+}
@@ -0,0 +1,182 @@
+﻿/*!
+ * \file			sbgEComDecode.c
+ * \author			SBG Systems
+ * \date			19 October 2026
+ *
+ * \brief			Offline tool decoding a recorded sbgECom stream in parallel.
+ *
+ *				Decodes a recorded stream with the parallel decoder and displays the number of
+ *				received logs per message along with the decoding throughput.
+ *
+ * \copyright		Copyright (C) 2022, SBG Systems SAS. All rights reserved.
+ * \beginlicense	The MIT license
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * \endlicense
+ */
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+// sbgECom headers
+#include <sbgEComLib.h>
+
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Callback definition called each time a new log is decoded.
+ * 
+ * \param[in]	pHandle									Valid handle on the sbgECom instance that has called this callback.
+ * \param[in]	msgClass								Class of the message we have received
+ * \param[in]	msg										Message ID of the log received.
+ * \param[in]	pLogData								Contains the received log data as an union.
+ * \param[in]	pUserArg								Number of received logs per class and message ID.
+ * \return												SBG_NO_ERROR if the received log has been used successfully.
+ */
+static SbgErrorCode onLogReceived(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const SbgBinaryLogData *pLogData, void *pUserArg)
+{
+	uint64_t		(*pNrLogs)[256] = pUserArg;
+
+	assert(pLogData);
+	assert(pNrLogs);
+
+	SBG_UNUSED_PARAMETER(pHandle);
+
+	if (msgClass <= SBG_ECOM_CLASS_LOG_ECOM_1)
+	{
+		pNrLogs[msgClass][msg]++;
+	}
+
+	return SBG_NO_ERROR;
+}
+
+/*!
+ * Decode a recorded stream file and display statistics.
+ *
+ * \param[in]	pPath								Recorded stream file path.
+ * \param[in]	nrWorkers							Number of worker threads, 0 to use one per available CPU.
+ * \param[in]	chunkSize							Chunk size in bytes, 0 for the default size.
+ * \return											SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComDecodeProcess(const char *pPath, uint32_t nrWorkers, size_t chunkSize)
+{
+	SbgErrorCode			errorCode;
+	SbgEComHandle			comHandle;
+	SbgEComDecoderStats		stats;
+	uint64_t				nrLogs[SBG_ECOM_CLASS_LOG_ECOM_1 + 1][256];
+	uint64_t				startTime;
+	uint64_t				elapsedTime;
+
+	assert(pPath);
+
+	memset(&comHandle, 0, sizeof(comHandle));
+	memset(nrLogs, 0, sizeof(nrLogs));
+
+	//
+	// The handle isn't linked to any interface, it is only used to dispatch decoded logs
+	//
+	sbgEComSetReceiveLogCallback(&comHandle, onLogReceived, nrLogs);
+
+	startTime	= sbgGetTimeInUs();
+	errorCode	= sbgEComDecoderDecodeFile(&comHandle, pPath, nrWorkers, chunkSize, &stats);
+	elapsedTime	= sbgMax(sbgGetTimeInUs() - startTime, 1);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		for (size_t i = 0; i < SBG_ARRAY_SIZE(nrLogs); i++)
+		{
+			for (size_t j = 0; j < SBG_ARRAY_SIZE(nrLogs[i]); j++)
+			{
+				if (nrLogs[i][j] != 0)
+				{
+					printf("class %zu msg %3zu: %" PRIu64 " logs\n", i, j, nrLogs[i][j]);
+				}
+			}
+		}
+
+		printf("\n");
+		printf("          Workers: %" PRIu32 "\n",			stats.nrWorkers);
+		printf("           Chunks: %zu\n",					stats.nrChunks);
+		printf("           Frames: %" PRIu64 "\n",			stats.nrFrames);
+		printf("             Logs: %" PRIu64 "\n",			stats.nrLogs);
+		printf("     Parse errors: %" PRIu64 "\n",			stats.nrParseErrors);
+		printf("    Skipped bytes: %" PRIu64 "\n",			stats.nrSkippedBytes);
+		printf("     Elapsed time: %.3f s\n",				elapsedTime / 1e6);
+		printf("       Throughput: %.1f MB/s, %.1f frames/s\n",	stats.nrBytes / (double)elapsedTime, stats.nrFrames * 1e6 / elapsedTime);
+	}
+	else
+	{
+		SBG_LOG_ERROR(errorCode, "unable to decode %s", pPath);
+	}
+
+	return errorCode;
+}
+
+//----------------------------------------------------------------------//
+//  Main program                                                        //
+//----------------------------------------------------------------------//
+
+/*!
+ * Program entry point usage: sbgEComDecode FILE [NR_WORKERS] [CHUNK_SIZE]
+ * 
+ * \param[in]	argc					Number of input arguments.
+ * \param[in]	argv					Input arguments as an array of strings.
+ * \return								EXIT_SUCCESS if successful.
+ */
+int main(int argc, char** argv)
+{
+	SbgErrorCode		errorCode;
+	uint32_t			nrWorkers = 0;
+	size_t				chunkSize = 0;
+	int					exitCode;
+
+	if ((argc >= 2) && (argc <= 4))
+	{
+		if (argc >= 3)
+		{
+			nrWorkers = (uint32_t)strtoul(argv[2], NULL, 10);
+		}
+
+		if (argc == 4)
+		{
+			chunkSize = (size_t)strtoull(argv[3], NULL, 10);
+		}
+
+		errorCode = sbgEComDecodeProcess(argv[1], nrWorkers, chunkSize);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			exitCode = EXIT_SUCCESS;
+		}
+		else
+		{
+			exitCode = EXIT_FAILURE;
+		}
+	}
+	else
+	{
+		printf("Invalid input arguments, usage: sbgEComDecode FILE [NR_WORKERS] [CHUNK_SIZE]\n");
+		exitCode = EXIT_FAILURE;
+	}
+
+	return exitCode;
+}
@@ -0,0 +1,168 @@
+﻿/*!
+ * \file			sbgEComExport.c
+ * \author			SBG Systems
+ * \date			19 October 2026
+ *
+ * \brief			Offline tool exporting a recorded sbgECom stream to columnar binary files.
+ *
+ *				Decodes a recorded stream with the parallel decoder and writes one raw column
+ *				file per log field along with a JSON manifest, see sbgEComColumnExport.h.
+ *
+ * \copyright		Copyright (C) 2022, SBG Systems SAS. All rights reserved.
+ * \beginlicense	The MIT license
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * \endlicense
+ */
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+
+// sbgECom headers
+#include <sbgEComLib.h>
+
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Callback definition called each time a new log is decoded.
+ * 
+ * \param[in]	pHandle									Valid handle on the sbgECom instance that has called this callback.
+ * \param[in]	msgClass								Class of the message we have received
+ * \param[in]	msg										Message ID of the log received.
+ * \param[in]	pLogData								Contains the received log data as an union.
+ * \param[in]	pUserArg								Columnar export.
+ * \return												SBG_NO_ERROR if the received log has been used successfully.
+ */
+static SbgErrorCode onLogReceived(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const SbgBinaryLogData *pLogData, void *pUserArg)
+{
+	SbgEComColumnExport		*pExport = pUserArg;
+
+	assert(pExport);
+
+	SBG_UNUSED_PARAMETER(pHandle);
+
+	return sbgEComColumnExportAppend(pExport, msgClass, msg, pLogData);
+}
+
+/*!
+ * Export a recorded stream file to columnar binary files.
+ *
+ * \param[in]	pPath								Recorded stream file path.
+ * \param[in]	pDirectory							Output directory.
+ * \param[in]	nrWorkers							Number of worker threads, 0 to use one per available CPU.
+ * \return											SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComExportProcess(const char *pPath, const char *pDirectory, uint32_t nrWorkers)
+{
+	SbgErrorCode			errorCode;
+	SbgEComHandle			comHandle;
+	SbgEComColumnExport		columnExport;
+	SbgEComDecoderStats		stats;
+	uint64_t				startTime;
+	uint64_t				elapsedTime;
+
+	assert(pPath);
+	assert(pDirectory);
+
+	errorCode = sbgEComColumnExportOpen(&columnExport, pDirectory, 0);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		memset(&comHandle, 0, sizeof(comHandle));
+
+		//
+		// The handle isn't linked to any interface, it is only used to dispatch decoded logs
+		//
+		sbgEComSetReceiveLogCallback(&comHandle, onLogReceived, &columnExport);
+
+		startTime	= sbgGetTimeInUs();
+		errorCode	= sbgEComDecoderDecodeFile(&comHandle, pPath, nrWorkers, 0, &stats);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			errorCode = sbgEComColumnExportClose(&columnExport);
+		}
+		else
+		{
+			SBG_LOG_ERROR(errorCode, "unable to decode %s", pPath);
+			sbgEComColumnExportClose(&columnExport);
+		}
+
+		elapsedTime	= sbgMax(sbgGetTimeInUs() - startTime, 1);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			printf("             Logs: %" PRIu64 "\n",			stats.nrLogs);
+			printf("    Exported rows: %" PRIu64 "\n",			columnExport.nrRows);
+			printf("    Written bytes: %" PRIu64 "\n",			columnExport.nrBytes);
+			printf("     Parse errors: %" PRIu64 "\n",			stats.nrParseErrors);
+			printf("     Elapsed time: %.3f s\n",				elapsedTime / 1e6);
+			printf("       Throughput: %.1f MB/s\n",			stats.nrBytes / (double)elapsedTime);
+		}
+	}
+
+	return errorCode;
+}
+
+//----------------------------------------------------------------------//
+//  Main program                                                        //
+//----------------------------------------------------------------------//
+
+/*!
+ * Program entry point usage: sbgEComExport FILE OUTPUT_DIRECTORY [NR_WORKERS]
+ * 
+ * \param[in]	argc					Number of input arguments.
+ * \param[in]	argv					Input arguments as an array of strings.
+ * \return								EXIT_SUCCESS if successful.
+ */
+int main(int argc, char** argv)
+{
+	SbgErrorCode		errorCode;
+	uint32_t			nrWorkers = 0;
+	int					exitCode;
+
+	if ((argc >= 3) && (argc <= 4))
+	{
+		if (argc == 4)
+		{
+			nrWorkers = (uint32_t)strtoul(argv[3], NULL, 10);
+		}
+
+		errorCode = sbgEComExportProcess(argv[1], argv[2], nrWorkers);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			exitCode = EXIT_SUCCESS;
+		}
+		else
+		{
+			exitCode = EXIT_FAILURE;
+		}
+	}
+	else
+	{
+		printf("Invalid input arguments, usage: sbgEComExport FILE OUTPUT_DIRECTORY [NR_WORKERS]\n");
+		exitCode = EXIT_FAILURE;
+	}
+
+	return exitCode;
+}
@@ -0,0 +1,284 @@
+﻿/*!
+ * \file			sbgEComTcpLoopback.c
+ * \author			SBG Systems
+ * \date			19 October 2026
+ *
+ * \brief			Loopback check of the TCP interface listener and client.
+ *
+ *				Opens a listener, connects a client to it through the loopback address, exchanges
+ *				data in both directions and finally checks that connecting to a closed port fails.
+ *
+ * \copyright		Copyright (C) 2022, SBG Systems SAS. All rights reserved.
+ * \beginlicense	The MIT license
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * \endlicense
+ */
+
+
+// sbgCommonLib headers
+#include <sbgCommon.h>
+#include <interfaces/sbgInterfaceTcp.h>
+
+// sbgECom headers
+#include <sbgEComLib.h>
+
+//----------------------------------------------------------------------//
+//- Constant definitions                                               -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Default local port used by the listener.
+ */
+#define SBG_ECOM_TCP_LOOPBACK_DEFAULT_PORT			(51234)
+
+/*!
+ * Size of the data exchanged in each direction, in bytes.
+ *
+ * The size is kept below the socket buffer sizes as both ends are handled by a single thread.
+ */
+#define SBG_ECOM_TCP_LOOPBACK_DATA_SIZE				(4096)
+
+/*!
+ * Time out to accept a connection or receive data, in ms.
+ */
+#define SBG_ECOM_TCP_LOOPBACK_TIME_OUT				(2000)
+
+//----------------------------------------------------------------------//
+//- Private methods                                                    -//
+//----------------------------------------------------------------------//
+
+/*!
+ * Read an exact number of bytes from a non blocking interface.
+ *
+ * \param[in]	pInterface							Interface to read from.
+ * \param[out]	pBuffer								Buffer to fill.
+ * \param[in]	size								Number of bytes to read.
+ * \return											SBG_NO_ERROR if all bytes have been read, SBG_TIME_OUT otherwise.
+ */
+static SbgErrorCode sbgEComTcpLoopbackReadAll(SbgInterface *pInterface, uint8_t *pBuffer, size_t size)
+{
+	SbgErrorCode		errorCode = SBG_NO_ERROR;
+	size_t				offset = 0;
+	uint32_t			startTime;
+
+	assert(pInterface);
+	assert(pBuffer);
+
+	startTime = sbgGetTime();
+
+	while ((errorCode == SBG_NO_ERROR) && (offset < size))
+	{
+		size_t			readBytes;
+
+		errorCode = sbgInterfaceRead(pInterface, &pBuffer[offset], &readBytes, size - offset);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			offset += readBytes;
+
+			if (readBytes == 0)
+			{
+				if ((sbgGetTime() - startTime) < SBG_ECOM_TCP_LOOPBACK_TIME_OUT)
+				{
+					sbgSleep(1);
+				}
+				else
+				{
+					errorCode = SBG_TIME_OUT;
+				}
+			}
+		}
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Send data from an interface and check it is received unchanged by another one.
+ *
+ * \param[in]	pSender								Sending interface.
+ * \param[in]	pReceiver							Receiving interface.
+ * \param[in]	seed								Seed used to generate the data.
+ * \return											SBG_NO_ERROR if the data has been received unchanged.
+ */
+static SbgErrorCode sbgEComTcpLoopbackExchange(SbgInterface *pSender, SbgInterface *pReceiver, uint8_t seed)
+{
+	SbgErrorCode		errorCode;
+	uint8_t				txBuffer[SBG_ECOM_TCP_LOOPBACK_DATA_SIZE];
+	uint8_t				rxBuffer[SBG_ECOM_TCP_LOOPBACK_DATA_SIZE];
+
+	assert(pSender);
+	assert(pReceiver);
+
+	for (size_t i = 0; i < sizeof(txBuffer); i++)
+	{
+		txBuffer[i] = (uint8_t)(i * 31 + seed);
+	}
+
+	errorCode = sbgInterfaceWrite(pSender, txBuffer, sizeof(txBuffer));
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		errorCode = sbgEComTcpLoopbackReadAll(pReceiver, rxBuffer, sizeof(rxBuffer));
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			if (memcmp(txBuffer, rxBuffer, sizeof(txBuffer)) != 0)
+			{
+				errorCode = SBG_ERROR;
+				SBG_LOG_ERROR(errorCode, "received data differs from sent data");
+			}
+		}
+		else
+		{
+			SBG_LOG_ERROR(errorCode, "unable to receive data");
+		}
+	}
+	else
+	{
+		SBG_LOG_ERROR(errorCode, "unable to send data");
+	}
+
+	return errorCode;
+}
+
+/*!
+ * Run the loopback check.
+ *
+ * \param[in]	localPort							Local port used by the listener.
+ * \return											SBG_NO_ERROR if successful.
+ */
+static SbgErrorCode sbgEComTcpLoopbackProcess(uint32_t localPort)
+{
+	SbgErrorCode				errorCode;
+	SbgInterfaceTcpListener		listener;
+	SbgInterface				client;
+	SbgInterface				server;
+
+	errorCode = sbgInterfaceTcpListenerOpen(&listener, localPort, NULL);
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		errorCode = sbgInterfaceTcpCreate(&client, sbgIpAddr(127, 0, 0, 1), localPort, NULL);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			errorCode = sbgInterfaceTcpListenerAccept(&listener, &server, SBG_ECOM_TCP_LOOPBACK_TIME_OUT);
+
+			if (errorCode == SBG_NO_ERROR)
+			{
+				errorCode = sbgEComTcpLoopbackExchange(&client, &server, 0);
+
+				if (errorCode == SBG_NO_ERROR)
+				{
+					errorCode = sbgEComTcpLoopbackExchange(&server, &client, 0x5a);
+				}
+
+				if (errorCode == SBG_NO_ERROR)
+				{
+					printf("data exchanged in both directions\n");
+				}
+
+				sbgInterfaceDestroy(&server);
+			}
+			else
+			{
+				SBG_LOG_ERROR(errorCode, "unable to accept the connection");
+			}
+
+			sbgInterfaceDestroy(&client);
+		}
+		else
+		{
+			SBG_LOG_ERROR(errorCode, "unable to connect to the listener");
+		}
+
+		sbgInterfaceTcpListenerClose(&listener);
+	}
+	else
+	{
+		SBG_LOG_ERROR(errorCode, "unable to open a listener on port %" PRIu32, localPort);
+	}
+
+	if (errorCode == SBG_NO_ERROR)
+	{
+		//
+		// Nothing listens on the port anymore, the connection must be refused
+		//
+		if (sbgInterfaceTcpCreate(&client, sbgIpAddr(127, 0, 0, 1), localPort, NULL) == SBG_NO_ERROR)
+		{
+			errorCode = SBG_ERROR;
+			SBG_LOG_ERROR(errorCode, "connection to a closed port has succeeded");
+
+			sbgInterfaceDestroy(&client);
+		}
+		else
+		{
+			printf("connection to a closed port refused\n");
+		}
+	}
+
+	return errorCode;
+}
+
+//----------------------------------------------------------------------//
+//  Main program                                                        //
+//----------------------------------------------------------------------//
+
+/*!
+ * Program entry point usage: sbgEComTcpLoopback [PORT]
+ * 
+ * \param[in]	argc					Number of input arguments.
+ * \param[in]	argv					Input arguments as an array of strings.
+ * \return								EXIT_SUCCESS if successful.
+ */
+int main(int argc, char** argv)
+{
+	SbgErrorCode		errorCode;
+	uint32_t			localPort = SBG_ECOM_TCP_LOOPBACK_DEFAULT_PORT;
+	int					exitCode;
+
+	if (argc <= 2)
+	{
+		if (argc == 2)
+		{
+			localPort = (uint32_t)strtoul(argv[1], NULL, 10);
+		}
+
+		errorCode = sbgEComTcpLoopbackProcess(localPort);
+
+		if (errorCode == SBG_NO_ERROR)
+		{
+			exitCode = EXIT_SUCCESS;
+		}
+		else
+		{
+			exitCode = EXIT_FAILURE;
+		}
+	}
+	else
+	{
+		printf("Invalid input arguments, usage: sbgEComTcpLoopback [PORT]\n");
+		exitCode = EXIT_FAILURE;
+	}
+
+	return exitCode;
+}